@@ -0,0 +1,208 @@
+#include "benchmark_util.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include <arrow/api.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+constexpr idx_t ROWS = STANDARD_VECTOR_SIZE;
+
+/**
+ * @brief start, start + step, ... with every `null_every`-th row NULL (0: no NULLs)
+ */
+template<typename BUILDER, typename T>
+std::shared_ptr<arrow::Array> BuildSequence(T start, T step, idx_t null_every = 0) {
+    BUILDER builder;
+    for (idx_t i = 0; i < ROWS; i++) {
+        if (null_every > 0 && i % null_every == 0) {
+            (void)builder.AppendNull();
+            continue;
+        }
+        (void)builder.Append(static_cast<T>(start + static_cast<T>(i) * step));
+    }
+    return builder.Finish().ValueOrDie();
+}
+
+std::shared_ptr<arrow::Field> ScaledField(const std::shared_ptr<arrow::DataType>& type, int scale) {
+    return arrow::field("c", type, true, arrow::key_value_metadata({"scale"}, {std::to_string(scale)}));
+}
+
+void RunDecode(const std::shared_ptr<arrow::Array>& array, const arrow::Field& field, const LogicalType& target,
+               uint64_t iterations, uint64_t value_bytes) {
+    auto decoder = SnowflakeColumnDecoder::Create(field, target).GetValue();
+    Vector result(target, ROWS);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto decoded = decoder.Decode(*array, 0, ROWS, result);
+        DoNotOptimize(decoded);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * value_bytes);
+}
+
+} // namespace
+
+// ===== NUMBER =====
+
+SNOWFLAKE_BENCHMARK("arrow_decode/number_10_2/int64_same_scale", 200000) {
+    auto array = BuildSequence<arrow::Int64Builder, int64_t>(-1000000, 997);
+    RunDecode(array, *ScaledField(arrow::int64(), 2), LogicalType::DECIMAL(10, 2), iterations, sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/number_10_2/int64_same_scale_10pct_null", 200000) {
+    auto array = BuildSequence<arrow::Int64Builder, int64_t>(-1000000, 997, 10);
+    RunDecode(array, *ScaledField(arrow::int64(), 2), LogicalType::DECIMAL(10, 2), iterations, sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/number_38_0/int8_widen", 200000) {
+    auto array = BuildSequence<arrow::Int8Builder, int8_t>(-100, 0);
+    RunDecode(array, *ScaledField(arrow::int8(), 0), LogicalType::DECIMAL(38, 0), iterations, sizeof(int8_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/number_18_2/int64_downscale", 100000) {
+    auto array = BuildSequence<arrow::Int64Builder, int64_t>(-100000000, 104729);
+    RunDecode(array, *ScaledField(arrow::int64(), 4), LogicalType::DECIMAL(18, 2), iterations, sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/float/double_copy", 200000) {
+    auto array = BuildSequence<arrow::DoubleBuilder, double>(0.5, 1.25);
+    RunDecode(array, *arrow::field("c", arrow::float64()), LogicalType::DOUBLE, iterations, sizeof(double));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/float/double_copy_10pct_null", 200000) {
+    auto array = BuildSequence<arrow::DoubleBuilder, double>(0.5, 1.25, 10);
+    RunDecode(array, *arrow::field("c", arrow::float64()), LogicalType::DOUBLE, iterations, sizeof(double));
+}
+
+// ===== TEMPORAL =====
+
+SNOWFLAKE_BENCHMARK("arrow_decode/timestamp_ntz_9/int64", 200000) {
+    auto array = BuildSequence<arrow::Int64Builder, int64_t>(1700000000000000000LL, 1000003);
+    RunDecode(array, *ScaledField(arrow::int64(), 9), LogicalType::TIMESTAMP, iterations, sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/timestamp_tz_9/struct", 100000) {
+    auto epoch = BuildSequence<arrow::Int64Builder, int64_t>(1700000000, 1);
+    auto fraction = BuildSequence<arrow::Int32Builder, int32_t>(0, 488281);
+    auto timezone = BuildSequence<arrow::Int32Builder, int32_t>(1440, 0);
+    auto array = arrow::StructArray::Make({epoch, fraction, timezone}, {"epoch", "fraction", "timezone"})
+                     .ValueOrDie();
+    RunDecode(array, *ScaledField(array->type(), 9), LogicalType::TIMESTAMP_TZ, iterations,
+              sizeof(int64_t) + 2 * sizeof(int32_t));
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/date/int32", 200000) {
+    auto array = BuildSequence<arrow::Date32Builder, int32_t>(18000, 1);
+    RunDecode(array, *arrow::field("c", arrow::date32()), LogicalType::DATE, iterations, sizeof(int32_t));
+}
+
+// ===== STRINGS =====
+// Low-cardinality column: 16 distinct values, plain vs dictionary-encoded
+
+namespace {
+
+std::shared_ptr<arrow::RecordBatch> StatusBatch(bool dictionary_encoded) {
+    arrow::StringBuilder values;
+    for (int i = 0; i < 16; i++) {
+        (void)values.Append("status-value-" + std::to_string(i));
+    }
+    auto dictionary = values.Finish().ValueOrDie();
+    arrow::Int8Builder index_builder;
+    arrow::StringBuilder plain;
+    for (idx_t i = 0; i < ROWS; i++) {
+        auto index = static_cast<int8_t>((i * 7) % 16);
+        (void)index_builder.Append(index);
+        (void)plain.Append("status-value-" + std::to_string(index));
+    }
+    std::shared_ptr<arrow::Array> column;
+    if (dictionary_encoded) {
+        column = arrow::DictionaryArray::FromArrays(arrow::dictionary(arrow::int8(), arrow::utf8()),
+                                                    index_builder.Finish().ValueOrDie(), dictionary)
+                     .ValueOrDie();
+    } else {
+        column = plain.Finish().ValueOrDie();
+    }
+    return arrow::RecordBatch::Make(arrow::schema({arrow::field("status", column->type())}), ROWS, {column});
+}
+
+void RunStatusDecode(bool dictionary_encoded, uint64_t iterations) {
+    auto batch = StatusBatch(dictionary_encoded);
+    auto decoder = SnowflakeBatchDecoder::CreateFromSchema(*batch->schema()).GetValue();
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), decoder.GetTypes());
+    std::vector<SnowflakeDecodedDictionary> dictionaries;
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto decoded = decoder.Decode(*batch, 0, chunk, &dictionaries);
+        DoNotOptimize(decoded);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 16);
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("arrow_decode/varchar_16_distinct/plain", 20000) {
+    RunStatusDecode(false, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/varchar_16_distinct/dictionary", 200000) {
+    RunStatusDecode(true, iterations);
+}
+
+// 64-byte strings: zero-copy decode vs the copy into DuckDB's string heap it replaced
+
+namespace {
+
+template<typename BUILDER>
+std::shared_ptr<arrow::Array> LongStrings() {
+    BUILDER builder;
+    for (idx_t i = 0; i < ROWS; i++) {
+        auto value = "order-comment-" + std::to_string(i * 7919);
+        value.resize(64, '.');
+        (void)builder.Append(value);
+    }
+    return builder.Finish().ValueOrDie();
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("arrow_decode/varchar_64b/copy_baseline", 20000) {
+    auto array = std::static_pointer_cast<arrow::StringArray>(LongStrings<arrow::StringBuilder>());
+    for (uint64_t i = 0; i < iterations; i++) {
+        Vector result(LogicalType::VARCHAR, ROWS);
+        auto target = FlatVector::GetData<string_t>(result);
+        for (idx_t row = 0; row < ROWS; row++) {
+            auto value = array->GetView(static_cast<int64_t>(row));
+            target[row] = StringVector::AddString(result, value.data(), value.size());
+        }
+        DoNotOptimize(target);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 64);
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/varchar_64b/utf8", 100000) {
+    auto array = LongStrings<arrow::StringBuilder>();
+    auto decoder = SnowflakeColumnDecoder::Create(*arrow::field("c", array->type()), LogicalType::VARCHAR).GetValue();
+    for (uint64_t i = 0; i < iterations; i++) {
+        Vector result(LogicalType::VARCHAR, ROWS);
+        auto decoded = decoder.Decode(*array, 0, ROWS, result);
+        DoNotOptimize(decoded);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 64);
+}
+
+SNOWFLAKE_BENCHMARK("arrow_decode/varchar_64b/string_view", 100000) {
+    auto array = LongStrings<arrow::StringViewBuilder>();
+    auto decoder = SnowflakeColumnDecoder::Create(*arrow::field("c", array->type()), LogicalType::VARCHAR).GetValue();
+    for (uint64_t i = 0; i < iterations; i++) {
+        Vector result(LogicalType::VARCHAR, ROWS);
+        auto decoded = decoder.Decode(*array, 0, ROWS, result);
+        DoNotOptimize(decoded);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 64);
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "benchmark_util.hpp"
+#include "snowflake_connection_pool.hpp"
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+SnowflakeConfig StubConfig() {
+    return SnowflakeConfig::Parse(std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                                  ";account=stub;user=stub;database=stub");
+}
+
+} // namespace
+
+// ===== SESSION SETUP =====
+// Cost of getting a usable session for one short query; against Snowflake the
+// unpooled case also pays the login round trips
+
+SNOWFLAKE_BENCHMARK("pool/lease/warm", 100000) {
+    SnowflakeConnectionPool pool;
+    auto config = StubConfig();
+    pool.Warm(config, 1);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto leased = pool.Acquire(config);
+        DoNotOptimize(leased);
+    }
+    SetItemsProcessed(iterations);
+}
+
+SNOWFLAKE_BENCHMARK("pool/connect/unpooled", 1000) {
+    auto config = StubConfig();
+    for (uint64_t i = 0; i < iterations; i++) {
+        SnowflakeADBCConnector connector(config);
+        auto error = connector.Connect();
+        DoNotOptimize(error);
+    }
+    SetItemsProcessed(iterations);
+}
\ No newline at end of file
@@ -0,0 +1,441 @@
+#include "benchmark_util.hpp"
+#include "arrow_data_converter.hpp"
+#include "decimal_rescale.hpp"
+#include "conversion_validator.hpp"
+#include "snowflake_memory_pool.hpp"
+#include <random>
+#include <thread>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+constexpr idx_t ROWS = STANDARD_VECTOR_SIZE;
+
+/**
+ * @brief Fill a flat vector with deterministic values and ~null_fraction NULLs
+ */
+template<typename T>
+void FillFlat(Vector& vector, double null_fraction) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    auto data = FlatVector::GetData<T>(vector);
+    for (idx_t i = 0; i < ROWS; i++) {
+        data[i] = static_cast<T>(static_cast<int64_t>(rng() % 1000000));
+        if (dist(rng) < null_fraction) {
+            FlatVector::SetNull(vector, i, true);
+        }
+    }
+}
+
+template<typename T>
+void RunFixedWidth(const LogicalType& type, uint64_t iterations, double null_fraction, bool zero_copy) {
+    Vector vector(type, ROWS);
+    FillFlat<T>(vector, null_fraction);
+    ArrowConversionOptions options;
+    options.zero_copy = zero_copy;
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS, options);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(T));
+}
+
+} // namespace
+
+// ===== FIXED WIDTH =====
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/flat_zero_copy", 200000) {
+    RunFixedWidth<int64_t>(LogicalType::BIGINT, iterations, 0.0, true);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/flat_copy", 200000) {
+    RunFixedWidth<int64_t>(LogicalType::BIGINT, iterations, 0.0, false);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/flat_copy_10pct_null", 200000) {
+    RunFixedWidth<int64_t>(LogicalType::BIGINT, iterations, 0.1, false);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/flat_copy_50pct_null", 200000) {
+    RunFixedWidth<int64_t>(LogicalType::BIGINT, iterations, 0.5, false);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/double/flat_copy", 200000) {
+    RunFixedWidth<double>(LogicalType::DOUBLE, iterations, 0.0, false);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/double/flat_copy_10pct_null", 200000) {
+    RunFixedWidth<double>(LogicalType::DOUBLE, iterations, 0.1, false);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/decimal_18_3/widen", 100000) {
+    Vector vector(LogicalType::DECIMAL(18, 3), ROWS);
+    FillFlat<int64_t>(vector, 0.0);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(int64_t));
+}
+
+namespace {
+
+void RunBoolean(uint64_t iterations, idx_t null_every) {
+    Vector vector(LogicalType::BOOLEAN, ROWS);
+    auto data = FlatVector::GetData<bool>(vector);
+    for (idx_t i = 0; i < ROWS; i++) {
+        data[i] = (i * 7) % 3 == 0;
+        if (null_every > 0 && i % null_every == 0) {
+            FlatVector::SetNull(vector, i, true);
+        }
+    }
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS);
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("data_conversion/boolean/pack", 200000) {
+    RunBoolean(iterations, 0);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/boolean/pack_10pct_null", 200000) {
+    RunBoolean(iterations, 10);
+}
+
+// ===== STRINGS =====
+
+namespace {
+
+/**
+ * @brief 16 distinct strings referenced through a DICTIONARY vector, gathered or kept as an Arrow dictionary
+ */
+void RunStringDictionary(bool keep_dictionaries, uint64_t iterations) {
+    Vector values(LogicalType::VARCHAR, 16);
+    auto data = FlatVector::GetData<string_t>(values);
+    for (idx_t i = 0; i < 16; i++) {
+        data[i] = StringVector::AddString(values, "status-value-" + std::to_string(i));
+    }
+    SelectionVector sel(ROWS);
+    for (idx_t i = 0; i < ROWS; i++) {
+        sel.set_index(i, (i * 7) % 16);
+    }
+    Vector dictionary(values, sel, ROWS);
+    ArrowConversionOptions options;
+    options.keep_dictionaries = keep_dictionaries;
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(dictionary, ROWS, options);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 16);
+}
+
+/**
+ * @brief 16 distinct strings in a FLAT vector, hash-encoded into Arrow dictionaries by `threads` threads at once
+ *
+ * Every conversion needs a hash table and a selection; the threaded case
+ * shows whether taking that scratch memory contends on the allocator.
+ */
+void RunStringHashEncode(idx_t threads, uint64_t iterations) {
+    Vector strings(LogicalType::VARCHAR, ROWS);
+    auto data = FlatVector::GetData<string_t>(strings);
+    for (idx_t i = 0; i < ROWS; i++) {
+        data[i] = StringVector::AddString(strings, "status-value-" + std::to_string((i * 7) % 16));
+    }
+    DataChunk chunk;
+    chunk.InitializeEmpty({LogicalType::VARCHAR});
+    chunk.data[0].Reference(strings);
+    chunk.SetCardinality(ROWS);
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"status"}, {LogicalType::VARCHAR});
+    auto encoded = DuckDBToArrowConverter::DictionaryEncodeStrings(schema.GetValue().arrow_schema);
+    std::vector<std::thread> workers;
+    for (idx_t t = 0; t < threads; t++) {
+        workers.emplace_back([&]() {
+            for (uint64_t i = 0; i < iterations; i++) {
+                auto result = DuckDBToArrowConverter::ConvertChunk(chunk, encoded);
+                DoNotOptimize(result);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    SetItemsProcessed(iterations * threads * ROWS);
+    SetBytesProcessed(iterations * threads * ROWS * 16);
+}
+
+} // namespace
+
+namespace {
+
+void RunVarchar(uint64_t iterations, idx_t null_every) {
+    Vector vector(LogicalType::VARCHAR, ROWS);
+    auto data = FlatVector::GetData<string_t>(vector);
+    uint64_t bytes = 0;
+    for (idx_t i = 0; i < ROWS; i++) {
+        if (null_every > 0 && i % null_every == 0) {
+            FlatVector::SetNull(vector, i, true);
+            continue;
+        }
+        auto value = "customer-name-" + std::to_string(i * 7919);
+        data[i] = StringVector::AddString(vector, value);
+        bytes += value.size();
+    }
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * bytes);
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/flat_copy", 20000) {
+    RunVarchar(iterations, 0);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/flat_copy_10pct_null", 20000) {
+    RunVarchar(iterations, 10);
+}
+
+namespace {
+
+/**
+ * @brief 64-byte strings (out of line in both string_t and Arrow views) as utf8 or string_view
+ */
+void RunLongStrings(bool string_views, bool zero_copy, uint64_t iterations,
+                    arrow::MemoryPool* pool = arrow::default_memory_pool()) {
+    Vector vector(LogicalType::VARCHAR, ROWS);
+    auto data = FlatVector::GetData<string_t>(vector);
+    for (idx_t i = 0; i < ROWS; i++) {
+        auto value = "order-comment-" + std::to_string(i * 7919);
+        value.resize(64, '.');
+        data[i] = StringVector::AddString(vector, value);
+    }
+    ArrowConversionOptions options;
+    options.pool = pool;
+    options.string_views = string_views;
+    options.zero_copy = zero_copy;
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS, options);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 64);
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar_64b/utf8_copy", 20000) {
+    RunLongStrings(false, true, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar_64b/utf8_copy_duckdb_pool", 20000) {
+    // Every iteration frees its buffers, so all but the first are served from the pool's cache
+    auto pool = SnowflakeMemoryPool::Create(Allocator::DefaultAllocator());
+    RunLongStrings(false, true, iterations, pool.get());
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar_64b/string_view_copy", 20000) {
+    RunLongStrings(true, false, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar_64b/string_view_zero_copy", 100000) {
+    RunLongStrings(true, true, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/dictionary_gather", 20000) {
+    RunStringDictionary(false, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/dictionary_keep", 200000) {
+    RunStringDictionary(true, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/dictionary_hash", 20000) {
+    RunStringHashEncode(1, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/varchar/dictionary_hash_8_threads", 5000) {
+    RunStringHashEncode(8, iterations);
+}
+
+// ===== VECTOR TYPES =====
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/constant", 200000) {
+    Vector vector(Value::BIGINT(7));
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(vector, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/bigint/dictionary", 100000) {
+    Vector values(LogicalType::BIGINT, 16);
+    auto data = FlatVector::GetData<int64_t>(values);
+    for (idx_t i = 0; i < 16; i++) {
+        data[i] = static_cast<int64_t>(i * 1000);
+    }
+    SelectionVector sel(ROWS);
+    for (idx_t i = 0; i < ROWS; i++) {
+        sel.set_index(i, (i * 5) % 16);
+    }
+    Vector dictionary(values, sel, ROWS);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(dictionary, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(int64_t));
+}
+
+// ===== NESTED =====
+
+/**
+ * @brief LIST(BIGINT) vector of ROWS lists with `length` elements each
+ */
+static void FillLists(Vector& lists, idx_t length, bool reversed) {
+    ListVector::Reserve(lists, ROWS * length);
+    auto& child = ListVector::GetEntry(lists);
+    auto child_data = FlatVector::GetData<int64_t>(child);
+    for (idx_t i = 0; i < ROWS * length; i++) {
+        child_data[i] = static_cast<int64_t>(i);
+    }
+    ListVector::SetListSize(lists, ROWS * length);
+    auto entries = FlatVector::GetData<list_entry_t>(lists);
+    for (idx_t i = 0; i < ROWS; i++) {
+        auto row = reversed ? ROWS - 1 - i : i;
+        entries[i] = list_entry_t(row * length, length);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/list_bigint/contiguous", 100000) {
+    Vector lists(LogicalType::LIST(LogicalType::BIGINT), ROWS);
+    FillLists(lists, 8, false);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(lists, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 8 * sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/list_bigint/gathered", 20000) {
+    Vector lists(LogicalType::LIST(LogicalType::BIGINT), ROWS);
+    FillLists(lists, 8, true);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(lists, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * 8 * sizeof(int64_t));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/struct_bigint_double/flat", 200000) {
+    Vector rows(LogicalType::STRUCT({{"id", LogicalType::BIGINT}, {"score", LogicalType::DOUBLE}}), ROWS);
+    auto& entries = StructVector::GetEntries(rows);
+    FillFlat<int64_t>(*entries[0], 0.0);
+    FillFlat<double>(*entries[1], 0.0);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = DuckDBToArrowConverter::ConvertVector(rows, ROWS);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * (sizeof(int64_t) + sizeof(double)));
+}
+
+// ===== DECIMAL RESCALE =====
+
+namespace {
+
+template<typename SRC>
+void RunRescale(const LogicalType& source_type, const LogicalType& target_type, uint64_t iterations,
+                DecimalOverflowPolicy policy) {
+    Vector source(source_type, ROWS);
+    FillFlat<SRC>(source, 0.0);
+    Vector result(target_type, ROWS);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto stats = DecimalRescaleKernel::Rescale(source, ROWS, result, policy);
+        DoNotOptimize(stats);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(SRC));
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("data_conversion/decimal_rescale/widen_9_2_to_18_4", 200000) {
+    RunRescale<int32_t>(LogicalType::DECIMAL(9, 2), LogicalType::DECIMAL(18, 4), iterations,
+                        DecimalOverflowPolicy::ERROR);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/decimal_rescale/narrow_18_4_to_12_2", 100000) {
+    RunRescale<int64_t>(LogicalType::DECIMAL(18, 4), LogicalType::DECIMAL(12, 2), iterations,
+                        DecimalOverflowPolicy::SET_NULL);
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/decimal_rescale/hugeint_38_10_to_38_2", 20000) {
+    RunRescale<hugeint_t>(LogicalType::DECIMAL(38, 10), LogicalType::DECIMAL(38, 2), iterations,
+                          DecimalOverflowPolicy::SATURATE);
+}
+
+// ===== VALIDATION =====
+
+namespace {
+
+template<typename SRC, typename TGT>
+void RunValidation(const LogicalType& source_type, const LogicalType& target_type, uint64_t iterations,
+                   const ValidationOptions& options) {
+    Vector source(source_type, ROWS);
+    FillFlat<SRC>(source, 0.05);
+    Vector target(target_type, ROWS);
+    auto status = DecimalRescaleKernel::Rescale(source, ROWS, target);
+    DoNotOptimize(status);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = ConversionValidator::Validate(source, target, ROWS, options);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * (sizeof(SRC) + sizeof(TGT)));
+}
+
+ValidationOptions MakeOptions(ValidationMode mode, double sample_fraction = 0.01) {
+    ValidationOptions options;
+    options.mode = mode;
+    options.sample_fraction = sample_fraction;
+    return options;
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("data_conversion/validate/full_identical_bigint", 200000) {
+    RunValidation<int64_t, int64_t>(LogicalType::DECIMAL(18, 0), LogicalType::DECIMAL(18, 0), iterations,
+                                    MakeOptions(ValidationMode::FULL));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/validate/full_9_2_vs_18_4", 50000) {
+    RunValidation<int32_t, int64_t>(LogicalType::DECIMAL(9, 2), LogicalType::DECIMAL(18, 4), iterations,
+                                    MakeOptions(ValidationMode::FULL));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/validate/sampled_1pct_9_2_vs_18_4", 200000) {
+    RunValidation<int32_t, int64_t>(LogicalType::DECIMAL(9, 2), LogicalType::DECIMAL(18, 4), iterations,
+                                    MakeOptions(ValidationMode::SAMPLED, 0.01));
+}
+
+SNOWFLAKE_BENCHMARK("data_conversion/validate/checksum_9_2_vs_18_4", 50000) {
+    RunValidation<int32_t, int64_t>(LogicalType::DECIMAL(9, 2), LogicalType::DECIMAL(18, 4), iterations,
+                                    MakeOptions(ValidationMode::CHECKSUM));
+}
\ No newline at end of file
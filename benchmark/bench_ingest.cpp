@@ -0,0 +1,63 @@
+#include "benchmark_util.hpp"
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include <cstdio>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+// Every ingested batch costs BATCH_LATENCY_MS in the stub driver, standing in
+// for the upload of one batch
+constexpr int64_t TOTAL_ROWS = 4 * 1000 * 1000;
+constexpr int BATCH_LATENCY_MS = 5;
+const char *TARGET_PATH = "bench_ingest_table.arrows";
+
+void RunCopy(uint64_t iterations, int threads, int64_t batch_size) {
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("SET threads = " + std::to_string(threads));
+    con.Query("CREATE TABLE source AS SELECT range AS id, range * 0.5 AS score, "
+              "(range % 100000)::DECIMAL(18,2) AS amount FROM range(" + std::to_string(TOTAL_ROWS) + ")");
+    auto sql = std::string("COPY source TO 'snowflake://driver=") + ADBC_IPC_STUB_DRIVER +
+               ";account=stub;user=stub;database=stub;stub_latency_ms=" + std::to_string(BATCH_LATENCY_MS) +
+               "' (FORMAT snowflake, TABLE '" + TARGET_PATH + "', MODE 'replace', BATCH_SIZE " +
+               std::to_string(batch_size) + ")";
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = con.Query(sql);
+        DoNotOptimize(result);
+    }
+    std::remove(TARGET_PATH);
+    SetItemsProcessed(iterations * TOTAL_ROWS);
+    SetBytesProcessed(iterations * TOTAL_ROWS * (sizeof(int64_t) + sizeof(double) + sizeof(int64_t)));
+}
+
+} // namespace
+
+// ===== COPY TO =====
+// End-to-end rows/s: DuckDB scan, conversion on worker threads, upload
+
+SNOWFLAKE_BENCHMARK("ingest/copy/threads_1", 2) {
+    RunCopy(iterations, 1, 122880);
+}
+
+SNOWFLAKE_BENCHMARK("ingest/copy/threads_4", 4) {
+    RunCopy(iterations, 4, 122880);
+}
+
+SNOWFLAKE_BENCHMARK("ingest/copy/threads_8", 4) {
+    RunCopy(iterations, 8, 122880);
+}
+
+// ===== BATCH SIZE =====
+// Per-batch upload overhead dominates small batches
+
+SNOWFLAKE_BENCHMARK("ingest/batch_size/16384", 2) {
+    RunCopy(iterations, 8, 16384);
+}
+
+SNOWFLAKE_BENCHMARK("ingest/batch_size/1048576", 2) {
+    RunCopy(iterations, 8, 1048576);
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "benchmark_util.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace duckdb::bench;
+
+namespace {
+
+/**
+ * @brief Command line: [name-filter] [--repetitions=N] [--json=PATH]
+ */
+struct BenchmarkOptions {
+    std::string filter;
+    uint64_t repetitions = 5;
+    std::string json_path;
+};
+
+/**
+ * @brief Timings of one benchmark over all repetitions
+ */
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;
+    // ns/op of each repetition, sorted
+    std::vector<double> ns_per_op;
+    // Throughput of the median repetition (0 when the body reports none)
+    double items_per_second = 0;
+    double bytes_per_second = 0;
+
+    double Median() const {
+        return ns_per_op[ns_per_op.size() / 2];
+    }
+};
+
+bool ParseOptions(int argc, char** argv, BenchmarkOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = std::strtoull(arg.c_str() + strlen("--repetitions="), nullptr, 10);
+            if (options.repetitions == 0) {
+                std::cerr << "--repetitions must be positive" << std::endl;
+                return false;
+            }
+        } else if (arg.rfind("--json=", 0) == 0) {
+            options.json_path = arg.substr(strlen("--json="));
+        } else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "unknown option " << arg << std::endl
+                      << "usage: bench_snowflake [name-filter] [--repetitions=N] [--json=PATH]" << std::endl;
+            return false;
+        } else {
+            options.filter = arg;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Run a case once for warm-up, then time it `repetitions` times
+ */
+BenchmarkResult Run(const BenchmarkCase& benchmark, uint64_t repetitions) {
+    benchmark.body(std::max<uint64_t>(benchmark.iterations / 10, 1));
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = benchmark.iterations;
+    std::vector<std::pair<double, BenchmarkCounters>> runs;
+    for (uint64_t rep = 0; rep < repetitions; rep++) {
+        CurrentCounters() = BenchmarkCounters();
+        auto start = std::chrono::steady_clock::now();
+        benchmark.body(benchmark.iterations);
+        auto end = std::chrono::steady_clock::now();
+        runs.emplace_back(std::chrono::duration<double, std::nano>(end - start).count(), CurrentCounters());
+    }
+    std::sort(runs.begin(), runs.end(),
+              [](const std::pair<double, BenchmarkCounters>& a, const std::pair<double, BenchmarkCounters>& b) {
+                  return a.first < b.first;
+              });
+    for (auto& run : runs) {
+        result.ns_per_op.push_back(run.first / benchmark.iterations);
+    }
+    auto& median = runs[runs.size() / 2];
+    result.items_per_second = median.second.items * 1e9 / median.first;
+    result.bytes_per_second = median.second.bytes * 1e9 / median.first;
+    return result;
+}
+
+void PrintResult(const BenchmarkResult& result) {
+    auto ns_per_op = result.Median();
+    std::cout << std::left << std::setw(48) << result.name << std::right << std::setw(14) << std::fixed
+              << std::setprecision(2) << ns_per_op << std::setw(16) << std::setprecision(0) << (1e9 / ns_per_op);
+    if (result.items_per_second > 0) {
+        std::cout << std::setw(16) << result.items_per_second;
+    } else {
+        std::cout << std::setw(16) << "-";
+    }
+    if (result.bytes_per_second > 0) {
+        std::cout << std::setw(10) << std::setprecision(2) << (result.bytes_per_second / 1e9);
+    } else {
+        std::cout << std::setw(10) << "-";
+    }
+    // Spread between the fastest and slowest repetition, relative to the median
+    auto spread = (result.ns_per_op.back() - result.ns_per_op.front()) / ns_per_op * 100;
+    std::cout << std::setw(9) << std::setprecision(1) << spread << "%" << std::endl;
+}
+
+std::string JsonEscape(const std::string& value) {
+    std::string escaped;
+    for (auto c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+/**
+ * @brief Write the results in the format compare_benchmarks.py reads
+ */
+bool WriteJson(const std::string& path, const BenchmarkOptions& options, const std::vector<BenchmarkResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "cannot write " << path << std::endl;
+        return false;
+    }
+    auto now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    out << std::setprecision(17);
+    out << "{\n";
+    out << "  \"context\": {\"date\": \"" << date << "\", \"repetitions\": " << options.repetitions
+        << ", \"filter\": \"" << JsonEscape(options.filter) << "\"},\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto& result = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"name\": \"" << JsonEscape(result.name) << "\", \"iterations\": " << result.iterations
+            << ", \"ns_per_op\": " << result.Median() << ", \"min_ns_per_op\": " << result.ns_per_op.front()
+            << ", \"max_ns_per_op\": " << result.ns_per_op.back()
+            << ", \"items_per_second\": " << result.items_per_second
+            << ", \"bytes_per_second\": " << result.bytes_per_second << "}";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+/**
+ * @brief Run every registered benchmark whose name contains the filter (if given)
+ *
+ * Each case is run once for warm-up, then timed `--repetitions` times over its
+ * iteration count; the median repetition is reported. `--json` also writes
+ * the results to a file for compare_benchmarks.py.
+ */
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 2;
+    }
+    auto& benchmarks = GetBenchmarks();
+    std::sort(benchmarks.begin(), benchmarks.end(),
+              [](const BenchmarkCase& a, const BenchmarkCase& b) { return a.name < b.name; });
+
+    std::cout << std::left << std::setw(48) << "benchmark" << std::right << std::setw(14) << "ns/op"
+              << std::setw(16) << "ops/s" << std::setw(16) << "rows/s" << std::setw(10) << "GB/s" << std::setw(10)
+              << "spread" << std::endl;
+    std::vector<BenchmarkResult> results;
+    for (auto& benchmark : benchmarks) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(Run(benchmark, options.repetitions));
+        PrintResult(results.back());
+    }
+    if (!options.json_path.empty() && !WriteJson(options.json_path, options, results)) {
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "benchmark_util.hpp"
+#include "snowflake_result_cache.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <filesystem>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+// One result of 16 batches; every batch costs BATCH_LATENCY_MS in the stub
+// driver, standing in for the warehouse round trip a hit avoids
+constexpr int64_t BATCHES = 16;
+constexpr int64_t ROWS_PER_BATCH = 65536;
+constexpr int64_t TOTAL_ROWS = BATCHES * ROWS_PER_BATCH;
+constexpr int BATCH_LATENCY_MS = 5;
+const std::string CACHE_DIRECTORY = "bench_result_cache";
+
+/**
+ * @brief Write the result file once and return the stub driver query naming it
+ */
+const std::string &ResultQuery() {
+    static const std::string query = [] {
+        std::string path = "bench_result_cache.arrows";
+        auto schema = arrow::schema({arrow::field("id", arrow::int64()), arrow::field("score", arrow::float64())});
+        auto file = arrow::io::FileOutputStream::Open(path).ValueOrDie();
+        auto writer = arrow::ipc::MakeStreamWriter(file, schema).ValueOrDie();
+        for (int64_t batch = 0; batch < BATCHES; batch++) {
+            arrow::Int64Builder ids;
+            arrow::DoubleBuilder scores;
+            for (int64_t i = 0; i < ROWS_PER_BATCH; i++) {
+                (void)ids.Append(i);
+                (void)scores.Append(static_cast<double>(i) * 0.5);
+            }
+            auto record_batch = arrow::RecordBatch::Make(schema, ROWS_PER_BATCH,
+                                                         {ids.Finish().ValueOrDie(), scores.Finish().ValueOrDie()});
+            (void)writer->WriteRecordBatch(*record_batch);
+        }
+        (void)writer->Close();
+        (void)file->Close();
+        return path;
+    }();
+    return query;
+}
+
+SnowflakeConfig StubConfig() {
+    return SnowflakeConfig::Parse(std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                                  ";account=stub;user=stub;database=stub;stub_latency_ms=" +
+                                  std::to_string(BATCH_LATENCY_MS));
+}
+
+void Drain(std::unique_ptr<SnowflakeResultStream> stream) {
+    while (auto batch = stream->ReadNext().first) {
+        DoNotOptimize(batch);
+    }
+}
+
+void ReportThroughput(uint64_t iterations) {
+    SetItemsProcessed(iterations * TOTAL_ROWS);
+    SetBytesProcessed(iterations * TOTAL_ROWS * (sizeof(int64_t) + sizeof(double)));
+}
+
+} // namespace
+
+// ===== REPEATED QUERY =====
+// A hit maps the stored IPC file instead of fetching: its cost is page-cache
+// bandwidth, independent of warehouse latency
+
+SNOWFLAKE_BENCHMARK("result_cache/uncached", 4) {
+    SnowflakeADBCConnector connector(StubConfig());
+    connector.Connect();
+    for (uint64_t i = 0; i < iterations; i++) {
+        Drain(std::move(connector.ExecuteQuery(ResultQuery()).first));
+    }
+    ReportThroughput(iterations);
+}
+
+SNOWFLAKE_BENCHMARK("result_cache/hit", 200) {
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    SnowflakeResultCacheOptions options;
+    options.directory = CACHE_DIRECTORY;
+    SnowflakeResultCache cache(options);
+    SnowflakeADBCConnector connector(StubConfig());
+    connector.Connect();
+    // Populated once; every lookup below is a hit
+    Drain(std::move(cache.Execute(connector, ResultQuery()).first));
+    for (uint64_t i = 0; i < iterations; i++) {
+        Drain(cache.Lookup(connector.GetConfig(), ResultQuery()));
+    }
+    ReportThroughput(iterations);
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+}
+
+SNOWFLAKE_BENCHMARK("result_cache/miss_and_store", 4) {
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    SnowflakeResultCacheOptions options;
+    options.directory = CACHE_DIRECTORY;
+    SnowflakeResultCache cache(options);
+    SnowflakeADBCConnector connector(StubConfig());
+    connector.Connect();
+    for (uint64_t i = 0; i < iterations; i++) {
+        cache.Clear();
+        Drain(std::move(cache.Execute(connector, ResultQuery()).first));
+    }
+    ReportThroughput(iterations);
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "benchmark_util.hpp"
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+// 16 partitions of 4 batches; every batch costs BATCH_LATENCY_MS in the stub
+// driver, standing in for a remote chunk fetch
+constexpr int64_t PARTITIONS = 16;
+constexpr int64_t BATCHES_PER_PARTITION = 4;
+constexpr int64_t ROWS_PER_BATCH = 8192;
+constexpr int64_t TOTAL_ROWS = PARTITIONS * BATCHES_PER_PARTITION * ROWS_PER_BATCH;
+constexpr int BATCH_LATENCY_MS = 5;
+
+/**
+ * @brief Write the partition files once and return the stub driver query naming them
+ */
+const std::string& PartitionQuery() {
+    static const std::string query = [] {
+        auto schema = arrow::schema({
+            arrow::field("id", arrow::int64(), true,
+                         arrow::key_value_metadata({"logicalType", "precision", "scale"}, {"FIXED", "18", "0"})),
+            arrow::field("score", arrow::float64(), true, arrow::key_value_metadata({"logicalType"}, {"REAL"})),
+        });
+        std::string paths;
+        for (int64_t partition = 0; partition < PARTITIONS; partition++) {
+            auto path = "bench_scan_part" + std::to_string(partition) + ".arrows";
+            auto file = arrow::io::FileOutputStream::Open(path).ValueOrDie();
+            auto writer = arrow::ipc::MakeStreamWriter(file, schema).ValueOrDie();
+            for (int64_t batch = 0; batch < BATCHES_PER_PARTITION; batch++) {
+                arrow::Int64Builder ids;
+                arrow::DoubleBuilder scores;
+                for (int64_t i = 0; i < ROWS_PER_BATCH; i++) {
+                    (void)ids.Append(i);
+                    (void)scores.Append(static_cast<double>(i) * 0.5);
+                }
+                auto record_batch = arrow::RecordBatch::Make(schema, ROWS_PER_BATCH,
+                                                             {ids.Finish().ValueOrDie(), scores.Finish().ValueOrDie()});
+                (void)writer->WriteRecordBatch(*record_batch);
+            }
+            (void)writer->Close();
+            (void)file->Close();
+            paths += (partition > 0 ? ";" : "") + path;
+        }
+        return paths;
+    }();
+    return query;
+}
+
+void RunScan(uint64_t iterations, int threads, bool partitioned, int64_t prefetch_batches = 4) {
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("SET threads = " + std::to_string(threads));
+    auto sql = std::string("SELECT SUM(score) FROM snowflake_scan('driver=") + ADBC_IPC_STUB_DRIVER +
+               ";account=stub;user=stub;database=stub;stub_latency_ms=" + std::to_string(BATCH_LATENCY_MS) +
+               "', '" + PartitionQuery() + "', partitioned := " + (partitioned ? "true" : "false") +
+               ", prefetch_batches := " + std::to_string(prefetch_batches) + ")";
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = con.Query(sql);
+        DoNotOptimize(result);
+    }
+    SetItemsProcessed(iterations * TOTAL_ROWS);
+    SetBytesProcessed(iterations * TOTAL_ROWS * (sizeof(int64_t) + sizeof(double)));
+}
+
+} // namespace
+
+// ===== PARTITIONED FETCH =====
+// Fetch latency dominates, so throughput should grow close to linearly with threads
+
+SNOWFLAKE_BENCHMARK("scan/partitioned/threads_1", 2) {
+    RunScan(iterations, 1, true);
+}
+
+SNOWFLAKE_BENCHMARK("scan/partitioned/threads_2", 4) {
+    RunScan(iterations, 2, true);
+}
+
+SNOWFLAKE_BENCHMARK("scan/partitioned/threads_4", 8) {
+    RunScan(iterations, 4, true);
+}
+
+SNOWFLAKE_BENCHMARK("scan/partitioned/threads_8", 16) {
+    RunScan(iterations, 8, true);
+}
+
+// ===== SINGLE STREAM =====
+// Baseline: one stream serializes every fetch regardless of thread count
+
+SNOWFLAKE_BENCHMARK("scan/single_stream/threads_8", 2) {
+    RunScan(iterations, 8, false);
+}
+
+// ===== PREFETCH =====
+// Read-ahead overlaps each fetch with decoding; without it every batch waits for its download
+
+SNOWFLAKE_BENCHMARK("scan/prefetch/off/single_stream", 2) {
+    RunScan(iterations, 1, false, 0);
+}
+
+SNOWFLAKE_BENCHMARK("scan/prefetch/on/single_stream", 2) {
+    RunScan(iterations, 1, false);
+}
+
+SNOWFLAKE_BENCHMARK("scan/prefetch/off/partitioned/threads_4", 8) {
+    RunScan(iterations, 4, true, 0);
+}
+
+SNOWFLAKE_BENCHMARK("scan/prefetch/on/partitioned/threads_4", 8) {
+    RunScan(iterations, 4, true);
+}
\ No newline at end of file
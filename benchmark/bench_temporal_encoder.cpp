@@ -0,0 +1,75 @@
+#include "benchmark_util.hpp"
+#include "snowflake_temporal_encoder.hpp"
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+constexpr idx_t ROWS = STANDARD_VECTOR_SIZE;
+constexpr int64_t MICROS_PER_HOUR = 3600LL * 1000000LL;
+
+/**
+ * @brief Evenly spaced instants starting 2023-11-14
+ */
+void FillInstants(Vector& vector, int64_t step) {
+    auto data = FlatVector::GetData<int64_t>(vector);
+    for (idx_t i = 0; i < ROWS; i++) {
+        data[i] = 1700000000000000LL + static_cast<int64_t>(i) * step;
+    }
+}
+
+void RunEncode(const LogicalType& type, SnowflakeTimestampKind kind, int32_t scale, TimezoneOffsetCache* timezone,
+               uint64_t iterations, int64_t step = 1757) {
+    Vector source(type, ROWS);
+    FillInstants(source, step);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto encoded = SnowflakeTemporalEncoder::Encode(source, ROWS, kind, scale, timezone);
+        DoNotOptimize(encoded);
+    }
+    SetItemsProcessed(iterations * ROWS);
+    SetBytesProcessed(iterations * ROWS * sizeof(int64_t));
+}
+
+/**
+ * @brief Zone with a transition every hour, the worst case for the offset cache
+ */
+TimezoneOffsetCache HourlyZone() {
+    return TimezoneOffsetCache([](int64_t micros) {
+        auto first = micros - ((micros % MICROS_PER_HOUR) + MICROS_PER_HOUR) % MICROS_PER_HOUR;
+        return TimezoneOffsetSpan {first, first + MICROS_PER_HOUR - 1,
+                                   static_cast<int32_t>((first / MICROS_PER_HOUR) % 2 * 60)};
+    });
+}
+
+} // namespace
+
+// ===== SCALED =====
+
+SNOWFLAKE_BENCHMARK("temporal_encode/ntz_3/scaled_downscale", 200000) {
+    RunEncode(LogicalType::TIMESTAMP, SnowflakeTimestampKind::NTZ, 3, nullptr, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("temporal_encode/ltz_7/scaled_upscale", 200000) {
+    RunEncode(LogicalType::TIMESTAMP_TZ, SnowflakeTimestampKind::LTZ, 7, nullptr, iterations);
+}
+
+// ===== STRUCT =====
+
+SNOWFLAKE_BENCHMARK("temporal_encode/ntz_9/epoch_fraction", 100000) {
+    RunEncode(LogicalType::TIMESTAMP, SnowflakeTimestampKind::NTZ, 9, nullptr, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("temporal_encode/ntz_9/epoch_fraction_from_ns", 100000) {
+    RunEncode(LogicalType::TIMESTAMP_NS, SnowflakeTimestampKind::NTZ, 9, nullptr, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("temporal_encode/tz_9/fixed_zone", 100000) {
+    auto zone = TimezoneOffsetCache::Fixed(60);
+    RunEncode(LogicalType::TIMESTAMP_TZ, SnowflakeTimestampKind::TZ, 9, &zone, iterations);
+}
+
+SNOWFLAKE_BENCHMARK("temporal_encode/tz_9/transition_per_batch", 50000) {
+    auto zone = HourlyZone();
+    RunEncode(LogicalType::TIMESTAMP_TZ, SnowflakeTimestampKind::TZ, 9, &zone, iterations, MICROS_PER_HOUR / 1024);
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "benchmark_util.hpp"
+#include "type_converter.hpp"
+#include "type_registry.hpp"
+#include "type_conversion_cache.hpp"
+#include <arrow/type.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+// Column mix resembling a typical synced table
+const LogicalType COLUMN_TYPES[] = {
+    LogicalType::INTEGER, LogicalType::VARCHAR, LogicalType::BIGINT,    LogicalType::DOUBLE,
+    LogicalType::DATE,    LogicalType::BOOLEAN, LogicalType::TIMESTAMP, LogicalType::TIMESTAMP_TZ,
+};
+constexpr size_t COLUMN_TYPE_COUNT = sizeof(COLUMN_TYPES) / sizeof(COLUMN_TYPES[0]);
+
+// ===== LEGACY DISPATCH (hash lookup + string compare chain) =====
+// Kept verbatim from the pre-registry implementation as the comparison baseline.
+
+const std::unordered_map<LogicalTypeId, std::string> LEGACY_ARROW_EQUIVALENTS = {
+    {LogicalTypeId::TINYINT, "int8"},        {LogicalTypeId::SMALLINT, "int16"},
+    {LogicalTypeId::INTEGER, "int32"},       {LogicalTypeId::BIGINT, "int64"},
+    {LogicalTypeId::FLOAT, "float32"},       {LogicalTypeId::DOUBLE, "float64"},
+    {LogicalTypeId::VARCHAR, "utf8"},        {LogicalTypeId::BLOB, "binary"},
+    {LogicalTypeId::BOOLEAN, "bool"},        {LogicalTypeId::DATE, "date32"},
+    {LogicalTypeId::TIME, "time64[us]"},     {LogicalTypeId::TIMESTAMP, "timestamp[us]"},
+    {LogicalTypeId::TIMESTAMP_TZ, "timestamp[us, UTC]"}
+};
+
+std::shared_ptr<arrow::DataType> LegacyConvertDuckDBToArrow(const LogicalType& duckdb_type) {
+    auto it = LEGACY_ARROW_EQUIVALENTS.find(duckdb_type.id());
+    if (it == LEGACY_ARROW_EQUIVALENTS.end()) return nullptr;
+    if (it->second == "int8") return arrow::int8();
+    if (it->second == "int16") return arrow::int16();
+    if (it->second == "int32") return arrow::int32();
+    if (it->second == "int64") return arrow::int64();
+    if (it->second == "float32") return arrow::float32();
+    if (it->second == "float64") return arrow::float64();
+    if (it->second == "utf8") return arrow::utf8();
+    if (it->second == "binary") return arrow::binary();
+    if (it->second == "bool") return arrow::boolean();
+    if (it->second == "date32") return arrow::date32();
+    if (it->second == "time64[us]") return arrow::time64(arrow::TimeUnit::MICRO);
+    if (it->second == "timestamp[us]") return arrow::timestamp(arrow::TimeUnit::MICRO);
+    if (it->second == "timestamp[us, UTC]") return arrow::timestamp(arrow::TimeUnit::MICRO, "UTC");
+    return nullptr;
+}
+
+std::string LegacyConvertArrowToSnowflake(const std::string& arrow_type_desc) {
+    if (arrow_type_desc == "int8")   return "NUMBER(3,0)";
+    if (arrow_type_desc == "int16")  return "NUMBER(5,0)";
+    if (arrow_type_desc == "int32")  return "NUMBER(10,0)";
+    if (arrow_type_desc == "int64")  return "NUMBER(19,0)";
+    if (arrow_type_desc == "float32")return "FLOAT";
+    if (arrow_type_desc == "float64")return "DOUBLE";
+    if (arrow_type_desc == "utf8")   return "VARCHAR";
+    if (arrow_type_desc == "binary") return "BINARY";
+    if (arrow_type_desc == "bool")   return "BOOLEAN";
+    if (arrow_type_desc == "date32") return "DATE";
+    if (arrow_type_desc == "time64[us]") return "TIME";
+    if (arrow_type_desc == "timestamp[us]")     return "TIMESTAMP_NTZ";
+    if (arrow_type_desc == "timestamp[us, UTC]")return "TIMESTAMP_TZ";
+    return "";
+}
+
+} // namespace
+
+// ===== DUCKDB -> ARROW =====
+
+SNOWFLAKE_BENCHMARK("type_mapping/duckdb_to_arrow/legacy", 2000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = LegacyConvertDuckDBToArrow(COLUMN_TYPES[i % COLUMN_TYPE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_mapping/duckdb_to_arrow/registry", 2000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::ConvertDuckDBToArrow(COLUMN_TYPES[i % COLUMN_TYPE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+// ===== ARROW -> SNOWFLAKE =====
+
+SNOWFLAKE_BENCHMARK("type_mapping/arrow_to_snowflake/legacy_string", 2000000) {
+    std::string descriptions[COLUMN_TYPE_COUNT];
+    for (size_t i = 0; i < COLUMN_TYPE_COUNT; i++) {
+        descriptions[i] = std::string(SnowflakeTypeRegistry::Lookup(COLUMN_TYPES[i].id())->arrow_name);
+    }
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = LegacyConvertArrowToSnowflake(descriptions[i % COLUMN_TYPE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_mapping/arrow_to_snowflake/registry_type", 2000000) {
+    std::shared_ptr<arrow::DataType> arrow_types[COLUMN_TYPE_COUNT];
+    for (size_t i = 0; i < COLUMN_TYPE_COUNT; i++) {
+        arrow_types[i] = SnowflakeTypeConverter::ConvertDuckDBToArrow(COLUMN_TYPES[i]).GetValue();
+    }
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::ConvertArrowToSnowflake(*arrow_types[i % COLUMN_TYPE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_mapping/registry_lookup", 10000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto entry = SnowflakeTypeRegistry::Lookup(COLUMN_TYPES[i % COLUMN_TYPE_COUNT].id());
+        DoNotOptimize(entry);
+    }
+}
+
+// ===== DUCKDB -> SNOWFLAKE =====
+
+SNOWFLAKE_BENCHMARK("type_mapping/duckdb_to_snowflake", 2000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(COLUMN_TYPES[i % COLUMN_TYPE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+// ===== CONVERSION CACHE =====
+
+SNOWFLAKE_BENCHMARK("type_mapping/decimal_to_snowflake/uncached", 1000000) {
+    SnowflakeTypeConverter::DisableConversionCache();
+    auto decimal_type = LogicalType::DECIMAL(18, 3);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::GetTypeMappingInfo(decimal_type);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_mapping/decimal_to_snowflake/cached", 1000000) {
+    SnowflakeTypeConverter::EnableConversionCache();
+    auto decimal_type = LogicalType::DECIMAL(18, 3);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto entry = SnowflakeTypeConverter::LookupCachedConversion(decimal_type);
+        DoNotOptimize(entry);
+    }
+    SnowflakeTypeConverter::DisableConversionCache();
+}
+
+// ===== SCHEMA CONVERSION =====
+
+namespace {
+
+void BuildWideSchema(std::vector<std::string>& names, std::vector<LogicalType>& types) {
+    // 2,000-column fact table built from a small set of repeated types
+    const LogicalType fact_types[] = {LogicalType::BIGINT, LogicalType::DECIMAL(18, 2), LogicalType::VARCHAR,
+                                      LogicalType::DATE, LogicalType::DECIMAL(38, 10), LogicalType::TIMESTAMP};
+    for (size_t i = 0; i < 2000; i++) {
+        names.push_back("col_" + std::to_string(i));
+        types.push_back(fact_types[i % (sizeof(fact_types) / sizeof(fact_types[0]))]);
+    }
+}
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("schema/2000_columns/per_column", 200) {
+    std::vector<std::string> names;
+    std::vector<LogicalType> types;
+    BuildWideSchema(names, types);
+    for (uint64_t i = 0; i < iterations; i++) {
+        for (auto& type : types) {
+            auto snowflake_type = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(type);
+            auto arrow_type = SnowflakeTypeConverter::ConvertDuckDBToArrow(type);
+            auto info = SnowflakeTypeConverter::GetTypeMappingInfo(type);
+            DoNotOptimize(snowflake_type);
+            DoNotOptimize(arrow_type);
+            DoNotOptimize(info);
+        }
+    }
+}
+
+SNOWFLAKE_BENCHMARK("schema/2000_columns/convert_schema", 200) {
+    std::vector<std::string> names;
+    std::vector<LogicalType> types;
+    BuildWideSchema(names, types);
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::ConvertSchema(names, types);
+        DoNotOptimize(result);
+    }
+}
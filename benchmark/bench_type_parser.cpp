@@ -0,0 +1,56 @@
+#include "benchmark_util.hpp"
+#include "snowflake_type_parser.hpp"
+#include "type_converter.hpp"
+#include <string>
+
+using namespace duckdb;
+using namespace duckdb::bench;
+
+namespace {
+
+// Signatures as returned by DESCRIBE TABLE on a typical warehouse schema
+const std::string DESCRIBE_SIGNATURES[] = {
+    "NUMBER(38,0)",
+    "VARCHAR(16777216)",
+    "TIMESTAMP_NTZ(9)",
+    "NUMBER(18,2)",
+    "BOOLEAN",
+    "DATE",
+    "TIMESTAMP_TZ(9)",
+    "ARRAY(NUMBER(10,0))",
+    "OBJECT(id NUMBER(38,0), name VARCHAR(256), created TIMESTAMP_LTZ(9))",
+    "VARIANT",
+};
+constexpr size_t SIGNATURE_COUNT = sizeof(DESCRIBE_SIGNATURES) / sizeof(DESCRIBE_SIGNATURES[0]);
+
+} // namespace
+
+SNOWFLAKE_BENCHMARK("type_parser/parse_describe_mix", 1000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeParser::Parse(DESCRIBE_SIGNATURES[i % SIGNATURE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_parser/parse_number", 2000000) {
+    const std::string signature = "NUMBER(38, 0)";
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeParser::Parse(signature);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_parser/convert_snowflake_to_duckdb", 1000000) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB(DESCRIBE_SIGNATURES[i % SIGNATURE_COUNT]);
+        DoNotOptimize(result);
+    }
+}
+
+SNOWFLAKE_BENCHMARK("type_parser/reject_unknown", 2000000) {
+    const std::string signature = "UNKNOWN_TYPE(1,2)";
+    for (uint64_t i = 0; i < iterations; i++) {
+        auto result = SnowflakeTypeParser::Parse(signature);
+        DoNotOptimize(result);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+namespace bench {
+
+/**
+ * @brief Single registered microbenchmark
+ *
+ * The body is invoked with an iteration count and must perform exactly that
+ * many units of work; the runner divides wall time by that count.
+ */
+struct BenchmarkCase {
+    std::string name;
+    std::function<void(uint64_t iterations)> body;
+    uint64_t iterations;
+};
+
+/**
+ * @brief Process-wide benchmark list populated by SNOWFLAKE_BENCHMARK
+ */
+inline std::vector<BenchmarkCase>& GetBenchmarks() {
+    static std::vector<BenchmarkCase> benchmarks;
+    return benchmarks;
+}
+
+/**
+ * @brief Work counters a benchmark body may report for throughput output
+ *
+ * Bodies call SetItemsProcessed/SetBytesProcessed with totals for the
+ * iterations they were asked to run; the runner turns them into rows/s and GB/s.
+ */
+struct BenchmarkCounters {
+    uint64_t items = 0;
+    uint64_t bytes = 0;
+};
+
+inline BenchmarkCounters& CurrentCounters() {
+    static BenchmarkCounters counters;
+    return counters;
+}
+
+inline void SetItemsProcessed(uint64_t items) {
+    CurrentCounters().items = items;
+}
+
+inline void SetBytesProcessed(uint64_t bytes) {
+    CurrentCounters().bytes = bytes;
+}
+
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(const char* name, uint64_t iterations, void (*body)(uint64_t)) {
+        GetBenchmarks().push_back({name, body, iterations});
+    }
+};
+
+/**
+ * @brief Keep the optimizer from discarding a computed value
+ */
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace bench
+} // namespace duckdb
+
+#define SNOWFLAKE_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define SNOWFLAKE_BENCHMARK_CONCAT(a, b) SNOWFLAKE_BENCHMARK_CONCAT_INNER(a, b)
+
+/**
+ * Register a benchmark: SNOWFLAKE_BENCHMARK(name, iterations) { ...loop over iterations... }
+ */
+#define SNOWFLAKE_BENCHMARK(NAME, ITERATIONS)                                                          \
+    static void SNOWFLAKE_BENCHMARK_CONCAT(BenchBody_, __LINE__)(uint64_t iterations);                 \
+    static ::duckdb::bench::BenchmarkRegistrar SNOWFLAKE_BENCHMARK_CONCAT(bench_registrar_, __LINE__)( \
+        NAME, ITERATIONS, &SNOWFLAKE_BENCHMARK_CONCAT(BenchBody_, __LINE__));                          \
+    static void SNOWFLAKE_BENCHMARK_CONCAT(BenchBody_, __LINE__)(uint64_t iterations)
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Compare two bench_snowflake --json results and flag regressions.
+
+A benchmark regresses when its median ns/op in the candidate run exceeds the
+baseline by more than the threshold. A case is only flagged when the slowdown
+also exceeds the spread the baseline measured between its fastest and slowest
+repetition, so noisy cases need a larger change to fail.
+
+    ./benchmark/bench_snowflake --json=baseline.json     # on the base revision
+    ./benchmark/bench_snowflake --json=candidate.json    # on the change
+    ./benchmark/compare_benchmarks.py baseline.json candidate.json --threshold 10
+
+Exits with 1 if any benchmark regressed, 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {case["name"]: case for case in json.load(f)["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON written by the base revision")
+    parser.add_argument("candidate", help="JSON written by the change under test")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent that counts as a regression (default: 10)")
+    parser.add_argument("--filter", default="", help="only compare benchmarks whose name contains this")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    candidate = load(args.candidate)
+    names = sorted(name for name in baseline.keys() & candidate.keys() if args.filter in name)
+
+    regressions = []
+    print(f"{'benchmark':<48}{'base ns/op':>14}{'new ns/op':>14}{'change':>10}")
+    for name in names:
+        base = baseline[name]
+        new = candidate[name]
+        change = (new["ns_per_op"] / base["ns_per_op"] - 1) * 100
+        noise = (base["max_ns_per_op"] - base["min_ns_per_op"]) / base["ns_per_op"] * 100
+        regressed = change > max(args.threshold, noise)
+        improved = -change > max(args.threshold, noise)
+        marker = "  REGRESSION" if regressed else ("  improved" if improved else "")
+        print(f"{name:<48}{base['ns_per_op']:>14.2f}{new['ns_per_op']:>14.2f}{change:>+9.1f}%{marker}")
+        if regressed:
+            regressions.append(name)
+
+    for name in sorted(baseline.keys() - candidate.keys()):
+        if args.filter in name:
+            print(f"{name:<48}  missing from {args.candidate}")
+    for name in sorted(candidate.keys() - baseline.keys()):
+        if args.filter in name:
+            print(f"{name:<48}  new (no baseline)")
+
+    if regressions:
+        print(f"\n{len(regressions)} of {len(names)} benchmarks regressed by more than {args.threshold:g}%:")
+        for name in regressions:
+            print(f"  {name}")
+        return 1
+    print(f"\nNo regressions beyond {args.threshold:g}% in {len(names)} benchmarks")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
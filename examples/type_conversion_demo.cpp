@@ -20,25 +20,25 @@ int main() {
     
     // Test integer types
     auto int_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::INTEGER);
-    std::cout << "   INTEGER -> " << (int_result.success ? int_result.result : "ERROR: " + int_result.error_message) << "\n";
+    std::cout << "   INTEGER -> " << (int_result.success ? int_result.result : "ERROR: " + int_result.GetError()) << "\n";
     
     auto bigint_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::BIGINT);
-    std::cout << "   BIGINT -> " << (bigint_result.success ? bigint_result.result : "ERROR: " + bigint_result.error_message) << "\n";
+    std::cout << "   BIGINT -> " << (bigint_result.success ? bigint_result.result : "ERROR: " + bigint_result.GetError()) << "\n";
     
     // Test floating point types
     auto float_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::FLOAT);
-    std::cout << "   FLOAT -> " << (float_result.success ? float_result.result : "ERROR: " + float_result.error_message) << "\n";
+    std::cout << "   FLOAT -> " << (float_result.success ? float_result.result : "ERROR: " + float_result.GetError()) << "\n";
     
     auto double_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::DOUBLE);
-    std::cout << "   DOUBLE -> " << (double_result.success ? double_result.result : "ERROR: " + double_result.error_message) << "\n";
+    std::cout << "   DOUBLE -> " << (double_result.success ? double_result.result : "ERROR: " + double_result.GetError()) << "\n";
     
     // Test text types
     auto varchar_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::VARCHAR);
-    std::cout << "   VARCHAR -> " << (varchar_result.success ? varchar_result.result : "ERROR: " + varchar_result.error_message) << "\n";
+    std::cout << "   VARCHAR -> " << (varchar_result.success ? varchar_result.result : "ERROR: " + varchar_result.GetError()) << "\n";
     
     // Test boolean
     auto bool_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::BOOLEAN);
-    std::cout << "   BOOLEAN -> " << (bool_result.success ? bool_result.result : "ERROR: " + bool_result.error_message) << "\n";
+    std::cout << "   BOOLEAN -> " << (bool_result.success ? bool_result.result : "ERROR: " + bool_result.GetError()) << "\n";
     
     std::cout << "\n";
     
@@ -47,10 +47,10 @@ int main() {
     std::cout << "   ---------------------------\n";
     
     auto date_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::DATE);
-    std::cout << "   DATE -> " << (date_result.success ? date_result.result : "ERROR: " + date_result.error_message) << "\n";
+    std::cout << "   DATE -> " << (date_result.success ? date_result.result : "ERROR: " + date_result.GetError()) << "\n";
     
     auto timestamp_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::TIMESTAMP);
-    std::cout << "   TIMESTAMP -> " << (timestamp_result.success ? timestamp_result.result : "ERROR: " + timestamp_result.error_message) << "\n";
+    std::cout << "   TIMESTAMP -> " << (timestamp_result.success ? timestamp_result.result : "ERROR: " + timestamp_result.GetError()) << "\n";
     
     std::cout << "\n";
     
@@ -61,12 +61,12 @@ int main() {
     // Normal decimal
     auto normal_decimal = LogicalType::DECIMAL(18, 3);
     auto normal_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(normal_decimal);
-    std::cout << "   DECIMAL(18,3) -> " << (normal_result.success ? normal_result.result : "ERROR: " + normal_result.error_message) << "\n";
+    std::cout << "   DECIMAL(18,3) -> " << (normal_result.success ? normal_result.result : "ERROR: " + normal_result.GetError()) << "\n";
     
     // Large decimal requiring adjustment
     auto large_decimal = LogicalType::DECIMAL(45, 5);
     auto large_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(large_decimal);
-    std::cout << "   DECIMAL(45,5) -> " << (large_result.success ? large_result.result : "ERROR: " + large_result.error_message) << "\n";
+    std::cout << "   DECIMAL(45,5) -> " << (large_result.success ? large_result.result : "ERROR: " + large_result.GetError()) << "\n";
     
     // Test precision adjustment function
     auto adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(50, 10);
@@ -85,17 +85,17 @@ int main() {
     // List type
     auto list_type = LogicalType::LIST(LogicalType::VARCHAR);
     auto list_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(list_type);
-    std::cout << "   LIST(VARCHAR) -> " << (list_result.success ? list_result.result : "ERROR: " + list_result.error_message) << "\n";
+    std::cout << "   LIST(VARCHAR) -> " << (list_result.success ? list_result.result : "ERROR: " + list_result.GetError()) << "\n";
     
     // Nested list type
     auto nested_list = LogicalType::LIST(LogicalType::LIST(LogicalType::INTEGER));
     auto nested_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(nested_list);
-    std::cout << "   LIST(LIST(INTEGER)) -> " << (nested_result.success ? nested_result.result : "ERROR: " + nested_result.error_message) << "\n";
+    std::cout << "   LIST(LIST(INTEGER)) -> " << (nested_result.success ? nested_result.result : "ERROR: " + nested_result.GetError()) << "\n";
     
     // Struct type
     auto struct_type = LogicalType::STRUCT({{"name", LogicalType::VARCHAR}, {"age", LogicalType::INTEGER}});
     auto struct_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(struct_type);
-    std::cout << "   STRUCT(name:VARCHAR, age:INTEGER) -> " << (struct_result.success ? struct_result.result : "ERROR: " + struct_result.error_message) << "\n";
+    std::cout << "   STRUCT(name:VARCHAR, age:INTEGER) -> " << (struct_result.success ? struct_result.result : "ERROR: " + struct_result.GetError()) << "\n";
     
     std::cout << "\n";
     
@@ -112,7 +112,7 @@ int main() {
         std::cout << "   Precision Loss: " << (mapping_info.result.has_precision_loss ? "Yes" : "No") << "\n";
         std::cout << "   Special Handling: " << (mapping_info.result.requires_special_handling ? "Yes" : "No") << "\n";
     } else {
-        std::cout << "   Error getting mapping info: " << mapping_info.error_message << "\n";
+        std::cout << "   Error getting mapping info: " << mapping_info.GetError() << "\n";
     }
     
     std::cout << "\n";
@@ -122,13 +122,13 @@ int main() {
     std::cout << "   -------------------------------------------\n";
     
     auto reverse_int = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("NUMBER(10,0)");
-    std::cout << "   NUMBER(10,0) -> " << (reverse_int.success ? reverse_int.result.ToString() : "ERROR: " + reverse_int.error_message) << "\n";
+    std::cout << "   NUMBER(10,0) -> " << (reverse_int.success ? reverse_int.result.ToString() : "ERROR: " + reverse_int.GetError()) << "\n";
     
     auto reverse_varchar = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("VARCHAR");
-    std::cout << "   VARCHAR -> " << (reverse_varchar.success ? reverse_varchar.result.ToString() : "ERROR: " + reverse_varchar.error_message) << "\n";
+    std::cout << "   VARCHAR -> " << (reverse_varchar.success ? reverse_varchar.result.ToString() : "ERROR: " + reverse_varchar.GetError()) << "\n";
     
     auto reverse_array = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("ARRAY(VARCHAR)");
-    std::cout << "   ARRAY(VARCHAR) -> " << (reverse_array.success ? reverse_array.result.ToString() : "ERROR: " + reverse_array.error_message) << "\n";
+    std::cout << "   ARRAY(VARCHAR) -> " << (reverse_array.success ? reverse_array.result.ToString() : "ERROR: " + reverse_array.GetError()) << "\n";
     
     std::cout << "\n";
     
@@ -138,11 +138,11 @@ int main() {
     
     // Test with unsupported type (placeholder for now)
     auto error_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::UNION({{LogicalType::INTEGER, LogicalType::VARCHAR}}));
-    std::cout << "   UNION(INTEGER, VARCHAR) -> " << (error_result.success ? error_result.result : "ERROR: " + error_result.error_message) << "\n";
+    std::cout << "   UNION(INTEGER, VARCHAR) -> " << (error_result.success ? error_result.result : "ERROR: " + error_result.GetError()) << "\n";
     
     // Test invalid Snowflake type
     auto invalid_result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("INVALID_TYPE");
-    std::cout << "   INVALID_TYPE -> " << (invalid_result.success ? invalid_result.result.ToString() : "ERROR: " + invalid_result.error_message) << "\n";
+    std::cout << "   INVALID_TYPE -> " << (invalid_result.success ? invalid_result.result.ToString() : "ERROR: " + invalid_result.GetError()) << "\n";
     
     std::cout << "\n";
     
@@ -1,26 +1,54 @@
 #include "adbc_connector.hpp"
 #include "duckdb/common/string_util.hpp"
 
-// TODO: Add Arrow includes when available
-// #include <arrow/record_batch.h>
-// #include <arrow/array.h>
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <cstring>
 
 namespace duckdb {
 
+namespace {
+
+/**
+ * @brief Release a statement, discarding any error (used on cleanup paths)
+ */
+void ReleaseStatement(AdbcStatement &statement) {
+    AdbcError error;
+    std::memset(&error, 0, sizeof(error));
+    AdbcStatementRelease(&statement, &error);
+    if (error.release) {
+        error.release(&error);
+    }
+}
+
+const char *IngestModeOption(SnowflakeIngestMode mode) {
+    switch (mode) {
+    case SnowflakeIngestMode::CREATE:
+        return ADBC_INGEST_OPTION_MODE_CREATE;
+    case SnowflakeIngestMode::REPLACE:
+        return ADBC_INGEST_OPTION_MODE_REPLACE;
+    default:
+        return ADBC_INGEST_OPTION_MODE_APPEND;
+    }
+}
+
+} // namespace
+
 std::string SnowflakeConfig::BuildURI() const {
     // Format: user[:password]@account/database/schema[?params]
     std::string uri = user;
-    
+
     if (!password.empty()) {
         uri += ":" + password;
     }
-    
+
     uri += "@" + account + "/" + database;
-    
+
     if (!schema.empty()) {
         uri += "/" + schema;
     }
-    
+
     // Add optional parameters
     std::vector<std::string> params;
     if (!warehouse.empty()) {
@@ -29,12 +57,12 @@ std::string SnowflakeConfig::BuildURI() const {
     if (!role.empty()) {
         params.push_back("role=" + role);
     }
-    
+
     // Add custom options
     for (const auto &option : options) {
         params.push_back(option.first + "=" + option.second);
     }
-    
+
     if (!params.empty()) {
         uri += "?";
         for (size_t i = 0; i < params.size(); ++i) {
@@ -42,7 +70,7 @@ std::string SnowflakeConfig::BuildURI() const {
             uri += params[i];
         }
     }
-    
+
     return uri;
 }
 
@@ -50,14 +78,87 @@ bool SnowflakeConfig::IsValid() const {
     return !account.empty() && !user.empty() && !database.empty();
 }
 
+SnowflakeConfig SnowflakeConfig::Parse(const std::string &connection_string) {
+    SnowflakeConfig config;
+    std::unordered_map<std::string, std::string*> members = {
+        {"account", &config.account},
+        {"user", &config.user},
+        {"password", &config.password},
+        {"database", &config.database},
+        {"schema", &config.schema},
+        {"warehouse", &config.warehouse},
+        {"role", &config.role},
+        {"private_key_path", &config.private_key_path},
+        {"private_key_passphrase", &config.private_key_passphrase},
+        {"token", &config.token},
+        {"driver", &config.driver},
+    };
+    for (auto &pair : StringUtil::Split(connection_string, ';')) {
+        auto separator = pair.find('=');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        auto key = pair.substr(0, separator);
+        auto value = pair.substr(separator + 1);
+        StringUtil::Trim(key);
+        StringUtil::Trim(value);
+        auto member = members.find(StringUtil::Lower(key));
+        if (member != members.end()) {
+            *member->second = value;
+        } else {
+            config.options[key] = value;
+        }
+    }
+    return config;
+}
+
+// ===== RESULT STREAM =====
+
+SnowflakeResultStream::SnowflakeResultStream(AdbcStatement statement,
+                                             std::shared_ptr<arrow::RecordBatchReader> reader)
+    : statement_(statement), reader_(std::move(reader)) {
+}
+
+SnowflakeResultStream::SnowflakeResultStream(std::shared_ptr<arrow::RecordBatchReader> reader)
+    : reader_(std::move(reader)) {
+    std::memset(&statement_, 0, sizeof(statement_));
+}
+
+SnowflakeResultStream::~SnowflakeResultStream() {
+    // The stream may reference the statement, so it goes first
+    reader_.reset();
+    if (statement_.private_data) {
+        ReleaseStatement(statement_);
+    }
+}
+
+std::shared_ptr<arrow::Schema> SnowflakeResultStream::GetSchema() const {
+    return reader_->schema();
+}
+
+std::pair<std::shared_ptr<arrow::RecordBatch>, string> SnowflakeResultStream::ReadNext() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (finished_) {
+        return {nullptr, ""};
+    }
+    std::shared_ptr<arrow::RecordBatch> batch;
+    auto status = reader_->ReadNext(&batch);
+    if (!status.ok()) {
+        return {nullptr, "Error reading result stream: " + status.ToString()};
+    }
+    finished_ = !batch;
+    return {std::move(batch), ""};
+}
+
+// ===== CONNECTOR =====
+
 SnowflakeADBCConnector::SnowflakeADBCConnector(const SnowflakeConfig &config)
-    : config_(config), connected_(false) {
-    
+    : config_(config), connected_(false), supports_partitions_(true) {
+
     // Initialize ADBC structures
     std::memset(&adbc_error_, 0, sizeof(adbc_error_));
     std::memset(&adbc_database_, 0, sizeof(adbc_database_));
     std::memset(&adbc_connection_, 0, sizeof(adbc_connection_));
-    std::memset(&adbc_statement_, 0, sizeof(adbc_statement_));
 }
 
 SnowflakeADBCConnector::~SnowflakeADBCConnector() {
@@ -68,52 +169,286 @@ string SnowflakeADBCConnector::Connect() {
     if (connected_) {
         return "Already connected";
     }
-    
+    if (!config_.IsValid()) {
+        return "Invalid Snowflake configuration: account, user and database are required";
+    }
+
     string result = InitializeDatabase();
-    if (!result.empty()) return result;
-    
+    if (!result.empty()) {
+        Cleanup();
+        return result;
+    }
+
     result = InitializeConnection();
-    if (!result.empty()) return result;
-    
+    if (!result.empty()) {
+        Cleanup();
+        return result;
+    }
+
     connected_ = true;
     return "";
 }
 
-string SnowflakeADBCConnector::Disconnect() {
+void SnowflakeADBCConnector::Disconnect() {
     if (!connected_) {
-        return "";
+        return;
     }
-    
+
     Cleanup();
     connected_ = false;
-    return "";
 }
 
-string SnowflakeADBCConnector::ExecuteQuery(const string &query) {
+string SnowflakeADBCConnector::Ping() {
+    auto executed = ExecuteQuery("SELECT 1");
+    if (!executed.first) {
+        return executed.second;
+    }
+    while (true) {
+        auto next = executed.first->ReadNext();
+        if (!next.second.empty()) {
+            return next.second;
+        }
+        if (!next.first) {
+            return "";
+        }
+    }
+}
+
+std::pair<std::unique_ptr<SnowflakeResultStream>, string>
+SnowflakeADBCConnector::ExecuteQuery(const std::string &sql) {
+    if (!connected_) {
+        return {nullptr, "Not connected to Snowflake"};
+    }
+
+    std::lock_guard<std::mutex> guard(adbc_lock_);
+    AdbcStatement statement;
+    std::memset(&statement, 0, sizeof(statement));
+    if (AdbcStatementNew(&adbc_connection_, &statement, &adbc_error_) != ADBC_STATUS_OK) {
+        return {nullptr, FormatADBCError("StatementNew")};
+    }
+
+    ArrowArrayStream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    int64_t rows_affected = -1;
+    if (AdbcStatementSetSqlQuery(&statement, sql.c_str(), &adbc_error_) != ADBC_STATUS_OK ||
+        AdbcStatementExecuteQuery(&statement, &stream, &rows_affected, &adbc_error_) != ADBC_STATUS_OK) {
+        auto error = FormatADBCError("ExecuteQuery");
+        ReleaseStatement(statement);
+        return {nullptr, error};
+    }
+
+    // Importing only wraps the stream; batches are pulled lazily by ReadNext
+    auto reader = arrow::ImportRecordBatchReader(&stream);
+    if (!reader.ok()) {
+        if (stream.release) {
+            stream.release(&stream);
+        }
+        ReleaseStatement(statement);
+        return {nullptr, "Error importing result stream: " + reader.status().ToString()};
+    }
+    return {std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(statement, *reader)), ""};
+}
+
+std::pair<std::unique_ptr<SnowflakePartitions>, string>
+SnowflakeADBCConnector::ExecutePartitions(const std::string &sql) {
+    if (!connected_) {
+        return {nullptr, "Not connected to Snowflake"};
+    }
+
+    std::lock_guard<std::mutex> guard(adbc_lock_);
+    AdbcStatement statement;
+    std::memset(&statement, 0, sizeof(statement));
+    if (AdbcStatementNew(&adbc_connection_, &statement, &adbc_error_) != ADBC_STATUS_OK) {
+        return {nullptr, FormatADBCError("StatementNew")};
+    }
+
+    ArrowSchema schema;
+    std::memset(&schema, 0, sizeof(schema));
+    AdbcPartitions partitions;
+    std::memset(&partitions, 0, sizeof(partitions));
+    int64_t rows_affected = -1;
+    auto status = AdbcStatementSetSqlQuery(&statement, sql.c_str(), &adbc_error_);
+    if (status == ADBC_STATUS_OK) {
+        status = AdbcStatementExecutePartitions(&statement, &schema, &partitions, &rows_affected, &adbc_error_);
+    }
+    if (status != ADBC_STATUS_OK) {
+        if (status == ADBC_STATUS_NOT_IMPLEMENTED) {
+            supports_partitions_ = false;
+        }
+        auto error = FormatADBCError("ExecutePartitions");
+        ReleaseStatement(statement);
+        return {nullptr, error};
+    }
+
+    // Descriptors are copied, so the statement is not needed to read them
+    auto result = std::unique_ptr<SnowflakePartitions>(new SnowflakePartitions());
+    result->descriptors.reserve(partitions.num_partitions);
+    for (size_t i = 0; i < partitions.num_partitions; i++) {
+        result->descriptors.emplace_back(reinterpret_cast<const char *>(partitions.partitions[i]),
+                                         partitions.partition_lengths[i]);
+    }
+    if (partitions.release) {
+        partitions.release(&partitions);
+    }
+    ReleaseStatement(statement);
+
+    auto imported = arrow::ImportSchema(&schema);
+    if (!imported.ok()) {
+        return {nullptr, "Error importing result schema: " + imported.status().ToString()};
+    }
+    result->schema = *imported;
+    return {std::move(result), ""};
+}
+
+std::pair<std::unique_ptr<SnowflakeResultStream>, string>
+SnowflakeADBCConnector::ReadPartition(const std::string &descriptor) {
+    if (!connected_) {
+        return {nullptr, "Not connected to Snowflake"};
+    }
+
+    ArrowArrayStream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    {
+        // Only opening the partition needs the connection; its batches are
+        // fetched by the stream without holding the lock
+        std::lock_guard<std::mutex> guard(adbc_lock_);
+        if (AdbcConnectionReadPartition(&adbc_connection_, reinterpret_cast<const uint8_t *>(descriptor.data()),
+                                        descriptor.size(), &stream, &adbc_error_) != ADBC_STATUS_OK) {
+            return {nullptr, FormatADBCError("ReadPartition")};
+        }
+    }
+
+    auto reader = arrow::ImportRecordBatchReader(&stream);
+    if (!reader.ok()) {
+        if (stream.release) {
+            stream.release(&stream);
+        }
+        return {nullptr, "Error importing partition stream: " + reader.status().ToString()};
+    }
+    return {std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(*reader)), ""};
+}
+
+string SnowflakeADBCConnector::InsertBatch(const std::string &table_name,
+                                           const std::shared_ptr<arrow::RecordBatch> &batch) {
+    auto reader = arrow::RecordBatchReader::Make({batch});
+    if (!reader.ok()) {
+        return "Error wrapping batch: " + reader.status().ToString();
+    }
+    return IngestStream(table_name, SnowflakeIngestMode::APPEND, *reader).second;
+}
+
+std::pair<int64_t, string>
+SnowflakeADBCConnector::IngestStream(const std::string &table_name, SnowflakeIngestMode mode,
+                                     std::shared_ptr<arrow::RecordBatchReader> reader,
+                                     const std::string &db_schema) {
     if (!connected_) {
-        return "Not connected to Snowflake";
+        return {-1, "Not connected to Snowflake"};
+    }
+
+    ArrowArrayStream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    auto exported = arrow::ExportRecordBatchReader(std::move(reader), &stream);
+    if (!exported.ok()) {
+        return {-1, "Error exporting ingest stream: " + exported.ToString()};
     }
-    
-    // TODO: Implement query execution using ADBC
-    return "Query execution not yet implemented";
+
+    std::lock_guard<std::mutex> guard(adbc_lock_);
+    AdbcStatement statement;
+    std::memset(&statement, 0, sizeof(statement));
+    if (AdbcStatementNew(&adbc_connection_, &statement, &adbc_error_) != ADBC_STATUS_OK) {
+        stream.release(&stream);
+        return {-1, FormatADBCError("StatementNew")};
+    }
+
+    // The statement takes ownership of the stream once bound
+    int64_t rows_affected = -1;
+    if (AdbcStatementSetOption(&statement, ADBC_INGEST_OPTION_TARGET_TABLE, table_name.c_str(), &adbc_error_) !=
+            ADBC_STATUS_OK ||
+        AdbcStatementSetOption(&statement, ADBC_INGEST_OPTION_MODE, IngestModeOption(mode), &adbc_error_) !=
+            ADBC_STATUS_OK ||
+        (!db_schema.empty() && AdbcStatementSetOption(&statement, ADBC_INGEST_OPTION_TARGET_DB_SCHEMA,
+                                                      db_schema.c_str(), &adbc_error_) != ADBC_STATUS_OK) ||
+        AdbcStatementBindStream(&statement, &stream, &adbc_error_) != ADBC_STATUS_OK ||
+        AdbcStatementExecuteQuery(&statement, nullptr, &rows_affected, &adbc_error_) != ADBC_STATUS_OK) {
+        auto error = FormatADBCError("Ingest");
+        if (stream.release) {
+            stream.release(&stream);
+        }
+        ReleaseStatement(statement);
+        return {-1, error};
+    }
+    ReleaseStatement(statement);
+    return {rows_affected, ""};
+}
+
+std::pair<std::shared_ptr<arrow::Schema>, string>
+SnowflakeADBCConnector::GetTableSchema(const std::string &table_name) {
+    if (!connected_) {
+        return {nullptr, "Not connected to Snowflake"};
+    }
+
+    std::lock_guard<std::mutex> guard(adbc_lock_);
+    ArrowSchema schema;
+    std::memset(&schema, 0, sizeof(schema));
+    auto db_schema = config_.schema.empty() ? nullptr : config_.schema.c_str();
+    if (AdbcConnectionGetTableSchema(&adbc_connection_, config_.database.c_str(), db_schema, table_name.c_str(),
+                                     &schema, &adbc_error_) != ADBC_STATUS_OK) {
+        return {nullptr, FormatADBCError("GetTableSchema")};
+    }
+    auto imported = arrow::ImportSchema(&schema);
+    if (!imported.ok()) {
+        return {nullptr, "Error importing table schema: " + imported.status().ToString()};
+    }
+    return {*imported, ""};
 }
 
 string SnowflakeADBCConnector::InitializeDatabase() {
-    // TODO: Initialize ADBC database with Snowflake driver
+    if (AdbcDatabaseNew(&adbc_database_, &adbc_error_) != ADBC_STATUS_OK) {
+        return FormatADBCError("DatabaseNew");
+    }
+    if (AdbcDatabaseSetOption(&adbc_database_, "driver", config_.driver.c_str(), &adbc_error_) != ADBC_STATUS_OK ||
+        AdbcDatabaseSetOption(&adbc_database_, "uri", config_.BuildURI().c_str(), &adbc_error_) != ADBC_STATUS_OK) {
+        return FormatADBCError("DatabaseSetOption");
+    }
+    if (AdbcDatabaseInit(&adbc_database_, &adbc_error_) != ADBC_STATUS_OK) {
+        return FormatADBCError("DatabaseInit");
+    }
     return "";
 }
 
 string SnowflakeADBCConnector::InitializeConnection() {
-    // TODO: Initialize ADBC connection
+    if (AdbcConnectionNew(&adbc_connection_, &adbc_error_) != ADBC_STATUS_OK) {
+        return FormatADBCError("ConnectionNew");
+    }
+    if (AdbcConnectionInit(&adbc_connection_, &adbc_database_, &adbc_error_) != ADBC_STATUS_OK) {
+        return FormatADBCError("ConnectionInit");
+    }
     return "";
 }
 
 void SnowflakeADBCConnector::Cleanup() {
-    // TODO: Clean up ADBC resources
+    if (adbc_connection_.private_data) {
+        AdbcConnectionRelease(&adbc_connection_, &adbc_error_);
+    }
+    if (adbc_database_.private_data) {
+        AdbcDatabaseRelease(&adbc_database_, &adbc_error_);
+    }
+    if (adbc_error_.release) {
+        adbc_error_.release(&adbc_error_);
+    }
+    std::memset(&adbc_error_, 0, sizeof(adbc_error_));
+    std::memset(&adbc_database_, 0, sizeof(adbc_database_));
+    std::memset(&adbc_connection_, 0, sizeof(adbc_connection_));
 }
 
-string SnowflakeADBCConnector::FormatADBCError(const std::string &operation) const {
-    return StringUtil::Format("ADBC Error in %s: %s", operation.c_str(), adbc_error_.message);
+string SnowflakeADBCConnector::FormatADBCError(const std::string &operation) {
+    auto message = StringUtil::Format("ADBC Error in %s: %s", operation.c_str(),
+                                      adbc_error_.message ? adbc_error_.message : "unknown error");
+    if (adbc_error_.release) {
+        adbc_error_.release(&adbc_error_);
+    }
+    std::memset(&adbc_error_, 0, sizeof(adbc_error_));
+    return message;
 }
 
 } // namespace duckdb 
\ No newline at end of file
@@ -0,0 +1,1004 @@
+#include "include/arrow_data_converter.hpp"
+#include "include/snowflake_conversion_arena.hpp"
+#include "include/snowflake_metrics.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include <arrow/buffer.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace duckdb {
+
+namespace {
+
+using ArrayDataPtr = std::shared_ptr<arrow::ArrayData>;
+using BufferPtr = std::shared_ptr<arrow::Buffer>;
+
+/**
+ * @brief Arrow buffer aliasing memory owned by a DuckDB vector
+ */
+class VectorBackedBuffer : public arrow::Buffer {
+public:
+    VectorBackedBuffer(const uint8_t* data, int64_t size, buffer_ptr<VectorBuffer> owner)
+        : arrow::Buffer(data, size), owner_(std::move(owner)) {
+    }
+
+private:
+    buffer_ptr<VectorBuffer> owner_;
+};
+
+inline int64_t BitmapBytes(idx_t count) {
+    return static_cast<int64_t>((count + 63) / 64 * sizeof(validity_t));
+}
+
+arrow::Result<BufferPtr> AllocateZeroed(int64_t size, arrow::MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(size, pool));
+    std::memset(buffer->mutable_data(), 0, static_cast<size_t>(size));
+    return BufferPtr(std::move(buffer));
+}
+
+arrow::Result<BufferPtr> Allocate(int64_t size, arrow::MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(size, pool));
+    return BufferPtr(std::move(buffer));
+}
+
+// ===== VALIDITY =====
+
+/**
+ * @brief Build the Arrow validity bitmap for any vector type
+ *
+ * Nulls are counted before anything is allocated; a vector that merely
+ * carries a mask without null rows gets no bitmap.
+ *
+ * @param null_count Receives the number of null rows
+ * @return Bitmap, or nullptr when every row is valid
+ */
+arrow::Result<BufferPtr> ConvertValidity(Vector& vector, idx_t count, arrow::MemoryPool* pool, int64_t& null_count) {
+    null_count = 0;
+    switch (vector.GetVectorType()) {
+        case VectorType::FLAT_VECTOR: {
+            auto& validity = FlatVector::Validity(vector);
+            if (validity.AllValid() || validity.CountValid(count) == count) {
+                return BufferPtr();
+            }
+            ARROW_ASSIGN_OR_RAISE(auto bitmap, Allocate(BitmapBytes(count), pool));
+            null_count = DuckDBToArrowConverter::CopyValidity(validity.GetData(), count, bitmap->mutable_data());
+            return bitmap;
+        }
+        case VectorType::CONSTANT_VECTOR: {
+            if (!ConstantVector::IsNull(vector)) {
+                return BufferPtr();
+            }
+            null_count = static_cast<int64_t>(count);
+            return AllocateZeroed(BitmapBytes(count), pool);
+        }
+        default:
+            break;
+    }
+
+    // DICTIONARY and everything else: gather validity through the selection
+    UnifiedVectorFormat format;
+    vector.ToUnifiedFormat(count, format);
+    if (format.validity.AllValid()) {
+        return BufferPtr();
+    }
+    // Gathered into scratch first: a selection over a masked vector often picks no null row
+    auto words = SnowflakeConversionArena::Get().AllocateArray<validity_t>((count + 63) / 64);
+    int64_t valid_count = 0;
+    for (idx_t base = 0; base < count; base += 64) {
+        auto limit = MinValue<idx_t>(64, count - base);
+        validity_t word = 0;
+        for (idx_t bit = 0; bit < limit; bit++) {
+            auto source_idx = format.sel->get_index(base + bit);
+            word |= static_cast<validity_t>(format.validity.RowIsValid(source_idx)) << bit;
+        }
+        words[base / 64] = word;
+        valid_count += __builtin_popcountll(word);
+    }
+    null_count = static_cast<int64_t>(count) - valid_count;
+    if (null_count == 0) {
+        return BufferPtr();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, Allocate(BitmapBytes(count), pool));
+    std::memcpy(bitmap->mutable_data(), words, static_cast<size_t>(BitmapBytes(count)));
+    return bitmap;
+}
+
+// ===== FIXED-WIDTH VALUES =====
+
+struct IdentityOp {
+    template<typename T>
+    static inline T Operation(T value) {
+        return value;
+    }
+};
+
+/**
+ * @brief Widen DuckDB decimal storage into Arrow's little-endian decimal128
+ */
+struct Decimal128Op {
+    template<typename T>
+    static inline hugeint_t Operation(T value) {
+        hugeint_t result;
+        result.lower = static_cast<uint64_t>(static_cast<int64_t>(value));
+        result.upper = value < 0 ? -1 : 0;
+        return result;
+    }
+};
+
+template<>
+inline hugeint_t Decimal128Op::Operation(hugeint_t value) {
+    return value;
+}
+
+/**
+ * @brief Convert fixed-width values, specialized per vector type
+ *
+ * FLAT vectors whose source and target layouts match are wrapped without
+ * copying when zero-copy is enabled.
+ */
+template<typename SRC, typename DST, typename OP>
+arrow::Result<BufferPtr> ConvertFixedWidthValues(Vector& vector, idx_t count, const ArrowConversionOptions& options) {
+    constexpr bool SAME_LAYOUT = std::is_same<SRC, DST>::value;
+    switch (vector.GetVectorType()) {
+        case VectorType::FLAT_VECTOR: {
+            auto source = FlatVector::GetData<SRC>(vector);
+            if (SAME_LAYOUT && options.zero_copy) {
+                return BufferPtr(std::make_shared<VectorBackedBuffer>(
+                    reinterpret_cast<const uint8_t*>(source), static_cast<int64_t>(count * sizeof(DST)),
+                    vector.GetBuffer()));
+            }
+            ARROW_ASSIGN_OR_RAISE(auto buffer, Allocate(static_cast<int64_t>(count * sizeof(DST)), options.pool));
+            auto target = reinterpret_cast<DST*>(buffer->mutable_data());
+            if (SAME_LAYOUT) {
+                std::memcpy(target, source, count * sizeof(DST));
+            } else {
+                for (idx_t i = 0; i < count; i++) {
+                    target[i] = OP::template Operation<SRC>(source[i]);
+                }
+            }
+            return buffer;
+        }
+        case VectorType::CONSTANT_VECTOR: {
+            ARROW_ASSIGN_OR_RAISE(auto buffer, Allocate(static_cast<int64_t>(count * sizeof(DST)), options.pool));
+            auto target = reinterpret_cast<DST*>(buffer->mutable_data());
+            auto value = OP::template Operation<SRC>(*ConstantVector::GetData<SRC>(vector));
+            std::fill(target, target + count, value);
+            return buffer;
+        }
+        case VectorType::DICTIONARY_VECTOR: {
+            auto& child = DictionaryVector::Child(vector);
+            if (child.GetVectorType() == VectorType::FLAT_VECTOR) {
+                auto& sel = DictionaryVector::SelVector(vector);
+                auto source = FlatVector::GetData<SRC>(child);
+                ARROW_ASSIGN_OR_RAISE(auto buffer, Allocate(static_cast<int64_t>(count * sizeof(DST)), options.pool));
+                auto target = reinterpret_cast<DST*>(buffer->mutable_data());
+                for (idx_t i = 0; i < count; i++) {
+                    target[i] = OP::template Operation<SRC>(source[sel.get_index(i)]);
+                }
+                return buffer;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    UnifiedVectorFormat format;
+    vector.ToUnifiedFormat(count, format);
+    auto source = UnifiedVectorFormat::GetData<SRC>(format);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, Allocate(static_cast<int64_t>(count * sizeof(DST)), options.pool));
+    auto target = reinterpret_cast<DST*>(buffer->mutable_data());
+    for (idx_t i = 0; i < count; i++) {
+        target[i] = OP::template Operation<SRC>(source[format.sel->get_index(i)]);
+    }
+    return buffer;
+}
+
+template<typename SRC, typename DST, typename OP>
+arrow::Result<ArrayDataPtr> ConvertFixedWidth(Vector& vector, idx_t count,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    ARROW_ASSIGN_OR_RAISE(auto values, (ConvertFixedWidthValues<SRC, DST, OP>(vector, count, options)));
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), {std::move(validity), std::move(values)},
+                                  null_count);
+}
+
+// ===== BOOLEAN =====
+
+arrow::Result<ArrayDataPtr> ConvertBoolean(Vector& vector, idx_t count,
+                                           const std::shared_ptr<arrow::DataType>& arrow_type,
+                                           const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    ARROW_ASSIGN_OR_RAISE(auto values, Allocate(BitmapBytes(count), options.pool));
+    auto target = values->mutable_data();
+
+    switch (vector.GetVectorType()) {
+        case VectorType::FLAT_VECTOR:
+            DuckDBToArrowConverter::PackBooleans(reinterpret_cast<const uint8_t*>(FlatVector::GetData<bool>(vector)),
+                                                 count, target);
+            break;
+        case VectorType::CONSTANT_VECTOR:
+            std::memset(target, *ConstantVector::GetData<bool>(vector) ? 0xFF : 0x00,
+                        static_cast<size_t>(BitmapBytes(count)));
+            break;
+        default: {
+            UnifiedVectorFormat format;
+            vector.ToUnifiedFormat(count, format);
+            auto source = UnifiedVectorFormat::GetData<bool>(format);
+            auto words = reinterpret_cast<uint64_t*>(target);
+            for (idx_t base = 0; base < count; base += 64) {
+                auto limit = MinValue<idx_t>(64, count - base);
+                uint64_t word = 0;
+                for (idx_t bit = 0; bit < limit; bit++) {
+                    word |= static_cast<uint64_t>(source[format.sel->get_index(base + bit)]) << bit;
+                }
+                words[base / 64] = word;
+            }
+            break;
+        }
+    }
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), {std::move(validity), std::move(values)},
+                                  null_count);
+}
+
+// ===== VARIABLE-WIDTH =====
+
+/**
+ * @brief utf8 / binary / large_utf8 / large_binary: offsets plus one copied payload buffer
+ */
+template<typename OFFSET>
+arrow::Result<ArrayDataPtr> ConvertStringOffsets(Vector& vector, idx_t count,
+                                                 const std::shared_ptr<arrow::DataType>& arrow_type,
+                                                 const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+
+    UnifiedVectorFormat format;
+    vector.ToUnifiedFormat(count, format);
+    auto strings = UnifiedVectorFormat::GetData<string_t>(format);
+
+    // Pass 1: offsets (null rows contribute zero bytes)
+    ARROW_ASSIGN_OR_RAISE(auto offsets, Allocate(static_cast<int64_t>((count + 1) * sizeof(OFFSET)), options.pool));
+    auto offset_data = reinterpret_cast<OFFSET*>(offsets->mutable_data());
+    uint64_t total_size = 0;
+    offset_data[0] = 0;
+    for (idx_t i = 0; i < count; i++) {
+        auto idx = format.sel->get_index(i);
+        if (format.validity.RowIsValid(idx)) {
+            total_size += strings[idx].GetSize();
+            if (total_size > static_cast<uint64_t>(std::numeric_limits<OFFSET>::max())) {
+                return arrow::Status::CapacityError("String column exceeds 2GB in a single batch");
+            }
+        }
+        offset_data[i + 1] = static_cast<OFFSET>(total_size);
+    }
+
+    // Pass 2: payload
+    ARROW_ASSIGN_OR_RAISE(auto data, Allocate(static_cast<int64_t>(total_size), options.pool));
+    auto target = data->mutable_data();
+    for (idx_t i = 0; i < count; i++) {
+        auto idx = format.sel->get_index(i);
+        auto length = static_cast<idx_t>(offset_data[i + 1] - offset_data[i]);
+        if (length > 0) {
+            std::memcpy(target + offset_data[i], strings[idx].GetData(), length);
+        }
+    }
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count),
+                                  {std::move(validity), std::move(offsets), std::move(data)}, null_count);
+}
+
+/**
+ * @brief Vector whose string heap owns the strings a vector's rows point to
+ */
+Vector& StringOwner(Vector& vector) {
+    auto owner = &vector;
+    while (owner->GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+        owner = &DictionaryVector::Child(*owner);
+    }
+    return *owner;
+}
+
+/**
+ * @brief Contiguous run of out-of-line strings, wrapped as one variadic buffer
+ */
+struct StringRegion {
+    const char* begin;
+    const char* end;
+};
+
+// Past this many regions the heap is too fragmented to be worth aliasing
+constexpr size_t MAX_ALIASED_REGIONS = 64;
+constexpr uint64_t MAX_VIEW_BUFFER_SIZE = static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+
+/**
+ * @brief string_view / binary_view arrays over DuckDB's string heap
+ *
+ * string_t and Arrow's BinaryView are both 16 bytes with the same inline
+ * layout for strings of up to 12 bytes, so those views are a straight copy.
+ * Out-of-line strings keep their bytes where they are: DuckDB's heap hands
+ * out consecutive allocations, so runs of adjacent strings are wrapped (with
+ * zero-copy enabled) as variadic buffers that keep the heap alive. A heap too
+ * fragmented for that is copied into data buffers of at most 2GB.
+ */
+arrow::Result<ArrayDataPtr> ConvertStringView(Vector& vector, idx_t count,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              const ArrowConversionOptions& options) {
+    using View = arrow::BinaryViewType::c_type;
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+
+    UnifiedVectorFormat format;
+    vector.ToUnifiedFormat(count, format);
+    auto strings = UnifiedVectorFormat::GetData<string_t>(format);
+    // Zeroed: null rows are empty views and inline padding must be zero
+    ARROW_ASSIGN_OR_RAISE(auto views, AllocateZeroed(static_cast<int64_t>(count * sizeof(View)), options.pool));
+    auto view_data = reinterpret_cast<View*>(views->mutable_data());
+
+    // Pass 1: inline views, prefixes, and regions when aliasing
+    StringRegion regions[MAX_ALIASED_REGIONS];
+    size_t region_count = 0;
+    auto owner = StringOwner(vector).GetAuxiliary();
+    bool aliased = options.zero_copy && owner;
+    uint64_t out_of_line_size = 0;
+    for (idx_t i = 0; i < count; i++) {
+        auto idx = format.sel->get_index(i);
+        if (!format.validity.RowIsValid(idx)) {
+            continue;
+        }
+        auto& source = strings[idx];
+        auto length = source.GetSize();
+        if (length > MAX_VIEW_BUFFER_SIZE) {
+            return arrow::Status::CapacityError("String of " + std::to_string(length) + " bytes exceeds 2GB");
+        }
+        auto data = source.GetData();
+        auto& view = view_data[i];
+        view.inlined.size = static_cast<int32_t>(length);
+        if (length <= static_cast<idx_t>(arrow::BinaryViewType::kInlineSize)) {
+            std::memcpy(view.inlined.data.data(), data, length);
+            continue;
+        }
+        std::memcpy(view.ref.prefix.data(), data, arrow::BinaryViewType::kPrefixSize);
+        out_of_line_size += length;
+        if (!aliased) {
+            continue;
+        }
+        auto end = data + length;
+        auto current = region_count == 0 ? nullptr : &regions[region_count - 1];
+        if (current && data >= current->begin && end <= current->end) {
+            // Repeated or overlapping string inside the current run
+        } else if (current && data == current->end &&
+                   static_cast<uint64_t>(end - current->begin) <= MAX_VIEW_BUFFER_SIZE) {
+            current->end = end;
+        } else if (region_count < MAX_ALIASED_REGIONS) {
+            regions[region_count++] = StringRegion {data, end};
+        } else {
+            aliased = false;
+            continue;
+        }
+        view.ref.buffer_index = static_cast<int32_t>(region_count - 1);
+        view.ref.offset = static_cast<int32_t>(data - regions[region_count - 1].begin);
+    }
+
+    std::vector<BufferPtr> buffers {std::move(validity), std::move(views)};
+    if (aliased) {
+        for (size_t r = 0; r < region_count; r++) {
+            auto& region = regions[r];
+            buffers.push_back(std::make_shared<VectorBackedBuffer>(reinterpret_cast<const uint8_t*>(region.begin),
+                                                                   static_cast<int64_t>(region.end - region.begin),
+                                                                   owner));
+        }
+    } else if (out_of_line_size > 0) {
+        // Pass 2: copy out-of-line strings, starting a new buffer whenever the current one would pass 2GB.
+        // Any two consecutive buffers hold more than 2GB, which bounds how many there can be.
+        auto& arena = SnowflakeConversionArena::Get();
+        auto max_buffers = static_cast<idx_t>(2 * out_of_line_size / MAX_VIEW_BUFFER_SIZE + 1);
+        auto sizes = arena.AllocateArray<uint64_t>(max_buffers);
+        idx_t buffer_count = 1;
+        sizes[0] = 0;
+        for (idx_t i = 0; i < count; i++) {
+            auto length = static_cast<uint64_t>(view_data[i].size());
+            if (view_data[i].is_inline()) {
+                continue;
+            }
+            if (sizes[buffer_count - 1] + length > MAX_VIEW_BUFFER_SIZE) {
+                sizes[buffer_count++] = 0;
+            }
+            sizes[buffer_count - 1] += length;
+        }
+        auto targets = arena.AllocateArray<uint8_t*>(buffer_count);
+        for (idx_t b = 0; b < buffer_count; b++) {
+            ARROW_ASSIGN_OR_RAISE(auto buffer, Allocate(static_cast<int64_t>(sizes[b]), options.pool));
+            targets[b] = buffer->mutable_data();
+            buffers.push_back(std::move(buffer));
+        }
+        int32_t buffer_index = 0;
+        uint64_t position = 0;
+        for (idx_t i = 0; i < count; i++) {
+            auto& view = view_data[i];
+            auto length = static_cast<uint64_t>(view.size());
+            if (view.is_inline()) {
+                continue;
+            }
+            if (position + length > MAX_VIEW_BUFFER_SIZE) {
+                buffer_index++;
+                position = 0;
+            }
+            std::memcpy(targets[buffer_index] + position,
+                        strings[format.sel->get_index(i)].GetData(), length);
+            view.ref.buffer_index = buffer_index;
+            view.ref.offset = static_cast<int32_t>(position);
+            position += length;
+        }
+    }
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), std::move(buffers), null_count);
+}
+
+arrow::Result<ArrayDataPtr> ConvertString(Vector& vector, idx_t count,
+                                          const std::shared_ptr<arrow::DataType>& arrow_type,
+                                          const ArrowConversionOptions& options) {
+    switch (arrow_type->id()) {
+        case arrow::Type::STRING:
+        case arrow::Type::BINARY:
+            return ConvertStringOffsets<int32_t>(vector, count, arrow_type, options);
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::LARGE_BINARY:
+            return ConvertStringOffsets<int64_t>(vector, count, arrow_type, options);
+        case arrow::Type::STRING_VIEW:
+        case arrow::Type::BINARY_VIEW:
+            return ConvertStringView(vector, count, arrow_type, options);
+        default:
+            return arrow::Status::NotImplemented("Cannot convert " + vector.GetType().ToString() + " to " +
+                                                 arrow_type->ToString());
+    }
+}
+
+// ===== NESTED =====
+
+arrow::Result<ArrayDataPtr> ConvertVectorData(Vector& vector, idx_t count,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              const ArrowConversionOptions& options);
+
+arrow::Result<ArrayDataPtr> ConvertStruct(Vector& vector, idx_t count,
+                                          const std::shared_ptr<arrow::DataType>& arrow_type,
+                                          const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    auto& entries = StructVector::GetEntries(vector);
+    std::vector<ArrayDataPtr> children;
+    children.reserve(entries.size());
+    for (idx_t i = 0; i < entries.size(); i++) {
+        ARROW_ASSIGN_OR_RAISE(auto child, ConvertVectorData(*entries[i], count,
+                                                            arrow_type->field(static_cast<int>(i))->type(), options));
+        children.push_back(std::move(child));
+    }
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), {std::move(validity)},
+                                  std::move(children), null_count);
+}
+
+/**
+ * @brief LIST and MAP (a LIST of {key, value} structs in both systems)
+ *
+ * DuckDB stores (offset, length) per row into a shared child vector. When the
+ * valid rows' ranges are contiguous, which is how DuckDB builds lists, the
+ * child vector is converted in place (zero-copy for fixed-width children) and
+ * only the int32 offsets are computed. Otherwise the referenced child rows are
+ * gathered through a selection first.
+ */
+arrow::Result<ArrayDataPtr> ConvertList(Vector& vector, idx_t count,
+                                        const std::shared_ptr<arrow::DataType>& arrow_type,
+                                        const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    auto entries = FlatVector::GetData<list_entry_t>(vector);
+    auto& mask = FlatVector::Validity(vector);
+    auto& child = ListVector::GetEntry(vector);
+    auto& child_type = static_cast<const arrow::BaseListType&>(*arrow_type).value_type();
+
+    ARROW_ASSIGN_OR_RAISE(auto offsets, Allocate(static_cast<int64_t>((count + 1) * sizeof(int32_t)), options.pool));
+    auto offset_data = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    idx_t start = 0;
+    for (idx_t i = 0; i < count; i++) {
+        if (mask.RowIsValid(i)) {
+            start = entries[i].offset;
+            break;
+        }
+    }
+    uint64_t total = 0;
+    bool contiguous = true;
+    offset_data[0] = 0;
+    for (idx_t i = 0; i < count; i++) {
+        auto valid = mask.RowIsValid(i);
+        contiguous = contiguous && (!valid || entries[i].offset == start + total);
+        total += valid ? entries[i].length : 0;
+        if (total > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+            return arrow::Status::CapacityError("List column exceeds 2^31 elements in a single batch");
+        }
+        offset_data[i + 1] = static_cast<int32_t>(total);
+    }
+
+    ArrayDataPtr child_data;
+    if (contiguous) {
+        ARROW_ASSIGN_OR_RAISE(child_data, ConvertVectorData(child, start + total, child_type, options));
+        if (start > 0) {
+            child_data = child_data->Slice(static_cast<int64_t>(start), static_cast<int64_t>(total));
+        }
+    } else {
+        // The gathered vector is converted (copied) before returning, so the selection can be scratch
+        SelectionVector sel(SnowflakeConversionArena::Get().AllocateArray<sel_t>(total));
+        idx_t position = 0;
+        for (idx_t i = 0; i < count; i++) {
+            if (!mask.RowIsValid(i)) {
+                continue;
+            }
+            for (idx_t j = 0; j < entries[i].length; j++) {
+                sel.set_index(position++, entries[i].offset + j);
+            }
+        }
+        Vector gathered(child, sel, total);
+        ARROW_ASSIGN_OR_RAISE(child_data, ConvertVectorData(gathered, total, child_type, options));
+    }
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), {std::move(validity), std::move(offsets)},
+                                  {std::move(child_data)}, null_count);
+}
+
+arrow::Result<ArrayDataPtr> ConvertFixedSizeList(Vector& vector, idx_t count,
+                                                 const std::shared_ptr<arrow::DataType>& arrow_type,
+                                                 const ArrowConversionOptions& options) {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    // The child holds exactly count * size rows, already in Arrow's order
+    auto size = ArrayType::GetSize(vector.GetType());
+    auto& child_type = static_cast<const arrow::FixedSizeListType&>(*arrow_type).value_type();
+    ARROW_ASSIGN_OR_RAISE(auto child_data,
+                          ConvertVectorData(ArrayVector::GetEntry(vector), count * size, child_type, options));
+    return arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(count), {std::move(validity)},
+                                  {std::move(child_data)}, null_count);
+}
+
+arrow::Result<ArrayDataPtr> ConvertNested(Vector& vector, idx_t count,
+                                          const std::shared_ptr<arrow::DataType>& arrow_type,
+                                          const ArrowConversionOptions& options) {
+    if (vector.GetVectorType() != VectorType::FLAT_VECTOR) {
+        // Nested kernels read FLAT layouts; other vector types are materialized once
+        Vector flat(vector.GetType(), count);
+        VectorOperations::Copy(vector, flat, count, 0, 0);
+        return ConvertNested(flat, count, arrow_type, options);
+    }
+    switch (vector.GetType().id()) {
+        case LogicalTypeId::STRUCT:
+            return ConvertStruct(vector, count, arrow_type, options);
+        case LogicalTypeId::LIST:
+        case LogicalTypeId::MAP:
+            return ConvertList(vector, count, arrow_type, options);
+        case LogicalTypeId::ARRAY:
+            return ConvertFixedSizeList(vector, count, arrow_type, options);
+        default:
+            return arrow::Status::NotImplemented("No nested kernel for " + vector.GetType().ToString());
+    }
+}
+
+// ===== DISPATCH =====
+
+arrow::Result<ArrayDataPtr> ConvertDecimal(Vector& vector, idx_t count,
+                                           const std::shared_ptr<arrow::DataType>& arrow_type,
+                                           const ArrowConversionOptions& options) {
+    switch (vector.GetType().InternalType()) {
+        case PhysicalType::INT16:
+            return ConvertFixedWidth<int16_t, hugeint_t, Decimal128Op>(vector, count, arrow_type, options);
+        case PhysicalType::INT32:
+            return ConvertFixedWidth<int32_t, hugeint_t, Decimal128Op>(vector, count, arrow_type, options);
+        case PhysicalType::INT64:
+            return ConvertFixedWidth<int64_t, hugeint_t, Decimal128Op>(vector, count, arrow_type, options);
+        case PhysicalType::INT128:
+            // hugeint_t is {lower, upper}: already Arrow's decimal128 layout
+            return ConvertFixedWidth<hugeint_t, hugeint_t, Decimal128Op>(vector, count, arrow_type, options);
+        default:
+            return arrow::Status::NotImplemented("Unsupported decimal storage type");
+    }
+}
+
+arrow::Result<ArrayDataPtr> ConvertVectorData(Vector& vector, idx_t count,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              const ArrowConversionOptions& options) {
+    switch (vector.GetType().id()) {
+        case LogicalTypeId::BOOLEAN:
+            return ConvertBoolean(vector, count, arrow_type, options);
+        case LogicalTypeId::TINYINT:
+            return ConvertFixedWidth<int8_t, int8_t, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::SMALLINT:
+            return ConvertFixedWidth<int16_t, int16_t, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::DATE:
+            // date_t is int32 days since epoch, identical to date32
+            return ConvertFixedWidth<int32_t, int32_t, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::BIGINT:
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+            // dtime_t / timestamp_t are int64 in the unit of their type, identical to time64 / timestamp
+            return ConvertFixedWidth<int64_t, int64_t, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::FLOAT:
+            return ConvertFixedWidth<float, float, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::DOUBLE:
+            return ConvertFixedWidth<double, double, IdentityOp>(vector, count, arrow_type, options);
+        case LogicalTypeId::VARCHAR:
+        case LogicalTypeId::BLOB:
+            return ConvertString(vector, count, arrow_type, options);
+        case LogicalTypeId::DECIMAL:
+            return ConvertDecimal(vector, count, arrow_type, options);
+        case LogicalTypeId::STRUCT:
+        case LogicalTypeId::LIST:
+        case LogicalTypeId::MAP:
+        case LogicalTypeId::ARRAY:
+            return ConvertNested(vector, count, arrow_type, options);
+        default:
+            return arrow::Status::NotImplemented("No data conversion kernel for " + vector.GetType().ToString());
+    }
+}
+
+// ===== STRING ENCODINGS =====
+
+bool IsStringType(const LogicalType& type) {
+    return type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB;
+}
+
+/**
+ * @brief utf8 or binary for any offset or view encoding of them, nullptr for other types
+ */
+std::shared_ptr<arrow::DataType> PlainStringType(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::STRING:
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::STRING_VIEW:
+            return arrow::utf8();
+        case arrow::Type::BINARY:
+        case arrow::Type::LARGE_BINARY:
+        case arrow::Type::BINARY_VIEW:
+            return arrow::binary();
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief 64-bit offset variant of utf8 / binary, nullptr for other types
+ */
+std::shared_ptr<arrow::DataType> LargeStringType(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::STRING:
+            return arrow::large_utf8();
+        case arrow::Type::BINARY:
+            return arrow::large_binary();
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief View variant of utf8 / binary, nullptr for other types
+ */
+std::shared_ptr<arrow::DataType> StringViewType(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::STRING:
+            return arrow::utf8_view();
+        case arrow::Type::BINARY:
+            return arrow::binary_view();
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Convert a top-level column, retrying utf8 / binary as large_utf8 / large_binary past 2GB
+ */
+arrow::Result<ArrayDataPtr> ConvertColumnData(Vector& vector, idx_t count,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              const ArrowConversionOptions& options) {
+    auto data = ConvertVectorData(vector, count, arrow_type, options);
+    auto large_type = LargeStringType(*arrow_type);
+    if (!data.ok() && data.status().IsCapacityError() && large_type) {
+        return ConvertVectorData(vector, count, large_type, options);
+    }
+    return data;
+}
+
+/**
+ * @brief Column of ConvertChunk whose schema field is a large or view string type
+ */
+DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>
+ConvertStringColumn(Vector& vector, idx_t count, const std::shared_ptr<arrow::DataType>& string_type,
+                    const ArrowConversionOptions& options) {
+    using Result = DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>;
+    auto value_type = SnowflakeTypeConverter::ConvertDuckDBToArrow(vector.GetType());
+    if (!IsStringType(vector.GetType()) || !value_type.IsValid() ||
+        !value_type.GetValue()->Equals(*PlainStringType(*string_type))) {
+        return Result::Error("Cannot convert " + vector.GetType().ToString() + " to " + string_type->ToString());
+    }
+    auto data = ConvertVectorData(vector, count, string_type, options);
+    if (!data.ok()) {
+        return Result::Error(data.status().ToString());
+    }
+    return Result::Success(arrow::MakeArray(data.MoveValueUnsafe()));
+}
+
+/**
+ * @brief Same schema with every utf8 / binary field replaced by `encode(type)`
+ */
+template<typename ENCODE>
+std::shared_ptr<arrow::Schema> EncodeStringFields(const std::shared_ptr<arrow::Schema>& schema, ENCODE encode) {
+    arrow::FieldVector fields;
+    fields.reserve(static_cast<size_t>(schema->num_fields()));
+    for (auto& field : schema->fields()) {
+        switch (field->type()->id()) {
+            case arrow::Type::STRING:
+            case arrow::Type::BINARY:
+                fields.push_back(field->WithType(encode(field->type())));
+                break;
+            default:
+                fields.push_back(field);
+                break;
+        }
+    }
+    return arrow::schema(std::move(fields), schema->metadata());
+}
+
+// ===== DICTIONARY ENCODING =====
+
+
+/**
+ * @brief Encode a VARCHAR / BLOB vector as an Arrow dictionary<int32, T> array
+ *
+ * A DICTIONARY vector over FLAT entries keeps its dictionary when its rows
+ * reference no more entries than there are rows: those entries are converted
+ * once and the selection is copied into the indices. Otherwise (including
+ * dictionaries far larger than the slice, e.g. from storage compression) the
+ * rows are hash-encoded, so the Arrow dictionary holds each distinct value once.
+ */
+arrow::Result<ArrayDataPtr> ConvertDictionaryEncoded(Vector& vector, idx_t count,
+                                                     const std::shared_ptr<arrow::DataType>& dictionary_type,
+                                                     const ArrowConversionOptions& options) {
+    auto& type = static_cast<const arrow::DictionaryType&>(*dictionary_type);
+    if (type.index_type()->id() != arrow::Type::INT32) {
+        return arrow::Status::NotImplemented("Dictionary indices must be int32, not " + type.index_type()->ToString());
+    }
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ConvertValidity(vector, count, options.pool, null_count));
+    ARROW_ASSIGN_OR_RAISE(auto indices, Allocate(static_cast<int64_t>(count * sizeof(int32_t)), options.pool));
+    auto index_data = reinterpret_cast<int32_t*>(indices->mutable_data());
+
+    ArrayDataPtr values;
+    if (vector.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+        DictionaryVector::Child(vector).GetVectorType() == VectorType::FLAT_VECTOR) {
+        auto& sel = DictionaryVector::SelVector(vector);
+        idx_t entries = 0;
+        for (idx_t i = 0; i < count; i++) {
+            auto index = sel.get_index(i);
+            index_data[i] = static_cast<int32_t>(index);
+            entries = MaxValue<idx_t>(entries, index + 1);
+        }
+        if (entries <= count) {
+            ARROW_ASSIGN_OR_RAISE(values,
+                                  ConvertVectorData(DictionaryVector::Child(vector), entries, type.value_type(), options));
+        }
+    }
+    if (!values) {
+        UnifiedVectorFormat format;
+        vector.ToUnifiedFormat(count, format);
+        auto strings = UnifiedVectorFormat::GetData<string_t>(format);
+        // Open-addressing table of dictionary positions (-1 = empty), at most half full
+        auto& arena = SnowflakeConversionArena::Get();
+        idx_t capacity = 16;
+        while (capacity < count * 2) {
+            capacity <<= 1;
+        }
+        auto mask = capacity - 1;
+        auto slots = arena.AllocateArray<int32_t>(capacity);
+        std::fill(slots, slots + capacity, -1);
+        // Row holding the first occurrence of each distinct value
+        SelectionVector first_rows(arena.AllocateArray<sel_t>(count));
+        idx_t distinct = 0;
+        for (idx_t i = 0; i < count; i++) {
+            auto idx = format.sel->get_index(i);
+            if (!format.validity.RowIsValid(idx)) {
+                index_data[i] = 0;
+                continue;
+            }
+            auto& value = strings[idx];
+            auto slot = Hash(value) & mask;
+            while (slots[slot] >= 0 &&
+                   !(strings[format.sel->get_index(first_rows.get_index(static_cast<idx_t>(slots[slot])))] == value)) {
+                slot = (slot + 1) & mask;
+            }
+            if (slots[slot] < 0) {
+                slots[slot] = static_cast<int32_t>(distinct);
+                first_rows.set_index(distinct++, i);
+            }
+            index_data[i] = slots[slot];
+        }
+        Vector distinct_values(vector, first_rows, distinct);
+        ARROW_ASSIGN_OR_RAISE(values, ConvertVectorData(distinct_values, distinct, type.value_type(), options));
+    }
+
+    auto result = arrow::ArrayData::Make(dictionary_type, static_cast<int64_t>(count),
+                                         {std::move(validity), std::move(indices)}, null_count);
+    result->dictionary = std::move(values);
+    return result;
+}
+
+/**
+ * @brief Column of ConvertChunk whose schema field is dictionary-typed
+ */
+DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>
+ConvertDictionaryColumn(Vector& vector, idx_t count, const std::shared_ptr<arrow::DataType>& dictionary_type,
+                        const ArrowConversionOptions& options) {
+    using Result = DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>;
+    if (!IsStringType(vector.GetType())) {
+        return Result::Error("Dictionary encoding is only supported for VARCHAR and BLOB, not " +
+                             vector.GetType().ToString());
+    }
+    auto value_type = SnowflakeTypeConverter::ConvertDuckDBToArrow(vector.GetType());
+    auto& expected = *static_cast<const arrow::DictionaryType&>(*dictionary_type).value_type();
+    if (!value_type.IsValid() || !value_type.GetValue()->Equals(expected)) {
+        return Result::Error("Cannot dictionary-encode " + vector.GetType().ToString() + " as " +
+                             dictionary_type->ToString());
+    }
+    auto data = ConvertDictionaryEncoded(vector, count, dictionary_type, options);
+    if (!data.ok()) {
+        return Result::Error(data.status().ToString());
+    }
+    return Result::Success(arrow::MakeArray(data.MoveValueUnsafe()));
+}
+
+} // namespace
+
+// ===== VALIDITY KERNELS =====
+
+int64_t DuckDBToArrowConverter::CopyValidity(const validity_t* source, idx_t count, uint8_t* target) {
+    auto words = reinterpret_cast<validity_t*>(target);
+    auto word_count = (count + 63) / 64;
+    if (!source) {
+        std::fill(words, words + word_count, ~validity_t(0));
+        return 0;
+    }
+    // Same LSB-first layout on both sides: copy whole words, count with popcount
+    std::memcpy(words, source, word_count * sizeof(validity_t));
+    int64_t valid_count = 0;
+    auto full_words = count / 64;
+    for (idx_t i = 0; i < full_words; i++) {
+        valid_count += __builtin_popcountll(words[i]);
+    }
+    if (full_words < word_count) {
+        auto tail_mask = (validity_t(1) << (count % 64)) - 1;
+        valid_count += __builtin_popcountll(words[full_words] & tail_mask);
+    }
+    return static_cast<int64_t>(count) - valid_count;
+}
+
+void DuckDBToArrowConverter::PackBooleans(const uint8_t* source, idx_t count, uint8_t* target) {
+    // Eight one-byte booleans → one byte: mask to bit 0 of each byte, then a
+    // single multiply gathers the eight bits into the top byte.
+    constexpr uint64_t LOW_BITS = 0x0101010101010101ULL;
+    constexpr uint64_t GATHER = 0x0102040810204080ULL;
+    auto full_bytes = count / 8;
+    for (idx_t i = 0; i < full_bytes; i++) {
+        uint64_t lanes;
+        std::memcpy(&lanes, source + i * 8, sizeof(lanes));
+        target[i] = static_cast<uint8_t>(((lanes & LOW_BITS) * GATHER) >> 56);
+    }
+    auto remainder = count % 8;
+    if (remainder > 0) {
+        uint8_t last = 0;
+        for (idx_t bit = 0; bit < remainder; bit++) {
+            last |= static_cast<uint8_t>((source[full_bytes * 8 + bit] & 1) << bit);
+        }
+        target[full_bytes] = last;
+    }
+}
+
+// ===== PUBLIC API =====
+
+DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>
+DuckDBToArrowConverter::ConvertVector(Vector& vector, idx_t count, const ArrowConversionOptions& options) {
+    SnowflakeConversionArena::Scope scratch;
+    auto arrow_type = SnowflakeTypeConverter::ConvertDuckDBToArrow(vector.GetType());
+    if (!arrow_type.IsValid()) {
+        return ConversionResult<std::shared_ptr<arrow::Array>>::Error(arrow_type.GetError());
+    }
+    if (options.keep_dictionaries && vector.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+        IsStringType(vector.GetType())) {
+        auto data = ConvertDictionaryEncoded(vector, count, arrow::dictionary(arrow::int32(), arrow_type.GetValue()),
+                                             options);
+        if (!data.ok()) {
+            return ConversionResult<std::shared_ptr<arrow::Array>>::Error(data.status().ToString());
+        }
+        return ConversionResult<std::shared_ptr<arrow::Array>>::Success(arrow::MakeArray(data.MoveValueUnsafe()));
+    }
+    auto column_type = arrow_type.GetValue();
+    if (options.string_views && IsStringType(vector.GetType())) {
+        column_type = StringViewType(*column_type);
+    }
+    auto data = ConvertColumnData(vector, count, column_type, options);
+    if (!data.ok()) {
+        return ConversionResult<std::shared_ptr<arrow::Array>>::Error(data.status().ToString());
+    }
+    return ConversionResult<std::shared_ptr<arrow::Array>>::Success(arrow::MakeArray(data.MoveValueUnsafe()));
+}
+
+DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::RecordBatch>>
+DuckDBToArrowConverter::ConvertChunk(DataChunk& chunk, const std::shared_ptr<arrow::Schema>& schema,
+                                     const ArrowConversionOptions& options) {
+    if (static_cast<idx_t>(schema->num_fields()) != chunk.ColumnCount()) {
+        return ConversionResult<std::shared_ptr<arrow::RecordBatch>>::Error(
+            "Schema has " + std::to_string(schema->num_fields()) + " fields but chunk has " +
+            std::to_string(chunk.ColumnCount()) + " columns");
+    }
+    SnowflakeConversionArena::Scope scratch;
+    auto count = chunk.size();
+    arrow::ArrayVector columns;
+    columns.reserve(chunk.ColumnCount());
+    auto vector_options = options;
+    vector_options.keep_dictionaries = false;
+    vector_options.string_views = false;
+    auto batch_schema = schema;
+    for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
+        auto& field = schema->field(static_cast<int>(col));
+        auto& field_type = field->type();
+        ConversionResult<std::shared_ptr<arrow::Array>> column;
+        SnowflakeScopedTimer timer(options.column_ns ? &options.column_ns[col] : nullptr);
+        if (field_type->id() == arrow::Type::DICTIONARY) {
+            column = ConvertDictionaryColumn(chunk.data[col], count, field_type, options);
+        } else if (PlainStringType(*field_type) && !field_type->Equals(*PlainStringType(*field_type))) {
+            column = ConvertStringColumn(chunk.data[col], count, field_type, options);
+        } else {
+            column = ConvertVector(chunk.data[col], count, vector_options);
+        }
+        if (!column.IsValid()) {
+            return ConversionResult<std::shared_ptr<arrow::RecordBatch>>::Error(
+                "column '" + field->name() + "': " + column.GetError());
+        }
+        auto& column_type = column.GetValue()->type();
+        if (!column_type->Equals(*field_type)) {
+            auto large_type = LargeStringType(*field_type);
+            if (!large_type || !column_type->Equals(*large_type)) {
+                return ConversionResult<std::shared_ptr<arrow::RecordBatch>>::Error(
+                    "column '" + field->name() + "': converted type " + column_type->ToString() +
+                    " does not match schema");
+            }
+            // Past 2GB of strings this batch carries the column as large_utf8 / large_binary
+            auto fallback = batch_schema->SetField(static_cast<int>(col), field->WithType(large_type));
+            if (!fallback.ok()) {
+                return ConversionResult<std::shared_ptr<arrow::RecordBatch>>::Error(fallback.status().ToString());
+            }
+            batch_schema = fallback.MoveValueUnsafe();
+        }
+        columns.push_back(column.GetValue());
+    }
+    return ConversionResult<std::shared_ptr<arrow::RecordBatch>>::Success(
+        arrow::RecordBatch::Make(batch_schema, static_cast<int64_t>(count), std::move(columns)));
+}
+
+std::shared_ptr<arrow::Schema>
+DuckDBToArrowConverter::DictionaryEncodeStrings(const std::shared_ptr<arrow::Schema>& schema) {
+    return EncodeStringFields(schema, [](const std::shared_ptr<arrow::DataType>& type) {
+        return arrow::dictionary(arrow::int32(), type);
+    });
+}
+
+std::shared_ptr<arrow::Schema>
+DuckDBToArrowConverter::ViewEncodeStrings(const std::shared_ptr<arrow::Schema>& schema) {
+    return EncodeStringFields(schema, [](const std::shared_ptr<arrow::DataType>& type) {
+        return StringViewType(*type);
+    });
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,614 @@
+#include "include/conversion_validator.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace duckdb {
+
+namespace {
+
+enum class CanonicalKind : uint8_t { UNSUPPORTED = 0, EXACT, APPROX, TEMPORAL, BOOLEAN, STRING };
+
+// Validity flag for an exact value that overflows the canonical scale
+constexpr uint8_t UNREPRESENTABLE = 2;
+
+CanonicalKind GetCanonicalKind(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::TINYINT:
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+        case LogicalTypeId::HUGEINT:
+        case LogicalTypeId::UTINYINT:
+        case LogicalTypeId::USMALLINT:
+        case LogicalTypeId::UINTEGER:
+        case LogicalTypeId::UBIGINT:
+        case LogicalTypeId::DECIMAL:
+            return CanonicalKind::EXACT;
+        case LogicalTypeId::FLOAT:
+        case LogicalTypeId::DOUBLE:
+            return CanonicalKind::APPROX;
+        case LogicalTypeId::DATE:
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return CanonicalKind::TEMPORAL;
+        case LogicalTypeId::BOOLEAN:
+            return CanonicalKind::BOOLEAN;
+        case LogicalTypeId::VARCHAR:
+        case LogicalTypeId::BLOB:
+            return CanonicalKind::STRING;
+        default:
+            return CanonicalKind::UNSUPPORTED;
+    }
+}
+
+uint8_t ExactScale(const LogicalType& type) {
+    return type.id() == LogicalTypeId::DECIMAL ? DecimalType::GetScale(type) : 0;
+}
+
+/**
+ * @brief Temporal types share a canonical value only within one family
+ */
+LogicalTypeId TemporalFamily(const LogicalType& type) {
+    return type.id() == LogicalTypeId::TIMESTAMP_TZ ? LogicalTypeId::TIMESTAMP : type.id();
+}
+
+inline uint64_t Mix64(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+inline hugeint_t WrappingAdd(hugeint_t left, hugeint_t right) {
+    hugeint_t result;
+    result.lower = left.lower + right.lower;
+    auto carry = static_cast<uint64_t>(result.lower < left.lower);
+    result.upper = static_cast<int64_t>(static_cast<uint64_t>(left.upper) + static_cast<uint64_t>(right.upper) + carry);
+    return result;
+}
+
+template<typename T>
+inline hugeint_t ToHugeint(T value) {
+    return hugeint_t(static_cast<int64_t>(value));
+}
+
+template<>
+inline hugeint_t ToHugeint(uint64_t value) {
+    hugeint_t result;
+    result.lower = value;
+    result.upper = 0;
+    return result;
+}
+
+template<>
+inline hugeint_t ToHugeint(hugeint_t value) {
+    return value;
+}
+
+// ===== CANONICAL GATHER =====
+
+/**
+ * @brief One block of canonical values; only the array for the column kind is used
+ */
+struct CanonicalBlock {
+    std::vector<hugeint_t> exact;
+    std::vector<int64_t> integers;
+    std::vector<double> reals;
+    std::vector<string_t> strings;
+    std::vector<uint8_t> valid;
+};
+
+template<typename T>
+void GatherExact(const UnifiedVectorFormat& format, const idx_t* rows, idx_t n, hugeint_t* values, uint8_t* valid) {
+    auto data = UnifiedVectorFormat::GetData<T>(format);
+    for (idx_t j = 0; j < n; j++) {
+        auto idx = format.sel->get_index(rows[j]);
+        valid[j] = format.validity.RowIsValid(idx);
+        values[j] = ToHugeint(data[idx]);
+    }
+}
+
+template<typename T>
+void GatherInteger(const UnifiedVectorFormat& format, const idx_t* rows, idx_t n, int64_t* values, uint8_t* valid) {
+    auto data = UnifiedVectorFormat::GetData<T>(format);
+    for (idx_t j = 0; j < n; j++) {
+        auto idx = format.sel->get_index(rows[j]);
+        valid[j] = format.validity.RowIsValid(idx);
+        values[j] = static_cast<int64_t>(data[idx]);
+    }
+}
+
+template<typename T>
+void GatherReal(const UnifiedVectorFormat& format, const idx_t* rows, idx_t n, double* values, uint8_t* valid) {
+    auto data = UnifiedVectorFormat::GetData<T>(format);
+    for (idx_t j = 0; j < n; j++) {
+        auto idx = format.sel->get_index(rows[j]);
+        valid[j] = format.validity.RowIsValid(idx);
+        values[j] = static_cast<double>(data[idx]);
+    }
+}
+
+/**
+ * @brief Reads one column into canonical blocks
+ */
+class CanonicalReader {
+public:
+    CanonicalReader(const Vector& vector, idx_t count, CanonicalKind kind, uint8_t canonical_scale)
+        : physical_type_(vector.GetType().InternalType()), kind_(kind), rescale_(false) {
+        // ToUnifiedFormat does not modify FLAT, CONSTANT or DICTIONARY vectors
+        const_cast<Vector&>(vector).ToUnifiedFormat(count, format_);
+        block_.valid.resize(STANDARD_VECTOR_SIZE);
+        switch (kind) {
+            case CanonicalKind::EXACT: {
+                block_.exact.resize(STANDARD_VECTOR_SIZE);
+                auto own_scale = ExactScale(vector.GetType());
+                if (canonical_scale > own_scale) {
+                    rescale_ = true;
+                    factor_ = Hugeint::POWERS_OF_TEN[canonical_scale - own_scale];
+                }
+                break;
+            }
+            case CanonicalKind::APPROX:
+                block_.reals.resize(STANDARD_VECTOR_SIZE);
+                break;
+            case CanonicalKind::STRING:
+                block_.strings.resize(STANDARD_VECTOR_SIZE);
+                break;
+            default:
+                block_.integers.resize(STANDARD_VECTOR_SIZE);
+                break;
+        }
+    }
+
+    const CanonicalBlock& Gather(const idx_t* rows, idx_t n) {
+        auto valid = block_.valid.data();
+        switch (kind_) {
+            case CanonicalKind::EXACT:
+                GatherExactBlock(rows, n);
+                break;
+            case CanonicalKind::APPROX:
+                if (physical_type_ == PhysicalType::FLOAT) {
+                    GatherReal<float>(format_, rows, n, block_.reals.data(), valid);
+                } else {
+                    GatherReal<double>(format_, rows, n, block_.reals.data(), valid);
+                }
+                break;
+            case CanonicalKind::STRING: {
+                auto data = UnifiedVectorFormat::GetData<string_t>(format_);
+                for (idx_t j = 0; j < n; j++) {
+                    auto idx = format_.sel->get_index(rows[j]);
+                    valid[j] = format_.validity.RowIsValid(idx);
+                    // NULL slots may hold garbage pointers; never compare them
+                    block_.strings[j] = valid[j] ? data[idx] : string_t("", 0);
+                }
+                break;
+            }
+            default:
+                switch (physical_type_) {
+                    case PhysicalType::BOOL:
+                        GatherInteger<bool>(format_, rows, n, block_.integers.data(), valid);
+                        break;
+                    case PhysicalType::INT32:
+                        GatherInteger<int32_t>(format_, rows, n, block_.integers.data(), valid);
+                        break;
+                    default:
+                        GatherInteger<int64_t>(format_, rows, n, block_.integers.data(), valid);
+                        break;
+                }
+                break;
+        }
+        return block_;
+    }
+
+private:
+    void GatherExactBlock(const idx_t* rows, idx_t n) {
+        auto values = block_.exact.data();
+        auto valid = block_.valid.data();
+        switch (physical_type_) {
+            case PhysicalType::INT8:
+                GatherExact<int8_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::INT16:
+                GatherExact<int16_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::INT32:
+                GatherExact<int32_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::INT64:
+                GatherExact<int64_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::UINT8:
+                GatherExact<uint8_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::UINT16:
+                GatherExact<uint16_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::UINT32:
+                GatherExact<uint32_t>(format_, rows, n, values, valid);
+                break;
+            case PhysicalType::UINT64:
+                GatherExact<uint64_t>(format_, rows, n, values, valid);
+                break;
+            default:
+                GatherExact<hugeint_t>(format_, rows, n, values, valid);
+                break;
+        }
+        if (!rescale_) {
+            return;
+        }
+        for (idx_t j = 0; j < n; j++) {
+            if (valid[j] && !Hugeint::TryMultiply(values[j], factor_, values[j])) {
+                valid[j] = UNREPRESENTABLE;
+            }
+        }
+    }
+
+    UnifiedVectorFormat format_;
+    PhysicalType physical_type_;
+    CanonicalKind kind_;
+    bool rescale_;
+    hugeint_t factor_;
+    CanonicalBlock block_;
+};
+
+// ===== ROW SELECTION =====
+
+/**
+ * @brief Produces the rows to compare, a block at a time (stride 1 for FULL)
+ */
+class RowSampler {
+public:
+    RowSampler(idx_t count, idx_t stride, idx_t start) : count_(count), stride_(stride), next_(start) {
+    }
+
+    idx_t Next(idx_t* rows) {
+        idx_t n = 0;
+        while (n < STANDARD_VECTOR_SIZE && next_ < count_) {
+            rows[n++] = next_;
+            next_ += stride_;
+        }
+        return n;
+    }
+
+private:
+    idx_t count_;
+    idx_t stride_;
+    idx_t next_;
+};
+
+// ===== COMPARISON =====
+
+inline bool ValuesEqual(const hugeint_t& left, const hugeint_t& right) {
+    return left == right;
+}
+
+inline bool ValuesEqual(int64_t left, int64_t right) {
+    return left == right;
+}
+
+inline bool ValuesEqual(double left, double right) {
+    return left == right || (std::isnan(left) && std::isnan(right));
+}
+
+inline bool ValuesEqual(const string_t& left, const string_t& right) {
+    return left == right;
+}
+
+/**
+ * @brief Index of the first differing row of a block, or n
+ *
+ * The block is first reduced to a single "any difference" flag without
+ * branches; the scan for the exact row only runs when that flag is set.
+ * Both passes treat any non-zero validity (VALID or UNREPRESENTABLE) as set.
+ */
+template<typename T>
+idx_t FindMismatch(const T* left, const uint8_t* left_valid, const T* right, const uint8_t* right_valid, idx_t n) {
+    uint8_t any = 0;
+    for (idx_t j = 0; j < n; j++) {
+        any |= static_cast<uint8_t>(left_valid[j] != right_valid[j]) |
+               (static_cast<uint8_t>(left_valid[j] != 0) & static_cast<uint8_t>(!ValuesEqual(left[j], right[j])));
+    }
+    if (!any) {
+        return n;
+    }
+    for (idx_t j = 0; j < n; j++) {
+        if (left_valid[j] != right_valid[j] || (left_valid[j] && !ValuesEqual(left[j], right[j]))) {
+            return j;
+        }
+    }
+    return n;
+}
+
+idx_t FindBlockMismatch(CanonicalKind kind, const CanonicalBlock& left, const CanonicalBlock& right, idx_t n) {
+    switch (kind) {
+        case CanonicalKind::EXACT:
+            return FindMismatch(left.exact.data(), left.valid.data(), right.exact.data(), right.valid.data(), n);
+        case CanonicalKind::APPROX:
+            return FindMismatch(left.reals.data(), left.valid.data(), right.reals.data(), right.valid.data(), n);
+        case CanonicalKind::STRING:
+            return FindMismatch(left.strings.data(), left.valid.data(), right.strings.data(), right.valid.data(), n);
+        default:
+            return FindMismatch(left.integers.data(), left.valid.data(), right.integers.data(), right.valid.data(),
+                                n);
+    }
+}
+
+/**
+ * @brief memcmp fast path: same type, both FLAT, fixed width, no NULLs
+ * @return true if the columns are known to be identical
+ */
+bool IdenticalFlatColumns(const Vector& source, const Vector& target, idx_t count) {
+    if (source.GetType() != target.GetType() || source.GetVectorType() != VectorType::FLAT_VECTOR ||
+        target.GetVectorType() != VectorType::FLAT_VECTOR) {
+        return false;
+    }
+    auto physical_type = source.GetType().InternalType();
+    if (!TypeIsConstantSize(physical_type) || physical_type == PhysicalType::BOOL) {
+        // BOOL is excluded because its bytes may hold values other than 0/1
+        return false;
+    }
+    auto& source_vector = const_cast<Vector&>(source);
+    auto& target_vector = const_cast<Vector&>(target);
+    if (!FlatVector::Validity(source_vector).AllValid() || !FlatVector::Validity(target_vector).AllValid()) {
+        return false;
+    }
+    return std::memcmp(FlatVector::GetData(source_vector), FlatVector::GetData(target_vector),
+                       count * GetTypeIdSize(physical_type)) == 0;
+}
+
+// ===== CHECKSUM =====
+
+inline uint64_t HashDouble(double value) {
+    if (value == 0) {
+        value = 0;    // -0.0 and 0.0 hash alike
+    } else if (std::isnan(value)) {
+        value = std::numeric_limits<double>::quiet_NaN();
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return Mix64(bits);
+}
+
+void AccumulateBlock(CanonicalKind kind, const CanonicalBlock& block, idx_t n, ColumnChecksum& checksum) {
+    checksum.row_count += n;
+    auto valid = block.valid.data();
+    for (idx_t j = 0; j < n; j++) {
+        if (!valid[j]) {
+            checksum.null_count++;
+            continue;
+        }
+        switch (kind) {
+            case CanonicalKind::EXACT: {
+                auto& value = block.exact[j];
+                if (valid[j] == UNREPRESENTABLE) {
+                    checksum.value_hash += Mix64(~uint64_t(0));
+                    break;
+                }
+                checksum.value_hash += Mix64(value.lower ^ Mix64(static_cast<uint64_t>(value.upper)));
+                checksum.value_sum = WrappingAdd(checksum.value_sum, value);
+                break;
+            }
+            case CanonicalKind::APPROX:
+                checksum.value_hash += HashDouble(block.reals[j]);
+                break;
+            case CanonicalKind::STRING: {
+                auto& value = block.strings[j];
+                checksum.value_hash += Hash(value.GetData(), value.GetSize());
+                checksum.value_sum = WrappingAdd(checksum.value_sum, hugeint_t(static_cast<int64_t>(value.GetSize())));
+                break;
+            }
+            default: {
+                auto value = block.integers[j];
+                checksum.value_hash += Mix64(static_cast<uint64_t>(value));
+                checksum.value_sum = WrappingAdd(checksum.value_sum, hugeint_t(value));
+                break;
+            }
+        }
+    }
+}
+
+ColumnChecksum ComputeCanonicalChecksum(const Vector& vector, idx_t count, CanonicalKind kind,
+                                        uint8_t canonical_scale) {
+    ColumnChecksum checksum;
+    checksum.has_value_sum = kind != CanonicalKind::APPROX;
+    CanonicalReader reader(vector, count, kind, canonical_scale);
+    RowSampler sampler(count, 1, 0);
+    idx_t rows[STANDARD_VECTOR_SIZE];
+    idx_t n;
+    while ((n = sampler.Next(rows)) > 0) {
+        AccumulateBlock(kind, reader.Gather(rows, n), n, checksum);
+    }
+    return checksum;
+}
+
+} // namespace
+
+// ===== COLUMN CHECKSUM =====
+
+void ColumnChecksum::Combine(const ColumnChecksum& other) {
+    row_count += other.row_count;
+    null_count += other.null_count;
+    value_hash += other.value_hash;
+    value_sum = WrappingAdd(value_sum, other.value_sum);
+    has_value_sum = has_value_sum && other.has_value_sum;
+}
+
+bool ColumnChecksum::Matches(const ColumnChecksum& other) const {
+    return MatchesAggregates(other) && value_hash == other.value_hash;
+}
+
+bool ColumnChecksum::MatchesAggregates(const ColumnChecksum& other) const {
+    if (row_count != other.row_count || null_count != other.null_count) {
+        return false;
+    }
+    if (has_value_sum && other.has_value_sum && row_count > null_count) {
+        return value_sum == other.value_sum;
+    }
+    return true;
+}
+
+std::string ColumnChecksum::ToString() const {
+    std::string result = "{rows: " + std::to_string(row_count) + ", nulls: " + std::to_string(null_count) +
+                         ", hash: " + std::to_string(value_hash);
+    if (has_value_sum) {
+        result += ", sum: " + Hugeint::ToString(value_sum);
+    }
+    return result + "}";
+}
+
+ColumnChecksum ColumnChecksum::FromSnowflakeAggregates(idx_t row_count, idx_t non_null_count,
+                                                       const std::string& value_sum) {
+    ColumnChecksum checksum;
+    checksum.row_count = row_count;
+    checksum.null_count = row_count - non_null_count;
+    if (value_sum.empty() || StringUtil::CIEquals(value_sum, "NULL")) {
+        return checksum;
+    }
+    try {
+        checksum.value_sum = Value(value_sum).DefaultCastAs(LogicalType::HUGEINT).GetValue<hugeint_t>();
+        checksum.has_value_sum = true;
+    } catch (const std::exception&) {
+        checksum.has_value_sum = false;
+    }
+    return checksum;
+}
+
+// ===== VALIDATOR =====
+
+bool ConversionValidator::AreComparable(const LogicalType& source_type, const LogicalType& target_type) {
+    auto kind = GetCanonicalKind(source_type);
+    if (kind == CanonicalKind::UNSUPPORTED || kind != GetCanonicalKind(target_type)) {
+        return false;
+    }
+    if (kind == CanonicalKind::TEMPORAL) {
+        return TemporalFamily(source_type) == TemporalFamily(target_type);
+    }
+    return true;
+}
+
+ConversionValidator::ConversionResult<void>
+ConversionValidator::Validate(const Vector& source, const Vector& target, idx_t count,
+                              const ValidationOptions& options) {
+    auto& source_type = source.GetType();
+    auto& target_type = target.GetType();
+    if (!AreComparable(source_type, target_type)) {
+        return ConversionResult<void>::Error("Cannot validate " + source_type.ToString() + " against " +
+                                             target_type.ToString() + ": values have no common representation");
+    }
+    if (count == 0) {
+        return ConversionResult<void>::Success();
+    }
+    auto kind = GetCanonicalKind(source_type);
+    auto canonical_scale = MaxValue<uint8_t>(ExactScale(source_type), ExactScale(target_type));
+
+    if (options.mode == ValidationMode::CHECKSUM) {
+        auto source_checksum = ComputeCanonicalChecksum(source, count, kind, canonical_scale);
+        auto target_checksum = ComputeCanonicalChecksum(target, count, kind, canonical_scale);
+        if (!source_checksum.Matches(target_checksum)) {
+            return ConversionResult<void>::Error("Checksum mismatch: source " + source_checksum.ToString() +
+                                                 ", target " + target_checksum.ToString());
+        }
+        return ConversionResult<void>::Success();
+    }
+
+    idx_t stride = 1;
+    idx_t start = 0;
+    if (options.mode == ValidationMode::SAMPLED) {
+        if (!(options.sample_fraction > 0.0 && options.sample_fraction <= 1.0)) {
+            return ConversionResult<void>::Error("sample_fraction must be in (0, 1], got " +
+                                                 std::to_string(options.sample_fraction));
+        }
+        stride = MaxValue<idx_t>(1, static_cast<idx_t>(std::llround(1.0 / options.sample_fraction)));
+        start = static_cast<idx_t>(options.sample_seed % stride);
+    } else if (IdenticalFlatColumns(source, target, count)) {
+        return ConversionResult<void>::Success();
+    }
+
+    CanonicalReader source_reader(source, count, kind, canonical_scale);
+    CanonicalReader target_reader(target, count, kind, canonical_scale);
+    RowSampler sampler(count, stride, start);
+    idx_t rows[STANDARD_VECTOR_SIZE];
+    idx_t n;
+    while ((n = sampler.Next(rows)) > 0) {
+        auto& source_block = source_reader.Gather(rows, n);
+        auto& target_block = target_reader.Gather(rows, n);
+        auto mismatch = FindBlockMismatch(kind, source_block, target_block, n);
+        if (mismatch < n) {
+            auto row = rows[mismatch];
+            return ConversionResult<void>::Error("Mismatch at row " + std::to_string(row) + ": source " +
+                                                 source.GetValue(row).ToString() + ", target " +
+                                                 target.GetValue(row).ToString());
+        }
+    }
+    return ConversionResult<void>::Success();
+}
+
+ColumnChecksum ConversionValidator::ComputeChecksum(const Vector& vector, idx_t count) {
+    auto kind = GetCanonicalKind(vector.GetType());
+    if (kind == CanonicalKind::UNSUPPORTED) {
+        ColumnChecksum checksum;
+        checksum.row_count = count;
+        return checksum;
+    }
+    return ComputeCanonicalChecksum(vector, count, kind, ExactScale(vector.GetType()));
+}
+
+std::string ConversionValidator::BuildSnowflakeChecksumSQL(const std::string& column, const LogicalType& type) {
+    auto quoted = SnowflakeTypeConverter::QuoteIdentifier(column);
+    std::string value_sum;
+    switch (type.id()) {
+        case LogicalTypeId::DATE:
+            value_sum = "SUM(DATEDIFF('day', '1970-01-01'::DATE, " + quoted + "))";
+            break;
+        case LogicalTypeId::TIME:
+            value_sum = "SUM(DATEDIFF('microsecond', '00:00:00'::TIME, " + quoted + "))";
+            break;
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+            value_sum = "SUM(DATE_PART('epoch_microsecond', " + quoted + "))";
+            break;
+        case LogicalTypeId::TIMESTAMP_NS:
+            value_sum = "SUM(DATE_PART('epoch_nanosecond', " + quoted + "))::NUMBER(38,0)";
+            break;
+        case LogicalTypeId::TIMESTAMP_MS:
+            value_sum = "SUM(DATE_PART('epoch_millisecond', " + quoted + "))";
+            break;
+        case LogicalTypeId::TIMESTAMP_SEC:
+            value_sum = "SUM(DATE_PART('epoch_second', " + quoted + "))";
+            break;
+        case LogicalTypeId::BOOLEAN:
+            value_sum = "COUNT_IF(" + quoted + ")";
+            break;
+        case LogicalTypeId::VARCHAR:
+            value_sum = "SUM(LENGTH(TO_BINARY(" + quoted + ", 'UTF-8')))";
+            break;
+        case LogicalTypeId::BLOB:
+            value_sum = "SUM(LENGTH(" + quoted + "))";
+            break;
+        default:
+            if (GetCanonicalKind(type) == CanonicalKind::EXACT) {
+                auto scale = ExactScale(type);
+                // Unscaled integer sum, e.g. SUM(x) * 100 for scale 2
+                value_sum = scale == 0 ? "SUM(" + quoted + ")"
+                                       : "(SUM(" + quoted + ") * 1" + std::string(scale, '0') + ")::NUMBER(38,0)";
+            } else {
+                value_sum = "NULL";
+            }
+            break;
+    }
+    return "COUNT(*), COUNT(" + quoted + "), " + value_sum;
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,370 @@
+#include "include/decimal_rescale.hpp"
+#include "include/snowflake_metrics.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include <type_traits>
+
+namespace duckdb {
+
+namespace {
+
+constexpr int64_t POWERS_OF_TEN[] = {1LL,
+                                     10LL,
+                                     100LL,
+                                     1000LL,
+                                     10000LL,
+                                     100000LL,
+                                     1000000LL,
+                                     10000000LL,
+                                     100000000LL,
+                                     1000000000LL,
+                                     10000000000LL,
+                                     100000000000LL,
+                                     1000000000000LL,
+                                     10000000000000LL,
+                                     100000000000000LL,
+                                     1000000000000000LL,
+                                     10000000000000000LL,
+                                     100000000000000000LL,
+                                     1000000000000000000LL};
+
+constexpr uint8_t SNOWFLAKE_MAX_PRECISION = 38;
+// HUGEINT reports width 38 but holds up to 39 digits
+constexpr uint8_t HUGEINT_DIGITS = 39;
+
+constexpr uint8_t FLAG_ROUNDED = 1;
+constexpr uint8_t FLAG_OUT_OF_RANGE = 2;
+
+struct RescalePlan {
+    uint8_t target_width;
+    int32_t scale_difference;   // target scale - source scale
+    bool exact;                 // no row can round or overflow
+    DecimalOverflowPolicy policy;
+};
+
+template<typename T>
+inline hugeint_t Widen(T value) {
+    return hugeint_t(static_cast<int64_t>(value));
+}
+
+template<>
+inline hugeint_t Widen(hugeint_t value) {
+    return value;
+}
+
+/**
+ * @brief Store a value already known to fit T
+ */
+template<typename T>
+inline T Narrow(hugeint_t value) {
+    int64_t result = 0;
+    Hugeint::TryCast<int64_t>(value, result);
+    return static_cast<T>(result);
+}
+
+template<>
+inline hugeint_t Narrow(hugeint_t value) {
+    return value;
+}
+
+// ===== 64-BIT KERNELS =====
+
+/**
+ * @brief Rescale and range-check one block without branches
+ *
+ * Upscaling compares the source against limit / 10^k before multiplying, so
+ * the multiply never overflows; downscaling divides first and compares the
+ * quotient. Each row gets a flag byte and the loop returns how many rows
+ * were flagged, which is zero for the vast majority of blocks.
+ */
+template<typename SRC, typename DST>
+idx_t RescaleBlock64(const SRC* source, idx_t count, const RescalePlan& plan, DST* target, uint8_t* flags) {
+    const int64_t limit = POWERS_OF_TEN[plan.target_width] - 1;
+    idx_t flagged = 0;
+    if (plan.scale_difference > 0) {
+        const int64_t multiplier = POWERS_OF_TEN[plan.scale_difference];
+        const int64_t bound = limit / multiplier;
+        for (idx_t i = 0; i < count; i++) {
+            auto value = static_cast<int64_t>(source[i]);
+            auto out = static_cast<uint8_t>((value > bound) | (value < -bound));
+            target[i] = static_cast<DST>((out ? 0 : value) * multiplier);
+            flags[i] = static_cast<uint8_t>(out << 1);
+            flagged += out;
+        }
+    } else if (plan.scale_difference < 0) {
+        const int64_t divisor = POWERS_OF_TEN[-plan.scale_difference];
+        for (idx_t i = 0; i < count; i++) {
+            auto value = static_cast<int64_t>(source[i]);
+            auto quotient = value / divisor;
+            auto remainder = value % divisor;
+            auto round_up = static_cast<int64_t>(2 * (remainder < 0 ? -remainder : remainder) >= divisor);
+            quotient += value < 0 ? -round_up : round_up;
+            auto rounded = static_cast<uint8_t>(remainder != 0);
+            auto out = static_cast<uint8_t>((quotient > limit) | (quotient < -limit));
+            target[i] = static_cast<DST>(out ? 0 : quotient);
+            flags[i] = static_cast<uint8_t>(rounded | (out << 1));
+            flagged += rounded | out;
+        }
+    } else {
+        for (idx_t i = 0; i < count; i++) {
+            auto value = static_cast<int64_t>(source[i]);
+            auto out = static_cast<uint8_t>((value > limit) | (value < -limit));
+            target[i] = static_cast<DST>(out ? 0 : value);
+            flags[i] = static_cast<uint8_t>(out << 1);
+            flagged += out;
+        }
+    }
+    return flagged;
+}
+
+// ===== 128-BIT KERNELS =====
+
+template<typename SRC, typename DST>
+idx_t RescaleBlockWide(const SRC* source, idx_t count, const RescalePlan& plan, DST* target, uint8_t* flags) {
+    const hugeint_t limit = Hugeint::POWERS_OF_TEN[plan.target_width] - hugeint_t(1);
+    const hugeint_t negative_limit = -limit;
+    const hugeint_t zero(0);
+    idx_t flagged = 0;
+    if (plan.scale_difference > 0) {
+        const hugeint_t multiplier = Hugeint::POWERS_OF_TEN[plan.scale_difference];
+        const hugeint_t bound = limit / multiplier;
+        const hugeint_t negative_bound = -bound;
+        for (idx_t i = 0; i < count; i++) {
+            auto value = Widen(source[i]);
+            auto out = static_cast<uint8_t>(value > bound || value < negative_bound);
+            target[i] = Narrow<DST>(out ? zero : value * multiplier);
+            flags[i] = static_cast<uint8_t>(out << 1);
+            flagged += out;
+        }
+    } else if (plan.scale_difference < 0) {
+        const hugeint_t divisor = Hugeint::POWERS_OF_TEN[-plan.scale_difference];
+        for (idx_t i = 0; i < count; i++) {
+            auto value = Widen(source[i]);
+            auto quotient = value / divisor;
+            auto remainder = value % divisor;
+            auto magnitude = remainder < zero ? -remainder : remainder;
+            if (magnitude * hugeint_t(2) >= divisor) {
+                quotient = value < zero ? quotient - hugeint_t(1) : quotient + hugeint_t(1);
+            }
+            auto rounded = static_cast<uint8_t>(remainder != zero);
+            auto out = static_cast<uint8_t>(quotient > limit || quotient < negative_limit);
+            target[i] = Narrow<DST>(out ? zero : quotient);
+            flags[i] = static_cast<uint8_t>(rounded | (out << 1));
+            flagged += rounded | out;
+        }
+    } else {
+        for (idx_t i = 0; i < count; i++) {
+            auto value = Widen(source[i]);
+            auto out = static_cast<uint8_t>(value > limit || value < negative_limit);
+            target[i] = Narrow<DST>(out ? zero : value);
+            flags[i] = static_cast<uint8_t>(out << 1);
+            flagged += out;
+        }
+    }
+    return flagged;
+}
+
+/**
+ * @brief Widening rescale for plans that cannot round or overflow
+ */
+template<typename SRC, typename DST, bool WIDE>
+void RescaleBlockExact(const SRC* source, idx_t count, const RescalePlan& plan, DST* target) {
+    if constexpr (WIDE) {
+        const hugeint_t multiplier = Hugeint::POWERS_OF_TEN[plan.scale_difference];
+        for (idx_t i = 0; i < count; i++) {
+            target[i] = Narrow<DST>(Widen(source[i]) * multiplier);
+        }
+    } else {
+        const int64_t multiplier = POWERS_OF_TEN[plan.scale_difference];
+        for (idx_t i = 0; i < count; i++) {
+            target[i] = static_cast<DST>(static_cast<int64_t>(source[i]) * multiplier);
+        }
+    }
+}
+
+// ===== POLICY =====
+
+/**
+ * @brief Count flagged rows and resolve out-of-range ones according to the policy
+ * @return false if the policy is ERROR and a valid row is out of range
+ */
+template<typename SRC, typename DST>
+bool ApplyPolicy(const SRC* source, const uint8_t* flags, idx_t base, idx_t count, const ValidityMask& source_validity,
+                 const RescalePlan& plan, DST* target, ValidityMask& result_validity, DecimalRescaleStats& stats,
+                 idx_t& failed_row) {
+    const hugeint_t limit = Hugeint::POWERS_OF_TEN[plan.target_width] - hugeint_t(1);
+    for (idx_t i = 0; i < count; i++) {
+        if (!flags[i] || !source_validity.RowIsValid(base + i)) {
+            continue;
+        }
+        if (flags[i] & FLAG_ROUNDED) {
+            stats.rows_rounded++;
+        }
+        if (!(flags[i] & FLAG_OUT_OF_RANGE)) {
+            continue;
+        }
+        stats.rows_out_of_range++;
+        switch (plan.policy) {
+            case DecimalOverflowPolicy::ERROR:
+                failed_row = base + i;
+                return false;
+            case DecimalOverflowPolicy::SET_NULL:
+                result_validity.SetInvalid(base + i);
+                break;
+            case DecimalOverflowPolicy::SATURATE:
+                target[i] = Narrow<DST>(Widen(source[i]) < hugeint_t(0) ? -limit : limit);
+                break;
+        }
+    }
+    return true;
+}
+
+template<typename SRC, typename DST>
+bool RescaleTyped(const SRC* source, const ValidityMask& source_validity, idx_t count, const RescalePlan& plan,
+                  Vector& result, DecimalRescaleStats& stats, idx_t& failed_row) {
+    constexpr bool WIDE = std::is_same<SRC, hugeint_t>::value || std::is_same<DST, hugeint_t>::value;
+    auto target = FlatVector::GetData<DST>(result);
+    auto& result_validity = FlatVector::Validity(result);
+    result_validity.Copy(source_validity, count);
+
+    uint8_t flags[STANDARD_VECTOR_SIZE];
+    for (idx_t base = 0; base < count; base += STANDARD_VECTOR_SIZE) {
+        auto block = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - base);
+        if (plan.exact) {
+            RescaleBlockExact<SRC, DST, WIDE>(source + base, block, plan, target + base);
+            continue;
+        }
+        idx_t flagged;
+        if constexpr (WIDE) {
+            flagged = RescaleBlockWide(source + base, block, plan, target + base, flags);
+        } else {
+            flagged = RescaleBlock64(source + base, block, plan, target + base, flags);
+        }
+        if (flagged > 0 && !ApplyPolicy(source + base, flags, base, block, source_validity, plan, target + base,
+                                        result_validity, stats, failed_row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename SRC>
+bool DispatchTarget(Vector& source, idx_t count, const RescalePlan& plan, Vector& result, DecimalRescaleStats& stats,
+                    idx_t& failed_row) {
+    auto data = FlatVector::GetData<SRC>(source);
+    auto& validity = FlatVector::Validity(source);
+    switch (result.GetType().InternalType()) {
+        case PhysicalType::INT16:
+            return RescaleTyped<SRC, int16_t>(data, validity, count, plan, result, stats, failed_row);
+        case PhysicalType::INT32:
+            return RescaleTyped<SRC, int32_t>(data, validity, count, plan, result, stats, failed_row);
+        case PhysicalType::INT64:
+            return RescaleTyped<SRC, int64_t>(data, validity, count, plan, result, stats, failed_row);
+        default:
+            return RescaleTyped<SRC, hugeint_t>(data, validity, count, plan, result, stats, failed_row);
+    }
+}
+
+/**
+ * @brief Digits and scale of a rescalable source type
+ */
+bool GetSourceDigits(const LogicalType& type, uint8_t& width, uint8_t& scale) {
+    switch (type.id()) {
+        case LogicalTypeId::DECIMAL:
+        case LogicalTypeId::TINYINT:
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+            return type.GetDecimalProperties(width, scale);
+        case LogicalTypeId::HUGEINT:
+            width = HUGEINT_DIGITS;
+            scale = 0;
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+LogicalType DecimalRescaleKernel::GetSnowflakeDecimalType(const LogicalType& source_type) {
+    uint8_t width, scale;
+    if (!GetSourceDigits(source_type, width, scale)) {
+        return LogicalType::INVALID;
+    }
+    auto adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(width, scale);
+    return LogicalType::DECIMAL(adjustment.adjusted_precision, adjustment.adjusted_scale);
+}
+
+DecimalRescaleKernel::ConversionResult<DecimalRescaleStats>
+DecimalRescaleKernel::Rescale(Vector& source, idx_t count, Vector& result, DecimalOverflowPolicy policy) {
+    uint8_t source_width, source_scale;
+    if (!GetSourceDigits(source.GetType(), source_width, source_scale)) {
+        return ConversionResult<DecimalRescaleStats>::Error("Cannot rescale " + source.GetType().ToString() +
+                                                            " to a decimal");
+    }
+    auto& target_type = result.GetType();
+    if (target_type.id() != LogicalTypeId::DECIMAL) {
+        return ConversionResult<DecimalRescaleStats>::Error("Rescale target must be DECIMAL, got " +
+                                                            target_type.ToString());
+    }
+    RescalePlan plan;
+    plan.target_width = DecimalType::GetWidth(target_type);
+    plan.scale_difference = static_cast<int32_t>(DecimalType::GetScale(target_type)) - source_scale;
+    plan.exact = plan.scale_difference >= 0 && source_width + plan.scale_difference <= plan.target_width;
+    plan.policy = policy;
+
+    // Constant and dictionary inputs are flattened into a private reference
+    Vector input(source.GetType(), nullptr);
+    input.Reference(source);
+    input.Flatten(count);
+
+    DecimalRescaleStats stats {0, 0};
+    idx_t failed_row = 0;
+    bool success;
+    switch (input.GetType().InternalType()) {
+        case PhysicalType::INT8:
+            success = DispatchTarget<int8_t>(input, count, plan, result, stats, failed_row);
+            break;
+        case PhysicalType::INT16:
+            success = DispatchTarget<int16_t>(input, count, plan, result, stats, failed_row);
+            break;
+        case PhysicalType::INT32:
+            success = DispatchTarget<int32_t>(input, count, plan, result, stats, failed_row);
+            break;
+        case PhysicalType::INT64:
+            success = DispatchTarget<int64_t>(input, count, plan, result, stats, failed_row);
+            break;
+        case PhysicalType::INT128:
+            success = DispatchTarget<hugeint_t>(input, count, plan, result, stats, failed_row);
+            break;
+        default:
+            return ConversionResult<DecimalRescaleStats>::Error("Unsupported storage for " +
+                                                                source.GetType().ToString());
+    }
+    // Reported by snowflake_metrics() for callers of the kernel; the row failing under ERROR counts as out of range
+    if (stats.rows_rounded != 0 || stats.rows_out_of_range != 0) {
+        SnowflakeMetrics::Get().AddRescale(stats.rows_rounded, stats.rows_out_of_range);
+    }
+    if (!success) {
+        return ConversionResult<DecimalRescaleStats>::Error(
+            "Value " + input.GetValue(failed_row).ToString() + " at row " + std::to_string(failed_row) +
+            " does not fit " + target_type.ToString());
+    }
+    return ConversionResult<DecimalRescaleStats>::Success(std::move(stats));
+}
+
+DecimalRescaleKernel::ConversionResult<DecimalRescaleStats>
+DecimalRescaleKernel::AdjustForSnowflake(Vector& source, idx_t count, Vector& result, DecimalOverflowPolicy policy) {
+    auto target_type = GetSnowflakeDecimalType(source.GetType());
+    if (target_type.id() == LogicalTypeId::INVALID) {
+        return ConversionResult<DecimalRescaleStats>::Error("No Snowflake decimal type for " +
+                                                            source.GetType().ToString());
+    }
+    if (result.GetType() != target_type) {
+        return ConversionResult<DecimalRescaleStats>::Error("Result vector must be " + target_type.ToString() +
+                                                            ", got " + result.GetType().ToString());
+    }
+    return Rescale(source, count, result, policy);
+}
+
+} // namespace duckdb
\ No newline at end of file
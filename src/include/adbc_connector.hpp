@@ -2,9 +2,12 @@
 
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 // ADBC includes
 extern "C" {
@@ -14,6 +17,7 @@ extern "C" {
 // Forward declarations
 namespace arrow {
     class RecordBatch;
+    class RecordBatchReader;
     class Schema;
 }
 
@@ -36,6 +40,9 @@ struct SnowflakeConfig {
     std::string private_key_passphrase;
     std::string token;
     
+    // ADBC driver to load: shared library name or path
+    std::string driver = "adbc_driver_snowflake";
+    
     // Connection options
     std::unordered_map<std::string, std::string> options;
     
@@ -50,6 +57,75 @@ struct SnowflakeConfig {
      * @return True if configuration is valid
      */
     bool IsValid() const;
+    
+    /**
+     * @brief Parse a "key=value;key=value" connection string
+     *
+     * Known keys (account, user, password, database, schema, warehouse,
+     * role, private_key_path, private_key_passphrase, token, driver) fill
+     * the matching member; any other key is passed through as an option.
+     * @param connection_string Connection string, e.g. from snowflake_scan
+     * @return Parsed configuration (check IsValid)
+     */
+    static SnowflakeConfig Parse(const std::string &connection_string);
+};
+
+/**
+ * @brief What bulk ingestion does with the target table
+ */
+enum class SnowflakeIngestMode : uint8_t {
+    APPEND,   // Table must exist; rows are added
+    CREATE,   // Table must not exist; created from the Arrow schema
+    REPLACE   // Table is dropped if it exists and created from the Arrow schema
+};
+
+/**
+ * @brief Streaming result of one query or one result partition
+ *
+ * Owns the ArrowArrayStream (and the ADBC statement that produced it, if
+ * any). Batches are
+ * imported one at a time as they are read, so memory stays bounded by the
+ * batches in flight rather than the size of the result. ReadNext may be
+ * called from several threads; calls are serialized because an
+ * ArrowArrayStream is not thread-safe.
+ */
+class SnowflakeResultStream {
+public:
+    SnowflakeResultStream(AdbcStatement statement, std::shared_ptr<arrow::RecordBatchReader> reader);
+    explicit SnowflakeResultStream(std::shared_ptr<arrow::RecordBatchReader> reader);
+    ~SnowflakeResultStream();
+    
+    SnowflakeResultStream(const SnowflakeResultStream&) = delete;
+    SnowflakeResultStream& operator=(const SnowflakeResultStream&) = delete;
+    
+    /**
+     * @brief Result schema reported by the driver
+     */
+    std::shared_ptr<arrow::Schema> GetSchema() const;
+    
+    /**
+     * @brief Pull the next batch from the driver
+     * @return Next batch, nullptr once the stream is exhausted (and on every later call), or error
+     */
+    std::pair<std::shared_ptr<arrow::RecordBatch>, string> ReadNext();
+
+private:
+    AdbcStatement statement_;
+    std::shared_ptr<arrow::RecordBatchReader> reader_;
+    std::mutex lock_;
+    bool finished_ = false;
+};
+
+/**
+ * @brief Result of partitioned execution
+ *
+ * Snowflake splits large results into chunks that can be fetched
+ * independently. Each descriptor is opaque and is read with
+ * SnowflakeADBCConnector::ReadPartition, in any order and from any thread.
+ */
+struct SnowflakePartitions {
+    std::shared_ptr<arrow::Schema> schema;
+    std::vector<std::string> descriptors;
 };
 
 /**
@@ -82,22 +158,60 @@ public:
     string Connect();
     
     /**
-     * @brief Execute SQL query and return Arrow data
+     * @brief Execute SQL query and stream its result
      * @param sql SQL query string
-     * @return Arrow RecordBatch with results or error
+     * @return Result stream (must not outlive the connector) or error
      */
-    std::pair<std::shared_ptr<arrow::RecordBatch>, string> 
+    std::pair<std::unique_ptr<SnowflakeResultStream>, string> 
     ExecuteQuery(const std::string &sql);
     
+    /**
+     * @brief Execute SQL query and return its result partitions
+     * @param sql SQL query string
+     * @return Partitions or error; if the driver has no partitioned execution,
+     *         SupportsPartitions() is false afterwards and ExecuteQuery should be used
+     */
+    std::pair<std::unique_ptr<SnowflakePartitions>, string>
+    ExecutePartitions(const std::string &sql);
+    
+    /**
+     * @brief Open one partition returned by ExecutePartitions
+     * @param descriptor Partition descriptor
+     * @return Result stream (must not outlive the connector) or error
+     */
+    std::pair<std::unique_ptr<SnowflakeResultStream>, string>
+    ReadPartition(const std::string &descriptor);
+    
+    /**
+     * @brief False once the driver reported partitioned execution as not implemented
+     */
+    bool SupportsPartitions() const { return supports_partitions_; }
+    
     /**
      * @brief Insert Arrow data into Snowflake table
-     * @param table_name Target table name
+     * @param table_name Target table name (must exist; rows are appended)
      * @param batch Arrow RecordBatch to insert
      * @return Success or error details
      */
     string InsertBatch(const std::string &table_name, 
                       const std::shared_ptr<arrow::RecordBatch> &batch);
     
+    /**
+     * @brief Bulk-ingest a stream of batches with ADBC ingestion
+     *
+     * The driver pulls batches from the reader while it uploads, so the
+     * reader may block until its producer has the next batch ready. Holds
+     * the connection until the driver has consumed the whole stream.
+     * @param table_name Target table name
+     * @param mode Append to, create or replace the table
+     * @param reader Batches to load
+     * @param db_schema Schema of the table (empty for the session's schema)
+     * @return Rows ingested (-1 if the driver does not report it) or error
+     */
+    std::pair<int64_t, string> IngestStream(const std::string &table_name, SnowflakeIngestMode mode,
+                                            std::shared_ptr<arrow::RecordBatchReader> reader,
+                                            const std::string &db_schema = "");
+    
     /**
      * @brief Get Snowflake table schema information
      * @param table_name Table to inspect
@@ -112,20 +226,31 @@ public:
      */
     bool IsConnected() const { return connected_; }
     
+    const SnowflakeConfig &GetConfig() const { return config_; }
+    
     /**
      * @brief Disconnect from Snowflake
      */
     void Disconnect();
 
+    /**
+     * @brief Round-trip a trivial query to check the session is still usable
+     * @return Success or error details
+     */
+    string Ping();
+
 private:
     SnowflakeConfig config_;
     bool connected_;
+    std::atomic<bool> supports_partitions_;
+    
+    // Serializes calls on the connection (ADBC connections are not thread-safe)
+    std::mutex adbc_lock_;
     
     // ADBC objects
     AdbcError adbc_error_;
     AdbcDatabase adbc_database_;
     AdbcConnection adbc_connection_;
-    AdbcStatement adbc_statement_;
     
     /**
      * @brief Initialize ADBC database with Snowflake driver
@@ -145,11 +270,11 @@ private:
     void Cleanup();
     
     /**
-     * @brief Format ADBC error messages
+     * @brief Format the pending ADBC error message and release it
      * @param operation Description of failed operation
      * @return Formatted error message
      */
-    string FormatADBCError(const std::string &operation) const;
+    string FormatADBCError(const std::string &operation);
 };
 
 } // namespace duckdb 
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "type_converter.hpp"
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <atomic>
+#include <memory>
+
+namespace duckdb {
+
+/**
+ * @brief Options for DuckDB → Arrow data conversion
+ */
+struct ArrowConversionOptions {
+    /**
+     * Pool used for every buffer the kernels allocate
+     */
+    arrow::MemoryPool* pool = arrow::default_memory_pool();
+
+    /**
+     * Let fixed-width FLAT vectors whose layout already matches Arrow, and the
+     * out-of-line strings of string_view arrays, be wrapped instead of copied.
+     * The resulting arrays alias the vector's memory: they keep the vector
+     * buffer (or string heap) alive, but must be consumed before the source
+     * DataChunk is Reset() or refilled.
+     */
+    bool zero_copy = true;
+
+    /**
+     * Let ConvertVector turn VARCHAR / BLOB DICTIONARY vectors into Arrow
+     * dictionary arrays instead of gathering their values. ConvertChunk
+     * ignores it and follows the schema: dictionary-typed fields are always
+     * dictionary-encoded.
+     */
+    bool keep_dictionaries = false;
+
+    /**
+     * Let ConvertVector write VARCHAR / BLOB as string_view / binary_view
+     * arrays. ConvertChunk ignores it and follows the schema.
+     */
+    bool string_views = false;
+
+    /**
+     * One counter per chunk column that ConvertChunk adds the nanoseconds spent
+     * converting that column to (nullptr to skip timing). ConvertVector ignores it.
+     */
+    std::atomic<uint64_t>* column_ns = nullptr;
+};
+
+/**
+ * @brief Vectorized conversion of DuckDB vectors into Arrow arrays
+ *
+ * Covers every primitive type in SnowflakeTypeRegistry plus DECIMAL. Each
+ * type has specialized kernels for FLAT, CONSTANT and DICTIONARY vectors;
+ * other vector types go through the unified-format gather path. DuckDB and
+ * Arrow share the LSB-first validity bitmap layout, so validity is moved a
+ * 64-bit word at a time.
+ *
+ * STRUCT, LIST, MAP and ARRAY convert recursively into struct, list, map and
+ * fixed_size_list arrays. Child vectors go through the same kernels, so a
+ * fixed-width child of a FLAT nested vector is wrapped rather than copied;
+ * only list offsets are rebuilt (DuckDB keeps (offset, length) pairs).
+ *
+ * VARCHAR and BLOB columns can be written as dictionary<int32, T> arrays. A
+ * DICTIONARY vector keeps its dictionary: the entries its rows reference
+ * become the Arrow dictionary and its selection becomes the indices, so each
+ * distinct string is copied once. Other vectors are hash-encoded.
+ *
+ * VARCHAR and BLOB can also be written as string_view / binary_view arrays,
+ * whose views share string_t's 16-byte layout and whose data buffers wrap
+ * DuckDB's string heap. utf8 / binary columns holding more than 2GB in one
+ * call fall back to large_utf8 / large_binary.
+ */
+class DuckDBToArrowConverter {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    /**
+     * @brief Convert the first `count` rows of a vector
+     * @param vector Source vector (any vector type)
+     * @param count Number of rows
+     * @param options Pool and zero-copy settings
+     * @return Arrow array of the type ConvertDuckDBToArrow assigns, or error
+     */
+    static ConversionResult<std::shared_ptr<arrow::Array>>
+    ConvertVector(Vector& vector, idx_t count, const ArrowConversionOptions& options = ArrowConversionOptions());
+
+    /**
+     * @brief Convert a whole chunk into a record batch
+     * @param chunk Source chunk
+     * @param schema Target schema (e.g. SchemaConversion::arrow_schema)
+     * @param options Pool and zero-copy settings
+     * @return Record batch with chunk.size() rows, or error naming the column. Its schema is
+     *         `schema` itself unless a utf8 / binary column fell back to large_utf8 / large_binary.
+     */
+    static ConversionResult<std::shared_ptr<arrow::RecordBatch>>
+    ConvertChunk(DataChunk& chunk, const std::shared_ptr<arrow::Schema>& schema,
+                 const ArrowConversionOptions& options = ArrowConversionOptions());
+
+    /**
+     * @brief Same schema with every string and binary field dictionary-encoded (int32 indices)
+     */
+    static std::shared_ptr<arrow::Schema> DictionaryEncodeStrings(const std::shared_ptr<arrow::Schema>& schema);
+
+    /**
+     * @brief Same schema with every string and binary field as string_view / binary_view
+     */
+    static std::shared_ptr<arrow::Schema> ViewEncodeStrings(const std::shared_ptr<arrow::Schema>& schema);
+
+    // ===== VALIDITY KERNELS =====
+
+    /**
+     * @brief Copy a DuckDB validity mask into an Arrow bitmap
+     * @param source DuckDB validity words (nullptr means all valid)
+     * @param count Number of rows
+     * @param target Bitmap with at least ceil(count / 64) * 8 bytes
+     * @return Number of null rows
+     */
+    static int64_t CopyValidity(const validity_t* source, idx_t count, uint8_t* target);
+
+    /**
+     * @brief Pack DuckDB's one-byte booleans into an Arrow bit-packed buffer
+     * @param source Bytes holding 0 or 1
+     * @param count Number of values
+     * @param target Bitmap with at least ceil(count / 64) * 8 bytes
+     */
+    static void PackBooleans(const uint8_t* source, idx_t count, uint8_t* target);
+};
+
+} // namespace duckdb
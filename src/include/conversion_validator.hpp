@@ -0,0 +1,95 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "type_converter.hpp"
+#include <cstdint>
+#include <string>
+
+namespace duckdb {
+
+/**
+ * @brief Order-independent fingerprint of one column
+ *
+ * `value_hash` is the wrapping sum of a 64-bit hash of every non-NULL value,
+ * so partial checksums of any batches can be combined in any order.
+ * `value_sum` is an exact aggregate Snowflake can compute too (see
+ * ConversionValidator::BuildSnowflakeChecksumSQL):
+ * - numerics: sum of unscaled values
+ * - DATE: days since epoch
+ * - TIME and TIMESTAMP: ticks of the type's unit (microseconds unless _NS/_MS/_S)
+ * - strings: byte lengths
+ * - BOOLEAN: true values
+ * Floating point columns have no exact aggregate.
+ */
+struct ColumnChecksum {
+    idx_t row_count = 0;
+    idx_t null_count = 0;
+    uint64_t value_hash = 0;
+    hugeint_t value_sum = hugeint_t(0);
+    bool has_value_sum = false;
+
+    /**
+     * @brief Merge the checksum of another batch of the same column
+     */
+    void Combine(const ColumnChecksum& other);
+
+    /**
+     * @brief Full comparison, for two checksums computed by this extension
+     */
+    bool Matches(const ColumnChecksum& other) const;
+
+    /**
+     * @brief Compare only what Snowflake can compute (counts and value_sum)
+     */
+    bool MatchesAggregates(const ColumnChecksum& other) const;
+
+    std::string ToString() const;
+
+    /**
+     * @brief Build a checksum from the result row of BuildSnowflakeChecksumSQL
+     * @param row_count COUNT(*)
+     * @param non_null_count COUNT(column)
+     * @param value_sum Third column as text (NULL or empty for no rows)
+     */
+    static ColumnChecksum FromSnowflakeAggregates(idx_t row_count, idx_t non_null_count,
+                                                 const std::string& value_sum);
+};
+
+/**
+ * @brief Vectorized round-trip validation behind SnowflakeTypeConverter::ValidateConversion
+ *
+ * Rows are processed a vector at a time: both sides are gathered into a
+ * canonical form per block (exact numerics as 128-bit integers at the larger
+ * of the two scales, temporals as int64, floats as double, strings as
+ * string_t), then compared in tight loops. Identical FLAT fixed-width
+ * columns without NULLs are compared with memcmp.
+ */
+class ConversionValidator {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    static ConversionResult<void> Validate(const Vector& source, const Vector& target, idx_t count,
+                                           const ValidationOptions& options);
+
+    /**
+     * @brief Checksum of a column at its own scale (comparable with Snowflake)
+     */
+    static ColumnChecksum ComputeChecksum(const Vector& vector, idx_t count);
+
+    /**
+     * @brief SELECT list computing the Snowflake side of ColumnChecksum
+     * @param column Column name (quoted as an identifier)
+     * @param type DuckDB type of the column as held locally
+     * @return "COUNT(*), COUNT(col), <value_sum expression>"
+     */
+    static std::string BuildSnowflakeChecksumSQL(const std::string& column, const LogicalType& type);
+
+    /**
+     * @brief Whether two types can be compared by Validate
+     */
+    static bool AreComparable(const LogicalType& source_type, const LogicalType& target_type);
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "type_converter.hpp"
+#include <cstdint>
+
+namespace duckdb {
+
+/**
+ * @brief What to do with a value that does not fit the target precision
+ */
+enum class DecimalOverflowPolicy : uint8_t {
+    ERROR = 0,    // Fail the whole vector, naming the first offending row
+    SET_NULL,     // Store NULL for the row
+    SATURATE      // Store the largest magnitude the target can hold, with the value's sign
+};
+
+/**
+ * @brief Rows of one Rescale call that did not convert exactly (NULL inputs excluded)
+ */
+struct DecimalRescaleStats {
+    idx_t rows_rounded;        // Fractional digits dropped by a scale reduction
+    idx_t rows_out_of_range;   // Exceeded the target precision; handled by the policy
+};
+
+/**
+ * @brief Data-level companion to SnowflakeTypeConverter::AdjustDecimalForSnowflake
+ *
+ * Moves decimal (or integer) values from their DuckDB storage to the storage
+ * of another DECIMAL(p,s): rescales by a power of ten (rounding half away
+ * from zero when the scale shrinks) and checks every row against the target
+ * precision. When both sides fit in 64 bits the rescale and the range check
+ * run as one branch-free loop per block; only blocks that rounded or
+ * overflowed are revisited row by row to apply the policy.
+ */
+class DecimalRescaleKernel {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    /**
+     * @brief Snowflake-compatible DECIMAL for a source type
+     * @param source_type DECIMAL or integer type (TINYINT .. HUGEINT)
+     * @return DECIMAL with the precision/scale AdjustDecimalForSnowflake picks
+     *         (integers as scale 0), or INVALID for other types
+     */
+    static LogicalType GetSnowflakeDecimalType(const LogicalType& source_type);
+
+    /**
+     * @brief Rescale `count` rows of `source` into `result`
+     * @param source DECIMAL or integer vector (any vector type)
+     * @param count Number of rows
+     * @param result FLAT vector whose type (a DECIMAL) is the target
+     * @param policy Handling of values exceeding the target precision
+     * @return Rounded/out-of-range row counts, or the first failing row under ERROR
+     */
+    static ConversionResult<DecimalRescaleStats>
+    Rescale(Vector& source, idx_t count, Vector& result, DecimalOverflowPolicy policy = DecimalOverflowPolicy::ERROR);
+
+    /**
+     * @brief Rescale into GetSnowflakeDecimalType(source type)
+     * @param result FLAT vector created with GetSnowflakeDecimalType(source.GetType())
+     */
+    static ConversionResult<DecimalRescaleStats>
+    AdjustForSnowflake(Vector& source, idx_t count, Vector& result,
+                       DecimalOverflowPolicy policy = DecimalOverflowPolicy::ERROR);
+};
+
+} // namespace duckdb
\ No newline at end of file
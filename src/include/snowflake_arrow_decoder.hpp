@@ -0,0 +1,186 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "type_converter.hpp"
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * @brief Dictionary of an Arrow dictionary column, decoded once and shared by its slices
+ *
+ * Dictionary-encoded columns decode into DuckDB DICTIONARY vectors over this
+ * vector, so a batch's dictionary is decoded once instead of once per row.
+ * The entry is reused for as long as the Arrow dictionary stays the same (an
+ * IPC stream keeps it across batches until it is replaced).
+ */
+struct SnowflakeDecodedDictionary {
+    // Arrow dictionary the values were decoded from (held so its address identifies it)
+    std::shared_ptr<arrow::ArrayData> source;
+    // Dictionary values followed by one NULL, which null indices select
+    std::unique_ptr<Vector> values;
+};
+
+/**
+ * @brief Decodes one Snowflake result column from Arrow into DuckDB vectors
+ *
+ * Snowflake picks the Arrow encoding per batch: NUMBER(p,s) arrives as the
+ * narrowest scaled int8/16/32/64 that fits the batch (or decimal128), TIME and
+ * TIMESTAMP_* as int64 scaled by 10^scale or as a struct of epoch seconds plus
+ * nanosecond fraction (plus timezone), DATE as int32 days. The decoder is
+ * bound to the DuckDB type ConvertSnowflakeToDuckDB produced for the column
+ * and selects a kernel per batch from the Arrow type it actually receives.
+ *
+ * Dictionary-encoded columns (dictionary<int*, T>) are decoded into DICTIONARY
+ * vectors: the dictionary goes through the kernel for T, the indices become
+ * the selection vector.
+ *
+ * VARCHAR and BLOB (utf8, binary, their large_ and _view variants) are not
+ * copied: strings longer than string_t::INLINE_LENGTH point into the Arrow
+ * data buffers, which the result vector's string heap keeps alive.
+ */
+class SnowflakeColumnDecoder {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    /**
+     * Field metadata key holding the power of ten Snowflake scaled the values by
+     */
+    static constexpr const char* SCALE_METADATA_KEY = "scale";
+    /**
+     * Field metadata keys Snowflake uses to describe the column type
+     */
+    static constexpr const char* LOGICAL_TYPE_METADATA_KEY = "logicalType";
+    static constexpr const char* PRECISION_METADATA_KEY = "precision";
+
+    SnowflakeColumnDecoder() = default;
+
+    /**
+     * @brief Bind a result field to its DuckDB target type
+     * @param field Arrow field as returned by the driver (metadata is consulted for "scale")
+     * @param target_type DuckDB type, normally ConvertSnowflakeToDuckDB of the column type
+     * @return Decoder, or error if no kernel produces the target type
+     */
+    static ConversionResult<SnowflakeColumnDecoder>
+    Create(const arrow::Field& field, const LogicalType& target_type);
+
+    /**
+     * @brief Snowflake column type of a result field
+     *
+     * Built from the "logicalType" / "precision" / "scale" field metadata
+     * Snowflake attaches to its Arrow results (FIXED becomes NUMBER(p,s),
+     * temporal types take their scale); fields without it fall back to the Arrow type.
+     */
+    static ConversionResult<std::string> ResolveSnowflakeType(const arrow::Field& field);
+
+    /**
+     * @brief DuckDB type a Snowflake column is read as, given the type its Snowflake type maps to
+     *
+     * Snowflake sends OBJECT, ARRAY and MAP values, structured or not, as JSON
+     * text like VARIANT, so the STRUCT / LIST / MAP they map to is read as
+     * VARCHAR. Every other type is returned unchanged. CreateFromSnowflakeTypes
+     * applies it to fields whose Arrow type holds text.
+     */
+    static LogicalType GetReadType(const LogicalType& type);
+
+    /**
+     * @brief Decode rows [offset, offset + count) of a batch column
+     * @param source Arrow column of the current batch
+     * @param offset First row of the batch to decode
+     * @param count Number of rows (at most the capacity of `result`)
+     * @param result Writable FLAT vector of the target type (a DICTIONARY vector on return
+     *        if the source is dictionary-encoded)
+     * @param dictionary Decoded dictionary reused across calls (nullptr decodes it for this call only)
+     * @return Rows decoded, or error (e.g. a value out of range for the target)
+     */
+    ConversionResult<idx_t> Decode(const arrow::Array& source, idx_t offset, idx_t count, Vector& result,
+                                   SnowflakeDecodedDictionary* dictionary = nullptr) const;
+
+    const LogicalType& GetTargetType() const { return target_type_; }
+
+    /**
+     * @brief Power of ten the integer-encoded source values are scaled by
+     */
+    int32_t GetSourceScale() const { return source_scale_; }
+
+private:
+    ConversionResult<idx_t> DecodeDictionary(const arrow::ArrayData& source, idx_t offset, idx_t count,
+                                             Vector& result, SnowflakeDecodedDictionary& dictionary) const;
+
+    LogicalType target_type_;
+    int32_t source_scale_ = 0;
+};
+
+/**
+ * @brief Decodes whole Snowflake record batches into DataChunks
+ */
+class SnowflakeBatchDecoder {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    SnowflakeBatchDecoder() = default;
+
+    /**
+     * @brief Bind every field of a result schema to a DuckDB type
+     * @param schema Result schema reported by the driver
+     * @param target_types One DuckDB type per field
+     * @return Decoder, or one error listing every column that cannot be decoded
+     */
+    static ConversionResult<SnowflakeBatchDecoder>
+    Create(const arrow::Schema& schema, const std::vector<LogicalType>& target_types);
+
+    /**
+     * @brief Bind a result schema using the Snowflake column types (e.g. from DESCRIBE)
+     * @param schema Result schema reported by the driver
+     * @param snowflake_types One Snowflake type string per field
+     * @param exact_timestamps Decode TIMESTAMP_NTZ(p) into TIMESTAMP_NS / _MS / _S when p needs it
+     *        (see SnowflakeTypeParseResult::ExactTemporalType). Otherwise every temporal
+     *        column reads at microsecond resolution and finer fractions are truncated.
+     */
+    static ConversionResult<SnowflakeBatchDecoder>
+    CreateFromSnowflakeTypes(const arrow::Schema& schema, const std::vector<std::string>& snowflake_types,
+                             bool exact_timestamps = false);
+
+    /**
+     * @brief Bind a result schema on its own (see SnowflakeColumnDecoder::ResolveSnowflakeType)
+     * @param schema Result schema reported by the driver
+     * @param exact_timestamps See CreateFromSnowflakeTypes
+     */
+    static ConversionResult<SnowflakeBatchDecoder> CreateFromSchema(const arrow::Schema& schema,
+                                                                    bool exact_timestamps = false);
+
+    /**
+     * @brief Decode the next slice of a batch into a chunk
+     * @param batch Arrow record batch matching the bound schema
+     * @param offset First row of the batch to decode
+     * @param output Chunk initialized with GetTypes(); reset before decoding
+     * @param dictionaries Per-column decoded dictionaries kept by the caller across
+     *        slices and batches (nullptr decodes dictionaries for this call only)
+     * @param column_ns One counter per column that receives the nanoseconds spent
+     *        decoding it (nullptr to skip timing)
+     * @return Rows decoded: min(batch rows - offset, output capacity), or error
+     */
+    ConversionResult<idx_t> Decode(const arrow::RecordBatch& batch, idx_t offset, DataChunk& output,
+                                   std::vector<SnowflakeDecodedDictionary>* dictionaries = nullptr,
+                                   std::atomic<uint64_t>* column_ns = nullptr) const;
+
+    const std::vector<LogicalType>& GetTypes() const { return types_; }
+    const std::vector<std::string>& GetNames() const { return names_; }
+
+private:
+    std::vector<std::string> names_;
+    std::vector<LogicalType> types_;
+    std::vector<SnowflakeColumnDecoder> columns_;
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/storage_extension.hpp"
+#include "duckdb/transaction/transaction_manager.hpp"
+#include "adbc_connector.hpp"
+#include "snowflake_schema_cache.hpp"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace duckdb {
+
+class SnowflakeCatalog;
+
+/**
+ * @brief Snowflake table as seen by the DuckDB binder
+ *
+ * Holds the columns whose Snowflake types convert to DuckDB; columns with no
+ * equivalent are left out, and OBJECT, ARRAY and MAP columns appear as
+ * VARCHAR holding their JSON text. Scans bind snowflake_scan to a query selecting
+ * those columns from the table, so projection and filter pushdown apply as
+ * for any snowflake_scan.
+ */
+class SnowflakeTableEntry : public TableCatalogEntry {
+public:
+    SnowflakeTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info,
+                        std::shared_ptr<const SnowflakeTableInfo> table);
+
+    unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id) override;
+    TableFunction GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) override;
+    TableStorageInfo GetStorageInfo(ClientContext &context) override;
+
+    /**
+     * @brief Metadata the entry was built from
+     */
+    const std::shared_ptr<const SnowflakeTableInfo> &GetTableInfo() const { return table_; }
+
+    /**
+     * @brief Build an entry, or nullptr if no column of the table converts to DuckDB
+     */
+    static unique_ptr<SnowflakeTableEntry> Create(Catalog &catalog, SchemaCatalogEntry &schema,
+                                                  std::shared_ptr<const SnowflakeTableInfo> table);
+
+private:
+    std::shared_ptr<const SnowflakeTableInfo> table_;
+    // SELECT <columns> FROM database."SCHEMA"."TABLE"
+    std::string query_;
+};
+
+/**
+ * @brief Snowflake schema whose tables are resolved on first reference
+ *
+ * Table lookups go through SnowflakeSchemaCache, so the first one loads the
+ * whole schema with one INFORMATION_SCHEMA query and later ones are served
+ * from memory. An entry is rebuilt when the cache has reloaded its table;
+ * the previous one stays alive until the database is detached, as queries
+ * bound earlier may still reference it.
+ */
+class SnowflakeSchemaEntry : public SchemaCatalogEntry {
+public:
+    SnowflakeSchemaEntry(Catalog &catalog, CreateSchemaInfo &info);
+
+    optional_ptr<CatalogEntry> GetEntry(CatalogTransaction transaction, CatalogType type,
+                                        const string &name) override;
+    void Scan(ClientContext &context, CatalogType type, const std::function<void(CatalogEntry &)> &callback) override;
+    void Scan(CatalogType type, const std::function<void(CatalogEntry &)> &callback) override;
+
+    optional_ptr<CatalogEntry> CreateIndex(CatalogTransaction transaction, CreateIndexInfo &info,
+                                           TableCatalogEntry &table) override;
+    optional_ptr<CatalogEntry> CreateFunction(CatalogTransaction transaction, CreateFunctionInfo &info) override;
+    optional_ptr<CatalogEntry> CreateTable(CatalogTransaction transaction, BoundCreateTableInfo &info) override;
+    optional_ptr<CatalogEntry> CreateView(CatalogTransaction transaction, CreateViewInfo &info) override;
+    optional_ptr<CatalogEntry> CreateSequence(CatalogTransaction transaction, CreateSequenceInfo &info) override;
+    optional_ptr<CatalogEntry> CreateTableFunction(CatalogTransaction transaction,
+                                                   CreateTableFunctionInfo &info) override;
+    optional_ptr<CatalogEntry> CreateCopyFunction(CatalogTransaction transaction,
+                                                  CreateCopyFunctionInfo &info) override;
+    optional_ptr<CatalogEntry> CreatePragmaFunction(CatalogTransaction transaction,
+                                                    CreatePragmaFunctionInfo &info) override;
+    optional_ptr<CatalogEntry> CreateCollation(CatalogTransaction transaction, CreateCollationInfo &info) override;
+    optional_ptr<CatalogEntry> CreateType(CatalogTransaction transaction, CreateTypeInfo &info) override;
+    void DropEntry(ClientContext &context, DropInfo &info) override;
+    void Alter(CatalogTransaction transaction, AlterInfo &info) override;
+
+private:
+    /**
+     * @brief Current entry for a table, rebuilt if its metadata was reloaded
+     */
+    optional_ptr<SnowflakeTableEntry> GetTableEntry(const std::shared_ptr<const SnowflakeTableInfo> &table);
+
+    std::mutex lock_;
+    // By table name as stored in Snowflake
+    std::unordered_map<std::string, unique_ptr<SnowflakeTableEntry>> tables_;
+    // Entries replaced after a reload; queries bound to them may still be running
+    vector<unique_ptr<SnowflakeTableEntry>> retired_;
+};
+
+/**
+ * @brief Catalog of an ATTACHed Snowflake database
+ *
+ * ATTACH only parses the connection string: no session is opened and no
+ * metadata is read, so attaching costs the same for any number of tables.
+ * A schema is resolved on first reference by loading its tables (trying the
+ * upper-cased name first, as Snowflake stores unquoted identifiers in upper
+ * case); listing every table (e.g. duckdb_tables()) loads the whole database
+ * with one query. Only schemas that have tables can be referenced.
+ *
+ * Sessions are leased from SnowflakeConnectionPool. INSERT goes through
+ * SnowflakeIngestPipeline; other DDL and DML are not supported.
+ */
+class SnowflakeCatalog : public Catalog {
+public:
+    SnowflakeCatalog(AttachedDatabase &db, SnowflakeConfig config);
+
+    void Initialize(bool load_builtin) override;
+    string GetCatalogType() override { return "snowflake"; }
+    string GetDefaultSchema() const override;
+
+    optional_ptr<CatalogEntry> CreateSchema(CatalogTransaction transaction, CreateSchemaInfo &info) override;
+    void ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) override;
+    optional_ptr<SchemaCatalogEntry> GetSchema(CatalogTransaction transaction, const string &schema_name,
+                                               OnEntryNotFound if_not_found,
+                                               QueryErrorContext error_context = QueryErrorContext()) override;
+
+    unique_ptr<PhysicalOperator> PlanInsert(ClientContext &context, LogicalInsert &op,
+                                            unique_ptr<PhysicalOperator> plan) override;
+    unique_ptr<PhysicalOperator> PlanCreateTableAs(ClientContext &context, LogicalCreateTable &op,
+                                                   unique_ptr<PhysicalOperator> plan) override;
+    unique_ptr<PhysicalOperator> PlanDelete(ClientContext &context, LogicalDelete &op,
+                                            unique_ptr<PhysicalOperator> plan) override;
+    unique_ptr<PhysicalOperator> PlanUpdate(ClientContext &context, LogicalUpdate &op,
+                                            unique_ptr<PhysicalOperator> plan) override;
+    unique_ptr<LogicalOperator> BindCreateIndex(Binder &binder, CreateStatement &stmt, TableCatalogEntry &table,
+                                                unique_ptr<LogicalOperator> plan) override;
+
+    DatabaseSize GetDatabaseSize(ClientContext &context) override;
+    bool InMemory() override { return false; }
+    string GetDBPath() override { return config_.database; }
+    void DropSchema(ClientContext &context, DropInfo &info) override;
+
+    const SnowflakeConfig &GetConfig() const { return config_; }
+
+    /**
+     * @brief Lease a session for this database (throws on connection failure)
+     */
+    std::shared_ptr<SnowflakeADBCConnector> Connect();
+
+private:
+    /**
+     * @brief Entry for a schema known to exist, created on first use
+     */
+    SnowflakeSchemaEntry &GetSchemaEntry(const std::string &name);
+
+    SnowflakeConfig config_;
+    std::mutex lock_;
+    // By schema name as stored in Snowflake; entries live as long as the catalog
+    std::unordered_map<std::string, unique_ptr<SnowflakeSchemaEntry>> schemas_;
+};
+
+/**
+ * @brief Transactions of an attached Snowflake database
+ *
+ * Snowflake statements commit on their own (an INSERT is committed by the
+ * bulk load), so transactions only track which DuckDB transactions are open.
+ */
+class SnowflakeTransactionManager : public TransactionManager {
+public:
+    explicit SnowflakeTransactionManager(AttachedDatabase &db);
+
+    Transaction &StartTransaction(ClientContext &context) override;
+    ErrorData CommitTransaction(ClientContext &context, Transaction &transaction) override;
+    void RollbackTransaction(Transaction &transaction) override;
+    void Checkpoint(ClientContext &context, bool force = false) override;
+
+private:
+    std::mutex lock_;
+    reference_map_t<Transaction, unique_ptr<Transaction>> transactions_;
+};
+
+/**
+ * @brief ATTACH '<connection string>' AS name (TYPE snowflake [, READ_ONLY])
+ */
+class SnowflakeStorageExtension : public StorageExtension {
+public:
+    SnowflakeStorageExtension();
+};
+
+} // namespace duckdb
\ No newline at end of file
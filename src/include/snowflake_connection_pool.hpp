@@ -0,0 +1,134 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "adbc_connector.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace duckdb {
+
+/**
+ * @brief Sizing, eviction and health-check settings of SnowflakeConnectionPool
+ */
+struct SnowflakePoolOptions {
+    // Sessions kept open per configuration even when idle
+    idx_t min_size = 0;
+    // Sessions per configuration, leased and idle together
+    idx_t max_size = 8;
+    // Idle sessions above min_size are closed after this long
+    std::chrono::milliseconds idle_timeout = std::chrono::minutes(5);
+    // Sessions idle longer than this are health-checked before reuse
+    std::chrono::milliseconds health_check_after = std::chrono::seconds(30);
+    // Longest Acquire waits for a session when max_size are leased
+    std::chrono::milliseconds acquire_timeout = std::chrono::seconds(30);
+    // Returns false if the session is unusable; defaults to SnowflakeADBCConnector::Ping
+    std::function<bool(SnowflakeADBCConnector &)> health_check;
+};
+
+/**
+ * @brief Counters of a pool since it was created
+ */
+struct SnowflakePoolMetrics {
+    uint64_t leases = 0;
+    uint64_t hits = 0;                  // Leases served by an idle session
+    uint64_t misses = 0;                // Leases that opened a new session
+    uint64_t waits = 0;                 // Leases that waited for a session to be returned
+    uint64_t total_wait_micros = 0;
+    uint64_t max_wait_micros = 0;
+    uint64_t evictions = 0;             // Idle sessions closed after idle_timeout
+    uint64_t health_check_failures = 0;
+    idx_t open_sessions = 0;            // Leased plus idle
+    idx_t idle_sessions = 0;
+};
+
+/**
+ * @brief Process-wide pool of connected SnowflakeADBCConnector sessions
+ *
+ * Sessions are keyed by SnowflakeConfig identity (driver, URI and
+ * credentials), so queries against the same account reuse warm sessions
+ * instead of paying the handshake. A lease is a shared_ptr whose deleter
+ * returns the session to the pool; a session that was disconnected while
+ * leased is closed instead. Leasing is safe from any thread.
+ *
+ * Idle sessions are reused most-recently-returned first, so the warmest
+ * session serves the next query and surplus ones age out. Eviction runs
+ * lazily on Acquire and return (and on EvictIdle), without a background
+ * thread.
+ */
+class SnowflakeConnectionPool {
+public:
+    explicit SnowflakeConnectionPool(SnowflakePoolOptions options = SnowflakePoolOptions());
+    ~SnowflakeConnectionPool();
+
+    SnowflakeConnectionPool(const SnowflakeConnectionPool &) = delete;
+    SnowflakeConnectionPool &operator=(const SnowflakeConnectionPool &) = delete;
+
+    /**
+     * @brief Pool shared by every database in the process
+     */
+    static SnowflakeConnectionPool &Get();
+
+    /**
+     * @brief Replace the options; applies to later leases of every configuration
+     */
+    void Configure(const SnowflakePoolOptions &options);
+
+    /**
+     * @brief Lease a connected session
+     * @param config Connection configuration
+     * @return Session (returned to the pool when the last copy is released) or error
+     */
+    std::pair<std::shared_ptr<SnowflakeADBCConnector>, string> Acquire(const SnowflakeConfig &config);
+
+    /**
+     * @brief Open idle sessions ahead of the first query
+     * @param config Connection configuration
+     * @param count Sessions to have open (capped at max_size)
+     * @return Empty on success, or the first connection error
+     */
+    string Warm(const SnowflakeConfig &config, idx_t count);
+
+    /**
+     * @brief Close idle sessions past idle_timeout now
+     */
+    void EvictIdle();
+
+    SnowflakePoolMetrics GetMetrics() const;
+
+private:
+    struct Slot;
+
+    std::shared_ptr<Slot> GetSlot(const SnowflakeConfig &config);
+    std::shared_ptr<SnowflakeADBCConnector> Wrap(const std::shared_ptr<Slot> &slot,
+                                                 std::unique_ptr<SnowflakeADBCConnector> connector);
+    SnowflakePoolOptions GetOptions() const;
+
+    mutable std::mutex lock_;
+    SnowflakePoolOptions options_;
+    std::unordered_map<std::string, std::shared_ptr<Slot>> slots_;
+
+    std::atomic<uint64_t> leases_ {0};
+    std::atomic<uint64_t> hits_ {0};
+    std::atomic<uint64_t> misses_ {0};
+    std::atomic<uint64_t> waits_ {0};
+    std::atomic<uint64_t> total_wait_micros_ {0};
+    std::atomic<uint64_t> max_wait_micros_ {0};
+    std::atomic<uint64_t> evictions_ {0};
+    std::atomic<uint64_t> health_check_failures_ {0};
+};
+
+/**
+ * @brief snowflake_pool_stats() table function: one row of SnowflakePoolMetrics
+ */
+struct SnowflakePoolStatsFunction {
+    static TableFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
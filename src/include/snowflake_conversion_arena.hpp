@@ -0,0 +1,102 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/allocator.hpp"
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * @brief Per-thread scratch memory for the temporaries of one batch conversion
+ *
+ * Conversion kernels need short-lived buffers on every batch: selections that
+ * gather list children, the hash table that dictionary-encodes strings,
+ * validity words gathered before it is known whether any row is null. Taking
+ * them from the heap means several allocations per column per batch, and with
+ * many threads converting at once the allocator becomes a point of contention.
+ *
+ * Each thread has one arena (Get). Allocate bumps a pointer into the current
+ * block; a request that does not fit starts a block twice as large. Reset
+ * rewinds the arena in O(1). If the batch needed more than one block, Reset
+ * merges them into a single block of their combined size, so that block
+ * covers the next batch of the same shape. Once a thread has converted its
+ * largest batch, conversion takes no scratch memory from the heap.
+ *
+ * Memory is only valid until the next Reset. Kernels open a Scope and the
+ * outermost Scope resets the arena when it closes, so nothing allocated here
+ * may end up in a conversion's result.
+ */
+class SnowflakeConversionArena {
+public:
+    static constexpr idx_t INITIAL_CAPACITY = 64 * 1024;
+    // A merged block larger than this is released on Reset instead of kept
+    static constexpr idx_t MAX_RETAINED_CAPACITY = 16 * 1024 * 1024;
+    // Every allocation is aligned to this many bytes
+    static constexpr idx_t ALIGNMENT = 16;
+
+    /**
+     * @brief Closes one level of batch scope; the outermost Scope resets the arena
+     */
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        SnowflakeConversionArena &GetArena() {
+            return arena_;
+        }
+
+    private:
+        SnowflakeConversionArena &arena_;
+    };
+
+    /**
+     * @brief This thread's arena
+     */
+    static SnowflakeConversionArena &Get();
+
+    SnowflakeConversionArena() = default;
+    SnowflakeConversionArena(const SnowflakeConversionArena &) = delete;
+    SnowflakeConversionArena &operator=(const SnowflakeConversionArena &) = delete;
+
+    /**
+     * @brief Uninitialized scratch memory, valid until the next Reset
+     */
+    data_ptr_t Allocate(idx_t size);
+
+    template<typename T>
+    T *AllocateArray(idx_t count) {
+        return reinterpret_cast<T *>(Allocate(count * sizeof(T)));
+    }
+
+    /**
+     * @brief Release everything allocated since the last Reset
+     */
+    void Reset();
+
+    // Bytes handed out since the last Reset
+    idx_t GetUsed() const {
+        return used_;
+    }
+    // Bytes held in blocks
+    idx_t GetCapacity() const;
+    // Blocks taken from the heap over the arena's lifetime
+    idx_t GetBlockAllocations() const {
+        return block_allocations_;
+    }
+
+private:
+    void AddBlock(idx_t size);
+
+    std::vector<AllocatedData> blocks_;
+    // Offset of the next allocation in blocks_.back()
+    idx_t position_ = 0;
+    idx_t used_ = 0;
+    idx_t block_allocations_ = 0;
+    idx_t depth_ = 0;
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -40,6 +40,28 @@ private:
      * @param db DatabaseInstance to register with  
      */
     static void RegisterScalarFunctions(DatabaseInstance &db);
+    
+    /**
+     * @brief Register the "snowflake" storage extension used by ATTACH ... (TYPE snowflake)
+     * @param db DatabaseInstance to register with
+     */
+    static void RegisterStorageExtension(DatabaseInstance &db);
+    
+    /**
+     * @brief Register the snowflake_metrics setting (time every transfer)
+     * @param db DatabaseInstance to register with
+     */
+    static void RegisterSettings(DatabaseInstance &db);
+    
+    /**
+     * @brief Pre-open pooled sessions named by SNOWFLAKE_POOL_WARM (and SNOWFLAKE_POOL_WARM_SIZE)
+     */
+    static void WarmConnectionPool();
+    
+    /**
+     * @brief Enable the result cache from SNOWFLAKE_RESULT_CACHE_DIR (and _TTL seconds, _MAX_BYTES)
+     */
+    static void ConfigureResultCache();
 };
 
 } // namespace duckdb
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "adbc_connector.hpp"
+#include "snowflake_metrics.hpp"
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace duckdb {
+
+/**
+ * @brief Target and batching settings of a bulk load
+ */
+struct SnowflakeIngestOptions {
+    std::string table;
+    // Schema of the table; empty for the session's schema
+    std::string schema;
+    SnowflakeIngestMode mode = SnowflakeIngestMode::APPEND;
+    // Rows per record batch handed to the driver
+    idx_t batch_size = 122880;
+    // Converted batches allowed to wait for the upload before Append blocks
+    idx_t max_pending_batches = 4;
+};
+
+/**
+ * @brief Bulk load that uploads while its producers are still converting
+ *
+ * A dedicated upload thread runs SnowflakeADBCConnector::IngestStream over a
+ * bounded queue of record batches. Any number of threads Append converted
+ * batches to the queue, so DuckDB → Arrow conversion of the next batches
+ * overlaps with the driver uploading earlier ones. When the queue is full,
+ * Append blocks: memory stays bounded by max_pending_batches plus the batches
+ * producers are building.
+ *
+ * Given transfer metrics, the pipeline counts the batches sent, times the
+ * driver (excluding its waits for the next batch) and Append's waits on a
+ * full queue.
+ *
+ * If the load is abandoned (Abort, or destruction without Finish), the
+ * stream fails and the driver aborts the ingest; rows already committed by
+ * the driver in APPEND mode are not rolled back.
+ */
+class SnowflakeIngestPipeline {
+public:
+    /**
+     * @brief Start the upload
+     * @param connector Connected session, held until the upload ends
+     * @param schema Schema of every appended batch
+     * @param options Target table, mode and queue depth
+     * @param metrics Counters of the load (optional)
+     */
+    SnowflakeIngestPipeline(std::shared_ptr<SnowflakeADBCConnector> connector, std::shared_ptr<arrow::Schema> schema,
+                            SnowflakeIngestOptions options,
+                            std::shared_ptr<SnowflakeTransferMetrics> metrics = nullptr);
+    ~SnowflakeIngestPipeline();
+
+    SnowflakeIngestPipeline(const SnowflakeIngestPipeline &) = delete;
+    SnowflakeIngestPipeline &operator=(const SnowflakeIngestPipeline &) = delete;
+
+    /**
+     * @brief Queue a batch for upload (thread-safe; blocks while the queue is full)
+     * @return Empty on success, or the upload error once the upload has failed
+     */
+    string Append(std::shared_ptr<arrow::RecordBatch> batch);
+
+    /**
+     * @brief Convert rows with DuckDBToArrowConverter on the calling thread and queue them
+     *
+     * ConvertChunk switches a utf8 / binary column past 2GB to large_utf8 /
+     * large_binary, which the bound stream cannot carry, so such rows are
+     * split in half until each part fits. Conversion is timed into the metrics.
+     * @param rows Gathered rows; the queued arrays may alias its buffers
+     * @param pool Pool for the converted buffers
+     * @param operation Prefix of error messages, e.g. "snowflake COPY"
+     * @throws ConversionException if a row cannot be converted, IOException once the upload has failed
+     */
+    void AppendRows(DataChunk &rows, arrow::MemoryPool *pool, const string &operation);
+
+    /**
+     * @brief End the stream and wait for the driver to finish the load
+     * @return Rows ingested as reported by the driver, or error
+     */
+    std::pair<int64_t, string> Finish();
+
+    /**
+     * @brief Fail the stream so the driver abandons the load, and wait for it
+     */
+    void Abort(const string &reason);
+
+private:
+    class BatchQueue;
+
+    void AppendRows(DataChunk &rows, idx_t offset, idx_t count, arrow::MemoryPool *pool, const string &operation);
+
+    std::shared_ptr<SnowflakeADBCConnector> connector_;
+    std::shared_ptr<SnowflakeTransferMetrics> metrics_;
+    std::shared_ptr<BatchQueue> queue_;
+    std::pair<int64_t, string> result_;
+    std::thread upload_;
+};
+
+/**
+ * @brief COPY ... TO 'snowflake://<connection string>' (FORMAT snowflake, TABLE '<name>' [, MODE ...] [, BATCH_SIZE n]
+ *        [, DICTIONARY true] [, STRING_VIEW true])
+ *
+ * Every DuckDB thread gathers its chunks into batches of BATCH_SIZE rows and
+ * converts them with DuckDBToArrowConverter, then hands them to one
+ * SnowflakeIngestPipeline per COPY. MODE is append (default), create or
+ * replace. Rows are loaded in no particular order, as Snowflake tables are
+ * unordered. DICTIONARY true sends VARCHAR and BLOB columns dictionary-encoded,
+ * which keeps low-cardinality columns small while batches wait for the upload.
+ * STRING_VIEW true sends them as string_view / binary_view arrays built over
+ * the gathered rows' string heap instead of copying every string.
+ *
+ * A batch whose strings outgrow 32-bit offsets is split in half until each
+ * part fits, since the upload stream keeps the schema it was bound with.
+ */
+struct SnowflakeCopyFunction {
+    static CopyFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
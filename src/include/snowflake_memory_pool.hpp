@@ -0,0 +1,156 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "adbc_connector.hpp"
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace duckdb {
+
+class BufferManager;
+
+/**
+ * @brief Counters of one SnowflakeMemoryPool
+ */
+struct SnowflakeMemoryPoolStats {
+    // Bytes held by live allocations plus tracked batches
+    int64_t current_bytes = 0;
+    int64_t peak_bytes = 0;
+    // Freed buffers kept for reuse (still reserved with the buffer manager)
+    int64_t cached_bytes = 0;
+    // Bytes of driver batches counted by Track
+    int64_t tracked_bytes = 0;
+    int64_t allocations = 0;
+    // Allocations served from the cache
+    int64_t reused = 0;
+};
+
+/**
+ * @brief Arrow memory pool drawing from DuckDB's allocator under its memory limit
+ *
+ * Every allocation is first reserved with the database's BufferManager, so
+ * Arrow buffers count against memory_limit like DuckDB's own memory: the
+ * buffer manager evicts unpinned blocks to make room, and the allocation
+ * fails with OutOfMemory once it cannot. The memory comes from the
+ * database's Allocator.
+ *
+ * Sizes up to MAX_CACHED_SIZE are rounded up to a size class (a quarter of a
+ * power of two apart) and freed buffers of those classes are kept, up to
+ * max_cached_bytes, for the next batch, which usually has the same shape.
+ * Batches imported from the ADBC driver are not allocated here; Track counts
+ * them against the limit for as long as any of their buffers is alive.
+ *
+ * A pool serves one query. It is created shared and stays alive until its
+ * last buffer or tracked batch is released, even if that is after the query.
+ */
+class SnowflakeMemoryPool : public arrow::MemoryPool, public std::enable_shared_from_this<SnowflakeMemoryPool> {
+public:
+    static constexpr int64_t MIN_CACHED_SIZE = 4096;
+    static constexpr int64_t MAX_CACHED_SIZE = 16LL << 20;
+    static constexpr int64_t DEFAULT_MAX_CACHED_BYTES = 64LL << 20;
+
+    /**
+     * @brief Pool for a query: the database's allocator, counted against its memory limit
+     */
+    static std::shared_ptr<SnowflakeMemoryPool> Create(ClientContext &context,
+                                                       int64_t max_cached_bytes = DEFAULT_MAX_CACHED_BYTES);
+
+    /**
+     * @brief Pool outside a database: the given allocator, no memory limit
+     */
+    static std::shared_ptr<SnowflakeMemoryPool> Create(Allocator &allocator,
+                                                       int64_t max_cached_bytes = DEFAULT_MAX_CACHED_BYTES);
+
+    ~SnowflakeMemoryPool() override;
+
+    SnowflakeMemoryPool(const SnowflakeMemoryPool &) = delete;
+    SnowflakeMemoryPool &operator=(const SnowflakeMemoryPool &) = delete;
+
+    using arrow::MemoryPool::Allocate;
+    using arrow::MemoryPool::Free;
+    using arrow::MemoryPool::Reallocate;
+
+    arrow::Status Allocate(int64_t size, int64_t alignment, uint8_t **out) override;
+    /**
+     * @brief Grows or shrinks in place while the new size fits the allocation's size class
+     */
+    arrow::Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment, uint8_t **ptr) override;
+    void Free(uint8_t *buffer, int64_t size, int64_t alignment) override;
+
+    /**
+     * @brief Return cached buffers to the allocator and the buffer manager
+     */
+    void ReleaseUnused() override;
+
+    int64_t bytes_allocated() const override;
+    int64_t max_memory() const override;
+    int64_t total_bytes_allocated() const override;
+    int64_t num_allocations() const override;
+    std::string backend_name() const override {
+        return "duckdb";
+    }
+
+    /**
+     * @brief Per column: the last source dictionary of a stream and its tracked copy
+     */
+    using TrackedDictionaries =
+        std::vector<std::pair<std::shared_ptr<arrow::ArrayData>, std::shared_ptr<arrow::ArrayData>>>;
+
+    /**
+     * @brief Count a batch allocated elsewhere (e.g. by the driver) for as long as it is alive
+     * @param batch Batch to count
+     * @param dictionaries Dictionaries seen earlier in the stream; one seen before is reused,
+     *        not counted again, so decoders still recognize it (nullptr tracks the batch alone)
+     * @return The same data over buffers that release the reservation when freed, or OutOfMemory
+     */
+    arrow::Result<std::shared_ptr<arrow::RecordBatch>> Track(const std::shared_ptr<arrow::RecordBatch> &batch,
+                                                             TrackedDictionaries *dictionaries = nullptr);
+
+    /**
+     * @brief Wrap a result stream so that every batch it returns is tracked
+     */
+    std::unique_ptr<SnowflakeResultStream> Track(std::unique_ptr<SnowflakeResultStream> stream);
+
+    SnowflakeMemoryPoolStats GetStats() const;
+
+private:
+    class Reservation;
+
+    SnowflakeMemoryPool(Allocator &allocator, BufferManager *buffer_manager, shared_ptr<DatabaseInstance> database,
+                        int64_t max_cached_bytes);
+
+    // Reserve with the buffer manager, dropping the cache once if that is what it takes
+    arrow::Status Reserve(int64_t bytes);
+    void Unreserve(int64_t bytes);
+    void ReleaseCache();
+    // Under lock_: count an allocation and keep the pool alive while it is outstanding
+    void RecordAllocation(int64_t size, int64_t footprint);
+    // Under lock_: returns the pool's reference to itself once nothing is outstanding,
+    // to be dropped after unlocking
+    std::shared_ptr<SnowflakeMemoryPool> RecordFree(int64_t footprint);
+    void RaisePeak();
+
+    Allocator &allocator_;
+    BufferManager *buffer_manager_;
+    shared_ptr<DatabaseInstance> database_;
+    int64_t max_cached_bytes_;
+
+    mutable std::mutex lock_;
+    // Size class → freed blocks (aligned pointers) of that class
+    std::map<int64_t, std::vector<uint8_t *>> cache_;
+    int64_t cached_bytes_ = 0;
+    int64_t allocated_bytes_ = 0;
+    int64_t tracked_bytes_ = 0;
+    int64_t peak_bytes_ = 0;
+    int64_t total_allocated_bytes_ = 0;
+    int64_t allocations_ = 0;
+    int64_t reused_ = 0;
+    idx_t outstanding_ = 0;
+    std::shared_ptr<SnowflakeMemoryPool> self_;
+};
+
+} // namespace duckdb
\ No newline at end of file
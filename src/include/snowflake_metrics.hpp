@@ -0,0 +1,234 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "adbc_connector.hpp"
+#include <arrow/record_batch.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * @brief Operator a transfer runs in
+ */
+enum class SnowflakeTransferKind : uint8_t {
+    SCAN = 0,   // snowflake_scan and reads of attached tables
+    COPY,       // COPY ... TO 'snowflake://...'
+    INSERT      // INSERT INTO an attached table
+};
+
+/**
+ * @brief Adds the time between construction and destruction to a counter
+ *
+ * A null counter disables it: the clock is never read, so an untimed
+ * transfer pays one branch per timed section.
+ */
+class SnowflakeScopedTimer {
+public:
+    explicit SnowflakeScopedTimer(std::atomic<uint64_t> *counter) : counter_(counter) {
+        if (counter_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~SnowflakeScopedTimer() {
+        if (counter_) {
+            auto elapsed =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+            counter_->fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+        }
+    }
+
+    SnowflakeScopedTimer(const SnowflakeScopedTimer &) = delete;
+    SnowflakeScopedTimer &operator=(const SnowflakeScopedTimer &) = delete;
+
+private:
+    std::atomic<uint64_t> *counter_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Counters of one transfer, updated by every thread taking part in it
+ *
+ * Batches, rows and bytes (Arrow buffer sizes) fetched or sent are always
+ * counted, once per batch. Times are only taken when the transfer is timed:
+ * Time and ColumnTimes return nullptr otherwise, which SnowflakeScopedTimer
+ * and the conversion kernels skip.
+ *
+ * - driver_ns: executing the query, fetching batches, uploading them
+ * - convert_ns: Arrow → DuckDB decoding (scans) or DuckDB → Arrow conversion (loads)
+ * - queue_wait_ns: threads blocked on a full or empty batch queue
+ *
+ * Created by SnowflakeMetrics::Begin; the counters are added to the process
+ * totals when the last reference is released.
+ */
+class SnowflakeTransferMetrics : public std::enable_shared_from_this<SnowflakeTransferMetrics> {
+public:
+    SnowflakeTransferMetrics(SnowflakeTransferKind kind, std::vector<std::string> column_names, bool timed);
+
+    SnowflakeTransferMetrics(const SnowflakeTransferMetrics &) = delete;
+    SnowflakeTransferMetrics &operator=(const SnowflakeTransferMetrics &) = delete;
+
+    SnowflakeTransferKind GetKind() const {
+        return kind_;
+    }
+
+    bool IsTimed() const {
+        return timed_;
+    }
+
+    const std::vector<std::string> &GetColumnNames() const {
+        return column_names_;
+    }
+
+    /**
+     * @brief Counter to time a section into, or nullptr when the transfer is not timed
+     */
+    std::atomic<uint64_t> *Time(std::atomic<uint64_t> &counter) {
+        return timed_ ? &counter : nullptr;
+    }
+
+    /**
+     * @brief One conversion counter per column, or nullptr when the transfer is not timed
+     */
+    std::atomic<uint64_t> *ColumnTimes() {
+        return timed_ ? column_ns_.get() : nullptr;
+    }
+
+    uint64_t GetColumnNanos(idx_t column) const {
+        return column_ns_[column].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Count a batch fetched or sent
+     */
+    void AddBatch(const arrow::RecordBatch &batch);
+
+    /**
+     * @brief Stream that counts every batch read from `stream`, timing the reads as driver time
+     */
+    std::unique_ptr<SnowflakeResultStream> Track(std::unique_ptr<SnowflakeResultStream> stream);
+
+    /**
+     * @brief Add the counters as EXPLAIN ANALYZE entries
+     */
+    void ToString(InsertionOrderPreservingMap<string> &result) const;
+
+    std::atomic<uint64_t> batches {0};
+    std::atomic<uint64_t> rows {0};
+    std::atomic<uint64_t> bytes {0};
+    std::atomic<uint64_t> driver_ns {0};
+    std::atomic<uint64_t> convert_ns {0};
+    std::atomic<uint64_t> queue_wait_ns {0};
+
+private:
+    SnowflakeTransferKind kind_;
+    std::vector<std::string> column_names_;
+    std::unique_ptr<std::atomic<uint64_t>[]> column_ns_;
+    bool timed_;
+};
+
+/**
+ * @brief Sum of the finished transfers of one kind
+ */
+struct SnowflakeTransferTotals {
+    uint64_t transfers = 0;
+    uint64_t batches = 0;
+    uint64_t rows = 0;
+    uint64_t bytes = 0;
+    uint64_t driver_ns = 0;
+    uint64_t convert_ns = 0;
+    uint64_t queue_wait_ns = 0;
+    // Conversion time by column name, over every timed transfer
+    std::map<std::string, uint64_t> column_ns;
+};
+
+/**
+ * @brief Process-wide transfer and decimal rescale counters behind snowflake_metrics()
+ *
+ * Every scan, COPY and INSERT gets a SnowflakeTransferMetrics from Begin and
+ * is added to the totals of its kind when it finishes. Transfers are timed
+ * when TimingEnabled: under EXPLAIN ANALYZE (or another enabled profiler), or
+ * with SET snowflake_metrics = true. Counting is always on.
+ *
+ * The rescale counters come from DecimalRescaleKernel::Rescale alone. No
+ * scan, COPY or INSERT rescales (DuckDB decimals fit Snowflake's NUMBER as
+ * they are), so they only move for code that calls the kernel directly.
+ */
+class SnowflakeMetrics {
+public:
+    /**
+     * @brief Counters shared by every database in the process
+     */
+    static SnowflakeMetrics &Get();
+
+    /**
+     * @brief Whether transfers of the current query should be timed
+     */
+    static bool TimingEnabled(ClientContext &context);
+
+    /**
+     * @brief Counters for a new transfer, added to the totals once released
+     * @param column_names Columns decoded or converted, in order
+     */
+    std::shared_ptr<SnowflakeTransferMetrics> Begin(SnowflakeTransferKind kind, std::vector<std::string> column_names,
+                                                    bool timed);
+
+    /**
+     * @brief Count rows of a DecimalRescaleKernel call: rounded, and exceeding the target precision
+     */
+    void AddRescale(uint64_t rows_rounded, uint64_t rows_rejected);
+
+    SnowflakeTransferTotals GetTotals(SnowflakeTransferKind kind) const;
+
+    uint64_t GetRowsRounded() const {
+        return rows_rounded_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetRowsRejected() const {
+        return rows_rejected_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Zero the transfer totals and rescale counters
+     */
+    void Reset();
+
+private:
+    void Merge(const SnowflakeTransferMetrics &metrics);
+
+    mutable std::mutex lock_;
+    std::array<SnowflakeTransferTotals, 3> totals_;
+    std::atomic<uint64_t> rows_rounded_ {0};
+    std::atomic<uint64_t> rows_rejected_ {0};
+};
+
+/**
+ * @brief snowflake_metrics() table function: one (scope, metric, column_name, value) row per counter
+ *
+ * Transfer totals per kind (scope 'scan', 'copy', 'insert'), conversion time
+ * per column (metric 'column_convert_ms'), DecimalRescaleKernel counters
+ * (scope 'decimal_rescale'), and the
+ * hit rates of the connection pool, result cache, schema cache and type
+ * conversion cache.
+ */
+struct SnowflakeMetricsFunction {
+    static TableFunction GetFunction();
+};
+
+/**
+ * @brief snowflake_reset_metrics() table function: zero the counters of SnowflakeMetrics
+ */
+struct SnowflakeResetMetricsFunction {
+    static TableFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
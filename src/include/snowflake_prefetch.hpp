@@ -0,0 +1,107 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "adbc_connector.hpp"
+#include <arrow/record_batch.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace duckdb {
+
+/**
+ * @brief Bounds of the batches fetched ahead of the decoders
+ */
+struct SnowflakePrefetchOptions {
+    // Batches fetched ahead; 0 disables prefetching
+    idx_t max_batches = 4;
+    // Bytes of Arrow buffers fetched ahead (one batch is always admitted, however large)
+    uint64_t max_bytes = 64ULL << 20;
+};
+
+/**
+ * @brief Counters shared by the prefetching readers of one scan
+ *
+ * Fetch stalls are decoders waiting for the network: the queue was empty.
+ * Queue-full stalls are the I/O thread waiting for decoders: fetching is
+ * ahead by the configured bound.
+ */
+struct SnowflakePrefetchStats {
+    std::atomic<uint64_t> batches {0};
+    std::atomic<uint64_t> bytes {0};
+    std::atomic<uint64_t> fetch_stalls {0};
+    std::atomic<uint64_t> fetch_stall_us {0};
+    std::atomic<uint64_t> queue_full_stalls {0};
+    std::atomic<uint64_t> queue_full_stall_us {0};
+    // Largest number of batches and bytes queued at once, by any reader
+    std::atomic<uint64_t> peak_batches {0};
+    std::atomic<uint64_t> peak_bytes {0};
+};
+
+/**
+ * @brief Reads a result ahead of its consumers on a dedicated I/O thread
+ *
+ * The I/O thread pulls batches from the source stream and queues them; the
+ * decoding threads take them from the queue. Fetching the next batch thus
+ * overlaps with decoding the current one instead of following it. The queue
+ * holds at most max_batches batches and max_bytes of buffers, so memory stays
+ * bounded when the network outpaces the decoders. Batches keep their order.
+ *
+ * Source errors are delivered after the batches queued before them.
+ * Destroying the reader stops the I/O thread once its fetch in flight (if
+ * any) returns.
+ */
+class SnowflakePrefetchReader : public arrow::RecordBatchReader {
+public:
+    SnowflakePrefetchReader(std::unique_ptr<SnowflakeResultStream> source, SnowflakePrefetchOptions options,
+                            std::shared_ptr<SnowflakePrefetchStats> stats);
+    ~SnowflakePrefetchReader() override;
+
+    SnowflakePrefetchReader(const SnowflakePrefetchReader &) = delete;
+    SnowflakePrefetchReader &operator=(const SnowflakePrefetchReader &) = delete;
+
+    std::shared_ptr<arrow::Schema> schema() const override;
+
+    /**
+     * @brief Next batch in order (blocks while the I/O thread is fetching it)
+     */
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override;
+
+    /**
+     * @brief Wrap a result stream so it is read ahead
+     * @return The prefetching stream, or source itself when options.max_batches is 0
+     */
+    static std::unique_ptr<SnowflakeResultStream> Wrap(std::unique_ptr<SnowflakeResultStream> source,
+                                                       const SnowflakePrefetchOptions &options,
+                                                       std::shared_ptr<SnowflakePrefetchStats> stats);
+
+private:
+    struct Entry {
+        std::shared_ptr<arrow::RecordBatch> batch;
+        uint64_t bytes;
+    };
+
+    void Fetch();
+
+    std::unique_ptr<SnowflakeResultStream> source_;
+    std::shared_ptr<arrow::Schema> schema_;
+    SnowflakePrefetchOptions options_;
+    std::shared_ptr<SnowflakePrefetchStats> stats_;
+
+    std::mutex lock_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    std::deque<Entry> queue_;
+    uint64_t queued_bytes_ = 0;
+    // Set by the I/O thread at the end of the source (error_ says why, if it failed)
+    bool finished_ = false;
+    string error_;
+    // Set by the destructor to stop the I/O thread
+    bool stopped_ = false;
+    std::thread io_thread_;
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "type_converter.hpp"
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * @brief Rewrites a snowflake_scan query so Snowflake projects and filters
+ *
+ * The user query is wrapped as a derived table:
+ *
+ *     SELECT "a", "b" FROM (<query>) AS "snowflake_scan" WHERE ("a" > 10) AND ("b" IS NOT NULL)
+ *
+ * Filters that cannot be rendered exactly are left out; the scan applies
+ * every pushed filter again in DuckDB, so leaving one out only costs
+ * bandwidth. The re-check cannot restore rows Snowflake dropped, so filters
+ * are only pushed on columns both sides compare alike (see CanPushFilter).
+ */
+struct SnowflakePushdown {
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    /**
+     * @brief Render a DuckDB table filter as a Snowflake predicate
+     * @param column Quoted column name
+     * @param filter Constant comparison, IS [NOT] NULL, IN list, or a conjunction of these
+     * @return Predicate, or error if the filter (or a literal in it) cannot be rendered.
+     *         An AND whose children only partly render returns the renderable part,
+     *         which selects a superset of the rows.
+     */
+    static ConversionResult<std::string> RenderFilter(const std::string& column, const TableFilter& filter);
+
+    /**
+     * @brief Whether Snowflake compares a column of this type the way DuckDB compares the decoded values
+     *
+     * True for text, NUMBER, FLOAT, BOOLEAN, DATE and BINARY, and for TIME /
+     * TIMESTAMP_* of scale 6 or less. VARIANT, OBJECT, ARRAY, MAP and the
+     * geospatial types reach DuckDB as JSON text, and finer temporal scales are
+     * truncated to microseconds, so a Snowflake-side filter could drop rows the
+     * same filter keeps in DuckDB.
+     * @param snowflake_type Column type, e.g. from SnowflakeColumnDecoder::ResolveSnowflakeType
+     */
+    static bool CanPushFilter(const std::string& snowflake_type);
+
+    /**
+     * @brief Wrap the query with a column list and WHERE clause
+     * @param query User query
+     * @param columns Column names to select, in order (empty selects *)
+     * @param predicates Predicates to AND together (may be empty)
+     */
+    static std::string BuildQuery(const std::string& query, const std::vector<std::string>& columns,
+                                  const std::vector<std::string>& predicates);
+
+    /**
+     * @brief Zero-row form of the query, executed at bind to learn the result schema
+     */
+    static std::string BuildSchemaQuery(const std::string& query);
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "adbc_connector.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace duckdb {
+
+/**
+ * @brief Location and bounds of SnowflakeResultCache
+ */
+struct SnowflakeResultCacheOptions {
+    // Directory holding the cached results; empty disables the cache
+    std::string directory;
+    // Results older than this are not served (and are deleted when found)
+    std::chrono::seconds ttl = std::chrono::minutes(15);
+    // Total size of the cached files; least recently used ones are deleted beyond it
+    uint64_t max_bytes = 1ULL << 30;
+};
+
+/**
+ * @brief Counters of a result cache since it was created
+ */
+struct SnowflakeResultCacheMetrics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;            // Results written to the cache
+    uint64_t store_failures = 0;    // Results not stored: read only in part, I/O error, or larger than max_bytes
+    uint64_t evictions = 0;         // Entries deleted to stay within max_bytes
+    uint64_t expirations = 0;       // Entries deleted after their TTL
+    uint64_t bytes_read = 0;        // Bytes of cached files served
+    uint64_t bytes_written = 0;
+    idx_t entries = 0;
+    uint64_t bytes = 0;             // Size of the cached files
+};
+
+/**
+ * @brief Opt-in local cache of query results, kept as Arrow IPC files
+ *
+ * Entries are keyed by the normalized SQL text plus the connection identity
+ * (driver, account, user, database, schema, warehouse, role and options), so
+ * a result is only served to the principal and context that produced it.
+ * Each entry is one Arrow IPC file named by the key's hash; the full key is
+ * kept in the file footer and checked when the file is opened.
+ *
+ * Hits are memory-mapped and read without copying or decoding: the record
+ * batches reference the mapped pages directly. A miss is executed normally
+ * and written to a temporary file while it is read; only a result read to
+ * its end is renamed into place, so readers never see a partial entry.
+ * Deleting an entry (TTL, LRU eviction, Clear) only unlinks the file, so
+ * results already being read from it stay valid.
+ *
+ * Files left by earlier processes are picked up when the cache is
+ * configured. max_bytes bounds the files this process knows about.
+ */
+class SnowflakeResultCache {
+public:
+    explicit SnowflakeResultCache(SnowflakeResultCacheOptions options = SnowflakeResultCacheOptions());
+
+    SnowflakeResultCache(const SnowflakeResultCache &) = delete;
+    SnowflakeResultCache &operator=(const SnowflakeResultCache &) = delete;
+
+    /**
+     * @brief Cache shared by every database in the process (disabled until configured)
+     */
+    static SnowflakeResultCache &Get();
+
+    /**
+     * @brief Replace the options and index the files already in the directory
+     * @return Empty on success, or error if the directory cannot be created
+     */
+    string Configure(const SnowflakeResultCacheOptions &options);
+
+    bool IsEnabled() const;
+
+    /**
+     * @brief Run a query through the cache
+     * @param connector Connected session, used on a miss
+     * @param sql Query text
+     * @return Cached result, or the live result (stored once read to the end), or error
+     */
+    std::pair<std::unique_ptr<SnowflakeResultStream>, string> Execute(SnowflakeADBCConnector &connector,
+                                                                       const std::string &sql);
+
+    /**
+     * @brief Open a cached result
+     * @return Memory-mapped result, or nullptr on a miss (or when disabled)
+     */
+    std::unique_ptr<SnowflakeResultStream> Lookup(const SnowflakeConfig &config, const std::string &sql);
+
+    /**
+     * @brief Wrap a live result so that reading it to the end stores it
+     * @return Result to read in place of the original (the original itself when disabled)
+     */
+    std::unique_ptr<SnowflakeResultStream> Store(const SnowflakeConfig &config, const std::string &sql,
+                                                 std::unique_ptr<SnowflakeResultStream> result);
+
+    /**
+     * @brief Delete every entry
+     */
+    void Clear();
+
+    SnowflakeResultCacheMetrics GetMetrics() const;
+
+    /**
+     * @brief Collapse whitespace outside quotes and comments and drop trailing semicolons
+     *
+     * '...', "...", $$...$$, -- and /* */ runs are kept byte for byte.
+     */
+    static std::string NormalizeQuery(const std::string &sql);
+
+private:
+    struct Entry {
+        std::string path;
+        uint64_t bytes;
+        std::chrono::system_clock::time_point created;
+    };
+    class StoringReader;
+
+    /**
+     * @brief Add a committed file, evicting least recently used entries beyond max_bytes
+     */
+    void Insert(Entry entry);
+    /**
+     * @brief Remove an entry and its file; caller holds lock_
+     */
+    void Erase(std::list<Entry>::iterator entry);
+
+    mutable std::mutex lock_;
+    SnowflakeResultCacheOptions options_;
+    // Most recently used first
+    std::list<Entry> lru_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    uint64_t bytes_ = 0;
+
+    std::atomic<uint64_t> hits_ {0};
+    std::atomic<uint64_t> misses_ {0};
+    std::atomic<uint64_t> stores_ {0};
+    std::atomic<uint64_t> store_failures_ {0};
+    std::atomic<uint64_t> evictions_ {0};
+    std::atomic<uint64_t> expirations_ {0};
+    std::atomic<uint64_t> bytes_read_ {0};
+    std::atomic<uint64_t> bytes_written_ {0};
+};
+
+/**
+ * @brief snowflake_cache_stats() table function: one row of SnowflakeResultCacheMetrics
+ */
+struct SnowflakeCacheStatsFunction {
+    static TableFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
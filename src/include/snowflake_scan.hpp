@@ -0,0 +1,77 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "adbc_connector.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include "snowflake_prefetch.hpp"
+#include <memory>
+#include <string>
+
+namespace duckdb {
+
+/**
+ * @brief Result being scanned: partitions read on demand, or a single stream
+ */
+struct SnowflakeScanSource {
+    std::unique_ptr<SnowflakePartitions> partitions;
+    std::unique_ptr<SnowflakeResultStream> stream;
+
+    std::shared_ptr<arrow::Schema> GetSchema() const;
+};
+
+/**
+ * @brief Bind data of snowflake_scan: connection, query and result columns
+ *
+ * Binding runs a zero-row form of the query to learn its result schema; the
+ * query itself runs once the scan knows its projection and filters.
+ */
+struct SnowflakeScanBindData : public TableFunctionData {
+    SnowflakeConfig config;
+    std::string query;
+    // Fetch through ExecutePartitions/ReadPartition (when the driver can)
+    bool partitioned = true;
+    // Go through SnowflakeResultCache (when it is enabled)
+    bool cache = true;
+    // Read ahead of the decoders on an I/O thread per stream
+    SnowflakePrefetchOptions prefetch;
+    std::vector<std::string> names;
+    std::vector<LogicalType> types;
+    // Snowflake type of each column; decides which filters are pushed down
+    std::vector<std::string> snowflake_types;
+};
+
+/**
+ * @brief snowflake_scan(connection_string, query [, partitioned := true] [, cache := true]
+ *        [, prefetch_batches := 4] [, prefetch_bytes := 64 MiB]) table function
+ *
+ * Streams the result batch by batch: every DuckDB thread pulls the next
+ * record batch and decodes it straight into its output chunks with
+ * SnowflakeBatchDecoder. At most one batch per thread is held at a time, so
+ * memory is bounded regardless of result size.
+ *
+ * When the driver supports it, the result is fetched as partitions that
+ * threads claim one at a time and read in parallel; once none are left, idle
+ * threads join a partition still being read. Otherwise all threads share the
+ * single result stream.
+ *
+ * Projection and filters are pushed into the Snowflake query (see
+ * SnowflakePushdown), so only the needed columns and rows cross the network.
+ * Filters are only pushed on columns whose Snowflake type compares like the
+ * decoded DuckDB values (SnowflakePushdown::CanPushFilter), and are
+ * evaluated again on the decoded rows.
+ *
+ * Every stream being read is fetched ahead by a SnowflakePrefetchReader, so
+ * network fetch overlaps with decoding. prefetch_batches and prefetch_bytes
+ * bound what each stream holds ahead (prefetch_batches := 0 disables it);
+ * stalls on either side are shown by EXPLAIN ANALYZE.
+ *
+ * When SnowflakeResultCache is enabled, the rewritten query is served from it
+ * if cached; otherwise it is fetched as a single stream and stored as it is
+ * read. cache := false bypasses the cache.
+ */
+struct SnowflakeScanFunction {
+    static TableFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "adbc_connector.hpp"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * @brief Column of a Snowflake table as listed by INFORMATION_SCHEMA.COLUMNS
+ */
+struct SnowflakeColumnInfo {
+    std::string name;
+    // Full Snowflake type, e.g. NUMBER(18,2) or TIMESTAMP_NTZ(9)
+    std::string snowflake_type;
+    // Converted type; INVALID if error is set
+    LogicalType type;
+    bool nullable = true;
+    // Why the type has no DuckDB equivalent (empty when converted)
+    std::string error;
+};
+
+struct SnowflakeTableInfo {
+    std::string schema;
+    std::string name;
+    std::vector<SnowflakeColumnInfo> columns;
+};
+
+/**
+ * @brief Tables of one schema, as loaded at one point in time
+ */
+struct SnowflakeSchemaInfo {
+    std::string name;
+    // By name as stored in Snowflake (upper case unless created quoted)
+    std::map<std::string, std::shared_ptr<const SnowflakeTableInfo>> tables;
+
+    /**
+     * @brief Find a table by exact name, else by the only case-insensitive match
+     */
+    std::shared_ptr<const SnowflakeTableInfo> FindTable(const std::string &name) const;
+};
+
+struct SnowflakeSchemaCacheOptions {
+    // Loaded schemas are reloaded on first use after this long
+    std::chrono::milliseconds ttl = std::chrono::minutes(5);
+};
+
+/**
+ * @brief Counters of a schema cache since it was created
+ */
+struct SnowflakeSchemaCacheMetrics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t loads = 0;             // INFORMATION_SCHEMA queries run
+    uint64_t type_conversions = 0;  // Distinct type strings converted by those loads
+    idx_t schemas = 0;              // Schemas currently cached
+};
+
+/**
+ * @brief In-memory cache of table metadata, loaded a whole schema at a time
+ *
+ * Listing the tables of a schema for a BI tool would otherwise cost one
+ * GetTableSchema round trip per table. Instead, the first lookup in a schema
+ * reads every column of every table in it from INFORMATION_SCHEMA.COLUMNS
+ * with one query, and PrefetchDatabase does the same for every schema of the
+ * database. Each distinct type string of a load is converted with
+ * SnowflakeTypeConverter::ConvertSnowflakeToDuckDB once, however many
+ * columns share it.
+ *
+ * Entries are keyed by connection (driver, URI and credentials) and schema,
+ * reloaded after the TTL, and dropped by Invalidate/Clear (CALL
+ * snowflake_clear_cache()). Concurrent lookups of a schema being loaded wait
+ * for that load instead of issuing their own.
+ */
+class SnowflakeSchemaCache {
+public:
+    explicit SnowflakeSchemaCache(SnowflakeSchemaCacheOptions options = SnowflakeSchemaCacheOptions());
+
+    SnowflakeSchemaCache(const SnowflakeSchemaCache &) = delete;
+    SnowflakeSchemaCache &operator=(const SnowflakeSchemaCache &) = delete;
+
+    /**
+     * @brief Cache shared by every database in the process
+     */
+    static SnowflakeSchemaCache &Get();
+
+    void Configure(const SnowflakeSchemaCacheOptions &options);
+
+    /**
+     * @brief Tables of a schema of the connection's database, loaded on first use
+     * @param connector Connected session, used to load
+     * @param schema Schema name as stored in Snowflake
+     * @return Schema (with no tables if it does not exist) or error
+     */
+    std::pair<std::shared_ptr<const SnowflakeSchemaInfo>, string> GetSchema(SnowflakeADBCConnector &connector,
+                                                                           const std::string &schema);
+
+    /**
+     * @brief Columns of one table, loading its whole schema on first use
+     * @return Table, or error if the schema cannot be loaded or has no such table
+     */
+    std::pair<std::shared_ptr<const SnowflakeTableInfo>, string>
+    GetTable(SnowflakeADBCConnector &connector, const std::string &schema, const std::string &table);
+
+    /**
+     * @brief Load every schema of the connection's database with a single query
+     * @return Names of the schemas that have tables, or error
+     */
+    std::pair<std::vector<std::string>, string> PrefetchDatabase(SnowflakeADBCConnector &connector);
+
+    /**
+     * @brief Drop the cached schemas of one connection
+     */
+    void Invalidate(const SnowflakeConfig &config);
+
+    /**
+     * @brief Drop every cached schema
+     */
+    void Clear();
+
+    SnowflakeSchemaCacheMetrics GetMetrics() const;
+
+    /**
+     * @brief INFORMATION_SCHEMA.COLUMNS query for one schema of a database (every schema if empty)
+     */
+    static std::string BuildColumnsQuery(const std::string &database, const std::string &schema);
+
+    /**
+     * @brief database."SCHEMA"."TABLE", with the database quoted only when it is not a plain identifier
+     */
+    static std::string QualifiedName(const std::string &database, const std::string &schema,
+                                     const std::string &table);
+
+    /**
+     * @brief Rebuild a full type from INFORMATION_SCHEMA.COLUMNS fields (NULL fields as -1)
+     * @return E.g. NUMBER(18,2), VARCHAR(16777216), TIMESTAMP_NTZ(9), or data_type unchanged
+     */
+    static std::string ColumnType(const std::string &data_type, int64_t numeric_precision, int64_t numeric_scale,
+                                  int64_t datetime_precision, int64_t character_length);
+
+private:
+    struct Slot;
+    using SchemaMap = std::map<std::string, std::shared_ptr<SnowflakeSchemaInfo>>;
+
+    std::shared_ptr<Slot> GetSlot(const SnowflakeConfig &config, const std::string &schema);
+    /**
+     * @brief Run one COLUMNS query and group its rows by schema
+     */
+    std::pair<SchemaMap, string> Load(SnowflakeADBCConnector &connector, const std::string &schema);
+
+    mutable std::mutex lock_;
+    SnowflakeSchemaCacheOptions options_;
+    std::unordered_map<std::string, std::shared_ptr<Slot>> slots_;
+
+    std::atomic<uint64_t> hits_ {0};
+    std::atomic<uint64_t> misses_ {0};
+    std::atomic<uint64_t> loads_ {0};
+    std::atomic<uint64_t> type_conversions_ {0};
+};
+
+/**
+ * @brief CALL snowflake_clear_cache(): drop cached metadata and cached results
+ */
+struct SnowflakeClearCacheFunction {
+    static TableFunction GetFunction();
+};
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "type_converter.hpp"
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+#include <arrow/type.h>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace duckdb {
+
+/**
+ * @brief UTC offset of a time zone over a closed range of UTC instants
+ */
+struct TimezoneOffsetSpan {
+    int64_t first_micros;      // First UTC instant the offset applies to
+    int64_t last_micros;       // Last UTC instant the offset applies to
+    int32_t offset_minutes;    // Local time minus UTC
+
+    bool Contains(int64_t micros) const { return micros >= first_micros && micros <= last_micros; }
+};
+
+/**
+ * @brief Resolves the span containing a UTC instant (e.g. backed by ICU or tzdata)
+ *
+ * Returning the whole span up to the next transition, not just the offset, is
+ * what lets TimezoneOffsetCache answer almost every row without calling back.
+ */
+using TimezoneOffsetLookup = std::function<TimezoneOffsetSpan(int64_t utc_micros)>;
+
+/**
+ * @brief Per-column cache of time zone offsets for TIMESTAMP_TZ encoding
+ *
+ * A batch whose instants all fall between two transitions of the zone (the
+ * usual case) costs one min/max pass and a constant fill. Otherwise rows are
+ * matched against the last few spans seen, so data straddling a DST change
+ * still calls the lookup once per span rather than once per row.
+ */
+class TimezoneOffsetCache {
+public:
+    static constexpr idx_t CACHED_SPANS = 4;
+
+    explicit TimezoneOffsetCache(TimezoneOffsetLookup lookup);
+
+    /**
+     * @brief Cache for a zone with a single fixed offset (e.g. UTC or +05:30)
+     */
+    static TimezoneOffsetCache Fixed(int32_t offset_minutes);
+
+    /**
+     * @brief Offset of every instant of a batch
+     * @param micros UTC microseconds, one per row (rows without a value may hold any instant of the batch)
+     * @param count Number of rows
+     * @param offsets Receives the offset in minutes of each row
+     */
+    void Resolve(const int64_t* micros, idx_t count, int32_t* offsets);
+
+    /**
+     * @brief Number of times the lookup function has been called
+     */
+    idx_t GetLookupCount() const { return lookup_count_; }
+
+private:
+    const TimezoneOffsetSpan& Find(int64_t micros);
+
+    TimezoneOffsetLookup lookup_;
+    std::array<TimezoneOffsetSpan, CACHED_SPANS> spans_;
+    idx_t span_count_ = 0;
+    idx_t next_slot_ = 0;
+    idx_t lookup_count_ = 0;
+};
+
+/**
+ * @brief Encodes DuckDB temporal vectors into Snowflake's Arrow layouts
+ *
+ * The write-side counterpart of the temporal kernels in SnowflakeColumnDecoder.
+ * DuckDB holds TIME and TIMESTAMP values as int64 ticks of the type's unit
+ * (microseconds, or ns/ms/s for the TIMESTAMP_NS/MS/S variants); Snowflake
+ * expects, depending on the column type and its scale:
+ *
+ * | Column | Scale | Arrow layout |
+ * |--------|-------|--------------|
+ * | TIME(s) | 0..9 | int64 scaled by 10^s |
+ * | TIMESTAMP_NTZ/LTZ(s) | 0..7 | int64 scaled by 10^s |
+ * | TIMESTAMP_NTZ/LTZ(s) | 8..9 | struct {epoch: int64 s, fraction: int32 ns} |
+ * | TIMESTAMP_TZ(s) | 0..3 | struct {epoch: int64 scaled by 10^s, timezone: int32} |
+ * | TIMESTAMP_TZ(s) | 4..9 | struct {epoch: int64 s, fraction: int32 ns, timezone: int32} |
+ *
+ * `timezone` is the offset in minutes plus TIMEZONE_BIAS_MINUTES. Epochs are
+ * always UTC. Every layout is produced by branch-free loops over the batch;
+ * range checks use one min/max pass.
+ */
+class SnowflakeTemporalEncoder {
+public:
+    template<typename T>
+    using ConversionResult = SnowflakeTypeConverter::ConversionResult<T>;
+
+    static constexpr int32_t TIMEZONE_BIAS_MINUTES = 1440;
+    static constexpr int32_t MAX_SCALED_TIMESTAMP_SCALE = 7;
+    static constexpr int32_t MAX_COMPACT_TZ_SCALE = 3;
+
+    /**
+     * @brief Arrow type Encode produces for a column
+     * @param source_type DuckDB TIME or TIMESTAMP variant
+     * @param kind Snowflake timestamp semantics (ignored for TIME)
+     * @param scale Fractional digits of the Snowflake column (0..9)
+     * @return Arrow type, or nullptr if the combination is not supported
+     */
+    static std::shared_ptr<arrow::DataType> GetArrowType(const LogicalType& source_type, SnowflakeTimestampKind kind,
+                                                         int32_t scale);
+
+    /**
+     * @brief Encode `count` rows of a temporal vector
+     * @param source TIME, TIMESTAMP, TIMESTAMP_NS/MS/S or TIMESTAMP WITH TIME ZONE (any vector type)
+     * @param count Number of rows
+     * @param kind Snowflake timestamp semantics (ignored for TIME)
+     * @param scale Fractional digits of the Snowflake column (0..9); finer ticks are floored
+     * @param timezone Offsets for TIMESTAMP_TZ; nullptr writes UTC for every row
+     * @param pool Pool for the output buffers
+     * @return Array of GetArrowType(...), or error naming the first row that does not fit
+     */
+    static ConversionResult<std::shared_ptr<arrow::Array>>
+    Encode(Vector& source, idx_t count, SnowflakeTimestampKind kind, int32_t scale,
+           TimezoneOffsetCache* timezone = nullptr, arrow::MemoryPool* pool = arrow::default_memory_pool());
+};
+
+} // namespace duckdb
\ No newline at end of file
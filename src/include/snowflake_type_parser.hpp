@@ -0,0 +1,80 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace duckdb {
+
+/**
+ * @brief Failure categories reported by SnowflakeTypeParser
+ */
+enum class SnowflakeTypeParseError : uint8_t {
+    NONE = 0,
+    EMPTY_INPUT,
+    UNKNOWN_TYPE,
+    EXPECTED_TOKEN,
+    INVALID_NUMBER,
+    INVALID_PRECISION,
+    INVALID_SCALE,
+    TRAILING_INPUT,
+    NESTING_TOO_DEEP
+};
+
+/**
+ * @brief Outcome of parsing one Snowflake type signature
+ *
+ * On failure `type` is INVALID and `error_offset` points at the offending
+ * byte of the input; no message is built unless FormatError() is called.
+ */
+struct SnowflakeTypeParseResult {
+    LogicalType type;
+    SnowflakeTypeParseError error;
+    idx_t error_offset;
+    const char* expected;
+    // Fractional second digits of a top-level TIME / TIMESTAMP type (9 when not given)
+    uint8_t fractional_precision;
+
+    bool IsValid() const { return error == SnowflakeTypeParseError::NONE; }
+
+    /**
+     * @brief `type`, with a TIMESTAMP_NTZ resolved to the DuckDB unit that holds its precision
+     *
+     * (0) → TIMESTAMP_S, (1..3) → TIMESTAMP_MS, (7..9) → TIMESTAMP_NS. DuckDB has no
+     * such variants of TIME or TIMESTAMP WITH TIME ZONE, so those (and every other
+     * type) are returned unchanged and read at microsecond resolution.
+     */
+    LogicalType ExactTemporalType() const;
+
+    /**
+     * @brief Human readable description of the failure
+     * @param input The string that was parsed
+     */
+    std::string FormatError(std::string_view input) const;
+};
+
+/**
+ * @brief Single-pass recursive-descent parser for Snowflake type signatures
+ *
+ * Accepts the spellings produced by DESCRIBE TABLE / INFORMATION_SCHEMA and
+ * written by users: case-insensitive names, optional whitespace, aliases
+ * (INT, STRING, DATETIME, DOUBLE PRECISION, ...), length/precision arguments,
+ * COLLATE clauses and the structured types ARRAY(T), OBJECT(name T, ...),
+ * MAP(K, V) and VECTOR(T, n). Works directly on the input view; the only
+ * allocations are the ones LogicalType itself needs for nested types.
+ */
+class SnowflakeTypeParser {
+public:
+    static constexpr idx_t MAX_NESTING_DEPTH = 64;
+
+    /**
+     * @brief Parse a complete type signature
+     * @param input Snowflake type text, e.g. "NUMBER(38, 0)" or "ARRAY(VARCHAR)"
+     * @return Parsed DuckDB type or structured error
+     */
+    static SnowflakeTypeParseResult Parse(std::string_view input);
+};
+
+} // namespace duckdb
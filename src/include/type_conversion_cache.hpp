@@ -0,0 +1,110 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types.hpp"
+#include "type_converter.hpp"
+#include <arrow/type.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace duckdb {
+
+/**
+ * @brief Structural hash of a LogicalType
+ *
+ * Covers the type id plus everything that changes the conversion result:
+ * decimal width/scale, list/array children, struct field names and types,
+ * map key/value types and union members.
+ */
+hash_t HashLogicalTypeStructure(const LogicalType& type);
+
+/**
+ * @brief Immutable, fully computed conversion of one LogicalType
+ *
+ * Entries are published once and never modified or freed while the owning
+ * cache is alive, so readers may hold the pointer without synchronization.
+ */
+struct CachedTypeConversion {
+    LogicalType type;
+    hash_t hash;
+    SnowflakeTypeConverter::ConversionResult<std::string> snowflake_type;
+    SnowflakeTypeConverter::ConversionResult<std::shared_ptr<arrow::DataType>> arrow_type;
+    SnowflakeTypeConverter::ConversionResult<SnowflakeTypeConverter::TypeMappingInfo> mapping_info;
+};
+
+/**
+ * @brief Snapshot of cache counters
+ */
+struct TypeConversionCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t rejected;
+    idx_t size;
+    idx_t capacity;
+};
+
+/**
+ * @brief Bounded, lock-free memoization table for type conversions
+ *
+ * Open-addressed table of atomic entry pointers with a fixed capacity.
+ * Lookups are wait-free loads; inserts publish with a single CAS. The table
+ * is insert-only: once full, new types are computed by the caller without
+ * being admitted, which keeps memory bounded and makes entry lifetime trivial.
+ */
+class TypeConversionCache {
+public:
+    using EntryFactory = std::unique_ptr<CachedTypeConversion> (*)(const LogicalType& type, hash_t hash);
+
+    /**
+     * @brief Create a cache holding at most `capacity` distinct types
+     */
+    explicit TypeConversionCache(idx_t capacity);
+    ~TypeConversionCache();
+
+    TypeConversionCache(const TypeConversionCache&) = delete;
+    TypeConversionCache& operator=(const TypeConversionCache&) = delete;
+
+    /**
+     * @brief Find a previously cached conversion
+     * @return Cached entry or nullptr
+     */
+    const CachedTypeConversion* Lookup(const LogicalType& type) const;
+
+    /**
+     * @brief Find or compute-and-publish the conversion for a type
+     * @param type Type to convert
+     * @param factory Computes the entry on a miss
+     * @return Cached entry, or nullptr if the cache is full and the type is absent
+     */
+    const CachedTypeConversion* GetOrCreate(const LogicalType& type, EntryFactory factory);
+
+    TypeConversionCacheStats GetStats() const;
+
+    idx_t Capacity() const { return capacity_; }
+
+private:
+    static constexpr idx_t MAX_PROBE = 16;
+    static constexpr idx_t COUNTER_STRIPES = 16;
+
+    // Hit/miss counters are striped across cache lines so that many worker
+    // threads hitting the same hot types do not serialize on one counter.
+    struct alignas(64) CounterStripe {
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+    };
+
+    const CachedTypeConversion* Probe(const LogicalType& type, hash_t hash) const;
+    CounterStripe& LocalStripe() const;
+
+    idx_t capacity_;
+    idx_t mask_;
+    std::unique_ptr<std::atomic<const CachedTypeConversion*>[]> slots_;
+    std::atomic<idx_t> size_;
+    std::atomic<uint64_t> insertions_;
+    std::atomic<uint64_t> rejected_;
+    mutable CounterStripe stripes_[COUNTER_STRIPES];
+};
+
+} // namespace duckdb
@@ -8,9 +8,45 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace duckdb {
 
+struct CachedTypeConversion;
+struct TypeConversionCacheStats;
+
+/**
+ * @brief How SnowflakeTypeConverter::ValidateConversion compares two columns
+ */
+enum class ValidationMode : uint8_t {
+    FULL = 0,   // Every row, element-wise
+    SAMPLED,    // Every k-th row, k = 1 / sample_fraction
+    CHECKSUM    // Order-independent per-column checksum (see ColumnChecksum)
+};
+
+struct ValidationOptions {
+    ValidationMode mode = ValidationMode::FULL;
+    
+    /**
+     * Fraction of rows compared in SAMPLED mode, in (0, 1]
+     */
+    double sample_fraction = 0.01;
+    
+    /**
+     * Selects which residue of the sampling stride is compared
+     */
+    uint64_t sample_seed = 0;
+};
+
+/**
+ * @brief Snowflake's three timestamp semantics
+ */
+enum class SnowflakeTimestampKind : uint8_t {
+    NTZ = 0,    // Wall-clock time, no zone
+    LTZ,        // UTC instant, rendered in the session time zone
+    TZ          // UTC instant plus the writer's offset, stored per value
+};
+
 /**
  * @brief Core type conversion engine for DuckDB-Snowflake extension
  * 
@@ -19,42 +55,53 @@ namespace duckdb {
  */
 class SnowflakeTypeConverter {
 public:
-    // Conversion result wrapper
-    template<typename T>
+    // Conversion result wrapper (the unused second parameter lets the void
+    // case be a partial specialization, which is allowed at class scope).
+    // The error message is only allocated on failure: a successful result
+    // holds a null pointer, so the success path never builds a string.
+    template<typename T, typename = void>
     struct ConversionResult {
         T result;
-        bool success;
-        std::string error_message;
+        bool success = false;
+        std::shared_ptr<const std::string> error_message;
         
         static ConversionResult<T> Success(T&& value) {
-            return {std::forward<T>(value), true, ""};
+            return {std::forward<T>(value), true, nullptr};
         }
         
-        static ConversionResult<T> Error(const std::string& error) {
-            return {T{}, false, error};
+        static ConversionResult<T> Error(std::string error) {
+            return {T{}, false, std::make_shared<const std::string>(std::move(error))};
         }
         
         bool IsValid() const { return success; }
         const T& GetValue() const { return result; }
-        const std::string& GetError() const { return error_message; }
+        const std::string& GetError() const { return error_message ? *error_message : NoError(); }
     };
 
     // Template specialization for void
-    template<>
-    struct ConversionResult<void> {
-        bool success;
-        std::string error_message;
+    template<typename UNUSED>
+    struct ConversionResult<void, UNUSED> {
+        bool success = false;
+        std::shared_ptr<const std::string> error_message;
         
         static ConversionResult<void> Success() {
-            return {true, ""};
+            return {true, nullptr};
         }
-        static ConversionResult<void> Error(const std::string& error) {
-            return {false, error};
+        static ConversionResult<void> Error(std::string error) {
+            return {false, std::make_shared<const std::string>(std::move(error))};
         }
         bool IsValid() const { return success; }
-        const std::string& GetError() const { return error_message; }
+        const std::string& GetError() const { return error_message ? *error_message : NoError(); }
     };
 
+    /**
+     * @brief Message of a successful ConversionResult (empty)
+     */
+    static const std::string& NoError() {
+        static const std::string empty;
+        return empty;
+    }
+
     // ===== PRIMARY CONVERSION FUNCTIONS =====
     
     /**
@@ -73,6 +120,14 @@ public:
     static ConversionResult<std::string> 
     ConvertArrowToSnowflake(const std::string& arrow_type_desc);
     
+    /**
+     * @brief Convert Arrow DataType to Snowflake SQL type string
+     * @param arrow_type Source Arrow type (dispatched on type id, no string parsing)
+     * @return Snowflake SQL type specification or error details
+     */
+    static ConversionResult<std::string> 
+    ConvertArrowToSnowflake(const arrow::DataType& arrow_type);
+    
     /**
      * @brief Direct conversion: DuckDB → Snowflake (via Arrow)
      * @param duckdb_type Source DuckDB type
@@ -83,7 +138,8 @@ public:
     
     /**
      * @brief Reverse conversion: Snowflake → DuckDB (via Arrow)
-     * @param snowflake_type Snowflake SQL type specification
+     * @param snowflake_type Snowflake SQL type specification, in any spelling
+     *        DESCRIBE TABLE produces (see SnowflakeTypeParser)
      * @return DuckDB LogicalType or error details
      */
     static ConversionResult<LogicalType> 
@@ -108,6 +164,46 @@ public:
     static ConversionResult<TypeMappingInfo> 
     GetTypeMappingInfo(const LogicalType& duckdb_type);
     
+    // ===== CONVERSION CACHE =====
+    
+    static constexpr idx_t DEFAULT_CONVERSION_CACHE_CAPACITY = 4096;
+    
+    /**
+     * @brief Enable memoization of non-primitive conversions (opt-in)
+     * @param capacity Minimum number of distinct types held
+     * 
+     * Reuses the most recent cache, with its entries, when it holds at least
+     * `capacity` types; otherwise replaces it with one of at least twice its
+     * capacity. Safe to call while other threads convert; superseded caches
+     * are retained until process exit so readers never observe freed entries,
+     * and together stay smaller than the active one.
+     */
+    static void EnableConversionCache(idx_t capacity = DEFAULT_CONVERSION_CACHE_CAPACITY);
+    
+    /**
+     * @brief Stop consulting the conversion cache
+     */
+    static void DisableConversionCache();
+    
+    /**
+     * @brief Whether a conversion cache is currently active
+     */
+    static bool IsConversionCacheEnabled();
+    
+    /**
+     * @brief Hit/miss/size counters of the active cache (all zero if disabled)
+     */
+    static TypeConversionCacheStats GetConversionCacheStats();
+    
+    /**
+     * @brief Borrow the cached conversion of a type without copying results
+     * @param duckdb_type Source DuckDB type
+     * @return Entry valid for the process lifetime, or nullptr if the cache is
+     *         disabled or full
+     */
+    static const CachedTypeConversion* 
+    LookupCachedConversion(const LogicalType& duckdb_type);
+    
     /**
      * @brief Check if two types are conversion-compatible
      * @param source_type Source type
@@ -118,6 +214,54 @@ public:
     CheckTypeCompatibility(const LogicalType& source_type, 
                           const LogicalType& target_type);
 
+    // ===== SCHEMA CONVERSION =====
+    
+    /**
+     * @brief Result of converting a whole table schema in one pass
+     * 
+     * Column i of every member describes input column i. Arrow fields carry
+     * "duckdb.type" and "snowflake.type" metadata; columns of identical type
+     * share one Arrow type and metadata instance.
+     */
+    struct SchemaConversion {
+        std::shared_ptr<arrow::Schema> arrow_schema;
+        std::vector<std::string> snowflake_columns;
+        std::vector<TypeMappingInfo> column_mappings;
+        
+        /**
+         * @brief Render CREATE TABLE DDL from the converted column definitions
+         * @param table_name Target table name (quoted as an identifier)
+         */
+        std::string BuildCreateTableDDL(const std::string& table_name) const;
+    };
+    
+    /**
+     * @brief Convert a table schema: Arrow schema, Snowflake DDL and mapping info
+     * @param column_names Column names
+     * @param column_types Column types (same length as column_names)
+     * @return Converted schema, or one error listing every failing column
+     */
+    static ConversionResult<SchemaConversion> 
+    ConvertSchema(const std::vector<std::string>& column_names,
+                  const std::vector<LogicalType>& column_types);
+    
+    /**
+     * @brief Quote a name as a Snowflake identifier ("name", embedded quotes doubled)
+     */
+    static std::string QuoteIdentifier(const std::string& identifier);
+    
+    /**
+     * @brief Render a value as a Snowflake SQL literal typed like its column
+     * @param value Boolean, numeric, DECIMAL, VARCHAR, BLOB, DATE, TIME or TIMESTAMP value (or NULL)
+     * @return Literal, e.g. CAST('2024-01-01 10:00:00' AS TIMESTAMP_NTZ), or error if
+     *         the value has no exact Snowflake spelling (BC dates, infinities, NUMBER overflow)
+     * 
+     * Temporal, floating-point and decimal literals are CAST to the type
+     * ConvertDuckDBToSnowflake assigns, so Snowflake compares them exactly as
+     * DuckDB would instead of applying its own literal typing.
+     */
+    static ConversionResult<std::string> RenderLiteral(const Value& value);
+
     // ===== PRECISION AND SCALE HANDLING =====
     
     /**
@@ -125,6 +269,9 @@ public:
      * @param precision Source precision
      * @param scale Source scale
      * @return Adjusted precision/scale with warnings
+     * 
+     * Precision above 38 is absorbed by the scale first, e.g. (45,5) → (38,0).
+     * Type metadata only; DecimalRescaleKernel moves the data.
      */
     struct DecimalAdjustment {
         uint8_t adjusted_precision;
@@ -147,12 +294,36 @@ public:
     ValidateNumericRange(const LogicalType& source_type, 
                         const LogicalType& target_type);
 
+    // ===== TEMPORAL TYPE HANDLING =====
+    
+    /**
+     * @brief Convert a temporal type with an explicit choice of Snowflake zone semantics
+     * @param duckdb_type DATE, TIME or any TIMESTAMP variant
+     * @param timestamp_tz_kind Target for TIMESTAMP WITH TIME ZONE. TIMESTAMP_LTZ
+     *        matches DuckDB's UTC-instant semantics exactly; TIMESTAMP_TZ (the
+     *        default mapping) also records the writer's offset per value
+     * @return Snowflake type (sub-microsecond units carry their precision, e.g.
+     *         TIMESTAMP_NS → TIMESTAMP_NTZ(9)) or error for non-temporal types
+     * 
+     * Microsecond types map to Snowflake's default precision 9, which holds them
+     * losslessly; SnowflakeTemporalEncoder writes the matching Arrow layouts.
+     */
+    static ConversionResult<std::string> 
+    ConvertTemporalType(const LogicalType& duckdb_type,
+                        SnowflakeTimestampKind timestamp_tz_kind = SnowflakeTimestampKind::TZ);
+
     // ===== NESTED TYPE HANDLING =====
     
     /**
-     * @brief Convert nested/composite types (STRUCT, LIST, MAP, UNION)
+     * @brief Convert nested/composite types (STRUCT, LIST, ARRAY, MAP, UNION)
      * @param duckdb_type Source nested type
-     * @return Snowflake representation strategy
+     * @return Snowflake structured type with every child converted recursively,
+     *         e.g. ARRAY(NUMBER(10,0)), OBJECT(a NUMBER(10,0), b VARCHAR),
+     *         MAP(VARCHAR, DOUBLE); fixed-size INTEGER/FLOAT arrays become
+     *         VECTOR(INT|FLOAT, n)
+     * 
+     * Structured types cannot contain VARIANT, so a container with a UNION
+     * anywhere below it falls back to semi-structured ARRAY / OBJECT.
      */
     static ConversionResult<std::string> 
     ConvertNestedType(const LogicalType& duckdb_type);
@@ -173,28 +344,50 @@ public:
      * @param target_type Converted type
      * @param source_data Original data
      * @param target_data Converted data
-     * @return Success or error details
+     * @param count Number of rows in both vectors
+     * @param options FULL, SAMPLED or CHECKSUM comparison
+     * @return Success or error details (first differing row, or both checksums)
+     * 
+     * Values are compared in a canonical domain, so DECIMAL(9,2) data validates
+     * against its DECIMAL(18,4) or HUGEINT-backed conversion. Implemented by
+     * ConversionValidator.
      */
     static ConversionResult<void> 
     ValidateConversion(const LogicalType& source_type,
                       const LogicalType& target_type,
                       const Vector& source_data,
-                      const Vector& target_data);
+                      const Vector& target_data,
+                      idx_t count,
+                      const ValidationOptions& options = ValidationOptions());
 
 private:
     // ===== INTERNAL CONVERSION HELPERS =====
     
     /**
-     * @brief Handle simple/primitive type conversions
+     * @brief Uncached conversion paths (the cache is populated from these)
      */
+    static ConversionResult<std::shared_ptr<arrow::DataType>> 
+    ConvertDuckDBToArrowUncached(const LogicalType& duckdb_type);
+    
     static ConversionResult<std::string> 
-    ConvertPrimitiveType(const LogicalType& duckdb_type);
+    ConvertDuckDBToSnowflakeUncached(const LogicalType& duckdb_type);
+    
+    static ConversionResult<TypeMappingInfo> 
+    BuildTypeMappingInfo(const LogicalType& duckdb_type,
+                         const ConversionResult<std::string>& snowflake_type,
+                         const ConversionResult<std::shared_ptr<arrow::DataType>>& arrow_type);
     
     /**
-     * @brief Handle temporal type conversions with timezone awareness
+     * @brief Cache entry factory: computes every cached form of a type
+     */
+    static std::unique_ptr<CachedTypeConversion> 
+    BuildCachedConversion(const LogicalType& duckdb_type, hash_t hash);
+    
+    /**
+     * @brief Handle simple/primitive type conversions
      */
     static ConversionResult<std::string> 
-    ConvertTemporalType(const LogicalType& duckdb_type);
+    ConvertPrimitiveType(const LogicalType& duckdb_type);
     
     /**
      * @brief Handle unsigned integer types (no Snowflake equivalent)
@@ -202,6 +395,26 @@ private:
     static ConversionResult<std::string> 
     ConvertUnsignedType(const LogicalType& duckdb_type);
     
+    /**
+     * @brief Whether a Snowflake type is semi-structured (VARIANT, untyped ARRAY / OBJECT)
+     */
+    static bool IsSemiStructuredType(const std::string& snowflake_type);
+    
+    /**
+     * @brief OBJECT(...) from converted field types (semi-structured if any field is)
+     */
+    static std::string 
+    BuildSnowflakeObjectType(const std::vector<std::pair<std::string, std::string>>& fields);
+    
+    /**
+     * @brief MAP(key, value) from converted types
+     *
+     * Falls back to semi-structured OBJECT when the key is not VARCHAR or
+     * NUMBER(p,0) (Snowflake's only MAP key types) or the value is semi-structured.
+     */
+    static ConversionResult<std::string> 
+    BuildSnowflakeMapType(const std::string& key_type, const std::string& value_type);
+    
     /**
      * @brief Format detailed error messages with context
      */
@@ -211,7 +424,10 @@ private:
                          const std::string& error_detail);
                          
     /**
-     * @brief Type mapping lookup tables (populated during initialization)
+     * @brief String-keyed views of SnowflakeTypeRegistry (built at startup)
+     * 
+     * Hot paths index the registry directly; these remain for lookups that
+     * start from a type string.
      */
     static const std::unordered_map<LogicalTypeId, std::string> direct_snowflake_map_;
     static const std::unordered_map<LogicalTypeId, std::string> arrow_equivalents_;
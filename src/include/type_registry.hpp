@@ -0,0 +1,162 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types.hpp"
+#include <arrow/type.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace duckdb {
+
+/**
+ * @brief Arrow physical types reachable from the primitive registry
+ *
+ * Tags are resolved to concrete arrow::DataType singletons once, so the hot
+ * conversion path never builds or compares Arrow type strings.
+ */
+enum class ArrowTypeTag : uint8_t {
+    NONE = 0,
+    INT8,
+    INT16,
+    INT32,
+    INT64,
+    FLOAT32,
+    FLOAT64,
+    UTF8,
+    BINARY,
+    BOOL,
+    DATE32,
+    TIME64_US,
+    TIMESTAMP_US,
+    TIMESTAMP_US_UTC,
+    TIMESTAMP_NS,
+    TIMESTAMP_MS,
+    TIMESTAMP_S,
+    TAG_COUNT
+};
+
+/**
+ * @brief One row of the DuckDB ↔ Arrow ↔ Snowflake mapping table
+ */
+struct TypeRegistryEntry {
+    LogicalTypeId duckdb_id;
+    std::string_view duckdb_name;
+    ArrowTypeTag arrow_tag;
+    std::string_view arrow_name;
+    std::string_view snowflake_name;
+};
+
+namespace type_registry_detail {
+
+inline constexpr uint8_t NO_ENTRY = 0xFF;
+inline constexpr size_t ARROW_TAG_COUNT = static_cast<size_t>(ArrowTypeTag::TAG_COUNT);
+
+inline constexpr TypeRegistryEntry ENTRIES[] = {
+    {LogicalTypeId::TINYINT,      "TINYINT",      ArrowTypeTag::INT8,             "int8",               "NUMBER(3,0)"},
+    {LogicalTypeId::SMALLINT,     "SMALLINT",     ArrowTypeTag::INT16,            "int16",              "NUMBER(5,0)"},
+    {LogicalTypeId::INTEGER,      "INTEGER",      ArrowTypeTag::INT32,            "int32",              "NUMBER(10,0)"},
+    {LogicalTypeId::BIGINT,       "BIGINT",       ArrowTypeTag::INT64,            "int64",              "NUMBER(19,0)"},
+    {LogicalTypeId::FLOAT,        "FLOAT",        ArrowTypeTag::FLOAT32,          "float32",            "FLOAT"},
+    {LogicalTypeId::DOUBLE,       "DOUBLE",       ArrowTypeTag::FLOAT64,          "float64",            "DOUBLE"},
+    {LogicalTypeId::VARCHAR,      "VARCHAR",      ArrowTypeTag::UTF8,             "utf8",               "VARCHAR"},
+    {LogicalTypeId::BLOB,         "BLOB",         ArrowTypeTag::BINARY,           "binary",             "BINARY"},
+    {LogicalTypeId::BOOLEAN,      "BOOLEAN",      ArrowTypeTag::BOOL,             "bool",               "BOOLEAN"},
+    {LogicalTypeId::DATE,         "DATE",         ArrowTypeTag::DATE32,           "date32",             "DATE"},
+    {LogicalTypeId::TIME,         "TIME",         ArrowTypeTag::TIME64_US,        "time64[us]",         "TIME"},
+    {LogicalTypeId::TIMESTAMP,    "TIMESTAMP",    ArrowTypeTag::TIMESTAMP_US,     "timestamp[us]",      "TIMESTAMP_NTZ"},
+    {LogicalTypeId::TIMESTAMP_TZ, "TIMESTAMP_TZ", ArrowTypeTag::TIMESTAMP_US_UTC, "timestamp[us, UTC]", "TIMESTAMP_TZ"},
+    {LogicalTypeId::TIMESTAMP_NS, "TIMESTAMP_NS", ArrowTypeTag::TIMESTAMP_NS,     "timestamp[ns]",      "TIMESTAMP_NTZ(9)"},
+    {LogicalTypeId::TIMESTAMP_MS, "TIMESTAMP_MS", ArrowTypeTag::TIMESTAMP_MS,     "timestamp[ms]",      "TIMESTAMP_NTZ(3)"},
+    {LogicalTypeId::TIMESTAMP_SEC, "TIMESTAMP_S", ArrowTypeTag::TIMESTAMP_S,      "timestamp[s]",       "TIMESTAMP_NTZ(0)"}
+};
+
+inline constexpr size_t ENTRY_COUNT = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+constexpr std::array<uint8_t, 256> BuildTypeIdIndex() {
+    std::array<uint8_t, 256> index {};
+    for (auto &slot : index) {
+        slot = NO_ENTRY;
+    }
+    for (size_t i = 0; i < ENTRY_COUNT; i++) {
+        index[static_cast<uint8_t>(ENTRIES[i].duckdb_id)] = static_cast<uint8_t>(i);
+    }
+    return index;
+}
+
+constexpr std::array<uint8_t, ARROW_TAG_COUNT> BuildArrowTagIndex() {
+    std::array<uint8_t, ARROW_TAG_COUNT> index {};
+    for (auto &slot : index) {
+        slot = NO_ENTRY;
+    }
+    for (size_t i = 0; i < ENTRY_COUNT; i++) {
+        index[static_cast<uint8_t>(ENTRIES[i].arrow_tag)] = static_cast<uint8_t>(i);
+    }
+    return index;
+}
+
+inline constexpr std::array<uint8_t, 256> BY_TYPE_ID = BuildTypeIdIndex();
+inline constexpr std::array<uint8_t, ARROW_TAG_COUNT> BY_ARROW_TAG = BuildArrowTagIndex();
+
+} // namespace type_registry_detail
+
+/**
+ * @brief Compile-time registry of primitive type mappings
+ *
+ * Single source of truth for every fixed (parameterless) mapping. Lookups by
+ * LogicalTypeId and ArrowTypeTag are constant-time array indexing; the string
+ * keyed tables in SnowflakeTypeConverter are derived from this at startup.
+ */
+class SnowflakeTypeRegistry {
+public:
+    /**
+     * @brief Registry entry for a DuckDB type id, or nullptr if unmapped
+     */
+    static constexpr const TypeRegistryEntry *Lookup(LogicalTypeId id) {
+        auto slot = type_registry_detail::BY_TYPE_ID[static_cast<uint8_t>(id)];
+        return slot == type_registry_detail::NO_ENTRY ? nullptr : &type_registry_detail::ENTRIES[slot];
+    }
+
+    /**
+     * @brief Registry entry for an Arrow type tag, or nullptr if unmapped
+     */
+    static constexpr const TypeRegistryEntry *Lookup(ArrowTypeTag tag) {
+        auto slot = type_registry_detail::BY_ARROW_TAG[static_cast<uint8_t>(tag)];
+        return slot == type_registry_detail::NO_ENTRY ? nullptr : &type_registry_detail::ENTRIES[slot];
+    }
+
+    /**
+     * @brief Map a concrete Arrow type onto its registry tag
+     * @return ArrowTypeTag::NONE for types outside the primitive registry
+     */
+    static ArrowTypeTag GetArrowTag(const arrow::DataType &arrow_type);
+
+    /**
+     * @brief Shared Arrow type instance for a tag (created once per process)
+     */
+    static const std::shared_ptr<arrow::DataType> &GetArrowType(ArrowTypeTag tag);
+
+    /**
+     * @brief Iterable view over every registry entry
+     */
+    struct EntryRange {
+        const TypeRegistryEntry *first;
+        const TypeRegistryEntry *last;
+        constexpr const TypeRegistryEntry *begin() const { return first; }
+        constexpr const TypeRegistryEntry *end() const { return last; }
+    };
+
+    static constexpr EntryRange Entries() {
+        return {type_registry_detail::ENTRIES, type_registry_detail::ENTRIES + type_registry_detail::ENTRY_COUNT};
+    }
+};
+
+static_assert(SnowflakeTypeRegistry::Lookup(LogicalTypeId::INTEGER)->snowflake_name == "NUMBER(10,0)",
+              "type registry index is inconsistent");
+static_assert(SnowflakeTypeRegistry::Lookup(ArrowTypeTag::TIMESTAMP_US)->duckdb_id == LogicalTypeId::TIMESTAMP,
+              "arrow tag index is inconsistent");
+static_assert(SnowflakeTypeRegistry::Lookup(LogicalTypeId::INTERVAL) == nullptr,
+              "unmapped types must not resolve");
+
+} // namespace duckdb
@@ -0,0 +1,1019 @@
+#include "include/snowflake_arrow_decoder.hpp"
+#include "include/snowflake_metrics.hpp"
+#include "include/snowflake_type_parser.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include <arrow/util/bit_util.h>
+#include <arrow/util/bitmap_ops.h>
+#include <arrow/util/key_value_metadata.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace duckdb {
+
+namespace {
+
+constexpr int64_t POWERS_OF_TEN[] = {1LL,
+                                     10LL,
+                                     100LL,
+                                     1000LL,
+                                     10000LL,
+                                     100000LL,
+                                     1000000LL,
+                                     10000000LL,
+                                     100000000LL,
+                                     1000000000LL,
+                                     10000000000LL,
+                                     100000000000LL,
+                                     1000000000000LL,
+                                     10000000000000LL,
+                                     100000000000000LL,
+                                     1000000000000000LL,
+                                     10000000000000000LL,
+                                     100000000000000000LL,
+                                     1000000000000000000LL};
+constexpr int32_t MAX_INT64_EXPONENT = 18;
+
+constexpr int32_t MICROS_SCALE = 6;
+constexpr int32_t NANOS_SCALE = 9;
+constexpr int32_t DEFAULT_TEMPORAL_SCALE = 9;
+constexpr int64_t MILLIS_PER_DAY = 86400000;
+
+// ===== RESCALING =====
+
+/**
+ * @brief Exact integer rescale applied to every value of a batch
+ *
+ * At most one of multiplier/divisor differs from 1. Decimals round half away
+ * from zero (like DuckDB's decimal casts); temporal values round toward
+ * negative infinity so pre-epoch instants keep their ordering.
+ */
+struct Rescale {
+    int64_t multiplier = 1;
+    int64_t divisor = 1;
+    bool floor = false;
+
+    bool IsIdentity() const { return multiplier == 1 && divisor == 1; }
+};
+
+arrow::Result<Rescale> RescaleBetween(int32_t source_scale, int32_t target_scale, bool floor) {
+    auto difference = target_scale - source_scale;
+    if (difference > MAX_INT64_EXPONENT || difference < -MAX_INT64_EXPONENT) {
+        return arrow::Status::NotImplemented("Rescale from scale " + std::to_string(source_scale) + " to " +
+                                             std::to_string(target_scale));
+    }
+    Rescale rescale;
+    rescale.floor = floor;
+    if (difference > 0) {
+        rescale.multiplier = POWERS_OF_TEN[difference];
+    } else if (difference < 0) {
+        rescale.divisor = POWERS_OF_TEN[-difference];
+    }
+    return rescale;
+}
+
+inline int64_t DivideRoundHalfAway(int64_t value, int64_t divisor) {
+    auto quotient = value / divisor;
+    auto remainder = value % divisor;
+    auto adjust = static_cast<int64_t>(2 * (remainder < 0 ? -remainder : remainder) >= divisor);
+    return quotient + (value < 0 ? -adjust : adjust);
+}
+
+inline int64_t DivideFloor(int64_t value, int64_t divisor) {
+    return value / divisor - static_cast<int64_t>(value % divisor < 0);
+}
+
+inline bool TryRescale(int64_t value, const Rescale& rescale, int64_t& result) {
+    if (rescale.multiplier != 1) {
+        return !__builtin_mul_overflow(value, rescale.multiplier, &result);
+    }
+    if (rescale.divisor != 1) {
+        result = rescale.floor ? DivideFloor(value, rescale.divisor) : DivideRoundHalfAway(value, rescale.divisor);
+        return true;
+    }
+    result = value;
+    return true;
+}
+
+/**
+ * @brief Range a rescaled int64 must fall in to be stored as T
+ */
+template<typename T>
+struct StorageLimits {
+    static constexpr int64_t MIN = std::numeric_limits<T>::min();
+    static constexpr int64_t MAX = std::numeric_limits<T>::max();
+};
+
+template<>
+struct StorageLimits<hugeint_t> {
+    static constexpr int64_t MIN = std::numeric_limits<int64_t>::min();
+    static constexpr int64_t MAX = std::numeric_limits<int64_t>::max();
+};
+
+arrow::Status OutOfRange(idx_t row, const LogicalType& target) {
+    return arrow::Status::Invalid("Value at row " + std::to_string(row) + " is out of range for " +
+                                  target.ToString());
+}
+
+/**
+ * @brief Branch-free rescale loop (the compiler vectorizes each arm)
+ */
+template<typename SRC, typename DST>
+void RescaleValues(const SRC* source, idx_t count, const Rescale& rescale, DST* target) {
+    if (rescale.multiplier != 1) {
+        auto multiplier = rescale.multiplier;
+        for (idx_t i = 0; i < count; i++) {
+            target[i] = static_cast<DST>(static_cast<int64_t>(source[i]) * multiplier);
+        }
+    } else if (rescale.divisor != 1) {
+        auto divisor = rescale.divisor;
+        if (rescale.floor) {
+            for (idx_t i = 0; i < count; i++) {
+                target[i] = static_cast<DST>(DivideFloor(static_cast<int64_t>(source[i]), divisor));
+            }
+        } else {
+            for (idx_t i = 0; i < count; i++) {
+                target[i] = static_cast<DST>(DivideRoundHalfAway(static_cast<int64_t>(source[i]), divisor));
+            }
+        }
+    } else {
+        for (idx_t i = 0; i < count; i++) {
+            target[i] = static_cast<DST>(static_cast<int64_t>(source[i]));
+        }
+    }
+}
+
+/**
+ * @brief Decode scaled integers into integer/decimal/temporal storage
+ *
+ * One min/max reduction over the batch decides whether every value fits the
+ * target after rescaling; if so the conversion runs as a single branch-free
+ * loop. Only when it does not (or when NULL slots hold out-of-range garbage)
+ * are valid rows checked individually.
+ */
+template<typename SRC, typename DST>
+arrow::Status DecodeScaledIntegers(const SRC* source, idx_t count, const Rescale& rescale,
+                                   const ValidityMask& validity, const LogicalType& target_type, DST* target) {
+    if (std::is_same<SRC, DST>::value && rescale.IsIdentity()) {
+        std::memcpy(target, source, count * sizeof(DST));
+        return arrow::Status::OK();
+    }
+    if (count == 0) {
+        return arrow::Status::OK();
+    }
+
+    auto min_value = source[0];
+    auto max_value = source[0];
+    for (idx_t i = 1; i < count; i++) {
+        min_value = source[i] < min_value ? source[i] : min_value;
+        max_value = source[i] > max_value ? source[i] : max_value;
+    }
+    int64_t low, high;
+    if (TryRescale(static_cast<int64_t>(min_value), rescale, low) &&
+        TryRescale(static_cast<int64_t>(max_value), rescale, high) && low >= StorageLimits<DST>::MIN &&
+        high <= StorageLimits<DST>::MAX) {
+        RescaleValues(source, count, rescale, target);
+        return arrow::Status::OK();
+    }
+
+    for (idx_t i = 0; i < count; i++) {
+        if (!validity.RowIsValid(i)) {
+            target[i] = static_cast<DST>(0);
+            continue;
+        }
+        int64_t value;
+        if (TryRescale(static_cast<int64_t>(source[i]), rescale, value) && value >= StorageLimits<DST>::MIN &&
+            value <= StorageLimits<DST>::MAX) {
+            target[i] = static_cast<DST>(value);
+            continue;
+        }
+        if (std::is_same<DST, hugeint_t>::value && rescale.multiplier != 1) {
+            // Overflowed int64 but not the 128-bit target
+            hugeint_t wide;
+            if (Hugeint::TryMultiply(hugeint_t(static_cast<int64_t>(source[i])), hugeint_t(rescale.multiplier),
+                                     wide)) {
+                std::memcpy(&target[i], &wide, sizeof(hugeint_t));
+                continue;
+            }
+        }
+        return OutOfRange(i, target_type);
+    }
+    return arrow::Status::OK();
+}
+
+/**
+ * @brief Decode decimal128 values (sent by Snowflake only when a batch exceeds int64)
+ */
+template<typename DST>
+arrow::Status DecodeDecimal128(const hugeint_t* source, idx_t count, int32_t scale_difference,
+                               const ValidityMask& validity, const LogicalType& target_type, DST* target) {
+    if (std::is_same<DST, hugeint_t>::value && scale_difference == 0) {
+        // hugeint_t is {lower, upper}: identical to Arrow's little-endian decimal128
+        std::memcpy(target, source, count * sizeof(hugeint_t));
+        return arrow::Status::OK();
+    }
+    if (scale_difference > 38 || scale_difference < -38) {
+        return arrow::Status::NotImplemented("Rescale by 10^" + std::to_string(scale_difference));
+    }
+    auto factor = Hugeint::POWERS_OF_TEN[scale_difference < 0 ? -scale_difference : scale_difference];
+    for (idx_t i = 0; i < count; i++) {
+        if (!validity.RowIsValid(i)) {
+            target[i] = static_cast<DST>(0);
+            continue;
+        }
+        auto value = source[i];
+        if (scale_difference > 0) {
+            if (!Hugeint::TryMultiply(value, factor, value)) {
+                return OutOfRange(i, target_type);
+            }
+        } else if (scale_difference < 0) {
+            auto remainder = value % factor;
+            value = value / factor;
+            auto magnitude = remainder < hugeint_t(0) ? -remainder : remainder;
+            if (magnitude * hugeint_t(2) >= factor) {
+                value = source[i] < hugeint_t(0) ? value - hugeint_t(1) : value + hugeint_t(1);
+            }
+        }
+        if (std::is_same<DST, hugeint_t>::value) {
+            std::memcpy(&target[i], &value, sizeof(hugeint_t));
+            continue;
+        }
+        int64_t narrow;
+        if (!Hugeint::TryCast<int64_t>(value, narrow) || narrow < StorageLimits<DST>::MIN ||
+            narrow > StorageLimits<DST>::MAX) {
+            return OutOfRange(i, target_type);
+        }
+        target[i] = static_cast<DST>(narrow);
+    }
+    return arrow::Status::OK();
+}
+
+// ===== COLUMN KERNELS =====
+
+/**
+ * @brief Everything a kernel needs about the slice being decoded
+ */
+struct DecodeContext {
+    const arrow::ArrayData& data;
+    idx_t offset;
+    idx_t count;
+    const LogicalType& target_type;
+    int32_t source_scale;
+    Vector& result;
+
+    template<typename T>
+    const T* Values() const {
+        return data.GetValues<T>(1, data.offset + static_cast<int64_t>(offset));
+    }
+
+    const ValidityMask& Validity() const { return FlatVector::Validity(result); }
+};
+
+void DecodeValidity(const arrow::ArrayData& data, idx_t offset, idx_t count, Vector& result) {
+    auto& validity = FlatVector::Validity(result);
+    if (data.null_count == 0 || !data.buffers[0]) {
+        validity.Reset();
+        return;
+    }
+    // Arrow and DuckDB share the LSB-first bitmap layout; CopyBitmap moves whole
+    // words and only shifts when the slice is not byte aligned
+    if (count > STANDARD_VECTOR_SIZE) {
+        // Dictionaries are decoded whole and may exceed a chunk
+        validity.Initialize(count);
+    } else {
+        validity.EnsureWritable();
+    }
+    arrow::internal::CopyBitmap(data.buffers[0]->data(), data.offset + static_cast<int64_t>(offset),
+                                static_cast<int64_t>(count), reinterpret_cast<uint8_t*>(validity.GetData()), 0);
+}
+
+template<typename DST>
+arrow::Status DecodeNumber(const DecodeContext& context, int32_t target_scale) {
+    auto target = FlatVector::GetData<DST>(context.result);
+    auto& validity = context.Validity();
+    if (context.data.type->id() == arrow::Type::DECIMAL128) {
+        auto& decimal = static_cast<const arrow::Decimal128Type&>(*context.data.type);
+        return DecodeDecimal128<DST>(context.Values<hugeint_t>(), context.count, target_scale - decimal.scale(),
+                                     validity, context.target_type, target);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto rescale, RescaleBetween(context.source_scale, target_scale, false));
+    switch (context.data.type->id()) {
+        case arrow::Type::INT8:
+            return DecodeScaledIntegers<int8_t, DST>(context.Values<int8_t>(), context.count, rescale, validity,
+                                                     context.target_type, target);
+        case arrow::Type::INT16:
+            return DecodeScaledIntegers<int16_t, DST>(context.Values<int16_t>(), context.count, rescale, validity,
+                                                      context.target_type, target);
+        case arrow::Type::INT32:
+            return DecodeScaledIntegers<int32_t, DST>(context.Values<int32_t>(), context.count, rescale, validity,
+                                                      context.target_type, target);
+        case arrow::Type::INT64:
+            return DecodeScaledIntegers<int64_t, DST>(context.Values<int64_t>(), context.count, rescale, validity,
+                                                      context.target_type, target);
+        default:
+            return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                                 context.target_type.ToString());
+    }
+}
+
+arrow::Status DecodeExactNumeric(const DecodeContext& context) {
+    auto& type = context.target_type;
+    int32_t target_scale = type.id() == LogicalTypeId::DECIMAL ? DecimalType::GetScale(type) : 0;
+    switch (type.InternalType()) {
+        case PhysicalType::INT8:
+            return DecodeNumber<int8_t>(context, target_scale);
+        case PhysicalType::INT16:
+            return DecodeNumber<int16_t>(context, target_scale);
+        case PhysicalType::INT32:
+            return DecodeNumber<int32_t>(context, target_scale);
+        case PhysicalType::INT64:
+            return DecodeNumber<int64_t>(context, target_scale);
+        case PhysicalType::INT128:
+            return DecodeNumber<hugeint_t>(context, target_scale);
+        default:
+            return arrow::Status::NotImplemented("Unsupported storage for " + type.ToString());
+    }
+}
+
+template<typename SRC, typename DST>
+void DecodeScaledReal(const SRC* source, idx_t count, int32_t scale, DST* target) {
+    if (scale == 0) {
+        for (idx_t i = 0; i < count; i++) {
+            target[i] = static_cast<DST>(source[i]);
+        }
+        return;
+    }
+    auto divisor = static_cast<double>(POWERS_OF_TEN[MinValue<int32_t>(scale, MAX_INT64_EXPONENT)]);
+    for (idx_t i = 0; i < count; i++) {
+        target[i] = static_cast<DST>(static_cast<double>(source[i]) / divisor);
+    }
+}
+
+template<typename DST>
+arrow::Status DecodeReal(const DecodeContext& context) {
+    auto target = FlatVector::GetData<DST>(context.result);
+    auto scale = context.source_scale;
+    switch (context.data.type->id()) {
+        case arrow::Type::DOUBLE:
+            DecodeScaledReal(context.Values<double>(), context.count, 0, target);
+            return arrow::Status::OK();
+        case arrow::Type::FLOAT:
+            DecodeScaledReal(context.Values<float>(), context.count, 0, target);
+            return arrow::Status::OK();
+        case arrow::Type::INT8:
+            DecodeScaledReal(context.Values<int8_t>(), context.count, scale, target);
+            return arrow::Status::OK();
+        case arrow::Type::INT16:
+            DecodeScaledReal(context.Values<int16_t>(), context.count, scale, target);
+            return arrow::Status::OK();
+        case arrow::Type::INT32:
+            DecodeScaledReal(context.Values<int32_t>(), context.count, scale, target);
+            return arrow::Status::OK();
+        case arrow::Type::INT64:
+            DecodeScaledReal(context.Values<int64_t>(), context.count, scale, target);
+            return arrow::Status::OK();
+        case arrow::Type::DECIMAL128: {
+            auto& decimal = static_cast<const arrow::Decimal128Type&>(*context.data.type);
+            auto source = context.Values<hugeint_t>();
+            auto divisor = static_cast<double>(POWERS_OF_TEN[MinValue<int32_t>(decimal.scale(), MAX_INT64_EXPONENT)]);
+            for (idx_t i = 0; i < context.count; i++) {
+                target[i] = static_cast<DST>(Hugeint::Cast<double>(source[i]) / divisor);
+            }
+            return arrow::Status::OK();
+        }
+        default:
+            return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                                 context.target_type.ToString());
+    }
+}
+
+/**
+ * @brief Power of ten per second of a DuckDB TIME / TIMESTAMP variant
+ */
+int32_t ScaleOfTemporalType(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return 0;
+        case LogicalTypeId::TIMESTAMP_MS:
+            return 3;
+        case LogicalTypeId::TIMESTAMP_NS:
+            return NANOS_SCALE;
+        default:
+            return MICROS_SCALE;
+    }
+}
+
+int32_t ScaleOfTimeUnit(arrow::TimeUnit::type unit) {
+    switch (unit) {
+        case arrow::TimeUnit::SECOND:
+            return 0;
+        case arrow::TimeUnit::MILLI:
+            return 3;
+        case arrow::TimeUnit::MICRO:
+            return 6;
+        default:
+            return 9;
+    }
+}
+
+/**
+ * @brief Decode Snowflake's struct timestamp encodings into int64 ticks of the target unit
+ *
+ * {epoch, fraction[, timezone]}: epoch is whole seconds, fraction nanoseconds.
+ * {epoch, timezone}: epoch is scaled by 10^scale.
+ * The epoch is always UTC, so the timezone field is not needed for DuckDB's
+ * TIMESTAMP / TIMESTAMP WITH TIME ZONE representation.
+ */
+arrow::Status DecodeTimestampStruct(const DecodeContext& context, int32_t target_scale, int64_t* target) {
+    auto& type = static_cast<const arrow::StructType&>(*context.data.type);
+    auto epoch_index = type.GetFieldIndex("epoch");
+    auto fraction_index = type.GetFieldIndex("fraction");
+    if (epoch_index < 0 || type.field(epoch_index)->type()->id() != arrow::Type::INT64) {
+        return arrow::Status::Invalid("Timestamp struct without an int64 'epoch' field: " + type.ToString());
+    }
+    // Children are stored unsliced; the struct's own offset applies to them too
+    auto& epoch_data = *context.data.child_data[static_cast<size_t>(epoch_index)];
+    auto base = context.data.offset + static_cast<int64_t>(context.offset);
+    auto epoch = epoch_data.GetValues<int64_t>(1, epoch_data.offset + base);
+    auto& validity = context.Validity();
+
+    if (fraction_index < 0) {
+        ARROW_ASSIGN_OR_RAISE(auto rescale, RescaleBetween(context.source_scale, target_scale, true));
+        return DecodeScaledIntegers<int64_t, int64_t>(epoch, context.count, rescale, validity, context.target_type,
+                                                      target);
+    }
+    if (type.field(fraction_index)->type()->id() != arrow::Type::INT32) {
+        return arrow::Status::Invalid("Timestamp struct 'fraction' field must be int32: " + type.ToString());
+    }
+    auto& fraction_data = *context.data.child_data[static_cast<size_t>(fraction_index)];
+    auto fraction = fraction_data.GetValues<int32_t>(1, fraction_data.offset + base);
+
+    // The fraction is always nanoseconds in [0, 10^9), so truncation is a floor
+    Rescale to_target;
+    to_target.multiplier = POWERS_OF_TEN[target_scale];
+    auto seconds_status = DecodeScaledIntegers<int64_t, int64_t>(epoch, context.count, to_target, validity,
+                                                                 context.target_type, target);
+    if (!seconds_status.ok()) {
+        return seconds_status;
+    }
+    auto fraction_divisor = static_cast<int32_t>(POWERS_OF_TEN[NANOS_SCALE - target_scale]);
+    for (idx_t i = 0; i < context.count; i++) {
+        target[i] += fraction[i] / fraction_divisor;
+    }
+    return arrow::Status::OK();
+}
+
+/**
+ * @brief Decode TIME and every TIMESTAMP variant (int64 ticks of the type's unit)
+ */
+arrow::Status DecodeTemporal(const DecodeContext& context) {
+    auto target = FlatVector::GetData<int64_t>(context.result);
+    auto target_scale = ScaleOfTemporalType(context.target_type);
+    auto& validity = context.Validity();
+    auto scale = context.source_scale;
+    switch (context.data.type->id()) {
+        case arrow::Type::TIMESTAMP:
+            scale = ScaleOfTimeUnit(static_cast<const arrow::TimestampType&>(*context.data.type).unit());
+            break;
+        case arrow::Type::TIME32:
+            scale = ScaleOfTimeUnit(static_cast<const arrow::Time32Type&>(*context.data.type).unit());
+            break;
+        case arrow::Type::TIME64:
+            scale = ScaleOfTimeUnit(static_cast<const arrow::Time64Type&>(*context.data.type).unit());
+            break;
+        case arrow::Type::STRUCT:
+            return DecodeTimestampStruct(context, target_scale, target);
+        default:
+            break;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto rescale, RescaleBetween(scale, target_scale, true));
+    switch (context.data.type->id()) {
+        case arrow::Type::INT32:
+        case arrow::Type::TIME32:
+            return DecodeScaledIntegers<int32_t, int64_t>(context.Values<int32_t>(), context.count, rescale, validity,
+                                                          context.target_type, target);
+        case arrow::Type::INT64:
+        case arrow::Type::TIME64:
+        case arrow::Type::TIMESTAMP:
+            return DecodeScaledIntegers<int64_t, int64_t>(context.Values<int64_t>(), context.count, rescale, validity,
+                                                          context.target_type, target);
+        default:
+            return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                                 context.target_type.ToString());
+    }
+}
+
+arrow::Status DecodeDate(const DecodeContext& context) {
+    auto target = FlatVector::GetData<int32_t>(context.result);
+    switch (context.data.type->id()) {
+        case arrow::Type::DATE32:
+        case arrow::Type::INT32:
+            // date_t is int32 days since epoch, identical to date32
+            std::memcpy(target, context.Values<int32_t>(), context.count * sizeof(int32_t));
+            return arrow::Status::OK();
+        case arrow::Type::DATE64: {
+            Rescale to_days;
+            to_days.divisor = MILLIS_PER_DAY;
+            to_days.floor = true;
+            return DecodeScaledIntegers<int64_t, int32_t>(context.Values<int64_t>(), context.count, to_days,
+                                                          context.Validity(), context.target_type, target);
+        }
+        default:
+            return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                                 context.target_type.ToString());
+    }
+}
+
+arrow::Status DecodeBoolean(const DecodeContext& context) {
+    if (context.data.type->id() != arrow::Type::BOOL) {
+        return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                             context.target_type.ToString());
+    }
+    auto bits = context.data.buffers[1]->data();
+    auto bit_offset = static_cast<idx_t>(context.data.offset) + context.offset;
+    auto target = FlatVector::GetData<bool>(context.result);
+    for (idx_t i = 0; i < context.count; i++) {
+        auto bit = bit_offset + i;
+        target[i] = (bits[bit >> 3] >> (bit & 7)) & 1;
+    }
+    return arrow::Status::OK();
+}
+
+/**
+ * @brief Keeps the Arrow buffers that decoded strings point into alive
+ *
+ * Attached to the result's string heap, so the buffers live exactly as long as
+ * the vector (and every slice or copy sharing its heap) references them.
+ */
+class ArrowStringBuffer : public VectorBuffer {
+public:
+    explicit ArrowStringBuffer(std::vector<std::shared_ptr<arrow::Buffer>> buffers)
+        : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffers_(std::move(buffers)) {
+    }
+
+private:
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers_;
+};
+
+/**
+ * @brief utf8 / binary / large_* values without copying the payload
+ *
+ * Strings of up to string_t::INLINE_LENGTH bytes are inlined into the string_t
+ * as usual; longer ones point into the Arrow data buffer, which the result pins.
+ */
+template<typename OFFSET>
+arrow::Status DecodeStringValues(const DecodeContext& context) {
+    auto offsets = context.Values<OFFSET>();
+    auto& payload = context.data.buffers[2];
+    auto target = FlatVector::GetData<string_t>(context.result);
+    auto& validity = context.Validity();
+    if (!payload) {
+        for (idx_t i = 0; i < context.count; i++) {
+            target[i] = string_t(static_cast<uint32_t>(0));
+        }
+        return arrow::Status::OK();
+    }
+    auto data = reinterpret_cast<const char*>(payload->data());
+    bool referenced = false;
+    for (idx_t i = 0; i < context.count; i++) {
+        if (!validity.RowIsValid(i)) {
+            continue;
+        }
+        auto length = static_cast<uint32_t>(offsets[i + 1] - offsets[i]);
+        target[i] = string_t(data + offsets[i], length);
+        referenced |= !target[i].IsInlined();
+    }
+    if (referenced) {
+        StringVector::AddBuffer(context.result, make_buffer<ArrowStringBuffer>(
+                                                    std::vector<std::shared_ptr<arrow::Buffer>> {payload}));
+    }
+    return arrow::Status::OK();
+}
+
+/**
+ * @brief string_view / binary_view values without copying the payload
+ *
+ * Inline views are copied into the string_t (same 12-byte inline layout);
+ * out-of-line views point into their variadic data buffer, pinned by the result.
+ */
+arrow::Status DecodeStringViews(const DecodeContext& context) {
+    auto views = context.Values<arrow::BinaryViewType::c_type>();
+    auto target = FlatVector::GetData<string_t>(context.result);
+    auto& validity = context.Validity();
+    auto& buffers = context.data.buffers;
+    bool referenced = false;
+    for (idx_t i = 0; i < context.count; i++) {
+        if (!validity.RowIsValid(i)) {
+            continue;
+        }
+        auto& view = views[i];
+        auto length = static_cast<uint32_t>(view.size());
+        if (view.is_inline()) {
+            target[i] = string_t(reinterpret_cast<const char*>(view.inline_data()), length);
+            continue;
+        }
+        auto buffer = static_cast<size_t>(view.ref.buffer_index) + 2;
+        if (buffer >= buffers.size() || !buffers[buffer]) {
+            return arrow::Status::Invalid("String view at row " + std::to_string(i) + " references missing buffer " +
+                                          std::to_string(view.ref.buffer_index));
+        }
+        target[i] = string_t(reinterpret_cast<const char*>(buffers[buffer]->data()) + view.ref.offset, length);
+        referenced = true;
+    }
+    if (referenced) {
+        StringVector::AddBuffer(context.result, make_buffer<ArrowStringBuffer>(
+                                                    std::vector<std::shared_ptr<arrow::Buffer>>(buffers.begin() + 2,
+                                                                                                buffers.end())));
+    }
+    return arrow::Status::OK();
+}
+
+arrow::Status DecodeString(const DecodeContext& context) {
+    switch (context.data.type->id()) {
+        case arrow::Type::STRING:
+        case arrow::Type::BINARY:
+            return DecodeStringValues<int32_t>(context);
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::LARGE_BINARY:
+            return DecodeStringValues<int64_t>(context);
+        case arrow::Type::STRING_VIEW:
+        case arrow::Type::BINARY_VIEW:
+            return DecodeStringViews(context);
+        default:
+            return arrow::Status::NotImplemented("Cannot decode Arrow " + context.data.type->ToString() + " into " +
+                                                 context.target_type.ToString());
+    }
+}
+
+arrow::Status DecodeValues(const DecodeContext& context) {
+    switch (context.target_type.id()) {
+        case LogicalTypeId::BOOLEAN:
+            return DecodeBoolean(context);
+        case LogicalTypeId::TINYINT:
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+        case LogicalTypeId::HUGEINT:
+        case LogicalTypeId::DECIMAL:
+            return DecodeExactNumeric(context);
+        case LogicalTypeId::FLOAT:
+            return DecodeReal<float>(context);
+        case LogicalTypeId::DOUBLE:
+            return DecodeReal<double>(context);
+        case LogicalTypeId::DATE:
+            return DecodeDate(context);
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return DecodeTemporal(context);
+        case LogicalTypeId::VARCHAR:
+        case LogicalTypeId::BLOB:
+            return DecodeString(context);
+        default:
+            return arrow::Status::NotImplemented("No decode kernel for " + context.target_type.ToString());
+    }
+}
+
+bool HasDecodeKernel(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN:
+        case LogicalTypeId::TINYINT:
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+        case LogicalTypeId::HUGEINT:
+        case LogicalTypeId::DECIMAL:
+        case LogicalTypeId::FLOAT:
+        case LogicalTypeId::DOUBLE:
+        case LogicalTypeId::DATE:
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+        case LogicalTypeId::VARCHAR:
+        case LogicalTypeId::BLOB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Whether an Arrow type holds text: utf8 of any offset width, views, or a dictionary of these
+ */
+bool IsStringStorage(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::STRING:
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::STRING_VIEW:
+            return true;
+        case arrow::Type::DICTIONARY:
+            return IsStringStorage(*static_cast<const arrow::DictionaryType&>(type).value_type());
+        default:
+            return false;
+    }
+}
+
+// ===== DICTIONARY INDICES =====
+
+/**
+ * @brief Selection of the dictionary entries rows [offset, offset + count) refer to
+ *
+ * Null rows select null_index, the NULL slot after the dictionary values.
+ */
+template<typename INDEX>
+arrow::Status SelectDictionaryEntries(const arrow::ArrayData& indices, idx_t offset, idx_t count, idx_t null_index,
+                                      SelectionVector& sel) {
+    auto values = indices.GetValues<INDEX>(1, indices.offset + static_cast<int64_t>(offset));
+    auto bitmap = indices.null_count != 0 && indices.buffers[0] ? indices.buffers[0]->data() : nullptr;
+    auto bit_offset = indices.offset + static_cast<int64_t>(offset);
+    for (idx_t i = 0; i < count; i++) {
+        if (bitmap && !arrow::bit_util::GetBit(bitmap, bit_offset + static_cast<int64_t>(i))) {
+            sel.set_index(i, null_index);
+            continue;
+        }
+        auto index = static_cast<int64_t>(values[i]);
+        if (index < 0 || static_cast<idx_t>(index) >= null_index) {
+            return arrow::Status::Invalid("Dictionary index " + std::to_string(index) + " at row " +
+                                          std::to_string(i) + " is out of range for a dictionary of " +
+                                          std::to_string(null_index) + " values");
+        }
+        sel.set_index(i, static_cast<idx_t>(index));
+    }
+    return arrow::Status::OK();
+}
+
+arrow::Status SelectDictionaryEntries(const arrow::ArrayData& indices, idx_t offset, idx_t count, idx_t null_index,
+                                      SelectionVector& sel) {
+    switch (indices.type->id()) {
+        case arrow::Type::INT8:
+            return SelectDictionaryEntries<int8_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::UINT8:
+            return SelectDictionaryEntries<uint8_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::INT16:
+            return SelectDictionaryEntries<int16_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::UINT16:
+            return SelectDictionaryEntries<uint16_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::INT32:
+            return SelectDictionaryEntries<int32_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::UINT32:
+            return SelectDictionaryEntries<uint32_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::INT64:
+            return SelectDictionaryEntries<int64_t>(indices, offset, count, null_index, sel);
+        case arrow::Type::UINT64:
+            return SelectDictionaryEntries<uint64_t>(indices, offset, count, null_index, sel);
+        default:
+            return arrow::Status::NotImplemented("Dictionary indices of type " + indices.type->ToString());
+    }
+}
+
+/**
+ * @brief Scale of integer-encoded values: field metadata first, then the target type
+ */
+int32_t ResolveSourceScale(const arrow::Field& field, const LogicalType& target_type) {
+    if (field.metadata()) {
+        auto scale = field.metadata()->Get(SnowflakeColumnDecoder::SCALE_METADATA_KEY);
+        if (scale.ok()) {
+            try {
+                return std::stoi(*scale);
+            } catch (const std::exception&) {
+                // Fall through to the type default
+            }
+        }
+    }
+    switch (target_type.id()) {
+        case LogicalTypeId::DECIMAL:
+            return DecimalType::GetScale(target_type);
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return DEFAULT_TEMPORAL_SCALE;
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+// ===== COLUMN DECODER =====
+
+SnowflakeColumnDecoder::ConversionResult<SnowflakeColumnDecoder>
+SnowflakeColumnDecoder::Create(const arrow::Field& field, const LogicalType& target_type) {
+    if (!HasDecodeKernel(target_type)) {
+        return ConversionResult<SnowflakeColumnDecoder>::Error("No decode kernel for " + target_type.ToString() +
+                                                               " (column '" + field.name() + "')");
+    }
+    SnowflakeColumnDecoder decoder;
+    decoder.target_type_ = target_type;
+    decoder.source_scale_ = ResolveSourceScale(field, target_type);
+    return ConversionResult<SnowflakeColumnDecoder>::Success(std::move(decoder));
+}
+
+SnowflakeColumnDecoder::ConversionResult<idx_t>
+SnowflakeColumnDecoder::Decode(const arrow::Array& source, idx_t offset, idx_t count, Vector& result,
+                               SnowflakeDecodedDictionary* dictionary) const {
+    if (offset + count > static_cast<idx_t>(source.length())) {
+        return ConversionResult<idx_t>::Error("Decode range [" + std::to_string(offset) + ", " +
+                                              std::to_string(offset + count) + ") exceeds batch of " +
+                                              std::to_string(source.length()) + " rows");
+    }
+    auto& data = *source.data();
+    if (data.type->id() == arrow::Type::DICTIONARY) {
+        SnowflakeDecodedDictionary this_call;
+        return DecodeDictionary(data, offset, count, result, dictionary ? *dictionary : this_call);
+    }
+    DecodeValidity(data, offset, count, result);
+    DecodeContext context {data, offset, count, target_type_, source_scale_, result};
+    auto status = DecodeValues(context);
+    if (!status.ok()) {
+        return ConversionResult<idx_t>::Error(status.message());
+    }
+    return ConversionResult<idx_t>::Success(std::move(count));
+}
+
+SnowflakeColumnDecoder::ConversionResult<idx_t>
+SnowflakeColumnDecoder::DecodeDictionary(const arrow::ArrayData& source, idx_t offset, idx_t count, Vector& result,
+                                         SnowflakeDecodedDictionary& dictionary) const {
+    if (!source.dictionary) {
+        return ConversionResult<idx_t>::Error("Dictionary array without a dictionary");
+    }
+    auto size = static_cast<idx_t>(source.dictionary->length);
+    if (dictionary.source != source.dictionary || !dictionary.values) {
+        std::unique_ptr<Vector> values(new Vector(target_type_, size + 1));
+        auto decoded = Decode(*arrow::MakeArray(source.dictionary), 0, size, *values);
+        if (!decoded.IsValid()) {
+            return ConversionResult<idx_t>::Error("dictionary: " + decoded.GetError());
+        }
+        // Slot `size` is the NULL that null indices select
+        auto& decoded_validity = FlatVector::Validity(*values);
+        ValidityMask validity;
+        validity.Initialize(size + 1);
+        for (idx_t i = 0; i < size; i++) {
+            if (!decoded_validity.RowIsValid(i)) {
+                validity.SetInvalid(i);
+            }
+        }
+        validity.SetInvalid(size);
+        FlatVector::SetValidity(*values, validity);
+        dictionary.source = source.dictionary;
+        dictionary.values = std::move(values);
+    }
+
+    SelectionVector sel(count);
+    auto status = SelectDictionaryEntries(source, offset, count, size, sel);
+    if (!status.ok()) {
+        return ConversionResult<idx_t>::Error(status.message());
+    }
+    // The slice shares the dictionary's buffers, so it outlives a later replacement
+    result.Slice(*dictionary.values, sel, count);
+    return ConversionResult<idx_t>::Success(std::move(count));
+}
+
+SnowflakeColumnDecoder::ConversionResult<std::string>
+SnowflakeColumnDecoder::ResolveSnowflakeType(const arrow::Field& field) {
+    auto& metadata = field.metadata();
+    if (!metadata || !metadata->Contains(LOGICAL_TYPE_METADATA_KEY)) {
+        return SnowflakeTypeConverter::ConvertArrowToSnowflake(*field.type());
+    }
+    auto Get = [&](const char* key, const char* fallback) {
+        auto value = metadata->Get(key);
+        return value.ok() ? *value : std::string(fallback);
+    };
+    auto name = Get(LOGICAL_TYPE_METADATA_KEY, "");
+    if (name == "FIXED") {
+        return ConversionResult<std::string>::Success("NUMBER(" + Get(PRECISION_METADATA_KEY, "38") + "," +
+                                                      Get(SCALE_METADATA_KEY, "0") + ")");
+    }
+    if (name == "TIME" || StringUtil::StartsWith(name, "TIMESTAMP")) {
+        return ConversionResult<std::string>::Success(name + "(" + Get(SCALE_METADATA_KEY, "9") + ")");
+    }
+    // TEXT, REAL, BOOLEAN, DATE, BINARY and the semi-structured types are valid type names
+    return ConversionResult<std::string>::Success(std::move(name));
+}
+
+LogicalType SnowflakeColumnDecoder::GetReadType(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::STRUCT:
+        case LogicalTypeId::LIST:
+        case LogicalTypeId::MAP:
+            return LogicalType::VARCHAR;
+        default:
+            return type;
+    }
+}
+
+// ===== BATCH DECODER =====
+
+SnowflakeBatchDecoder::ConversionResult<SnowflakeBatchDecoder>
+SnowflakeBatchDecoder::Create(const arrow::Schema& schema, const std::vector<LogicalType>& target_types) {
+    if (static_cast<idx_t>(schema.num_fields()) != target_types.size()) {
+        return ConversionResult<SnowflakeBatchDecoder>::Error(
+            "Schema has " + std::to_string(schema.num_fields()) + " fields but " +
+            std::to_string(target_types.size()) + " target types were given");
+    }
+    SnowflakeBatchDecoder decoder;
+    std::string errors;
+    for (idx_t col = 0; col < target_types.size(); col++) {
+        auto& field = *schema.field(static_cast<int>(col));
+        auto column = SnowflakeColumnDecoder::Create(field, target_types[col]);
+        if (!column.IsValid()) {
+            errors += (errors.empty() ? "" : "; ") + column.GetError();
+            continue;
+        }
+        decoder.names_.push_back(field.name());
+        decoder.types_.push_back(target_types[col]);
+        decoder.columns_.push_back(column.GetValue());
+    }
+    if (!errors.empty()) {
+        return ConversionResult<SnowflakeBatchDecoder>::Error(errors);
+    }
+    return ConversionResult<SnowflakeBatchDecoder>::Success(std::move(decoder));
+}
+
+SnowflakeBatchDecoder::ConversionResult<SnowflakeBatchDecoder>
+SnowflakeBatchDecoder::CreateFromSnowflakeTypes(const arrow::Schema& schema,
+                                                const std::vector<std::string>& snowflake_types,
+                                                bool exact_timestamps) {
+    std::vector<LogicalType> target_types;
+    target_types.reserve(snowflake_types.size());
+    for (idx_t col = 0; col < snowflake_types.size(); col++) {
+        auto& snowflake_type = snowflake_types[col];
+        LogicalType target_type;
+        if (exact_timestamps) {
+            auto parsed = SnowflakeTypeParser::Parse(snowflake_type);
+            if (!parsed.IsValid()) {
+                return ConversionResult<SnowflakeBatchDecoder>::Error(parsed.FormatError(snowflake_type));
+            }
+            target_type = parsed.ExactTemporalType();
+        } else {
+            auto converted = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB(snowflake_type);
+            if (!converted.IsValid()) {
+                return ConversionResult<SnowflakeBatchDecoder>::Error(converted.GetError());
+            }
+            target_type = converted.GetValue();
+        }
+        // Nested values sent as JSON text read as VARCHAR; real Arrow nesting keeps its type
+        if (col < static_cast<idx_t>(schema.num_fields()) &&
+            IsStringStorage(*schema.field(static_cast<int>(col))->type())) {
+            target_type = SnowflakeColumnDecoder::GetReadType(target_type);
+        }
+        target_types.push_back(std::move(target_type));
+    }
+    return Create(schema, target_types);
+}
+
+SnowflakeBatchDecoder::ConversionResult<SnowflakeBatchDecoder>
+SnowflakeBatchDecoder::CreateFromSchema(const arrow::Schema& schema, bool exact_timestamps) {
+    std::vector<std::string> snowflake_types;
+    snowflake_types.reserve(static_cast<size_t>(schema.num_fields()));
+    for (auto& field : schema.fields()) {
+        auto resolved = SnowflakeColumnDecoder::ResolveSnowflakeType(*field);
+        if (!resolved.IsValid()) {
+            return ConversionResult<SnowflakeBatchDecoder>::Error("column '" + field->name() + "': " +
+                                                                  resolved.GetError());
+        }
+        snowflake_types.push_back(resolved.GetValue());
+    }
+    return CreateFromSnowflakeTypes(schema, snowflake_types, exact_timestamps);
+}
+
+SnowflakeBatchDecoder::ConversionResult<idx_t>
+SnowflakeBatchDecoder::Decode(const arrow::RecordBatch& batch, idx_t offset, DataChunk& output,
+                              std::vector<SnowflakeDecodedDictionary>* dictionaries,
+                              std::atomic<uint64_t>* column_ns) const {
+    if (static_cast<idx_t>(batch.num_columns()) != columns_.size()) {
+        return ConversionResult<idx_t>::Error("Batch has " + std::to_string(batch.num_columns()) +
+                                              " columns but the decoder was bound to " +
+                                              std::to_string(columns_.size()));
+    }
+    output.Reset();
+    auto available = static_cast<idx_t>(batch.num_rows()) > offset ? static_cast<idx_t>(batch.num_rows()) - offset : 0;
+    auto count = MinValue<idx_t>(available, output.GetCapacity());
+    if (dictionaries && dictionaries->size() != columns_.size()) {
+        dictionaries->resize(columns_.size());
+    }
+    for (idx_t col = 0; col < columns_.size(); col++) {
+        auto dictionary = dictionaries ? &(*dictionaries)[col] : nullptr;
+        SnowflakeScopedTimer timer(column_ns ? &column_ns[col] : nullptr);
+        auto decoded = columns_[col].Decode(*batch.column(static_cast<int>(col)), offset, count, output.data[col],
+                                            dictionary);
+        if (!decoded.IsValid()) {
+            return ConversionResult<idx_t>::Error("column '" + names_[col] + "': " + decoded.GetError());
+        }
+    }
+    output.SetCardinality(count);
+    return ConversionResult<idx_t>::Success(std::move(count));
+}
+
+} // namespace duckdb
\ No newline at end of file
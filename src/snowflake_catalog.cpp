@@ -0,0 +1,567 @@
+#include "snowflake_catalog.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include "snowflake_connection_pool.hpp"
+#include "snowflake_ingest.hpp"
+#include "snowflake_memory_pool.hpp"
+#include "snowflake_scan.hpp"
+#include "type_converter.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/parser/parsed_data/attach_info.hpp"
+#include "duckdb/parser/parsed_data/create_schema_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/planner/operator/logical_insert.hpp"
+#include "duckdb/storage/database_size.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace duckdb {
+
+namespace {
+
+[[noreturn]] void ThrowNotSupported(const string &operation) {
+    throw NotImplementedException("Snowflake catalogs do not support %s", operation);
+}
+
+} // namespace
+
+// ===== TABLES =====
+
+SnowflakeTableEntry::SnowflakeTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info,
+                                         std::shared_ptr<const SnowflakeTableInfo> table)
+    : TableCatalogEntry(catalog, schema, info), table_(std::move(table)) {
+    std::string columns_list;
+    for (auto &column : columns.Logical()) {
+        columns_list += (columns_list.empty() ? "" : ", ") + SnowflakeTypeConverter::QuoteIdentifier(column.Name());
+    }
+    auto &database = catalog.Cast<SnowflakeCatalog>().GetConfig().database;
+    query_ = "SELECT " + columns_list + " FROM " +
+             SnowflakeSchemaCache::QualifiedName(database, table_->schema, table_->name);
+}
+
+unique_ptr<SnowflakeTableEntry> SnowflakeTableEntry::Create(Catalog &catalog, SchemaCatalogEntry &schema,
+                                                            std::shared_ptr<const SnowflakeTableInfo> table) {
+    CreateTableInfo info(schema, table->name);
+    // Quoted Snowflake names may differ only in case; DuckDB names may not
+    case_insensitive_set_t names;
+    for (auto &column : table->columns) {
+        if (!column.error.empty() || !names.insert(column.name).second) {
+            continue;
+        }
+        // OBJECT/ARRAY/MAP values are scanned as the JSON text Snowflake sends
+        info.columns.AddColumn(ColumnDefinition(column.name, SnowflakeColumnDecoder::GetReadType(column.type)));
+    }
+    if (names.empty()) {
+        return nullptr;
+    }
+    return make_uniq<SnowflakeTableEntry>(catalog, schema, info, std::move(table));
+}
+
+unique_ptr<BaseStatistics> SnowflakeTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
+    return nullptr;
+}
+
+TableFunction SnowflakeTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
+    auto &catalog = ParentCatalog().Cast<SnowflakeCatalog>();
+    auto result = make_uniq<SnowflakeScanBindData>();
+    result->config = catalog.GetConfig();
+    result->query = query_;
+    // Catalog tables are written through INSERT and COPY, so a cached result could be stale
+    result->cache = false;
+    for (auto &column : columns.Logical()) {
+        result->names.push_back(column.Name());
+        result->types.push_back(column.Type());
+        auto described = std::find_if(table_->columns.begin(), table_->columns.end(),
+                                      [&](const SnowflakeColumnInfo &info) {
+                                          return info.name == column.Name() && info.error.empty();
+                                      });
+        result->snowflake_types.push_back(described != table_->columns.end() ? described->snowflake_type
+                                                                             : std::string());
+    }
+    bind_data = std::move(result);
+    return SnowflakeScanFunction::GetFunction();
+}
+
+TableStorageInfo SnowflakeTableEntry::GetStorageInfo(ClientContext &context) {
+    return TableStorageInfo();
+}
+
+// ===== SCHEMAS =====
+
+SnowflakeSchemaEntry::SnowflakeSchemaEntry(Catalog &catalog, CreateSchemaInfo &info)
+    : SchemaCatalogEntry(catalog, info) {
+}
+
+optional_ptr<SnowflakeTableEntry>
+SnowflakeSchemaEntry::GetTableEntry(const std::shared_ptr<const SnowflakeTableInfo> &table) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &entry = tables_[table->name];
+    if (entry && entry->GetTableInfo() == table) {
+        return entry.get();
+    }
+    auto created = SnowflakeTableEntry::Create(ParentCatalog(), *this, table);
+    if (!created) {
+        return nullptr;
+    }
+    if (entry) {
+        retired_.push_back(std::move(entry));
+    }
+    entry = std::move(created);
+    return entry.get();
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::GetEntry(CatalogTransaction transaction, CatalogType type,
+                                                          const string &name) {
+    if (type != CatalogType::TABLE_ENTRY) {
+        return nullptr;
+    }
+    auto connector = ParentCatalog().Cast<SnowflakeCatalog>().Connect();
+    auto loaded = SnowflakeSchemaCache::Get().GetSchema(*connector, this->name);
+    if (!loaded.first) {
+        throw IOException("snowflake: " + loaded.second);
+    }
+    auto table = loaded.first->FindTable(name);
+    if (!table) {
+        return nullptr;
+    }
+    auto entry = GetTableEntry(table);
+    if (!entry) {
+        throw BinderException("Snowflake table %s.%s has no column of a type DuckDB can read", this->name,
+                              table->name);
+    }
+    return entry.get();
+}
+
+void SnowflakeSchemaEntry::Scan(ClientContext &context, CatalogType type,
+                                const std::function<void(CatalogEntry &)> &callback) {
+    if (type != CatalogType::TABLE_ENTRY) {
+        return;
+    }
+    auto connector = ParentCatalog().Cast<SnowflakeCatalog>().Connect();
+    auto loaded = SnowflakeSchemaCache::Get().GetSchema(*connector, name);
+    if (!loaded.first) {
+        throw IOException("snowflake: " + loaded.second);
+    }
+    for (auto &table : loaded.first->tables) {
+        auto entry = GetTableEntry(table.second);
+        if (entry) {
+            callback(*entry);
+        }
+    }
+}
+
+void SnowflakeSchemaEntry::Scan(CatalogType type, const std::function<void(CatalogEntry &)> &callback) {
+    throw NotImplementedException("Snowflake schemas can only be scanned within a query");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateIndex(CatalogTransaction transaction, CreateIndexInfo &info,
+                                                             TableCatalogEntry &table) {
+    ThrowNotSupported("CREATE INDEX");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateFunction(CatalogTransaction transaction,
+                                                                CreateFunctionInfo &info) {
+    ThrowNotSupported("CREATE FUNCTION");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateTable(CatalogTransaction transaction,
+                                                             BoundCreateTableInfo &info) {
+    ThrowNotSupported("CREATE TABLE");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateView(CatalogTransaction transaction, CreateViewInfo &info) {
+    ThrowNotSupported("CREATE VIEW");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateSequence(CatalogTransaction transaction,
+                                                                CreateSequenceInfo &info) {
+    ThrowNotSupported("CREATE SEQUENCE");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateTableFunction(CatalogTransaction transaction,
+                                                                     CreateTableFunctionInfo &info) {
+    ThrowNotSupported("creating table functions");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateCopyFunction(CatalogTransaction transaction,
+                                                                    CreateCopyFunctionInfo &info) {
+    ThrowNotSupported("creating copy functions");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreatePragmaFunction(CatalogTransaction transaction,
+                                                                      CreatePragmaFunctionInfo &info) {
+    ThrowNotSupported("creating pragma functions");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateCollation(CatalogTransaction transaction,
+                                                                 CreateCollationInfo &info) {
+    ThrowNotSupported("CREATE COLLATION");
+}
+
+optional_ptr<CatalogEntry> SnowflakeSchemaEntry::CreateType(CatalogTransaction transaction, CreateTypeInfo &info) {
+    ThrowNotSupported("CREATE TYPE");
+}
+
+void SnowflakeSchemaEntry::DropEntry(ClientContext &context, DropInfo &info) {
+    ThrowNotSupported("DROP");
+}
+
+void SnowflakeSchemaEntry::Alter(CatalogTransaction transaction, AlterInfo &info) {
+    ThrowNotSupported("ALTER");
+}
+
+// ===== INSERT =====
+
+namespace {
+
+struct SnowflakeInsertGlobalState : public GlobalSinkState {
+    // Buffers of the converted batches, counted against memory_limit
+    std::shared_ptr<SnowflakeMemoryPool> memory;
+    // Declared before the pipeline so it releases its session before the lease ends
+    std::shared_ptr<SnowflakeADBCConnector> connector;
+    std::shared_ptr<SnowflakeTransferMetrics> metrics;
+    unique_ptr<SnowflakeIngestPipeline> pipeline;
+    std::atomic<idx_t> rows {0};
+};
+
+struct SnowflakeInsertLocalState : public LocalSinkState {
+    // Rows gathered for the next batch; a fresh chunk per batch, as for COPY
+    unique_ptr<DataChunk> pending;
+};
+
+/**
+ * @brief INSERT INTO a Snowflake table: the rows are bulk-loaded with SnowflakeIngestPipeline
+ *
+ * Works like COPY ... (FORMAT snowflake, MODE 'append'): every thread
+ * converts batches of rows to Arrow and queues them for one upload. Columns
+ * are matched by name, so an INSERT column list leaves the other columns to
+ * their Snowflake defaults.
+ */
+class SnowflakeInsert : public PhysicalOperator {
+public:
+    SnowflakeInsert(LogicalOperator &op, SnowflakeTableEntry &table, std::shared_ptr<arrow::Schema> schema,
+                    vector<LogicalType> input_types)
+        : PhysicalOperator(PhysicalOperatorType::EXTENSION, op.types, 1), table(table), schema(std::move(schema)),
+          input_types(std::move(input_types)) {
+        options.table = table.GetTableInfo()->name;
+        options.schema = table.GetTableInfo()->schema;
+        options.mode = SnowflakeIngestMode::APPEND;
+    }
+
+    SnowflakeTableEntry &table;
+    std::shared_ptr<arrow::Schema> schema;
+    vector<LogicalType> input_types;
+    SnowflakeIngestOptions options;
+
+    string GetName() const override {
+        return "SNOWFLAKE_INSERT";
+    }
+
+    InsertionOrderPreservingMap<string> ParamsToString() const override {
+        InsertionOrderPreservingMap<string> result;
+        result["Table"] = options.schema + "." + options.table;
+        return result;
+    }
+
+    // Source: the number of rows inserted
+
+    bool IsSource() const override {
+        return true;
+    }
+
+    SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override {
+        auto &global_state = sink_state->Cast<SnowflakeInsertGlobalState>();
+        chunk.SetCardinality(1);
+        chunk.SetValue(0, 0, Value::BIGINT(static_cast<int64_t>(global_state.rows.load())));
+        return SourceResultType::FINISHED;
+    }
+
+    InsertionOrderPreservingMap<string> ExtraSourceParams(GlobalSourceState &gstate,
+                                                          LocalSourceState &lstate) const override {
+        // Shown by EXPLAIN ANALYZE once the load has finished
+        InsertionOrderPreservingMap<string> result;
+        sink_state->Cast<SnowflakeInsertGlobalState>().metrics->ToString(result);
+        return result;
+    }
+
+    // Sink: rows to load
+
+    bool IsSink() const override {
+        return true;
+    }
+
+    bool ParallelSink() const override {
+        return true;
+    }
+
+    unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override {
+        auto result = make_uniq<SnowflakeInsertGlobalState>();
+        result->memory = SnowflakeMemoryPool::Create(context);
+        result->connector = table.ParentCatalog().Cast<SnowflakeCatalog>().Connect();
+        result->metrics = SnowflakeMetrics::Get().Begin(SnowflakeTransferKind::INSERT, schema->field_names(),
+                                                        SnowflakeMetrics::TimingEnabled(context));
+        result->pipeline = make_uniq<SnowflakeIngestPipeline>(result->connector, schema, options, result->metrics);
+        return std::move(result);
+    }
+
+    unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override {
+        return make_uniq<SnowflakeInsertLocalState>();
+    }
+
+    SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override {
+        auto &global_state = input.global_state.Cast<SnowflakeInsertGlobalState>();
+        auto &local_state = input.local_state.Cast<SnowflakeInsertLocalState>();
+        if (local_state.pending && local_state.pending->size() + chunk.size() > options.batch_size) {
+            Flush(global_state, local_state);
+        }
+        if (!local_state.pending) {
+            local_state.pending = make_uniq<DataChunk>();
+            local_state.pending->Initialize(Allocator::Get(context.client), input_types,
+                                            std::max<idx_t>(options.batch_size, STANDARD_VECTOR_SIZE));
+        }
+        local_state.pending->Append(chunk, true);
+        if (local_state.pending->size() >= options.batch_size) {
+            Flush(global_state, local_state);
+        }
+        return SinkResultType::NEED_MORE_INPUT;
+    }
+
+    SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override {
+        Flush(input.global_state.Cast<SnowflakeInsertGlobalState>(),
+              input.local_state.Cast<SnowflakeInsertLocalState>());
+        return SinkCombineResultType::FINISHED;
+    }
+
+    SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                              OperatorSinkFinalizeInput &input) const override {
+        auto &global_state = input.global_state.Cast<SnowflakeInsertGlobalState>();
+        auto result = global_state.pipeline->Finish();
+        if (!result.second.empty()) {
+            throw IOException("snowflake INSERT: " + result.second);
+        }
+        return SinkFinalizeType::READY;
+    }
+
+private:
+    /**
+     * @brief Convert the gathered rows on this thread and queue them for upload
+     */
+    void Flush(SnowflakeInsertGlobalState &global_state, SnowflakeInsertLocalState &local_state) const {
+        if (!local_state.pending || local_state.pending->size() == 0) {
+            return;
+        }
+        // The queued arrays keep the buffers they alias alive on their own
+        auto pending = std::move(local_state.pending);
+        global_state.pipeline->AppendRows(*pending, global_state.memory.get(), "snowflake INSERT");
+        global_state.rows += pending->size();
+    }
+};
+
+} // namespace
+
+// ===== CATALOG =====
+
+SnowflakeCatalog::SnowflakeCatalog(AttachedDatabase &db, SnowflakeConfig config)
+    : Catalog(db), config_(std::move(config)) {
+}
+
+void SnowflakeCatalog::Initialize(bool load_builtin) {
+    // Nothing is read until a schema is referenced
+}
+
+string SnowflakeCatalog::GetDefaultSchema() const {
+    return config_.schema.empty() ? "PUBLIC" : config_.schema;
+}
+
+std::shared_ptr<SnowflakeADBCConnector> SnowflakeCatalog::Connect() {
+    auto leased = SnowflakeConnectionPool::Get().Acquire(config_);
+    if (!leased.first) {
+        throw IOException("snowflake: " + leased.second);
+    }
+    return std::move(leased.first);
+}
+
+SnowflakeSchemaEntry &SnowflakeCatalog::GetSchemaEntry(const std::string &name) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &entry = schemas_[name];
+    if (!entry) {
+        CreateSchemaInfo info;
+        info.schema = name;
+        entry = make_uniq<SnowflakeSchemaEntry>(*this, info);
+    }
+    return *entry;
+}
+
+optional_ptr<SchemaCatalogEntry> SnowflakeCatalog::GetSchema(CatalogTransaction transaction,
+                                                             const string &schema_name, OnEntryNotFound if_not_found,
+                                                             QueryErrorContext error_context) {
+    // Unquoted Snowflake names are stored upper case; DuckDB passes them as typed
+    auto connector = Connect();
+    for (auto &candidate : {StringUtil::Upper(schema_name), schema_name}) {
+        auto loaded = SnowflakeSchemaCache::Get().GetSchema(*connector, candidate);
+        if (!loaded.first) {
+            throw IOException("snowflake: " + loaded.second);
+        }
+        if (!loaded.first->tables.empty()) {
+            return &GetSchemaEntry(candidate);
+        }
+        if (candidate == schema_name) {
+            break;
+        }
+    }
+    if (if_not_found == OnEntryNotFound::RETURN_NULL) {
+        return nullptr;
+    }
+    throw BinderException("Schema \"%s\" has no tables in Snowflake database %s", schema_name, config_.database);
+}
+
+void SnowflakeCatalog::ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) {
+    auto connector = Connect();
+    auto loaded = SnowflakeSchemaCache::Get().PrefetchDatabase(*connector);
+    if (!loaded.second.empty()) {
+        throw IOException("snowflake: " + loaded.second);
+    }
+    for (auto &name : loaded.first) {
+        callback(GetSchemaEntry(name));
+    }
+}
+
+optional_ptr<CatalogEntry> SnowflakeCatalog::CreateSchema(CatalogTransaction transaction, CreateSchemaInfo &info) {
+    ThrowNotSupported("CREATE SCHEMA");
+}
+
+void SnowflakeCatalog::DropSchema(ClientContext &context, DropInfo &info) {
+    ThrowNotSupported("DROP SCHEMA");
+}
+
+unique_ptr<PhysicalOperator> SnowflakeCatalog::PlanInsert(ClientContext &context, LogicalInsert &op,
+                                                          unique_ptr<PhysicalOperator> plan) {
+    if (op.return_chunk) {
+        throw BinderException("RETURNING is not supported for Snowflake tables");
+    }
+    if (op.action_type != OnConflictAction::THROW) {
+        throw BinderException("ON CONFLICT is not supported for Snowflake tables");
+    }
+    auto &table = op.table.Cast<SnowflakeTableEntry>();
+
+    // Input columns follow the INSERT column list when one is given
+    vector<string> names;
+    if (op.column_index_map.empty()) {
+        for (auto &column : table.GetColumns().Physical()) {
+            names.push_back(column.Name());
+        }
+    } else {
+        names.resize(plan->types.size());
+        for (auto &column : table.GetColumns().Physical()) {
+            auto input_index = op.column_index_map[column.Physical()];
+            if (input_index != DConstants::INVALID_INDEX) {
+                names[input_index] = column.Name();
+            }
+        }
+    }
+    auto schema = SnowflakeTypeConverter::ConvertSchema(names, plan->types);
+    if (!schema.IsValid()) {
+        throw BinderException("snowflake INSERT: " + schema.GetError());
+    }
+
+    auto insert = make_uniq<SnowflakeInsert>(op, table, schema.GetValue().arrow_schema, plan->types);
+    insert->children.push_back(std::move(plan));
+    return std::move(insert);
+}
+
+unique_ptr<PhysicalOperator> SnowflakeCatalog::PlanCreateTableAs(ClientContext &context, LogicalCreateTable &op,
+                                                                 unique_ptr<PhysicalOperator> plan) {
+    ThrowNotSupported("CREATE TABLE AS (use COPY ... (FORMAT snowflake, MODE 'create'))");
+}
+
+unique_ptr<PhysicalOperator> SnowflakeCatalog::PlanDelete(ClientContext &context, LogicalDelete &op,
+                                                          unique_ptr<PhysicalOperator> plan) {
+    ThrowNotSupported("DELETE");
+}
+
+unique_ptr<PhysicalOperator> SnowflakeCatalog::PlanUpdate(ClientContext &context, LogicalUpdate &op,
+                                                          unique_ptr<PhysicalOperator> plan) {
+    ThrowNotSupported("UPDATE");
+}
+
+unique_ptr<LogicalOperator> SnowflakeCatalog::BindCreateIndex(Binder &binder, CreateStatement &stmt,
+                                                              TableCatalogEntry &table,
+                                                              unique_ptr<LogicalOperator> plan) {
+    ThrowNotSupported("CREATE INDEX");
+}
+
+DatabaseSize SnowflakeCatalog::GetDatabaseSize(ClientContext &context) {
+    // Storage is Snowflake's; nothing is held locally
+    return DatabaseSize();
+}
+
+// ===== TRANSACTIONS =====
+
+namespace {
+
+class SnowflakeTransaction : public Transaction {
+public:
+    SnowflakeTransaction(TransactionManager &manager, ClientContext &context) : Transaction(manager, context) {
+    }
+};
+
+} // namespace
+
+SnowflakeTransactionManager::SnowflakeTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
+}
+
+Transaction &SnowflakeTransactionManager::StartTransaction(ClientContext &context) {
+    auto transaction = make_uniq<SnowflakeTransaction>(*this, context);
+    auto &result = *transaction;
+    std::lock_guard<std::mutex> guard(lock_);
+    transactions_[result] = std::move(transaction);
+    return result;
+}
+
+ErrorData SnowflakeTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction) {
+    std::lock_guard<std::mutex> guard(lock_);
+    transactions_.erase(transaction);
+    return ErrorData();
+}
+
+void SnowflakeTransactionManager::RollbackTransaction(Transaction &transaction) {
+    // Loads already committed by Snowflake stay committed
+    std::lock_guard<std::mutex> guard(lock_);
+    transactions_.erase(transaction);
+}
+
+void SnowflakeTransactionManager::Checkpoint(ClientContext &context, bool force) {
+}
+
+// ===== STORAGE EXTENSION =====
+
+namespace {
+
+unique_ptr<Catalog> SnowflakeAttach(StorageExtensionInfo *storage_info, ClientContext &context, AttachedDatabase &db,
+                                    const string &name, AttachInfo &info, AccessMode access_mode) {
+    auto config = SnowflakeConfig::Parse(info.path);
+    if (config.database.empty()) {
+        throw BinderException("ATTACH (TYPE snowflake): the connection string needs database=<name>");
+    }
+    return make_uniq<SnowflakeCatalog>(db, std::move(config));
+}
+
+unique_ptr<TransactionManager> SnowflakeCreateTransactionManager(StorageExtensionInfo *storage_info,
+                                                                 AttachedDatabase &db, Catalog &catalog) {
+    return make_uniq<SnowflakeTransactionManager>(db);
+}
+
+} // namespace
+
+SnowflakeStorageExtension::SnowflakeStorageExtension() {
+    attach = SnowflakeAttach;
+    create_transaction_manager = SnowflakeCreateTransactionManager;
+}
+
+} // namespace duckdb
\ No newline at end of file
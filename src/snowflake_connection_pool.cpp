@@ -0,0 +1,324 @@
+#include "snowflake_connection_pool.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+namespace duckdb {
+
+namespace {
+
+using PoolClock = std::chrono::steady_clock;
+
+/**
+ * @brief Sessions are interchangeable only if they connect to the same place as the same principal
+ */
+std::string PoolKey(const SnowflakeConfig &config) {
+    std::string key = config.driver + '\n' + config.account + '\n' + config.user + '\n' + config.password + '\n' +
+                      config.database + '\n' + config.schema + '\n' + config.warehouse + '\n' + config.role + '\n' +
+                      config.private_key_path + '\n' + config.private_key_passphrase + '\n' + config.token;
+    // Sorted: the options map has no stable order
+    std::map<std::string, std::string> options(config.options.begin(), config.options.end());
+    for (auto &option : options) {
+        key += '\n' + option.first + '=' + option.second;
+    }
+    return key;
+}
+
+bool DefaultHealthCheck(SnowflakeADBCConnector &connector) {
+    return connector.Ping().empty();
+}
+
+void RaiseMax(std::atomic<uint64_t> &max, uint64_t value) {
+    auto current = max.load();
+    while (value > current && !max.compare_exchange_weak(current, value)) {
+    }
+}
+
+struct IdleSession {
+    std::unique_ptr<SnowflakeADBCConnector> connector;
+    PoolClock::time_point returned;
+};
+
+} // namespace
+
+/**
+ * @brief Sessions of one configuration
+ *
+ * Leases hold a shared_ptr to their slot, so returning a session never
+ * touches the pool itself.
+ */
+struct SnowflakeConnectionPool::Slot {
+    std::mutex lock;
+    std::condition_variable available;
+    // Oldest first; Acquire takes from the back
+    std::deque<IdleSession> idle;
+    // Leased plus idle plus being opened
+    idx_t open = 0;
+
+    /**
+     * @brief Move idle sessions past idle_timeout (above min_size) into closing; caller holds lock
+     */
+    idx_t TakeExpired(const SnowflakePoolOptions &options, PoolClock::time_point now,
+                      std::vector<std::unique_ptr<SnowflakeADBCConnector>> &closing) {
+        idx_t expired = 0;
+        while (!idle.empty() && open > options.min_size && now - idle.front().returned >= options.idle_timeout) {
+            closing.push_back(std::move(idle.front().connector));
+            idle.pop_front();
+            open--;
+            expired++;
+        }
+        return expired;
+    }
+};
+
+SnowflakeConnectionPool::SnowflakeConnectionPool(SnowflakePoolOptions options) : options_(std::move(options)) {
+}
+
+SnowflakeConnectionPool::~SnowflakeConnectionPool() {
+    // Idle sessions close here; leased ones close when their slot is released
+    for (auto &entry : slots_) {
+        std::lock_guard<std::mutex> guard(entry.second->lock);
+        entry.second->open -= entry.second->idle.size();
+        entry.second->idle.clear();
+    }
+}
+
+SnowflakeConnectionPool &SnowflakeConnectionPool::Get() {
+    static SnowflakeConnectionPool pool;
+    return pool;
+}
+
+void SnowflakeConnectionPool::Configure(const SnowflakePoolOptions &options) {
+    std::lock_guard<std::mutex> guard(lock_);
+    options_ = options;
+}
+
+SnowflakePoolOptions SnowflakeConnectionPool::GetOptions() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return options_;
+}
+
+std::shared_ptr<SnowflakeConnectionPool::Slot> SnowflakeConnectionPool::GetSlot(const SnowflakeConfig &config) {
+    auto key = PoolKey(config);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &slot = slots_[key];
+    if (!slot) {
+        slot = std::make_shared<Slot>();
+    }
+    return slot;
+}
+
+std::shared_ptr<SnowflakeADBCConnector> SnowflakeConnectionPool::Wrap(const std::shared_ptr<Slot> &slot,
+                                                                      std::unique_ptr<SnowflakeADBCConnector> connector) {
+    return std::shared_ptr<SnowflakeADBCConnector>(connector.release(), [slot](SnowflakeADBCConnector *released) {
+        std::unique_ptr<SnowflakeADBCConnector> owned(released);
+        {
+            std::lock_guard<std::mutex> guard(slot->lock);
+            if (owned->IsConnected()) {
+                slot->idle.push_back({std::move(owned), PoolClock::now()});
+            } else {
+                slot->open--;
+            }
+        }
+        slot->available.notify_one();
+        // A disconnected session is destroyed here, outside the lock
+    });
+}
+
+std::pair<std::shared_ptr<SnowflakeADBCConnector>, string>
+SnowflakeConnectionPool::Acquire(const SnowflakeConfig &config) {
+    auto options = GetOptions();
+    if (!options.health_check) {
+        options.health_check = DefaultHealthCheck;
+    }
+    auto slot = GetSlot(config);
+    leases_++;
+
+    auto start = PoolClock::now();
+    auto deadline = start + options.acquire_timeout;
+    bool waited = false;
+    auto record_wait = [&]() {
+        if (!waited) {
+            return;
+        }
+        auto micros = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(PoolClock::now() - start).count());
+        waits_++;
+        total_wait_micros_ += micros;
+        RaiseMax(max_wait_micros_, micros);
+    };
+
+    std::unique_lock<std::mutex> guard(slot->lock);
+    while (true) {
+        std::vector<std::unique_ptr<SnowflakeADBCConnector>> closing;
+        auto now = PoolClock::now();
+        evictions_ += slot->TakeExpired(options, now, closing);
+
+        if (!slot->idle.empty()) {
+            // Most recently returned first: it is the least likely to have gone stale
+            auto session = std::move(slot->idle.back());
+            slot->idle.pop_back();
+            guard.unlock();
+            closing.clear();
+            if (now - session.returned >= options.health_check_after && !options.health_check(*session.connector)) {
+                health_check_failures_++;
+                session.connector.reset();
+                guard.lock();
+                slot->open--;
+                continue;
+            }
+            hits_++;
+            record_wait();
+            return {Wrap(slot, std::move(session.connector)), ""};
+        }
+
+        if (slot->open < options.max_size) {
+            slot->open++;
+            guard.unlock();
+            closing.clear();
+            auto connector = std::unique_ptr<SnowflakeADBCConnector>(new SnowflakeADBCConnector(config));
+            auto error = connector->Connect();
+            if (!error.empty()) {
+                guard.lock();
+                slot->open--;
+                guard.unlock();
+                slot->available.notify_one();
+                return {nullptr, error};
+            }
+            misses_++;
+            record_wait();
+            return {Wrap(slot, std::move(connector)), ""};
+        }
+
+        waited = true;
+        if (slot->available.wait_until(guard, deadline) == std::cv_status::timeout && slot->idle.empty() &&
+            slot->open >= options.max_size) {
+            guard.unlock();
+            record_wait();
+            return {nullptr, StringUtil::Format("Timed out after %lld ms waiting for a pooled Snowflake session",
+                                                static_cast<long long>(options.acquire_timeout.count()))};
+        }
+    }
+}
+
+string SnowflakeConnectionPool::Warm(const SnowflakeConfig &config, idx_t count) {
+    auto options = GetOptions();
+    auto slot = GetSlot(config);
+    count = std::min(count, options.max_size);
+    while (true) {
+        {
+            std::lock_guard<std::mutex> guard(slot->lock);
+            if (slot->open >= count) {
+                return "";
+            }
+            slot->open++;
+        }
+        auto connector = std::unique_ptr<SnowflakeADBCConnector>(new SnowflakeADBCConnector(config));
+        auto error = connector->Connect();
+        {
+            std::lock_guard<std::mutex> guard(slot->lock);
+            if (!error.empty()) {
+                slot->open--;
+            } else {
+                slot->idle.push_back({std::move(connector), PoolClock::now()});
+            }
+        }
+        slot->available.notify_one();
+        if (!error.empty()) {
+            return error;
+        }
+    }
+}
+
+void SnowflakeConnectionPool::EvictIdle() {
+    auto options = GetOptions();
+    std::vector<std::shared_ptr<Slot>> slots;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto &entry : slots_) {
+            slots.push_back(entry.second);
+        }
+    }
+    for (auto &slot : slots) {
+        std::vector<std::unique_ptr<SnowflakeADBCConnector>> closing;
+        std::lock_guard<std::mutex> guard(slot->lock);
+        evictions_ += slot->TakeExpired(options, PoolClock::now(), closing);
+    }
+}
+
+SnowflakePoolMetrics SnowflakeConnectionPool::GetMetrics() const {
+    SnowflakePoolMetrics metrics;
+    metrics.leases = leases_;
+    metrics.hits = hits_;
+    metrics.misses = misses_;
+    metrics.waits = waits_;
+    metrics.total_wait_micros = total_wait_micros_;
+    metrics.max_wait_micros = max_wait_micros_;
+    metrics.evictions = evictions_;
+    metrics.health_check_failures = health_check_failures_;
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto &entry : slots_) {
+        std::lock_guard<std::mutex> slot_guard(entry.second->lock);
+        metrics.open_sessions += entry.second->open;
+        metrics.idle_sessions += entry.second->idle.size();
+    }
+    return metrics;
+}
+
+// ===== snowflake_pool_stats() =====
+
+namespace {
+
+struct PoolStatsState : public GlobalTableFunctionState {
+    bool done = false;
+};
+
+unique_ptr<FunctionData> PoolStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                       vector<LogicalType> &return_types, vector<string> &names) {
+    names = {"leases",    "hits",      "misses",
+             "waits",     "avg_wait_us", "max_wait_us",
+             "evictions", "health_check_failures",
+             "open_sessions", "idle_sessions"};
+    return_types = vector<LogicalType>(names.size(), LogicalType::UBIGINT);
+    return_types[4] = LogicalType::DOUBLE;
+    return make_uniq<TableFunctionData>();
+}
+
+unique_ptr<GlobalTableFunctionState> PoolStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<PoolStatsState>();
+}
+
+void PoolStatsExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &state = input.global_state->Cast<PoolStatsState>();
+    if (state.done) {
+        output.SetCardinality(0);
+        return;
+    }
+    state.done = true;
+
+    auto metrics = SnowflakeConnectionPool::Get().GetMetrics();
+    auto average = metrics.waits == 0 ? 0.0 : static_cast<double>(metrics.total_wait_micros) / metrics.waits;
+    output.SetValue(0, 0, Value::UBIGINT(metrics.leases));
+    output.SetValue(1, 0, Value::UBIGINT(metrics.hits));
+    output.SetValue(2, 0, Value::UBIGINT(metrics.misses));
+    output.SetValue(3, 0, Value::UBIGINT(metrics.waits));
+    output.SetValue(4, 0, Value::DOUBLE(average));
+    output.SetValue(5, 0, Value::UBIGINT(metrics.max_wait_micros));
+    output.SetValue(6, 0, Value::UBIGINT(metrics.evictions));
+    output.SetValue(7, 0, Value::UBIGINT(metrics.health_check_failures));
+    output.SetValue(8, 0, Value::UBIGINT(metrics.open_sessions));
+    output.SetValue(9, 0, Value::UBIGINT(metrics.idle_sessions));
+    output.SetCardinality(1);
+}
+
+} // namespace
+
+TableFunction SnowflakePoolStatsFunction::GetFunction() {
+    return TableFunction("snowflake_pool_stats", {}, PoolStatsExecute, PoolStatsBind, PoolStatsInit);
+}
+
+} // namespace duckdb
\ No newline at end of file
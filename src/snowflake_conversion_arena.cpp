@@ -0,0 +1,60 @@
+#include "snowflake_conversion_arena.hpp"
+
+namespace duckdb {
+
+SnowflakeConversionArena::Scope::Scope() : arena_(SnowflakeConversionArena::Get()) {
+    arena_.depth_++;
+}
+
+SnowflakeConversionArena::Scope::~Scope() {
+    if (--arena_.depth_ == 0) {
+        arena_.Reset();
+    }
+}
+
+SnowflakeConversionArena &SnowflakeConversionArena::Get() {
+    static thread_local SnowflakeConversionArena arena;
+    return arena;
+}
+
+data_ptr_t SnowflakeConversionArena::Allocate(idx_t size) {
+    auto aligned = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    if (blocks_.empty() || position_ + aligned > blocks_.back().GetSize()) {
+        auto capacity = blocks_.empty() ? INITIAL_CAPACITY : blocks_.back().GetSize() * 2;
+        AddBlock(MaxValue<idx_t>(capacity, aligned));
+    }
+    auto result = blocks_.back().get() + position_;
+    position_ += aligned;
+    used_ += aligned;
+    return result;
+}
+
+void SnowflakeConversionArena::Reset() {
+    if (blocks_.size() > 1 || GetCapacity() > MAX_RETAINED_CAPACITY) {
+        // The last batch outgrew one block: replace them all with one that fits it
+        auto capacity = GetCapacity();
+        blocks_.clear();
+        if (capacity <= MAX_RETAINED_CAPACITY) {
+            AddBlock(capacity);
+        }
+    }
+    position_ = 0;
+    used_ = 0;
+}
+
+idx_t SnowflakeConversionArena::GetCapacity() const {
+    idx_t capacity = 0;
+    for (auto &block : blocks_) {
+        capacity += block.GetSize();
+    }
+    return capacity;
+}
+
+void SnowflakeConversionArena::AddBlock(idx_t size) {
+    // Bump allocation restarts in the new block; the rest of the old one is left unused
+    blocks_.push_back(Allocator::DefaultAllocator().Allocate(size));
+    position_ = 0;
+    block_allocations_++;
+}
+
+} // namespace duckdb
\ No newline at end of file
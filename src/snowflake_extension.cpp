@@ -1,16 +1,31 @@
 #include "snowflake_extension.hpp"
 #include "type_converter.hpp"
+#include "snowflake_scan.hpp"
+#include "snowflake_connection_pool.hpp"
+#include "snowflake_ingest.hpp"
+#include "snowflake_metrics.hpp"
+#include "snowflake_result_cache.hpp"
+#include "snowflake_schema_cache.hpp"
+#include "snowflake_catalog.hpp"
 
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace duckdb {
 
 void SnowflakeExtension::Load(DatabaseInstance &db) {
     // Register all extension functions
     RegisterTableFunctions(db);
     RegisterScalarFunctions(db);
+    RegisterStorageExtension(db);
+    RegisterSettings(db);
+    WarmConnectionPool();
+    ConfigureResultCache();
 }
 
 std::string SnowflakeExtension::GetVersion() {
@@ -18,11 +33,77 @@ std::string SnowflakeExtension::GetVersion() {
 }
 
 void SnowflakeExtension::RegisterTableFunctions(DatabaseInstance &db) {
-    // TODO: Implement snowflake_scan table function
-    // This will handle: SELECT * FROM snowflake_scan('connection_string', 'query')
-    
-    // TODO: Implement snowflake_insert table function  
-    // This will handle: COPY data TO snowflake_insert('connection_string', 'table_name')
+    // SELECT * FROM snowflake_scan('connection_string', 'query')
+    ExtensionUtil::RegisterFunction(db, SnowflakeScanFunction::GetFunction());
+
+    // SELECT * FROM snowflake_pool_stats()
+    ExtensionUtil::RegisterFunction(db, SnowflakePoolStatsFunction::GetFunction());
+
+    // SELECT * FROM snowflake_cache_stats()
+    ExtensionUtil::RegisterFunction(db, SnowflakeCacheStatsFunction::GetFunction());
+
+    // CALL snowflake_clear_cache()
+    ExtensionUtil::RegisterFunction(db, SnowflakeClearCacheFunction::GetFunction());
+
+    // SELECT * FROM snowflake_metrics()
+    ExtensionUtil::RegisterFunction(db, SnowflakeMetricsFunction::GetFunction());
+
+    // CALL snowflake_reset_metrics()
+    ExtensionUtil::RegisterFunction(db, SnowflakeResetMetricsFunction::GetFunction());
+
+    // COPY tbl TO 'snowflake://connection_string' (FORMAT snowflake, TABLE 'table_name')
+    ExtensionUtil::RegisterFunction(db, SnowflakeCopyFunction::GetFunction());
+}
+
+void SnowflakeExtension::RegisterStorageExtension(DatabaseInstance &db) {
+    // ATTACH 'connection_string' AS sf (TYPE snowflake)
+    auto &config = DBConfig::GetConfig(db);
+    config.storage_extensions["snowflake"] = make_uniq<SnowflakeStorageExtension>();
+}
+
+void SnowflakeExtension::RegisterSettings(DatabaseInstance &db) {
+    // SET snowflake_metrics = true times every transfer, not only under EXPLAIN ANALYZE
+    auto &config = DBConfig::GetConfig(db);
+    config.AddExtensionOption("snowflake_metrics",
+                              "Time Snowflake transfers (driver, conversion, queue waits) for snowflake_metrics()",
+                              LogicalType::BOOLEAN, Value::BOOLEAN(false));
+}
+
+void SnowflakeExtension::WarmConnectionPool() {
+    // SNOWFLAKE_POOL_WARM=<connection string> opens sessions at load, so the
+    // first query does not pay the login handshake
+    auto connection_string = std::getenv("SNOWFLAKE_POOL_WARM");
+    if (!connection_string) {
+        return;
+    }
+    auto config = SnowflakeConfig::Parse(connection_string);
+    idx_t count = 1;
+    auto requested = std::getenv("SNOWFLAKE_POOL_WARM_SIZE");
+    if (requested) {
+        count = std::max<idx_t>(1, std::strtoull(requested, nullptr, 10));
+    }
+    // Best effort: a failure here surfaces again on the first query
+    SnowflakeConnectionPool::Get().Warm(config, count);
+}
+
+void SnowflakeExtension::ConfigureResultCache() {
+    // SNOWFLAKE_RESULT_CACHE_DIR=<directory> enables the result cache
+    auto directory = std::getenv("SNOWFLAKE_RESULT_CACHE_DIR");
+    if (!directory || !*directory) {
+        return;
+    }
+    SnowflakeResultCacheOptions options;
+    options.directory = directory;
+    auto ttl = std::getenv("SNOWFLAKE_RESULT_CACHE_TTL");
+    if (ttl) {
+        options.ttl = std::chrono::seconds(std::strtoll(ttl, nullptr, 10));
+    }
+    auto max_bytes = std::getenv("SNOWFLAKE_RESULT_CACHE_MAX_BYTES");
+    if (max_bytes) {
+        options.max_bytes = std::strtoull(max_bytes, nullptr, 10);
+    }
+    // A directory that cannot be created leaves the cache disabled
+    SnowflakeResultCache::Get().Configure(options);
 }
 
 void SnowflakeExtension::RegisterScalarFunctions(DatabaseInstance &db) {
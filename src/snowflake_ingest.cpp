@@ -0,0 +1,385 @@
+#include "snowflake_ingest.hpp"
+#include "snowflake_connection_pool.hpp"
+#include "snowflake_memory_pool.hpp"
+#include "arrow_data_converter.hpp"
+#include "type_converter.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+namespace duckdb {
+
+// ===== PIPELINE =====
+
+/**
+ * @brief Bounded queue read by the driver as the ingest stream
+ */
+class SnowflakeIngestPipeline::BatchQueue : public arrow::RecordBatchReader {
+public:
+    BatchQueue(std::shared_ptr<arrow::Schema> schema, idx_t capacity, SnowflakeTransferMetrics *metrics)
+        : schema_(std::move(schema)), capacity_(std::max<idx_t>(capacity, 1)), metrics_(metrics) {
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return schema_;
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (batches_.empty() && !closed_) {
+            SnowflakeScopedTimer timer(metrics_ ? metrics_->Time(starved_ns_) : nullptr);
+            ready_.wait(guard, [this]() { return !batches_.empty() || closed_; });
+        }
+        if (!error_.empty()) {
+            return arrow::Status::Cancelled(error_);
+        }
+        if (batches_.empty()) {
+            batch->reset();
+            return arrow::Status::OK();
+        }
+        *batch = std::move(batches_.front());
+        batches_.pop_front();
+        guard.unlock();
+        space_.notify_one();
+        if (metrics_) {
+            metrics_->AddBatch(**batch);
+        }
+        return arrow::Status::OK();
+    }
+
+    /**
+     * @return Empty once queued, or why the stream was closed
+     */
+    string Push(std::shared_ptr<arrow::RecordBatch> batch) {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (batches_.size() >= capacity_ && !closed_) {
+            SnowflakeScopedTimer timer(metrics_ ? metrics_->Time(metrics_->queue_wait_ns) : nullptr);
+            space_.wait(guard, [this]() { return batches_.size() < capacity_ || closed_; });
+        }
+        if (closed_) {
+            return error_.empty() ? "Ingest stream already finished" : error_;
+        }
+        batches_.push_back(std::move(batch));
+        guard.unlock();
+        ready_.notify_one();
+        return "";
+    }
+
+    /**
+     * @brief End the stream: after the queued batches, or immediately with an error
+     */
+    void Close(const string &error) {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            if (closed_) {
+                return;
+            }
+            closed_ = true;
+            error_ = error;
+            if (!error.empty()) {
+                batches_.clear();
+            }
+        }
+        ready_.notify_all();
+        space_.notify_all();
+    }
+
+    /**
+     * @brief Time the driver spent waiting for batches (timed transfers only)
+     */
+    uint64_t GetStarvedNanos() const {
+        return starved_ns_;
+    }
+
+private:
+    std::shared_ptr<arrow::Schema> schema_;
+    idx_t capacity_;
+    std::mutex lock_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    std::deque<std::shared_ptr<arrow::RecordBatch>> batches_;
+    bool closed_ = false;
+    string error_;
+    SnowflakeTransferMetrics *metrics_;
+    std::atomic<uint64_t> starved_ns_ {0};
+};
+
+SnowflakeIngestPipeline::SnowflakeIngestPipeline(std::shared_ptr<SnowflakeADBCConnector> connector,
+                                                 std::shared_ptr<arrow::Schema> schema,
+                                                 SnowflakeIngestOptions options,
+                                                 std::shared_ptr<SnowflakeTransferMetrics> metrics)
+    : connector_(std::move(connector)), metrics_(std::move(metrics)),
+      queue_(std::make_shared<BatchQueue>(std::move(schema), options.max_pending_batches, metrics_.get())) {
+    upload_ = std::thread([this, options]() {
+        // Driver time is the upload minus its waits for producers
+        std::atomic<uint64_t> upload_ns {0};
+        {
+            SnowflakeScopedTimer timer(metrics_ ? metrics_->Time(upload_ns) : nullptr);
+            result_ = connector_->IngestStream(options.table, options.mode, queue_, options.schema);
+        }
+        if (upload_ns > queue_->GetStarvedNanos()) {
+            metrics_->driver_ns += upload_ns - queue_->GetStarvedNanos();
+        }
+        // Unblock producers if the driver stopped reading early
+        queue_->Close(result_.second.empty() ? "Ingest ended before the stream was finished"
+                                             : "Snowflake ingest failed: " + result_.second);
+    });
+}
+
+SnowflakeIngestPipeline::~SnowflakeIngestPipeline() {
+    if (upload_.joinable()) {
+        Abort("Ingest abandoned");
+    }
+}
+
+string SnowflakeIngestPipeline::Append(std::shared_ptr<arrow::RecordBatch> batch) {
+    return queue_->Push(std::move(batch));
+}
+
+void SnowflakeIngestPipeline::AppendRows(DataChunk &rows, arrow::MemoryPool *pool, const string &operation) {
+    AppendRows(rows, 0, rows.size(), pool, operation);
+}
+
+void SnowflakeIngestPipeline::AppendRows(DataChunk &rows, idx_t offset, idx_t count, arrow::MemoryPool *pool,
+                                         const string &operation) {
+    DataChunk slice;
+    auto source = &rows;
+    if (offset != 0 || count != rows.size()) {
+        SelectionVector sel(count);
+        for (idx_t i = 0; i < count; i++) {
+            sel.set_index(i, offset + i);
+        }
+        slice.InitializeEmpty(rows.GetTypes());
+        slice.Slice(rows, sel, count);
+        source = &slice;
+    }
+    auto schema = queue_->schema();
+    ArrowConversionOptions options;
+    options.pool = pool;
+    options.column_ns = metrics_ ? metrics_->ColumnTimes() : nullptr;
+    DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::RecordBatch>> batch;
+    {
+        SnowflakeScopedTimer timer(metrics_ ? metrics_->Time(metrics_->convert_ns) : nullptr);
+        batch = DuckDBToArrowConverter::ConvertChunk(*source, schema, options);
+    }
+    if (!batch.IsValid()) {
+        throw ConversionException(operation + ": " + batch.GetError());
+    }
+    if (batch.GetValue()->schema() != schema) {
+        if (count == 1) {
+            throw ConversionException(operation + ": a single row holds more than 2GB of strings");
+        }
+        AppendRows(rows, offset, count / 2, pool, operation);
+        AppendRows(rows, offset + count / 2, count - count / 2, pool, operation);
+        return;
+    }
+    auto error = Append(batch.GetValue());
+    if (!error.empty()) {
+        throw IOException(operation + ": " + error);
+    }
+}
+
+std::pair<int64_t, string> SnowflakeIngestPipeline::Finish() {
+    queue_->Close("");
+    if (upload_.joinable()) {
+        upload_.join();
+    }
+    return result_;
+}
+
+void SnowflakeIngestPipeline::Abort(const string &reason) {
+    queue_->Close(reason);
+    if (upload_.joinable()) {
+        upload_.join();
+    }
+}
+
+// ===== COPY TO =====
+
+namespace {
+
+constexpr const char *SNOWFLAKE_PATH_PREFIX = "snowflake://";
+
+struct SnowflakeCopyBindData : public TableFunctionData {
+    SnowflakeIngestOptions options;
+    std::shared_ptr<arrow::Schema> schema;
+    vector<LogicalType> types;
+};
+
+struct SnowflakeCopyGlobalState : public GlobalFunctionData {
+    // Buffers of the converted batches, counted against memory_limit
+    std::shared_ptr<SnowflakeMemoryPool> memory;
+    // Batches sent, conversion, driver and queue time of this COPY (see snowflake_metrics())
+    std::shared_ptr<SnowflakeTransferMetrics> metrics;
+    // Declared before the pipeline so it releases its session before the lease ends
+    std::shared_ptr<SnowflakeADBCConnector> connector;
+    std::unique_ptr<SnowflakeIngestPipeline> pipeline;
+};
+
+struct SnowflakeCopyLocalState : public LocalFunctionData {
+    // Rows gathered for the next batch; a fresh chunk per batch, because the
+    // converted arrays alias its buffers until the driver has sent them
+    unique_ptr<DataChunk> pending;
+};
+
+SnowflakeIngestMode ParseMode(const string &mode) {
+    auto lowered = StringUtil::Lower(mode);
+    if (lowered == "append") {
+        return SnowflakeIngestMode::APPEND;
+    }
+    if (lowered == "create") {
+        return SnowflakeIngestMode::CREATE;
+    }
+    if (lowered == "replace") {
+        return SnowflakeIngestMode::REPLACE;
+    }
+    throw BinderException("snowflake COPY: MODE must be append, create or replace, not '%s'", mode);
+}
+
+unique_ptr<FunctionData> SnowflakeCopyBind(ClientContext &context, CopyFunctionBindInput &input,
+                                           const vector<string> &names, const vector<LogicalType> &sql_types) {
+    auto result = make_uniq<SnowflakeCopyBindData>();
+    bool dictionary = false;
+    bool string_view = false;
+    for (auto &option : input.info.options) {
+        auto key = StringUtil::Lower(option.first);
+        if (option.second.size() != 1) {
+            throw BinderException("snowflake COPY: %s takes exactly one value", option.first);
+        }
+        auto &value = option.second[0];
+        if (key == "table") {
+            result->options.table = value.ToString();
+        } else if (key == "mode") {
+            result->options.mode = ParseMode(value.ToString());
+        } else if (key == "batch_size") {
+            auto batch_size = value.GetValue<int64_t>();
+            if (batch_size <= 0) {
+                throw BinderException("snowflake COPY: BATCH_SIZE must be positive");
+            }
+            result->options.batch_size = static_cast<idx_t>(batch_size);
+        } else if (key == "dictionary") {
+            dictionary = value.GetValue<bool>();
+        } else if (key == "string_view") {
+            string_view = value.GetValue<bool>();
+        } else {
+            throw BinderException("snowflake COPY: unrecognized option '%s'", option.first);
+        }
+    }
+    if (result->options.table.empty()) {
+        throw BinderException("snowflake COPY: the TABLE option is required");
+    }
+    if (dictionary && string_view) {
+        throw BinderException("snowflake COPY: DICTIONARY and STRING_VIEW cannot be combined");
+    }
+
+    auto schema = SnowflakeTypeConverter::ConvertSchema(names, sql_types);
+    if (!schema.IsValid()) {
+        throw BinderException("snowflake COPY: " + schema.GetError());
+    }
+    result->schema = schema.GetValue().arrow_schema;
+    if (dictionary) {
+        result->schema = DuckDBToArrowConverter::DictionaryEncodeStrings(result->schema);
+    } else if (string_view) {
+        result->schema = DuckDBToArrowConverter::ViewEncodeStrings(result->schema);
+    }
+    result->types = sql_types;
+    return std::move(result);
+}
+
+unique_ptr<GlobalFunctionData> SnowflakeCopyInitGlobal(ClientContext &context, FunctionData &bind_data,
+                                                       const string &file_path) {
+    auto &data = bind_data.Cast<SnowflakeCopyBindData>();
+    auto connection_string = file_path;
+    if (StringUtil::StartsWith(connection_string, SNOWFLAKE_PATH_PREFIX)) {
+        connection_string = connection_string.substr(strlen(SNOWFLAKE_PATH_PREFIX));
+    }
+
+    auto result = make_uniq<SnowflakeCopyGlobalState>();
+    result->memory = SnowflakeMemoryPool::Create(context);
+    result->metrics = SnowflakeMetrics::Get().Begin(SnowflakeTransferKind::COPY, data.schema->field_names(),
+                                                    SnowflakeMetrics::TimingEnabled(context));
+    auto leased = SnowflakeConnectionPool::Get().Acquire(SnowflakeConfig::Parse(connection_string));
+    if (!leased.first) {
+        throw IOException("snowflake COPY: " + leased.second);
+    }
+    result->connector = std::move(leased.first);
+    result->pipeline =
+        make_uniq<SnowflakeIngestPipeline>(result->connector, data.schema, data.options, result->metrics);
+    return std::move(result);
+}
+
+unique_ptr<LocalFunctionData> SnowflakeCopyInitLocal(ExecutionContext &context, FunctionData &bind_data) {
+    return make_uniq<SnowflakeCopyLocalState>();
+}
+
+/**
+ * @brief Convert the gathered rows on this thread and queue them for upload
+ */
+void FlushPending(SnowflakeCopyGlobalState &global_state, SnowflakeCopyLocalState &local_state) {
+    if (!local_state.pending || local_state.pending->size() == 0) {
+        return;
+    }
+    // The queued arrays keep the buffers they alias alive on their own
+    auto pending = std::move(local_state.pending);
+    global_state.pipeline->AppendRows(*pending, global_state.memory.get(), "snowflake COPY");
+}
+
+void SnowflakeCopySink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                       LocalFunctionData &lstate, DataChunk &input) {
+    auto &data = bind_data.Cast<SnowflakeCopyBindData>();
+    auto &global_state = gstate.Cast<SnowflakeCopyGlobalState>();
+    auto &local_state = lstate.Cast<SnowflakeCopyLocalState>();
+
+    if (local_state.pending && local_state.pending->size() + input.size() > data.options.batch_size) {
+        FlushPending(global_state, local_state);
+    }
+    if (!local_state.pending) {
+        local_state.pending = make_uniq<DataChunk>();
+        local_state.pending->Initialize(Allocator::Get(context.client), data.types,
+                                        std::max<idx_t>(data.options.batch_size, STANDARD_VECTOR_SIZE));
+    }
+    local_state.pending->Append(input, true);
+    if (local_state.pending->size() >= data.options.batch_size) {
+        FlushPending(global_state, local_state);
+    }
+}
+
+void SnowflakeCopyCombine(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                          LocalFunctionData &lstate) {
+    FlushPending(gstate.Cast<SnowflakeCopyGlobalState>(), lstate.Cast<SnowflakeCopyLocalState>());
+}
+
+void SnowflakeCopyFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate) {
+    auto &global_state = gstate.Cast<SnowflakeCopyGlobalState>();
+    auto result = global_state.pipeline->Finish();
+    if (!result.second.empty()) {
+        throw IOException("snowflake COPY: " + result.second);
+    }
+}
+
+CopyFunctionExecutionMode SnowflakeCopyExecutionMode(bool preserve_insertion_order, bool supports_batch_index) {
+    // Snowflake tables have no row order to preserve
+    return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+}
+
+} // namespace
+
+CopyFunction SnowflakeCopyFunction::GetFunction() {
+    CopyFunction function("snowflake");
+    function.copy_to_bind = SnowflakeCopyBind;
+    function.copy_to_initialize_global = SnowflakeCopyInitGlobal;
+    function.copy_to_initialize_local = SnowflakeCopyInitLocal;
+    function.copy_to_sink = SnowflakeCopySink;
+    function.copy_to_combine = SnowflakeCopyCombine;
+    function.copy_to_finalize = SnowflakeCopyFinalize;
+    function.execution_mode = SnowflakeCopyExecutionMode;
+    return function;
+}
+
+} // namespace duckdb
\ No newline at end of file
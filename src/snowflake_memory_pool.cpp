@@ -0,0 +1,408 @@
+#include "snowflake_memory_pool.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include <arrow/buffer.h>
+#include <arrow/util/byte_size.h>
+#include <algorithm>
+#include <cstring>
+
+namespace duckdb {
+
+namespace {
+
+/**
+ * @brief Stored just before the aligned pointer handed to Arrow
+ */
+struct BlockHeader {
+    // Pointer the allocator returned, and the bytes allocated (and reserved) there
+    uint8_t *raw;
+    int64_t footprint;
+    // Usable bytes from the aligned pointer on
+    int64_t capacity;
+};
+
+constexpr int64_t HEADER_SIZE = 32;
+static_assert(sizeof(BlockHeader) <= HEADER_SIZE, "BlockHeader must fit before the aligned pointer");
+
+// Zero-byte allocations all share this address and are never freed
+alignas(64) uint8_t zero_size_area[1];
+
+BlockHeader ReadHeader(const uint8_t *block) {
+    BlockHeader header;
+    std::memcpy(&header, block - sizeof(BlockHeader), sizeof(BlockHeader));
+    return header;
+}
+
+void WriteHeader(uint8_t *block, const BlockHeader &header) {
+    std::memcpy(block - sizeof(BlockHeader), &header, sizeof(BlockHeader));
+}
+
+/**
+ * @brief Capacity allocated for a request: four classes per power of two (at most 25% slack)
+ *
+ * Requests above MAX_CACHED_SIZE are never cached and get exactly their size.
+ */
+int64_t SizeClass(int64_t size) {
+    if (size <= SnowflakeMemoryPool::MIN_CACHED_SIZE) {
+        return SnowflakeMemoryPool::MIN_CACHED_SIZE;
+    }
+    if (size > SnowflakeMemoryPool::MAX_CACHED_SIZE) {
+        return size;
+    }
+    auto base = int64_t(1) << (63 - __builtin_clzll(static_cast<uint64_t>(size - 1)));
+    auto step = base / 4;
+    return (size + step - 1) / step * step;
+}
+
+/**
+ * @brief Driver buffer whose bytes stay counted by a pool while it is alive
+ */
+class TrackedBuffer : public arrow::Buffer {
+public:
+    TrackedBuffer(const std::shared_ptr<arrow::Buffer> &buffer, std::shared_ptr<void> reservation)
+        : arrow::Buffer(buffer, 0, buffer->size()), reservation_(std::move(reservation)) {
+    }
+
+private:
+    std::shared_ptr<void> reservation_;
+};
+
+std::shared_ptr<arrow::ArrayData> TrackData(const arrow::ArrayData &data, const std::shared_ptr<void> &reservation) {
+    auto tracked = std::make_shared<arrow::ArrayData>(data);
+    for (auto &buffer : tracked->buffers) {
+        if (buffer) {
+            buffer = std::make_shared<TrackedBuffer>(buffer, reservation);
+        }
+    }
+    for (auto &child : tracked->child_data) {
+        child = TrackData(*child, reservation);
+    }
+    if (tracked->dictionary) {
+        tracked->dictionary = TrackData(*tracked->dictionary, reservation);
+    }
+    return tracked;
+}
+
+/**
+ * @brief Result stream whose batches a pool counts while they are alive
+ */
+class TrackedReader : public arrow::RecordBatchReader {
+public:
+    TrackedReader(std::unique_ptr<SnowflakeResultStream> source, std::shared_ptr<SnowflakeMemoryPool> pool)
+        : source_(std::move(source)), pool_(std::move(pool)) {
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return source_->GetSchema();
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        auto next = source_->ReadNext();
+        if (!next.second.empty()) {
+            return arrow::Status::IOError(next.second);
+        }
+        if (!next.first) {
+            batch->reset();
+            return arrow::Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(*batch, pool_->Track(next.first, &dictionaries_));
+        return arrow::Status::OK();
+    }
+
+private:
+    std::unique_ptr<SnowflakeResultStream> source_;
+    std::shared_ptr<SnowflakeMemoryPool> pool_;
+    SnowflakeMemoryPool::TrackedDictionaries dictionaries_;
+};
+
+} // namespace
+
+/**
+ * @brief Bytes of one tracked batch, released when its last buffer is
+ */
+class SnowflakeMemoryPool::Reservation {
+public:
+    Reservation(std::shared_ptr<SnowflakeMemoryPool> pool, int64_t bytes) : pool_(std::move(pool)), bytes_(bytes) {
+    }
+
+    ~Reservation() {
+        {
+            std::lock_guard<std::mutex> guard(pool_->lock_);
+            pool_->tracked_bytes_ -= bytes_;
+        }
+        pool_->Unreserve(bytes_);
+    }
+
+private:
+    std::shared_ptr<SnowflakeMemoryPool> pool_;
+    int64_t bytes_;
+};
+
+SnowflakeMemoryPool::SnowflakeMemoryPool(Allocator &allocator, BufferManager *buffer_manager,
+                                         shared_ptr<DatabaseInstance> database, int64_t max_cached_bytes)
+    : allocator_(allocator), buffer_manager_(buffer_manager), database_(std::move(database)),
+      max_cached_bytes_(max_cached_bytes) {
+}
+
+std::shared_ptr<SnowflakeMemoryPool> SnowflakeMemoryPool::Create(ClientContext &context, int64_t max_cached_bytes) {
+    return std::shared_ptr<SnowflakeMemoryPool>(new SnowflakeMemoryPool(
+        Allocator::Get(context), &BufferManager::GetBufferManager(context), context.db, max_cached_bytes));
+}
+
+std::shared_ptr<SnowflakeMemoryPool> SnowflakeMemoryPool::Create(Allocator &allocator, int64_t max_cached_bytes) {
+    return std::shared_ptr<SnowflakeMemoryPool>(
+        new SnowflakeMemoryPool(allocator, nullptr, nullptr, max_cached_bytes));
+}
+
+SnowflakeMemoryPool::~SnowflakeMemoryPool() {
+    ReleaseCache();
+}
+
+// ===== RESERVATIONS =====
+
+arrow::Status SnowflakeMemoryPool::Reserve(int64_t bytes) {
+    if (!buffer_manager_ || bytes == 0) {
+        return arrow::Status::OK();
+    }
+    for (idx_t attempt = 0;; attempt++) {
+        try {
+            buffer_manager_->ReserveMemory(static_cast<idx_t>(bytes));
+            return arrow::Status::OK();
+        } catch (std::exception &ex) {
+            bool cached;
+            {
+                std::lock_guard<std::mutex> guard(lock_);
+                cached = cached_bytes_ > 0;
+            }
+            if (attempt > 0 || !cached) {
+                return arrow::Status::OutOfMemory(ErrorData(ex).RawMessage());
+            }
+            ReleaseCache();
+        }
+    }
+}
+
+void SnowflakeMemoryPool::Unreserve(int64_t bytes) {
+    if (buffer_manager_ && bytes > 0) {
+        buffer_manager_->FreeReservedMemory(static_cast<idx_t>(bytes));
+    }
+}
+
+void SnowflakeMemoryPool::ReleaseCache() {
+    std::map<int64_t, std::vector<uint8_t *>> cache;
+    int64_t bytes;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        cache.swap(cache_);
+        bytes = cached_bytes_;
+        cached_bytes_ = 0;
+    }
+    for (auto &entry : cache) {
+        for (auto block : entry.second) {
+            auto header = ReadHeader(block);
+            allocator_.FreeData(header.raw, static_cast<idx_t>(header.footprint));
+        }
+    }
+    Unreserve(bytes);
+}
+
+void SnowflakeMemoryPool::RecordAllocation(int64_t size, int64_t footprint) {
+    allocated_bytes_ += footprint;
+    total_allocated_bytes_ += size;
+    allocations_++;
+    if (outstanding_++ == 0) {
+        self_ = shared_from_this();
+    }
+    RaisePeak();
+}
+
+std::shared_ptr<SnowflakeMemoryPool> SnowflakeMemoryPool::RecordFree(int64_t footprint) {
+    allocated_bytes_ -= footprint;
+    if (--outstanding_ == 0) {
+        return std::move(self_);
+    }
+    return nullptr;
+}
+
+void SnowflakeMemoryPool::RaisePeak() {
+    peak_bytes_ = std::max(peak_bytes_, allocated_bytes_ + tracked_bytes_);
+}
+
+// ===== ALLOCATION =====
+
+arrow::Status SnowflakeMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t **out) {
+    if (size < 0) {
+        return arrow::Status::Invalid("Negative allocation size " + std::to_string(size));
+    }
+    if (size == 0) {
+        *out = zero_size_area;
+        return arrow::Status::OK();
+    }
+    auto capacity = SizeClass(size);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto cached = cache_.find(capacity);
+        if (cached != cache_.end() && !cached->second.empty() &&
+            reinterpret_cast<uintptr_t>(cached->second.back()) % static_cast<uintptr_t>(alignment) == 0) {
+            *out = cached->second.back();
+            cached->second.pop_back();
+            auto footprint = ReadHeader(*out).footprint;
+            cached_bytes_ -= footprint;
+            reused_++;
+            RecordAllocation(size, footprint);
+            return arrow::Status::OK();
+        }
+    }
+
+    auto footprint = capacity + HEADER_SIZE + alignment;
+    ARROW_RETURN_NOT_OK(Reserve(footprint));
+    uint8_t *raw;
+    try {
+        raw = allocator_.AllocateData(static_cast<idx_t>(footprint));
+    } catch (std::exception &ex) {
+        Unreserve(footprint);
+        return arrow::Status::OutOfMemory(ErrorData(ex).RawMessage());
+    }
+    auto address = reinterpret_cast<uintptr_t>(raw) + HEADER_SIZE;
+    auto mask = static_cast<uintptr_t>(alignment) - 1;
+    auto block = raw + (((address + mask) & ~mask) - reinterpret_cast<uintptr_t>(raw));
+    WriteHeader(block, BlockHeader {raw, footprint, capacity});
+    *out = block;
+    std::lock_guard<std::mutex> guard(lock_);
+    RecordAllocation(size, footprint);
+    return arrow::Status::OK();
+}
+
+arrow::Status SnowflakeMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t alignment, uint8_t **ptr) {
+    if (old_size == 0) {
+        return Allocate(new_size, alignment, ptr);
+    }
+    if (new_size == 0) {
+        Free(*ptr, old_size, alignment);
+        *ptr = zero_size_area;
+        return arrow::Status::OK();
+    }
+    if (new_size <= ReadHeader(*ptr).capacity) {
+        std::lock_guard<std::mutex> guard(lock_);
+        total_allocated_bytes_ += std::max<int64_t>(new_size - old_size, 0);
+        return arrow::Status::OK();
+    }
+    uint8_t *moved;
+    ARROW_RETURN_NOT_OK(Allocate(new_size, alignment, &moved));
+    std::memcpy(moved, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size, alignment);
+    *ptr = moved;
+    return arrow::Status::OK();
+}
+
+void SnowflakeMemoryPool::Free(uint8_t *buffer, int64_t size, int64_t alignment) {
+    if (size == 0 || buffer == zero_size_area) {
+        return;
+    }
+    auto header = ReadHeader(buffer);
+    // Dropped last, after this call no longer touches the pool
+    std::shared_ptr<SnowflakeMemoryPool> last_reference;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (header.capacity <= MAX_CACHED_SIZE && cached_bytes_ + header.footprint <= max_cached_bytes_) {
+            cache_[header.capacity].push_back(buffer);
+            cached_bytes_ += header.footprint;
+            cached = true;
+        }
+        last_reference = RecordFree(header.footprint);
+    }
+    if (!cached) {
+        allocator_.FreeData(header.raw, static_cast<idx_t>(header.footprint));
+        Unreserve(header.footprint);
+    }
+}
+
+void SnowflakeMemoryPool::ReleaseUnused() {
+    ReleaseCache();
+}
+
+// ===== TRACKING =====
+
+arrow::Result<std::shared_ptr<arrow::RecordBatch>>
+SnowflakeMemoryPool::Track(const std::shared_ptr<arrow::RecordBatch> &batch, TrackedDictionaries *dictionaries) {
+    auto columns = batch->column_data();
+    if (dictionaries) {
+        dictionaries->resize(columns.size());
+    }
+    int64_t bytes = 0;
+    std::vector<bool> seen(columns.size(), false);
+    for (idx_t col = 0; col < columns.size(); col++) {
+        bytes += arrow::util::TotalBufferSize(*columns[col]);
+        auto &dictionary = columns[col]->dictionary;
+        if (dictionaries && dictionary && (*dictionaries)[col].first == dictionary) {
+            seen[col] = true;
+            bytes -= arrow::util::TotalBufferSize(*dictionary);
+        }
+    }
+    ARROW_RETURN_NOT_OK(Reserve(bytes));
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        tracked_bytes_ += bytes;
+        RaisePeak();
+    }
+    std::shared_ptr<void> reservation = std::make_shared<Reservation>(shared_from_this(), bytes);
+
+    for (idx_t col = 0; col < columns.size(); col++) {
+        auto source = *columns[col];
+        auto source_dictionary = source.dictionary;
+        if (seen[col]) {
+            source.dictionary = nullptr;
+        }
+        columns[col] = TrackData(source, reservation);
+        if (seen[col]) {
+            columns[col]->dictionary = (*dictionaries)[col].second;
+        } else if (dictionaries && source_dictionary) {
+            (*dictionaries)[col] = std::make_pair(source_dictionary, columns[col]->dictionary);
+        }
+    }
+    return arrow::RecordBatch::Make(batch->schema(), batch->num_rows(), std::move(columns));
+}
+
+std::unique_ptr<SnowflakeResultStream> SnowflakeMemoryPool::Track(std::unique_ptr<SnowflakeResultStream> stream) {
+    auto reader = std::make_shared<TrackedReader>(std::move(stream), shared_from_this());
+    return std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(std::move(reader)));
+}
+
+// ===== STATISTICS =====
+
+int64_t SnowflakeMemoryPool::bytes_allocated() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return allocated_bytes_;
+}
+
+int64_t SnowflakeMemoryPool::max_memory() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return peak_bytes_;
+}
+
+int64_t SnowflakeMemoryPool::total_bytes_allocated() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return total_allocated_bytes_;
+}
+
+int64_t SnowflakeMemoryPool::num_allocations() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return allocations_;
+}
+
+SnowflakeMemoryPoolStats SnowflakeMemoryPool::GetStats() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    SnowflakeMemoryPoolStats stats;
+    stats.current_bytes = allocated_bytes_ + tracked_bytes_;
+    stats.peak_bytes = peak_bytes_;
+    stats.cached_bytes = cached_bytes_;
+    stats.tracked_bytes = tracked_bytes_;
+    stats.allocations = allocations_;
+    stats.reused = reused_;
+    return stats;
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,317 @@
+#include "snowflake_metrics.hpp"
+#include "snowflake_connection_pool.hpp"
+#include "snowflake_result_cache.hpp"
+#include "snowflake_schema_cache.hpp"
+#include "type_conversion_cache.hpp"
+#include "type_converter.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/query_profiler.hpp"
+
+#include <arrow/util/byte_size.h>
+#include <algorithm>
+
+namespace duckdb {
+
+namespace {
+
+// Columns listed by EXPLAIN ANALYZE, most expensive first
+constexpr idx_t EXPLAIN_COLUMNS = 5;
+
+const char *KindName(SnowflakeTransferKind kind) {
+    switch (kind) {
+        case SnowflakeTransferKind::SCAN:
+            return "scan";
+        case SnowflakeTransferKind::COPY:
+            return "copy";
+        case SnowflakeTransferKind::INSERT:
+            return "insert";
+    }
+    return "unknown";
+}
+
+std::string Milliseconds(uint64_t nanos) {
+    return std::to_string(nanos / 1000000) + " ms";
+}
+
+/**
+ * @brief Result stream counting the batches of the driver stream beneath it
+ */
+class CountingReader : public arrow::RecordBatchReader {
+public:
+    CountingReader(std::unique_ptr<SnowflakeResultStream> source, std::shared_ptr<SnowflakeTransferMetrics> metrics)
+        : source_(std::move(source)), metrics_(std::move(metrics)) {
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return source_->GetSchema();
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        std::pair<std::shared_ptr<arrow::RecordBatch>, string> next;
+        {
+            SnowflakeScopedTimer timer(metrics_->Time(metrics_->driver_ns));
+            next = source_->ReadNext();
+        }
+        if (!next.second.empty()) {
+            return arrow::Status::IOError(next.second);
+        }
+        if (next.first) {
+            metrics_->AddBatch(*next.first);
+        }
+        *batch = std::move(next.first);
+        return arrow::Status::OK();
+    }
+
+private:
+    std::unique_ptr<SnowflakeResultStream> source_;
+    std::shared_ptr<SnowflakeTransferMetrics> metrics_;
+};
+
+} // namespace
+
+// ===== TRANSFER =====
+
+SnowflakeTransferMetrics::SnowflakeTransferMetrics(SnowflakeTransferKind kind, std::vector<std::string> column_names,
+                                                   bool timed)
+    : kind_(kind), column_names_(std::move(column_names)),
+      column_ns_(new std::atomic<uint64_t>[column_names_.size()]), timed_(timed) {
+    for (idx_t col = 0; col < column_names_.size(); col++) {
+        column_ns_[col] = 0;
+    }
+}
+
+void SnowflakeTransferMetrics::AddBatch(const arrow::RecordBatch &batch) {
+    batches.fetch_add(1, std::memory_order_relaxed);
+    rows.fetch_add(static_cast<uint64_t>(batch.num_rows()), std::memory_order_relaxed);
+    bytes.fetch_add(static_cast<uint64_t>(arrow::util::TotalBufferSize(batch)), std::memory_order_relaxed);
+}
+
+std::unique_ptr<SnowflakeResultStream>
+SnowflakeTransferMetrics::Track(std::unique_ptr<SnowflakeResultStream> stream) {
+    auto reader = std::make_shared<CountingReader>(std::move(stream), shared_from_this());
+    return std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(std::move(reader)));
+}
+
+void SnowflakeTransferMetrics::ToString(InsertionOrderPreservingMap<string> &result) const {
+    result["Batches"] = std::to_string(batches.load()) + " (" + std::to_string(rows.load()) + " rows, " +
+                        StringUtil::BytesToHumanReadableString(static_cast<idx_t>(bytes.load())) + ")";
+    if (!timed_) {
+        return;
+    }
+    result["Driver Time"] = Milliseconds(driver_ns.load());
+    result["Convert Time"] = Milliseconds(convert_ns.load());
+    if (queue_wait_ns > 0) {
+        result["Queue Wait"] = Milliseconds(queue_wait_ns.load());
+    }
+    std::vector<idx_t> order;
+    for (idx_t col = 0; col < column_names_.size(); col++) {
+        order.push_back(col);
+    }
+    std::sort(order.begin(), order.end(),
+              [this](idx_t a, idx_t b) { return GetColumnNanos(a) > GetColumnNanos(b); });
+    std::string columns;
+    for (idx_t i = 0; i < MinValue<idx_t>(order.size(), EXPLAIN_COLUMNS); i++) {
+        columns += (i == 0 ? "" : ", ") + column_names_[order[i]] + " " + Milliseconds(GetColumnNanos(order[i]));
+    }
+    if (!columns.empty()) {
+        result["Slowest Columns"] = columns;
+    }
+}
+
+// ===== PROCESS TOTALS =====
+
+SnowflakeMetrics &SnowflakeMetrics::Get() {
+    static SnowflakeMetrics metrics;
+    return metrics;
+}
+
+bool SnowflakeMetrics::TimingEnabled(ClientContext &context) {
+    if (QueryProfiler::Get(context).IsEnabled()) {
+        return true;
+    }
+    Value setting;
+    return context.TryGetCurrentSetting("snowflake_metrics", setting) && !setting.IsNull() &&
+           BooleanValue::Get(setting);
+}
+
+std::shared_ptr<SnowflakeTransferMetrics> SnowflakeMetrics::Begin(SnowflakeTransferKind kind,
+                                                                  std::vector<std::string> column_names, bool timed) {
+    // Merged when the last thread, stream or operator state lets go of it
+    return std::shared_ptr<SnowflakeTransferMetrics>(
+        new SnowflakeTransferMetrics(kind, std::move(column_names), timed), [this](SnowflakeTransferMetrics *done) {
+            Merge(*done);
+            delete done;
+        });
+}
+
+void SnowflakeMetrics::Merge(const SnowflakeTransferMetrics &metrics) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &totals = totals_[static_cast<idx_t>(metrics.GetKind())];
+    totals.transfers++;
+    totals.batches += metrics.batches;
+    totals.rows += metrics.rows;
+    totals.bytes += metrics.bytes;
+    totals.driver_ns += metrics.driver_ns;
+    totals.convert_ns += metrics.convert_ns;
+    totals.queue_wait_ns += metrics.queue_wait_ns;
+    if (!metrics.IsTimed()) {
+        return;
+    }
+    auto &names = metrics.GetColumnNames();
+    for (idx_t col = 0; col < names.size(); col++) {
+        totals.column_ns[names[col]] += metrics.GetColumnNanos(col);
+    }
+}
+
+void SnowflakeMetrics::AddRescale(uint64_t rows_rounded, uint64_t rows_rejected) {
+    rows_rounded_.fetch_add(rows_rounded, std::memory_order_relaxed);
+    rows_rejected_.fetch_add(rows_rejected, std::memory_order_relaxed);
+}
+
+SnowflakeTransferTotals SnowflakeMetrics::GetTotals(SnowflakeTransferKind kind) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return totals_[static_cast<idx_t>(kind)];
+}
+
+void SnowflakeMetrics::Reset() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto &totals : totals_) {
+        totals = SnowflakeTransferTotals();
+    }
+    rows_rounded_ = 0;
+    rows_rejected_ = 0;
+}
+
+// ===== snowflake_metrics() =====
+
+namespace {
+
+struct MetricRow {
+    std::string scope;
+    std::string metric;
+    // Empty for counters that are not per column
+    std::string column_name;
+    Value value;
+};
+
+struct MetricsState : public GlobalTableFunctionState {
+    std::vector<MetricRow> rows;
+    idx_t offset = 0;
+};
+
+Value HitRate(uint64_t hits, uint64_t misses) {
+    auto lookups = hits + misses;
+    return lookups == 0 ? Value(LogicalType::DOUBLE) : Value::DOUBLE(static_cast<double>(hits) / lookups);
+}
+
+void AddCount(std::vector<MetricRow> &rows, const std::string &scope, const std::string &metric, uint64_t value) {
+    rows.push_back({scope, metric, "", Value::DOUBLE(static_cast<double>(value))});
+}
+
+void AddMilliseconds(std::vector<MetricRow> &rows, const std::string &scope, const std::string &metric,
+                     uint64_t nanos) {
+    rows.push_back({scope, metric, "", Value::DOUBLE(static_cast<double>(nanos) / 1e6)});
+}
+
+std::vector<MetricRow> CollectMetrics() {
+    std::vector<MetricRow> rows;
+    auto &metrics = SnowflakeMetrics::Get();
+    for (auto kind : {SnowflakeTransferKind::SCAN, SnowflakeTransferKind::COPY, SnowflakeTransferKind::INSERT}) {
+        auto totals = metrics.GetTotals(kind);
+        std::string scope = KindName(kind);
+        AddCount(rows, scope, "transfers", totals.transfers);
+        AddCount(rows, scope, "batches", totals.batches);
+        AddCount(rows, scope, "rows", totals.rows);
+        AddCount(rows, scope, "bytes", totals.bytes);
+        AddMilliseconds(rows, scope, "driver_ms", totals.driver_ns);
+        AddMilliseconds(rows, scope, "convert_ms", totals.convert_ns);
+        AddMilliseconds(rows, scope, "queue_wait_ms", totals.queue_wait_ns);
+        for (auto &column : totals.column_ns) {
+            rows.push_back({scope, "column_convert_ms", column.first, Value::DOUBLE(column.second / 1e6)});
+        }
+    }
+    AddCount(rows, "decimal_rescale", "rows_rounded", metrics.GetRowsRounded());
+    AddCount(rows, "decimal_rescale", "rows_rejected", metrics.GetRowsRejected());
+
+    auto pool = SnowflakeConnectionPool::Get().GetMetrics();
+    AddCount(rows, "connection_pool", "leases", pool.leases);
+    rows.push_back({"connection_pool", "hit_rate", "", HitRate(pool.hits, pool.misses)});
+    AddMilliseconds(rows, "connection_pool", "wait_ms", pool.total_wait_micros * 1000);
+    auto results = SnowflakeResultCache::Get().GetMetrics();
+    AddCount(rows, "result_cache", "lookups", results.hits + results.misses);
+    rows.push_back({"result_cache", "hit_rate", "", HitRate(results.hits, results.misses)});
+    auto schemas = SnowflakeSchemaCache::Get().GetMetrics();
+    AddCount(rows, "schema_cache", "lookups", schemas.hits + schemas.misses);
+    rows.push_back({"schema_cache", "hit_rate", "", HitRate(schemas.hits, schemas.misses)});
+    auto types = SnowflakeTypeConverter::GetConversionCacheStats();
+    AddCount(rows, "type_cache", "lookups", types.hits + types.misses);
+    rows.push_back({"type_cache", "hit_rate", "", HitRate(types.hits, types.misses)});
+    return rows;
+}
+
+unique_ptr<FunctionData> MetricsBind(ClientContext &context, TableFunctionBindInput &input,
+                                     vector<LogicalType> &return_types, vector<string> &names) {
+    names = {"scope", "metric", "column_name", "value"};
+    return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE};
+    return make_uniq<TableFunctionData>();
+}
+
+unique_ptr<GlobalTableFunctionState> MetricsInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto result = make_uniq<MetricsState>();
+    result->rows = CollectMetrics();
+    return std::move(result);
+}
+
+void MetricsExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &state = input.global_state->Cast<MetricsState>();
+    idx_t count = 0;
+    while (state.offset < state.rows.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &row = state.rows[state.offset++];
+        output.SetValue(0, count, Value(row.scope));
+        output.SetValue(1, count, Value(row.metric));
+        output.SetValue(2, count, row.column_name.empty() ? Value(LogicalType::VARCHAR) : Value(row.column_name));
+        output.SetValue(3, count, row.value);
+        count++;
+    }
+    output.SetCardinality(count);
+}
+
+struct ResetMetricsState : public GlobalTableFunctionState {
+    bool done = false;
+};
+
+unique_ptr<FunctionData> ResetMetricsBind(ClientContext &context, TableFunctionBindInput &input,
+                                          vector<LogicalType> &return_types, vector<string> &names) {
+    names = {"success"};
+    return_types = {LogicalType::BOOLEAN};
+    return make_uniq<TableFunctionData>();
+}
+
+unique_ptr<GlobalTableFunctionState> ResetMetricsInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<ResetMetricsState>();
+}
+
+void ResetMetricsExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &state = input.global_state->Cast<ResetMetricsState>();
+    if (state.done) {
+        output.SetCardinality(0);
+        return;
+    }
+    state.done = true;
+
+    SnowflakeMetrics::Get().Reset();
+    output.SetValue(0, 0, Value::BOOLEAN(true));
+    output.SetCardinality(1);
+}
+
+} // namespace
+
+TableFunction SnowflakeMetricsFunction::GetFunction() {
+    return TableFunction("snowflake_metrics", {}, MetricsExecute, MetricsBind, MetricsInit);
+}
+
+TableFunction SnowflakeResetMetricsFunction::GetFunction() {
+    return TableFunction("snowflake_reset_metrics", {}, ResetMetricsExecute, ResetMetricsBind, ResetMetricsInit);
+}
+
+} // namespace duckdb
\ No newline at end of file
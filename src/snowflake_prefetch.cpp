@@ -0,0 +1,117 @@
+#include "snowflake_prefetch.hpp"
+
+#include <arrow/util/byte_size.h>
+#include <algorithm>
+#include <chrono>
+
+namespace duckdb {
+
+namespace {
+
+using PrefetchClock = std::chrono::steady_clock;
+
+uint64_t ElapsedMicros(PrefetchClock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(PrefetchClock::now() - start).count();
+}
+
+void RaisePeak(std::atomic<uint64_t> &peak, uint64_t value) {
+    auto current = peak.load();
+    while (value > current && !peak.compare_exchange_weak(current, value)) {
+    }
+}
+
+} // namespace
+
+SnowflakePrefetchReader::SnowflakePrefetchReader(std::unique_ptr<SnowflakeResultStream> source,
+                                                 SnowflakePrefetchOptions options,
+                                                 std::shared_ptr<SnowflakePrefetchStats> stats)
+    : source_(std::move(source)), schema_(source_->GetSchema()), options_(options),
+      stats_(stats ? std::move(stats) : std::make_shared<SnowflakePrefetchStats>()) {
+    options_.max_batches = std::max<idx_t>(options_.max_batches, 1);
+    io_thread_ = std::thread([this]() { Fetch(); });
+}
+
+SnowflakePrefetchReader::~SnowflakePrefetchReader() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stopped_ = true;
+    }
+    space_.notify_all();
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+}
+
+std::shared_ptr<arrow::Schema> SnowflakePrefetchReader::schema() const {
+    return schema_;
+}
+
+void SnowflakePrefetchReader::Fetch() {
+    while (true) {
+        auto next = source_->ReadNext();
+        std::unique_lock<std::mutex> guard(lock_);
+        if (!next.second.empty() || !next.first) {
+            finished_ = true;
+            error_ = next.second;
+            guard.unlock();
+            ready_.notify_all();
+            return;
+        }
+
+        auto bytes = static_cast<uint64_t>(arrow::util::TotalBufferSize(*next.first));
+        auto has_space = [&]() {
+            return stopped_ || queue_.empty() ||
+                   (queue_.size() < options_.max_batches && queued_bytes_ + bytes <= options_.max_bytes);
+        };
+        if (!has_space()) {
+            auto start = PrefetchClock::now();
+            space_.wait(guard, has_space);
+            stats_->queue_full_stalls++;
+            stats_->queue_full_stall_us += ElapsedMicros(start);
+        }
+        if (stopped_) {
+            return;
+        }
+        queue_.push_back(Entry {std::move(next.first), bytes});
+        queued_bytes_ += bytes;
+        stats_->batches++;
+        stats_->bytes += bytes;
+        RaisePeak(stats_->peak_batches, queue_.size());
+        RaisePeak(stats_->peak_bytes, queued_bytes_);
+        guard.unlock();
+        ready_.notify_one();
+    }
+}
+
+arrow::Status SnowflakePrefetchReader::ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) {
+    std::unique_lock<std::mutex> guard(lock_);
+    auto available = [this]() { return !queue_.empty() || finished_; };
+    if (!available()) {
+        auto start = PrefetchClock::now();
+        ready_.wait(guard, available);
+        stats_->fetch_stalls++;
+        stats_->fetch_stall_us += ElapsedMicros(start);
+    }
+    if (queue_.empty()) {
+        batch->reset();
+        return error_.empty() ? arrow::Status::OK() : arrow::Status::IOError(error_);
+    }
+    *batch = std::move(queue_.front().batch);
+    queued_bytes_ -= queue_.front().bytes;
+    queue_.pop_front();
+    guard.unlock();
+    space_.notify_one();
+    return arrow::Status::OK();
+}
+
+std::unique_ptr<SnowflakeResultStream>
+SnowflakePrefetchReader::Wrap(std::unique_ptr<SnowflakeResultStream> source, const SnowflakePrefetchOptions &options,
+                              std::shared_ptr<SnowflakePrefetchStats> stats) {
+    if (options.max_batches == 0) {
+        return source;
+    }
+    auto reader = std::make_shared<SnowflakePrefetchReader>(std::move(source), options, std::move(stats));
+    return std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(std::move(reader)));
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "snowflake_pushdown.hpp"
+#include "snowflake_type_parser.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+
+namespace duckdb {
+
+namespace {
+
+using StringResult = SnowflakeTypeConverter::ConversionResult<std::string>;
+
+const char* ComparisonOperator(ExpressionType type) {
+    switch (type) {
+        case ExpressionType::COMPARE_EQUAL:
+            return "=";
+        case ExpressionType::COMPARE_NOTEQUAL:
+            return "<>";
+        case ExpressionType::COMPARE_LESSTHAN:
+            return "<";
+        case ExpressionType::COMPARE_GREATERTHAN:
+            return ">";
+        case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+            return "<=";
+        case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+            return ">=";
+        case ExpressionType::COMPARE_DISTINCT_FROM:
+            return "IS DISTINCT FROM";
+        case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+            return "IS NOT DISTINCT FROM";
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Strip trailing whitespace and semicolons so the query nests as a derived table
+ */
+std::string TrimQuery(const std::string& query) {
+    auto end = query.find_last_not_of(" \t\r\n;");
+    return end == std::string::npos ? "" : query.substr(0, end + 1);
+}
+
+std::string DerivedTable(const std::string& query) {
+    // Newlines keep a trailing "--" comment in the query from swallowing the ")"
+    return "FROM (\n" + TrimQuery(query) + "\n) AS \"snowflake_scan\"";
+}
+
+} // namespace
+
+bool SnowflakePushdown::CanPushFilter(const std::string& snowflake_type) {
+    auto parsed = SnowflakeTypeParser::Parse(snowflake_type);
+    if (!parsed.IsValid()) {
+        return false;
+    }
+    switch (parsed.type.id()) {
+        case LogicalTypeId::DECIMAL:
+        case LogicalTypeId::DOUBLE:
+        case LogicalTypeId::BOOLEAN:
+        case LogicalTypeId::DATE:
+        case LogicalTypeId::BLOB:
+            return true;
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+            return parsed.fractional_precision <= 6;
+        case LogicalTypeId::VARCHAR: {
+            // VARIANT and GEOGRAPHY / GEOMETRY parse to VARCHAR too, holding JSON text
+            auto trimmed = StringUtil::Upper(snowflake_type);
+            StringUtil::Trim(trimmed);
+            auto name = trimmed.substr(0, trimmed.find_first_of("( \t\r\n"));
+            return name != "VARIANT" && name != "GEOGRAPHY" && name != "GEOMETRY";
+        }
+        default:
+            return false;
+    }
+}
+
+SnowflakePushdown::ConversionResult<std::string>
+SnowflakePushdown::RenderFilter(const std::string& column, const TableFilter& filter) {
+    switch (filter.filter_type) {
+        case TableFilterType::CONSTANT_COMPARISON: {
+            auto& constant = filter.Cast<ConstantFilter>();
+            auto op = ComparisonOperator(constant.comparison_type);
+            if (!op) {
+                return StringResult::Error("Comparison " + ExpressionTypeToString(constant.comparison_type) +
+                                           " not pushed down");
+            }
+            auto literal = SnowflakeTypeConverter::RenderLiteral(constant.constant);
+            if (!literal.IsValid()) {
+                return literal;
+            }
+            return StringResult::Success(column + " " + op + " " + literal.GetValue());
+        }
+        case TableFilterType::IS_NULL:
+            return StringResult::Success(column + " IS NULL");
+        case TableFilterType::IS_NOT_NULL:
+            return StringResult::Success(column + " IS NOT NULL");
+        case TableFilterType::IN_FILTER: {
+            auto& in_filter = filter.Cast<InFilter>();
+            std::string list;
+            for (auto& value : in_filter.values) {
+                auto literal = SnowflakeTypeConverter::RenderLiteral(value);
+                if (!literal.IsValid()) {
+                    return literal;
+                }
+                list += (list.empty() ? "" : ", ") + literal.GetValue();
+            }
+            return StringResult::Success(column + " IN (" + list + ")");
+        }
+        case TableFilterType::CONJUNCTION_AND: {
+            // Dropping a child widens an AND, which is safe: DuckDB filters again
+            std::string result;
+            for (auto& child : filter.Cast<ConjunctionAndFilter>().child_filters) {
+                auto rendered = RenderFilter(column, *child);
+                if (rendered.IsValid()) {
+                    result += (result.empty() ? "(" : " AND (") + rendered.GetValue() + ")";
+                }
+            }
+            if (result.empty()) {
+                return StringResult::Error("No part of the AND filter can be pushed down");
+            }
+            return StringResult::Success(std::move(result));
+        }
+        case TableFilterType::CONJUNCTION_OR: {
+            std::string result;
+            for (auto& child : filter.Cast<ConjunctionOrFilter>().child_filters) {
+                auto rendered = RenderFilter(column, *child);
+                if (!rendered.IsValid()) {
+                    return rendered;
+                }
+                result += (result.empty() ? "(" : " OR (") + rendered.GetValue() + ")";
+            }
+            return StringResult::Success(std::move(result));
+        }
+        case TableFilterType::OPTIONAL_FILTER: {
+            auto& optional = filter.Cast<OptionalFilter>();
+            if (!optional.child_filter) {
+                return StringResult::Error("Empty optional filter");
+            }
+            return RenderFilter(column, *optional.child_filter);
+        }
+        default:
+            return StringResult::Error("Filter " + filter.ToString(column) + " not pushed down");
+    }
+}
+
+std::string SnowflakePushdown::BuildQuery(const std::string& query, const std::vector<std::string>& columns,
+                                          const std::vector<std::string>& predicates) {
+    std::string sql = "SELECT ";
+    if (columns.empty()) {
+        sql += "*";
+    }
+    for (size_t i = 0; i < columns.size(); i++) {
+        sql += (i > 0 ? ", " : "") + SnowflakeTypeConverter::QuoteIdentifier(columns[i]);
+    }
+    sql += " " + DerivedTable(query);
+    for (size_t i = 0; i < predicates.size(); i++) {
+        sql += (i > 0 ? " AND (" : " WHERE (") + predicates[i] + ")";
+    }
+    return sql;
+}
+
+std::string SnowflakePushdown::BuildSchemaQuery(const std::string& query) {
+    return "SELECT * " + DerivedTable(query) + " LIMIT 0";
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,529 @@
+#include "snowflake_result_cache.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <arrow/util/key_value_metadata.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace duckdb {
+
+namespace {
+
+using CacheClock = std::chrono::system_clock;
+
+constexpr const char *ENTRY_EXTENSION = ".arrow";
+// Footer metadata of every entry
+constexpr const char *KEY_METADATA = "snowflake.cache_key";
+constexpr const char *CREATED_METADATA = "snowflake.cache_created";
+
+/**
+ * @brief 64-bit FNV-1a; stable across processes, unlike std::hash
+ */
+uint64_t StableHash(const std::string &text) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto c : text) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string HexHash(const std::string &text) {
+    static constexpr const char *HEX = "0123456789abcdef";
+    auto hash = StableHash(text);
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; i--, hash >>= 4) {
+        hex[i] = HEX[hash & 0x0F];
+    }
+    return hex;
+}
+
+/**
+ * @brief Who runs the query and where; secrets are hashed so they never reach the disk
+ */
+std::string CacheIdentity(const SnowflakeConfig &config) {
+    std::string identity = "driver=" + config.driver + ";account=" + config.account + ";user=" + config.user +
+                           ";database=" + config.database + ";schema=" + config.schema +
+                           ";warehouse=" + config.warehouse + ";role=" + config.role +
+                           ";private_key_path=" + config.private_key_path;
+    if (!config.token.empty()) {
+        identity += ";token#=" + HexHash(config.token);
+    }
+    // Sorted: the options map has no stable order
+    std::map<std::string, std::string> options(config.options.begin(), config.options.end());
+    for (auto &option : options) {
+        identity += ";" + option.first + "=" + option.second;
+    }
+    return identity;
+}
+
+std::string CacheKey(const SnowflakeConfig &config, const std::string &sql) {
+    return CacheIdentity(config) + "\n" + SnowflakeResultCache::NormalizeQuery(sql);
+}
+
+std::string EntryPath(const std::string &directory, const std::string &key) {
+    return (std::filesystem::path(directory) / (HexHash(key) + ENTRY_EXTENSION)).string();
+}
+
+/**
+ * @brief Memory-map an entry and read its footer
+ */
+arrow::Result<std::shared_ptr<arrow::ipc::RecordBatchFileReader>> OpenEntry(const std::string &path) {
+    ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ));
+    return arrow::ipc::RecordBatchFileReader::Open(file);
+}
+
+std::string FooterValue(const arrow::ipc::RecordBatchFileReader &reader, const std::string &key) {
+    auto metadata = reader.metadata();
+    if (!metadata) {
+        return "";
+    }
+    auto value = metadata->Get(key);
+    return value.ok() ? *value : "";
+}
+
+/**
+ * @brief Serves the batches of a mapped entry; they reference the mapping, nothing is copied
+ */
+class MappedResultReader : public arrow::RecordBatchReader {
+public:
+    explicit MappedResultReader(std::shared_ptr<arrow::ipc::RecordBatchFileReader> file) : file_(std::move(file)) {
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return file_->schema();
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        if (next_ >= file_->num_record_batches()) {
+            batch->reset();
+            return arrow::Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(*batch, file_->ReadRecordBatch(next_++));
+        return arrow::Status::OK();
+    }
+
+private:
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> file_;
+    int next_ = 0;
+};
+
+} // namespace
+
+/**
+ * @brief Passes a live result through while writing it to a temporary file
+ *
+ * The file becomes a cache entry when the result has been read to its end;
+ * a result abandoned early, failing, or growing beyond max_bytes is
+ * discarded.
+ */
+class SnowflakeResultCache::StoringReader : public arrow::RecordBatchReader {
+public:
+    StoringReader(SnowflakeResultCache &cache, std::unique_ptr<SnowflakeResultStream> source, Entry entry,
+                  std::string temp_path, uint64_t max_bytes, std::shared_ptr<arrow::io::FileOutputStream> file,
+                  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer)
+        : cache_(cache), source_(std::move(source)), entry_(std::move(entry)), temp_path_(std::move(temp_path)),
+          max_bytes_(max_bytes), file_(std::move(file)), writer_(std::move(writer)) {
+    }
+
+    ~StoringReader() override {
+        Discard();
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return source_->GetSchema();
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        auto next = source_->ReadNext();
+        if (!next.second.empty()) {
+            Discard();
+            return arrow::Status::IOError(next.second);
+        }
+        *batch = std::move(next.first);
+        if (!writer_) {
+            return arrow::Status::OK();
+        }
+        if (!*batch) {
+            Commit();
+            return arrow::Status::OK();
+        }
+        auto status = writer_->WriteRecordBatch(**batch);
+        auto size = file_->Tell();
+        if (!status.ok() || !size.ok() || static_cast<uint64_t>(*size) > max_bytes_) {
+            Discard();
+        }
+        return arrow::Status::OK();
+    }
+
+private:
+    void Commit() {
+        auto status = writer_->Close();
+        if (status.ok()) {
+            status = file_->Close();
+        }
+        std::error_code error;
+        auto size = std::filesystem::file_size(temp_path_, error);
+        if (!status.ok() || error) {
+            Discard();
+            return;
+        }
+        // Atomic replace: concurrent readers see the old file or the new one
+        std::filesystem::rename(temp_path_, entry_.path, error);
+        if (error) {
+            Discard();
+            return;
+        }
+        writer_.reset();
+        file_.reset();
+        entry_.bytes = size;
+        cache_.stores_++;
+        cache_.bytes_written_ += size;
+        cache_.Insert(std::move(entry_));
+    }
+
+    void Discard() {
+        if (!writer_) {
+            return;
+        }
+        (void)writer_->Close();
+        (void)file_->Close();
+        writer_.reset();
+        file_.reset();
+        std::remove(temp_path_.c_str());
+        cache_.store_failures_++;
+    }
+
+    SnowflakeResultCache &cache_;
+    std::unique_ptr<SnowflakeResultStream> source_;
+    Entry entry_;
+    std::string temp_path_;
+    uint64_t max_bytes_;
+    std::shared_ptr<arrow::io::FileOutputStream> file_;
+    // Null once the result was stored or discarded
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> writer_;
+};
+
+SnowflakeResultCache::SnowflakeResultCache(SnowflakeResultCacheOptions options) {
+    if (!options.directory.empty()) {
+        Configure(options);
+    }
+}
+
+SnowflakeResultCache &SnowflakeResultCache::Get() {
+    static SnowflakeResultCache cache;
+    return cache;
+}
+
+string SnowflakeResultCache::Configure(const SnowflakeResultCacheOptions &options) {
+    std::vector<Entry> found;
+    uint64_t expired = 0;
+    if (!options.directory.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(options.directory, error);
+        if (error) {
+            return "Cannot create result cache directory " + options.directory + ": " + error.message();
+        }
+        // Entries written by earlier processes
+        auto now = CacheClock::now();
+        for (auto &file : std::filesystem::directory_iterator(options.directory, error)) {
+            if (file.path().extension() != ENTRY_EXTENSION) {
+                continue;
+            }
+            auto path = file.path().string();
+            auto reader = OpenEntry(path);
+            auto created = reader.ok() ? FooterValue(**reader, CREATED_METADATA) : "";
+            if (created.empty()) {
+                continue;
+            }
+            auto seconds = std::chrono::seconds(std::strtoll(created.c_str(), nullptr, 10));
+            Entry entry {path, file.file_size(error), CacheClock::time_point(seconds)};
+            if (now - entry.created >= options.ttl) {
+                std::remove(path.c_str());
+                expired++;
+                continue;
+            }
+            found.push_back(std::move(entry));
+        }
+    }
+    std::sort(found.begin(), found.end(),
+              [](const Entry &left, const Entry &right) { return left.created < right.created; });
+
+    std::lock_guard<std::mutex> guard(lock_);
+    options_ = options;
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+    expirations_ += expired;
+    // Newest first, so the oldest are evicted first
+    for (auto &entry : found) {
+        bytes_ += entry.bytes;
+        lru_.push_front(std::move(entry));
+        index_[lru_.front().path] = lru_.begin();
+    }
+    while (bytes_ > options_.max_bytes && !lru_.empty()) {
+        Erase(std::prev(lru_.end()));
+        evictions_++;
+    }
+    return "";
+}
+
+bool SnowflakeResultCache::IsEnabled() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !options_.directory.empty();
+}
+
+std::pair<std::unique_ptr<SnowflakeResultStream>, string>
+SnowflakeResultCache::Execute(SnowflakeADBCConnector &connector, const std::string &sql) {
+    auto cached = Lookup(connector.GetConfig(), sql);
+    if (cached) {
+        return {std::move(cached), ""};
+    }
+    auto executed = connector.ExecuteQuery(sql);
+    if (!executed.first) {
+        return {nullptr, executed.second};
+    }
+    return {Store(connector.GetConfig(), sql, std::move(executed.first)), ""};
+}
+
+std::unique_ptr<SnowflakeResultStream> SnowflakeResultCache::Lookup(const SnowflakeConfig &config,
+                                                                    const std::string &sql) {
+    auto key = CacheKey(config, sql);
+    std::string path;
+    uint64_t bytes;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (options_.directory.empty()) {
+            return nullptr;
+        }
+        path = EntryPath(options_.directory, key);
+        auto found = index_.find(path);
+        if (found == index_.end()) {
+            misses_++;
+            return nullptr;
+        }
+        if (CacheClock::now() - found->second->created >= options_.ttl) {
+            Erase(found->second);
+            expirations_++;
+            misses_++;
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, found->second);
+        bytes = found->second->bytes;
+    }
+
+    // Opened outside the lock; an entry deleted meanwhile just fails to open
+    auto reader = OpenEntry(path);
+    if (!reader.ok() || FooterValue(**reader, KEY_METADATA) != key) {
+        // Missing, corrupt, or another key with the same hash
+        std::lock_guard<std::mutex> guard(lock_);
+        auto found = index_.find(path);
+        if (found != index_.end()) {
+            Erase(found->second);
+        }
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    bytes_read_ += bytes;
+    return std::unique_ptr<SnowflakeResultStream>(
+        new SnowflakeResultStream(std::make_shared<MappedResultReader>(std::move(*reader))));
+}
+
+std::unique_ptr<SnowflakeResultStream> SnowflakeResultCache::Store(const SnowflakeConfig &config,
+                                                                   const std::string &sql,
+                                                                   std::unique_ptr<SnowflakeResultStream> result) {
+    SnowflakeResultCacheOptions options;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        options = options_;
+    }
+    if (options.directory.empty()) {
+        return result;
+    }
+
+    auto key = CacheKey(config, sql);
+    Entry entry {EntryPath(options.directory, key), 0, CacheClock::now()};
+    // Unique across threads and processes sharing the directory
+    static std::atomic<uint64_t> next_temp {std::random_device()()};
+    auto temp_path = entry.path + ".tmp" + std::to_string(next_temp++);
+
+    auto created = std::chrono::duration_cast<std::chrono::seconds>(entry.created.time_since_epoch()).count();
+    auto metadata = arrow::key_value_metadata({KEY_METADATA, CREATED_METADATA}, {key, std::to_string(created)});
+    auto file = arrow::io::FileOutputStream::Open(temp_path);
+    if (!file.ok()) {
+        store_failures_++;
+        return result;
+    }
+    auto writer =
+        arrow::ipc::MakeFileWriter(*file, result->GetSchema(), arrow::ipc::IpcWriteOptions::Defaults(), metadata);
+    if (!writer.ok()) {
+        (void)(*file)->Close();
+        std::remove(temp_path.c_str());
+        store_failures_++;
+        return result;
+    }
+    auto reader = std::make_shared<StoringReader>(*this, std::move(result), std::move(entry), std::move(temp_path),
+                                                  options.max_bytes, std::move(*file), std::move(*writer));
+    return std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(std::move(reader)));
+}
+
+void SnowflakeResultCache::Insert(Entry entry) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto existing = index_.find(entry.path);
+    if (existing != index_.end()) {
+        // The file itself was already replaced by the rename
+        bytes_ -= existing->second->bytes;
+        lru_.erase(existing->second);
+        index_.erase(existing);
+    }
+    bytes_ += entry.bytes;
+    lru_.push_front(std::move(entry));
+    index_[lru_.front().path] = lru_.begin();
+    while (bytes_ > options_.max_bytes && lru_.size() > 1) {
+        Erase(std::prev(lru_.end()));
+        evictions_++;
+    }
+}
+
+void SnowflakeResultCache::Erase(std::list<Entry>::iterator entry) {
+    // Readers that mapped the file keep their mapping after the unlink
+    std::remove(entry->path.c_str());
+    bytes_ -= entry->bytes;
+    index_.erase(entry->path);
+    lru_.erase(entry);
+}
+
+void SnowflakeResultCache::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    while (!lru_.empty()) {
+        Erase(lru_.begin());
+    }
+}
+
+SnowflakeResultCacheMetrics SnowflakeResultCache::GetMetrics() const {
+    SnowflakeResultCacheMetrics metrics;
+    metrics.hits = hits_;
+    metrics.misses = misses_;
+    metrics.stores = stores_;
+    metrics.store_failures = store_failures_;
+    metrics.evictions = evictions_;
+    metrics.expirations = expirations_;
+    metrics.bytes_read = bytes_read_;
+    metrics.bytes_written = bytes_written_;
+    std::lock_guard<std::mutex> guard(lock_);
+    metrics.entries = lru_.size();
+    metrics.bytes = bytes_;
+    return metrics;
+}
+
+std::string SnowflakeResultCache::NormalizeQuery(const std::string &sql) {
+    std::string normalized;
+    normalized.reserve(sql.size());
+    // Delimiter ending the quoted text or comment being copied: ', ", $$, */ or a newline
+    std::string closing;
+    bool pending_space = false;
+    for (size_t i = 0; i < sql.size(); i++) {
+        auto c = sql[i];
+        if (!closing.empty()) {
+            // Quoted text and comments are kept byte for byte
+            if (sql.compare(i, closing.size(), closing) == 0) {
+                normalized += closing;
+                i += closing.size() - 1;
+                closing.clear();
+                continue;
+            }
+            normalized += c;
+            if (c == '\\' && closing == "'" && i + 1 < sql.size()) {
+                normalized += sql[++i];
+            }
+            continue;
+        }
+        if (StringUtil::CharacterIsSpace(c)) {
+            pending_space = !normalized.empty();
+            continue;
+        }
+        if (pending_space) {
+            normalized += ' ';
+            pending_space = false;
+        }
+        normalized += c;
+        auto next = i + 1 < sql.size() ? sql[i + 1] : '\0';
+        if (c == '\'' || c == '"') {
+            closing.assign(1, c);
+        } else if ((c == '-' && next == '-') || (c == '/' && next == '*') || (c == '$' && next == '$')) {
+            normalized += sql[++i];
+            closing = c == '-' ? "\n" : c == '/' ? "*/" : "$$";
+        }
+    }
+    // A trailing line comment keeps its newline; whitespace and semicolons after the query do not matter
+    while (!normalized.empty() && closing.empty() &&
+           (normalized.back() == ';' || StringUtil::CharacterIsSpace(normalized.back()))) {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+// ===== snowflake_cache_stats() =====
+
+namespace {
+
+struct CacheStatsState : public GlobalTableFunctionState {
+    bool done = false;
+};
+
+unique_ptr<FunctionData> CacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                        vector<LogicalType> &return_types, vector<string> &names) {
+    names = {"hits",        "misses",      "hit_rate",    "stores",
+             "store_failures", "evictions", "expirations", "bytes_read",
+             "bytes_written", "entries",   "bytes"};
+    return_types = vector<LogicalType>(names.size(), LogicalType::UBIGINT);
+    return_types[2] = LogicalType::DOUBLE;
+    return make_uniq<TableFunctionData>();
+}
+
+unique_ptr<GlobalTableFunctionState> CacheStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<CacheStatsState>();
+}
+
+void CacheStatsExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &state = input.global_state->Cast<CacheStatsState>();
+    if (state.done) {
+        output.SetCardinality(0);
+        return;
+    }
+    state.done = true;
+
+    auto metrics = SnowflakeResultCache::Get().GetMetrics();
+    auto lookups = metrics.hits + metrics.misses;
+    auto hit_rate = lookups == 0 ? 0.0 : static_cast<double>(metrics.hits) / lookups;
+    output.SetValue(0, 0, Value::UBIGINT(metrics.hits));
+    output.SetValue(1, 0, Value::UBIGINT(metrics.misses));
+    output.SetValue(2, 0, Value::DOUBLE(hit_rate));
+    output.SetValue(3, 0, Value::UBIGINT(metrics.stores));
+    output.SetValue(4, 0, Value::UBIGINT(metrics.store_failures));
+    output.SetValue(5, 0, Value::UBIGINT(metrics.evictions));
+    output.SetValue(6, 0, Value::UBIGINT(metrics.expirations));
+    output.SetValue(7, 0, Value::UBIGINT(metrics.bytes_read));
+    output.SetValue(8, 0, Value::UBIGINT(metrics.bytes_written));
+    output.SetValue(9, 0, Value::UBIGINT(metrics.entries));
+    output.SetValue(10, 0, Value::UBIGINT(metrics.bytes));
+    output.SetCardinality(1);
+}
+
+} // namespace
+
+TableFunction SnowflakeCacheStatsFunction::GetFunction() {
+    return TableFunction("snowflake_cache_stats", {}, CacheStatsExecute, CacheStatsBind, CacheStatsInit);
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,446 @@
+#include "snowflake_scan.hpp"
+#include "snowflake_connection_pool.hpp"
+#include "snowflake_memory_pool.hpp"
+#include "snowflake_metrics.hpp"
+#include "snowflake_pushdown.hpp"
+#include "snowflake_result_cache.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+#include <arrow/record_batch.h>
+#include <algorithm>
+
+namespace duckdb {
+
+namespace {
+
+/**
+ * @brief Hands result streams to scan threads
+ *
+ * Partitions are claimed in order through a shared cursor, so a thread held up
+ * by a slow partition never stalls the others. When none are left, an idle
+ * thread joins a stream that is still being read and takes batches from it:
+ * fetching stays serial within a stream, but decoding runs in parallel.
+ */
+struct SnowflakeScanGlobalState : public GlobalTableFunctionState {
+    std::shared_ptr<SnowflakeADBCConnector> connector;
+    std::unique_ptr<SnowflakeScanSource> source;
+    idx_t max_threads = 1;
+
+    // Decodes the columns the rewritten query selects
+    SnowflakeBatchDecoder decoder;
+    // Per output column: decoded column it references, or INVALID_INDEX for the row id
+    std::vector<idx_t> output_columns;
+    std::vector<std::string> decoder_names;
+    std::vector<LogicalType> decoder_types;
+    // Pushed filters, applied again to the decoded rows (nullptr if none)
+    unique_ptr<Expression> filter;
+
+    // Counts fetched batches against memory_limit
+    std::shared_ptr<SnowflakeMemoryPool> memory;
+    SnowflakePrefetchOptions prefetch;
+    std::shared_ptr<SnowflakePrefetchStats> prefetch_stats = std::make_shared<SnowflakePrefetchStats>();
+    // Batches, driver and decode time of this scan (see snowflake_metrics())
+    std::shared_ptr<SnowflakeTransferMetrics> metrics;
+
+    std::mutex lock;
+    idx_t next_partition = 0;
+    idx_t next_shared = 0;
+    std::vector<std::shared_ptr<SnowflakeResultStream>> active;
+
+    ~SnowflakeScanGlobalState() override {
+        if (metrics) {
+            // Decoders waiting on the prefetch queue, and the I/O threads on them
+            metrics->queue_wait_ns += (prefetch_stats->fetch_stall_us + prefetch_stats->queue_full_stall_us) * 1000;
+        }
+    }
+
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
+
+    /**
+     * @brief Open the next unclaimed partition, or join an active stream
+     * @return Stream to read, or nullptr once the whole result has been handed out
+     */
+    std::shared_ptr<SnowflakeResultStream> NextStream() {
+        std::unique_lock<std::mutex> guard(lock);
+        if (source->partitions && next_partition < source->partitions->descriptors.size()) {
+            auto &descriptor = source->partitions->descriptors[next_partition++];
+            guard.unlock();
+            std::pair<std::unique_ptr<SnowflakeResultStream>, string> opened;
+            {
+                SnowflakeScopedTimer timer(metrics->Time(metrics->driver_ns));
+                opened = connector->ReadPartition(descriptor);
+            }
+            if (!opened.first) {
+                throw IOException("snowflake_scan: " + opened.second);
+            }
+            std::shared_ptr<SnowflakeResultStream> stream(SnowflakePrefetchReader::Wrap(
+                memory->Track(metrics->Track(std::move(opened.first))), prefetch, prefetch_stats));
+            guard.lock();
+            active.push_back(stream);
+            return stream;
+        }
+        if (active.empty()) {
+            return nullptr;
+        }
+        return active[next_shared++ % active.size()];
+    }
+
+    /**
+     * @brief Drop an exhausted stream so no thread joins it any more
+     */
+    void Finish(const std::shared_ptr<SnowflakeResultStream> &stream) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto entry = std::find(active.begin(), active.end(), stream);
+        if (entry != active.end()) {
+            active.erase(entry);
+        }
+    }
+};
+
+struct SnowflakeScanLocalState : public LocalTableFunctionState {
+    std::shared_ptr<SnowflakeResultStream> stream;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    idx_t offset = 0;
+    DataChunk decoded;
+    // Dictionaries of dictionary-encoded columns, decoded once per Arrow dictionary
+    std::vector<SnowflakeDecodedDictionary> dictionaries;
+    unique_ptr<ExpressionExecutor> filter;
+    SelectionVector selection;
+};
+
+/**
+ * @brief Run the query through the result cache, if enabled and not bypassed
+ */
+std::pair<std::unique_ptr<SnowflakeResultStream>, string> ExecuteQuery(SnowflakeADBCConnector &connector,
+                                                                       const std::string &query, bool cache) {
+    if (cache && SnowflakeResultCache::Get().IsEnabled()) {
+        return SnowflakeResultCache::Get().Execute(connector, query);
+    }
+    return connector.ExecuteQuery(query);
+}
+
+/**
+ * @brief Run the query, from the result cache or through partitioned execution when
+ *        requested and supported
+ */
+std::unique_ptr<SnowflakeScanSource> ExecuteSource(SnowflakeADBCConnector &connector, const std::string &query,
+                                                   bool partitioned, bool cache) {
+    auto source = std::unique_ptr<SnowflakeScanSource>(new SnowflakeScanSource());
+    // A cached result is one file, so it is written from (and read as) a single stream
+    if (partitioned && !(cache && SnowflakeResultCache::Get().IsEnabled())) {
+        auto executed = connector.ExecutePartitions(query);
+        if (executed.first) {
+            source->partitions = std::move(executed.first);
+            return source;
+        }
+        if (connector.SupportsPartitions()) {
+            throw IOException("snowflake_scan: " + executed.second);
+        }
+    }
+    auto executed = ExecuteQuery(connector, query, cache);
+    if (!executed.first) {
+        throw IOException("snowflake_scan: " + executed.second);
+    }
+    source->stream = std::move(executed.first);
+    return source;
+}
+
+unique_ptr<FunctionData> SnowflakeScanBind(ClientContext &context, TableFunctionBindInput &input,
+                                           vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<SnowflakeScanBindData>();
+    result->config = SnowflakeConfig::Parse(input.inputs[0].GetValue<string>());
+    result->query = input.inputs[1].GetValue<string>();
+    auto partitioned = input.named_parameters.find("partitioned");
+    if (partitioned != input.named_parameters.end()) {
+        result->partitioned = BooleanValue::Get(partitioned->second);
+    }
+    auto cache = input.named_parameters.find("cache");
+    if (cache != input.named_parameters.end()) {
+        result->cache = BooleanValue::Get(cache->second);
+    }
+    auto prefetch_batches = input.named_parameters.find("prefetch_batches");
+    if (prefetch_batches != input.named_parameters.end()) {
+        auto batches = prefetch_batches->second.GetValue<int64_t>();
+        if (batches < 0) {
+            throw BinderException("snowflake_scan: prefetch_batches must not be negative");
+        }
+        result->prefetch.max_batches = static_cast<idx_t>(batches);
+    }
+    auto prefetch_bytes = input.named_parameters.find("prefetch_bytes");
+    if (prefetch_bytes != input.named_parameters.end()) {
+        auto bytes = prefetch_bytes->second.GetValue<int64_t>();
+        if (bytes <= 0) {
+            throw BinderException("snowflake_scan: prefetch_bytes must be positive");
+        }
+        result->prefetch.max_bytes = static_cast<uint64_t>(bytes);
+    }
+
+    // Leased for the probe only: bind data can outlive the query (prepared
+    // statements), and holding a session per bound scan would drain the pool
+    auto leased = SnowflakeConnectionPool::Get().Acquire(result->config);
+    if (!leased.first) {
+        throw IOException("snowflake_scan: " + leased.second);
+    }
+    auto probe = ExecuteQuery(*leased.first, SnowflakePushdown::BuildSchemaQuery(result->query), result->cache);
+    if (!probe.first) {
+        throw IOException("snowflake_scan: " + probe.second);
+    }
+    auto decoder = SnowflakeBatchDecoder::CreateFromSchema(*probe.first->GetSchema());
+    if (!decoder.IsValid()) {
+        throw BinderException("snowflake_scan: " + decoder.GetError());
+    }
+    for (auto &field : probe.first->GetSchema()->fields()) {
+        auto resolved = SnowflakeColumnDecoder::ResolveSnowflakeType(*field);
+        result->snowflake_types.push_back(resolved.IsValid() ? resolved.GetValue() : std::string());
+    }
+    // Drained (no rows) so that the result cache keeps the probe too
+    while (probe.first->ReadNext().first) {
+    }
+    result->names = decoder.GetValue().GetNames();
+    result->types = decoder.GetValue().GetTypes();
+    return_types = result->types;
+    names = result->names;
+    return std::move(result);
+}
+
+/**
+ * @brief Rewrite the query for the scan's projection and filters
+ * @param global_state Receives the output column mapping and the filter to re-check
+ * @return Query to execute
+ */
+std::string PushDown(const SnowflakeScanBindData &bind_data, TableFunctionInitInput &input,
+                     SnowflakeScanGlobalState &global_state) {
+    std::vector<std::string> columns;
+    std::vector<column_t> selected;
+    for (auto column_id : input.column_ids) {
+        if (column_id >= bind_data.names.size()) {
+            // Row id: only the row count matters
+            global_state.output_columns.push_back(DConstants::INVALID_INDEX);
+            continue;
+        }
+        auto existing = std::find(selected.begin(), selected.end(), column_id);
+        global_state.output_columns.push_back(existing - selected.begin());
+        if (existing == selected.end()) {
+            selected.push_back(column_id);
+            columns.push_back(bind_data.names[column_id]);
+        }
+    }
+    if (selected.empty()) {
+        // COUNT(*) and the like still need one column to count rows
+        selected.push_back(0);
+        columns.push_back(bind_data.names[0]);
+    }
+
+    std::vector<std::string> predicates;
+    vector<unique_ptr<Expression>> rechecks;
+    if (input.filters) {
+        for (auto &entry : input.filters->filters) {
+            // Filters are keyed by position in column_ids, which is also the output column
+            auto output_column = entry.first;
+            auto column_id = input.column_ids[output_column];
+            if (SnowflakePushdown::CanPushFilter(bind_data.snowflake_types[column_id])) {
+                auto quoted = SnowflakeTypeConverter::QuoteIdentifier(bind_data.names[column_id]);
+                auto rendered = SnowflakePushdown::RenderFilter(quoted, *entry.second);
+                if (rendered.IsValid()) {
+                    predicates.push_back(rendered.GetValue());
+                }
+            }
+            if (entry.second->filter_type != TableFilterType::OPTIONAL_FILTER) {
+                BoundReferenceExpression column(bind_data.types[column_id], output_column);
+                rechecks.push_back(entry.second->ToExpression(column));
+            }
+        }
+    }
+    if (rechecks.size() == 1) {
+        global_state.filter = std::move(rechecks[0]);
+    } else if (!rechecks.empty()) {
+        auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+        conjunction->children = std::move(rechecks);
+        global_state.filter = std::move(conjunction);
+    }
+
+    vector<LogicalType> types;
+    for (auto column_id : selected) {
+        types.push_back(bind_data.types[column_id]);
+    }
+    global_state.decoder_names = columns;
+    global_state.decoder_types = std::move(types);
+    return SnowflakePushdown::BuildQuery(bind_data.query, columns, predicates);
+}
+
+unique_ptr<GlobalTableFunctionState> SnowflakeScanInitGlobal(ClientContext &context,
+                                                             TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<SnowflakeScanBindData>();
+    auto result = make_uniq<SnowflakeScanGlobalState>();
+    // Leased for as long as the scan runs
+    auto leased = SnowflakeConnectionPool::Get().Acquire(bind_data.config);
+    if (!leased.first) {
+        throw IOException("snowflake_scan: " + leased.second);
+    }
+    result->connector = std::move(leased.first);
+    result->memory = SnowflakeMemoryPool::Create(context);
+    result->prefetch = bind_data.prefetch;
+    auto query = PushDown(bind_data, input, *result);
+    result->metrics = SnowflakeMetrics::Get().Begin(SnowflakeTransferKind::SCAN, result->decoder_names,
+                                                    SnowflakeMetrics::TimingEnabled(context));
+    {
+        SnowflakeScopedTimer timer(result->metrics->Time(result->metrics->driver_ns));
+        result->source = ExecuteSource(*result->connector, query, bind_data.partitioned, bind_data.cache);
+    }
+
+    // Decode into the types bind promised, whatever the physical Arrow types
+    auto decoder = SnowflakeBatchDecoder::Create(*result->source->GetSchema(), result->decoder_types);
+    if (!decoder.IsValid()) {
+        throw IOException("snowflake_scan: " + decoder.GetError());
+    }
+    result->decoder = decoder.GetValue();
+    if (result->source->stream) {
+        // A single stream is shared by every thread
+        auto stream = result->memory->Track(result->metrics->Track(std::move(result->source->stream)));
+        result->active.push_back(
+            SnowflakePrefetchReader::Wrap(std::move(stream), result->prefetch, result->prefetch_stats));
+    }
+    result->max_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+    return std::move(result);
+}
+
+unique_ptr<LocalTableFunctionState> SnowflakeScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                           GlobalTableFunctionState *global_state) {
+    auto &global = global_state->Cast<SnowflakeScanGlobalState>();
+    auto result = make_uniq<SnowflakeScanLocalState>();
+    result->decoded.Initialize(context.client, global.decoder.GetTypes());
+    if (global.filter) {
+        result->filter = make_uniq<ExpressionExecutor>(context.client, *global.filter);
+        result->selection.Initialize(STANDARD_VECTOR_SIZE);
+    }
+    return std::move(result);
+}
+
+/**
+ * @brief Decode the next rows of the local batch into the output chunk
+ * @return False once the whole result has been handed out
+ */
+bool DecodeNext(SnowflakeScanGlobalState &global_state, SnowflakeScanLocalState &local_state, DataChunk &output) {
+    while (!local_state.batch || local_state.offset >= static_cast<idx_t>(local_state.batch->num_rows())) {
+        // Release the finished batch before blocking on the next one
+        local_state.batch.reset();
+        if (!local_state.stream) {
+            local_state.stream = global_state.NextStream();
+            if (!local_state.stream) {
+                return false;
+            }
+        }
+        auto next = local_state.stream->ReadNext();
+        if (!next.second.empty()) {
+            throw IOException("snowflake_scan: " + next.second);
+        }
+        if (!next.first) {
+            global_state.Finish(local_state.stream);
+            local_state.stream.reset();
+            continue;
+        }
+        local_state.batch = std::move(next.first);
+        local_state.offset = 0;
+    }
+
+    auto &metrics = *global_state.metrics;
+    SnowflakeBatchDecoder::ConversionResult<idx_t> decoded;
+    {
+        SnowflakeScopedTimer timer(metrics.Time(metrics.convert_ns));
+        decoded = global_state.decoder.Decode(*local_state.batch, local_state.offset, local_state.decoded,
+                                              &local_state.dictionaries, metrics.ColumnTimes());
+    }
+    if (!decoded.IsValid()) {
+        throw ConversionException("snowflake_scan: " + decoded.GetError());
+    }
+    local_state.offset += decoded.GetValue();
+
+    // Output columns follow column_ids; decoded columns follow the SELECT list
+    for (idx_t col = 0; col < output.ColumnCount(); col++) {
+        auto source = global_state.output_columns[col];
+        if (source == DConstants::INVALID_INDEX) {
+            output.data[col].SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(output.data[col], true);
+        } else {
+            output.data[col].Reference(local_state.decoded.data[source]);
+        }
+    }
+    output.SetCardinality(decoded.GetValue());
+    return true;
+}
+
+void SnowflakeScanExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &global_state = input.global_state->Cast<SnowflakeScanGlobalState>();
+    auto &local_state = input.local_state->Cast<SnowflakeScanLocalState>();
+
+    while (DecodeNext(global_state, local_state, output)) {
+        if (!local_state.filter) {
+            return;
+        }
+        auto count = local_state.filter->SelectExpression(output, local_state.selection);
+        if (count == output.size()) {
+            return;
+        }
+        if (count > 0) {
+            output.Slice(local_state.selection, count);
+            return;
+        }
+        // Nothing survived; an empty chunk would end the scan
+        output.Reset();
+    }
+    output.SetCardinality(0);
+}
+
+/**
+ * @brief Transfer, memory and prefetch counters, shown per scan by EXPLAIN ANALYZE
+ */
+InsertionOrderPreservingMap<string> SnowflakeScanDynamicToString(TableFunctionDynamicToStringInput &input) {
+    InsertionOrderPreservingMap<string> result;
+    if (!input.global_state) {
+        return result;
+    }
+    auto &global = input.global_state->Cast<SnowflakeScanGlobalState>();
+    global.metrics->ToString(result);
+    auto memory = global.memory->GetStats();
+    result["Arrow Memory"] = StringUtil::BytesToHumanReadableString(static_cast<idx_t>(memory.current_bytes)) +
+                             " (peak " +
+                             StringUtil::BytesToHumanReadableString(static_cast<idx_t>(memory.peak_bytes)) + ")";
+    auto &stats = *global.prefetch_stats;
+    if (stats.batches == 0) {
+        return result;
+    }
+    result["Prefetched Batches"] = std::to_string(stats.batches.load());
+    result["Prefetch Peak Bytes"] = std::to_string(stats.peak_bytes.load());
+    result["Fetch Stalls"] =
+        std::to_string(stats.fetch_stalls.load()) + " (" + std::to_string(stats.fetch_stall_us / 1000) + " ms)";
+    result["Queue Full Stalls"] = std::to_string(stats.queue_full_stalls.load()) + " (" +
+                                  std::to_string(stats.queue_full_stall_us / 1000) + " ms)";
+    return result;
+}
+
+} // namespace
+
+std::shared_ptr<arrow::Schema> SnowflakeScanSource::GetSchema() const {
+    return partitions ? partitions->schema : stream->GetSchema();
+}
+
+TableFunction SnowflakeScanFunction::GetFunction() {
+    TableFunction function("snowflake_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR}, SnowflakeScanExecute,
+                           SnowflakeScanBind, SnowflakeScanInitGlobal, SnowflakeScanInitLocal);
+    function.named_parameters["partitioned"] = LogicalType::BOOLEAN;
+    function.named_parameters["cache"] = LogicalType::BOOLEAN;
+    function.named_parameters["prefetch_batches"] = LogicalType::BIGINT;
+    function.named_parameters["prefetch_bytes"] = LogicalType::BIGINT;
+    function.dynamic_to_string = SnowflakeScanDynamicToString;
+    function.projection_pushdown = true;
+    function.filter_pushdown = true;
+    return function;
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,366 @@
+#include "snowflake_schema_cache.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include "snowflake_result_cache.hpp"
+#include "type_converter.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <arrow/record_batch.h>
+#include <algorithm>
+
+namespace duckdb {
+
+namespace {
+
+using SchemaClock = std::chrono::steady_clock;
+
+// Columns of the query built by BuildColumnsQuery, in order
+enum ColumnsField : idx_t {
+    FIELD_TABLE_SCHEMA,
+    FIELD_TABLE_NAME,
+    FIELD_COLUMN_NAME,
+    FIELD_DATA_TYPE,
+    FIELD_NUMERIC_PRECISION,
+    FIELD_NUMERIC_SCALE,
+    FIELD_DATETIME_PRECISION,
+    FIELD_CHARACTER_MAXIMUM_LENGTH,
+    FIELD_IS_NULLABLE,
+    FIELD_COUNT
+};
+
+/**
+ * @brief Metadata is only shared by sessions that connect to the same place as the same principal
+ */
+std::string ConnectionKey(const SnowflakeConfig &config) {
+    return config.driver + '\n' + config.BuildURI() + '\n' + config.private_key_path + '\n' +
+           config.private_key_passphrase + '\n' + config.token + '\n';
+}
+
+/**
+ * @brief Unquoted identifiers resolve case-insensitively in Snowflake; anything else is quoted
+ */
+std::string DatabaseIdentifier(const std::string &database) {
+    if (database.empty() || !(StringUtil::CharacterIsAlpha(database[0]) || database[0] == '_')) {
+        return SnowflakeTypeConverter::QuoteIdentifier(database);
+    }
+    for (auto c : database) {
+        if (!(StringUtil::CharacterIsAlpha(c) || StringUtil::CharacterIsDigit(c) || c == '_' || c == '$')) {
+            return SnowflakeTypeConverter::QuoteIdentifier(database);
+        }
+    }
+    return database;
+}
+
+} // namespace
+
+std::shared_ptr<const SnowflakeTableInfo> SnowflakeSchemaInfo::FindTable(const std::string &name) const {
+    auto exact = tables.find(name);
+    if (exact != tables.end()) {
+        return exact->second;
+    }
+    std::shared_ptr<const SnowflakeTableInfo> match;
+    for (auto &entry : tables) {
+        if (StringUtil::CIEquals(entry.first, name)) {
+            if (match) {
+                // "Orders" and "ORDERS" both exist: only an exact name is unambiguous
+                return nullptr;
+            }
+            match = entry.second;
+        }
+    }
+    return match;
+}
+
+/**
+ * @brief Cached tables of one schema; lock is held while loading so concurrent lookups wait
+ */
+struct SnowflakeSchemaCache::Slot {
+    std::mutex lock;
+    std::shared_ptr<const SnowflakeSchemaInfo> info;
+    SchemaClock::time_point loaded;
+};
+
+SnowflakeSchemaCache::SnowflakeSchemaCache(SnowflakeSchemaCacheOptions options) : options_(std::move(options)) {
+}
+
+SnowflakeSchemaCache &SnowflakeSchemaCache::Get() {
+    static SnowflakeSchemaCache cache;
+    return cache;
+}
+
+void SnowflakeSchemaCache::Configure(const SnowflakeSchemaCacheOptions &options) {
+    std::lock_guard<std::mutex> guard(lock_);
+    options_ = options;
+}
+
+std::shared_ptr<SnowflakeSchemaCache::Slot> SnowflakeSchemaCache::GetSlot(const SnowflakeConfig &config,
+                                                                          const std::string &schema) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &slot = slots_[ConnectionKey(config) + schema];
+    if (!slot) {
+        slot = std::make_shared<Slot>();
+    }
+    return slot;
+}
+
+std::pair<std::shared_ptr<const SnowflakeSchemaInfo>, string>
+SnowflakeSchemaCache::GetSchema(SnowflakeADBCConnector &connector, const std::string &schema) {
+    std::chrono::milliseconds ttl;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        ttl = options_.ttl;
+    }
+    auto slot = GetSlot(connector.GetConfig(), schema);
+    std::lock_guard<std::mutex> guard(slot->lock);
+    if (slot->info && SchemaClock::now() - slot->loaded < ttl) {
+        hits_++;
+        return {slot->info, ""};
+    }
+    misses_++;
+
+    auto loaded = Load(connector, schema);
+    if (!loaded.second.empty()) {
+        return {nullptr, loaded.second};
+    }
+    auto found = loaded.first.find(schema);
+    std::shared_ptr<SnowflakeSchemaInfo> info;
+    if (found != loaded.first.end()) {
+        info = found->second;
+    } else {
+        info = std::make_shared<SnowflakeSchemaInfo>();
+        info->name = schema;
+    }
+    slot->info = info;
+    slot->loaded = SchemaClock::now();
+    return {slot->info, ""};
+}
+
+std::pair<std::shared_ptr<const SnowflakeTableInfo>, string>
+SnowflakeSchemaCache::GetTable(SnowflakeADBCConnector &connector, const std::string &schema,
+                               const std::string &table) {
+    auto loaded = GetSchema(connector, schema);
+    if (!loaded.first) {
+        return {nullptr, loaded.second};
+    }
+    auto info = loaded.first->FindTable(table);
+    if (!info) {
+        return {nullptr, "Table " + schema + "." + table + " does not exist or is not visible to this role"};
+    }
+    return {info, ""};
+}
+
+std::pair<std::vector<std::string>, string> SnowflakeSchemaCache::PrefetchDatabase(SnowflakeADBCConnector &connector) {
+    auto loaded = Load(connector, "");
+    if (!loaded.second.empty()) {
+        return {{}, loaded.second};
+    }
+    std::vector<std::string> names;
+    auto now = SchemaClock::now();
+    for (auto &schema : loaded.first) {
+        auto slot = GetSlot(connector.GetConfig(), schema.first);
+        std::lock_guard<std::mutex> guard(slot->lock);
+        slot->info = schema.second;
+        slot->loaded = now;
+        names.push_back(schema.first);
+    }
+    return {std::move(names), ""};
+}
+
+std::pair<SnowflakeSchemaCache::SchemaMap, string> SnowflakeSchemaCache::Load(SnowflakeADBCConnector &connector,
+                                                                              const std::string &schema) {
+    loads_++;
+    auto executed = connector.ExecuteQuery(BuildColumnsQuery(connector.GetConfig().database, schema));
+    if (!executed.first) {
+        return {{}, executed.second};
+    }
+    auto decoder = SnowflakeBatchDecoder::CreateFromSchema(*executed.first->GetSchema());
+    if (!decoder.IsValid()) {
+        return {{}, "Cannot read INFORMATION_SCHEMA.COLUMNS: " + decoder.GetError()};
+    }
+    if (decoder.GetValue().GetTypes().size() != FIELD_COUNT) {
+        return {{}, "Unexpected INFORMATION_SCHEMA.COLUMNS result"};
+    }
+
+    // Tables are filled while reading; types are converted once every row is in
+    std::map<std::pair<std::string, std::string>, std::shared_ptr<SnowflakeTableInfo>> tables;
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), decoder.GetValue().GetTypes());
+    std::vector<SnowflakeDecodedDictionary> dictionaries;
+    while (true) {
+        auto next = executed.first->ReadNext();
+        if (!next.second.empty()) {
+            return {{}, next.second};
+        }
+        if (!next.first) {
+            break;
+        }
+        for (idx_t offset = 0; offset < static_cast<idx_t>(next.first->num_rows());) {
+            auto decoded = decoder.GetValue().Decode(*next.first, offset, chunk, &dictionaries);
+            if (!decoded.IsValid()) {
+                return {{}, "Cannot read INFORMATION_SCHEMA.COLUMNS: " + decoded.GetError()};
+            }
+            offset += decoded.GetValue();
+
+            for (idx_t row = 0; row < chunk.size(); row++) {
+                auto text = [&](idx_t field) {
+                    auto value = chunk.GetValue(field, row);
+                    return value.IsNull() ? std::string() : value.ToString();
+                };
+                auto number = [&](idx_t field) {
+                    auto value = chunk.GetValue(field, row);
+                    return value.IsNull() ? int64_t(-1) : value.GetValue<int64_t>();
+                };
+                auto &table = tables[{text(FIELD_TABLE_SCHEMA), text(FIELD_TABLE_NAME)}];
+                if (!table) {
+                    table = std::make_shared<SnowflakeTableInfo>();
+                    table->schema = text(FIELD_TABLE_SCHEMA);
+                    table->name = text(FIELD_TABLE_NAME);
+                }
+                SnowflakeColumnInfo column;
+                column.name = text(FIELD_COLUMN_NAME);
+                column.snowflake_type =
+                    ColumnType(text(FIELD_DATA_TYPE), number(FIELD_NUMERIC_PRECISION), number(FIELD_NUMERIC_SCALE),
+                               number(FIELD_DATETIME_PRECISION), number(FIELD_CHARACTER_MAXIMUM_LENGTH));
+                column.nullable = text(FIELD_IS_NULLABLE) != "NO";
+                table->columns.push_back(std::move(column));
+            }
+        }
+    }
+
+    // Each distinct type string is converted once for the whole load
+    std::unordered_map<std::string, SnowflakeTypeConverter::ConversionResult<LogicalType>> converted;
+    SchemaMap schemas;
+    for (auto &entry : tables) {
+        auto &table = entry.second;
+        for (auto &column : table->columns) {
+            auto conversion = converted.find(column.snowflake_type);
+            if (conversion == converted.end()) {
+                conversion = converted
+                                 .emplace(column.snowflake_type,
+                                          SnowflakeTypeConverter::ConvertSnowflakeToDuckDB(column.snowflake_type))
+                                 .first;
+            }
+            if (conversion->second.IsValid()) {
+                column.type = conversion->second.GetValue();
+            } else {
+                column.error = conversion->second.GetError();
+            }
+        }
+        auto &info = schemas[table->schema];
+        if (!info) {
+            info = std::make_shared<SnowflakeSchemaInfo>();
+            info->name = table->schema;
+        }
+        info->tables[table->name] = table;
+    }
+    type_conversions_ += converted.size();
+    return {std::move(schemas), ""};
+}
+
+void SnowflakeSchemaCache::Invalidate(const SnowflakeConfig &config) {
+    auto prefix = ConnectionKey(config);
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto entry = slots_.begin(); entry != slots_.end();) {
+        if (StringUtil::StartsWith(entry->first, prefix)) {
+            entry = slots_.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+}
+
+void SnowflakeSchemaCache::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    // Loads in flight finish into their own slot, which is no longer reachable
+    slots_.clear();
+}
+
+SnowflakeSchemaCacheMetrics SnowflakeSchemaCache::GetMetrics() const {
+    SnowflakeSchemaCacheMetrics metrics;
+    metrics.hits = hits_;
+    metrics.misses = misses_;
+    metrics.loads = loads_;
+    metrics.type_conversions = type_conversions_;
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto &entry : slots_) {
+        std::lock_guard<std::mutex> slot_guard(entry.second->lock);
+        metrics.schemas += entry.second->info ? 1 : 0;
+    }
+    return metrics;
+}
+
+std::string SnowflakeSchemaCache::BuildColumnsQuery(const std::string &database, const std::string &schema) {
+    std::string sql = "SELECT TABLE_SCHEMA, TABLE_NAME, COLUMN_NAME, DATA_TYPE, NUMERIC_PRECISION, NUMERIC_SCALE, "
+                      "DATETIME_PRECISION, CHARACTER_MAXIMUM_LENGTH, IS_NULLABLE FROM ";
+    if (!database.empty()) {
+        sql += DatabaseIdentifier(database) + ".";
+    }
+    sql += "INFORMATION_SCHEMA.COLUMNS";
+    if (!schema.empty()) {
+        sql += " WHERE TABLE_SCHEMA = " + SnowflakeTypeConverter::RenderLiteral(Value(schema)).GetValue();
+    }
+    return sql + " ORDER BY TABLE_SCHEMA, TABLE_NAME, ORDINAL_POSITION";
+}
+
+std::string SnowflakeSchemaCache::QualifiedName(const std::string &database, const std::string &schema,
+                                                const std::string &table) {
+    auto name = SnowflakeTypeConverter::QuoteIdentifier(schema) + "." + SnowflakeTypeConverter::QuoteIdentifier(table);
+    return database.empty() ? name : DatabaseIdentifier(database) + "." + name;
+}
+
+std::string SnowflakeSchemaCache::ColumnType(const std::string &data_type, int64_t numeric_precision,
+                                             int64_t numeric_scale, int64_t datetime_precision,
+                                             int64_t character_length) {
+    auto type = StringUtil::Upper(data_type);
+    if ((type == "NUMBER" || type == "DECIMAL" || type == "NUMERIC") && numeric_precision > 0) {
+        auto scale = std::max<int64_t>(numeric_scale, 0);
+        return "NUMBER(" + std::to_string(numeric_precision) + "," + std::to_string(scale) + ")";
+    }
+    if ((type == "TEXT" || type == "VARCHAR") && character_length > 0) {
+        return "VARCHAR(" + std::to_string(character_length) + ")";
+    }
+    if ((type == "TIME" || StringUtil::StartsWith(type, "TIMESTAMP")) && datetime_precision >= 0) {
+        return type + "(" + std::to_string(datetime_precision) + ")";
+    }
+    return type;
+}
+
+// ===== snowflake_clear_cache() =====
+
+namespace {
+
+struct ClearCacheState : public GlobalTableFunctionState {
+    bool done = false;
+};
+
+unique_ptr<FunctionData> ClearCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                        vector<LogicalType> &return_types, vector<string> &names) {
+    names = {"success"};
+    return_types = {LogicalType::BOOLEAN};
+    return make_uniq<TableFunctionData>();
+}
+
+unique_ptr<GlobalTableFunctionState> ClearCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<ClearCacheState>();
+}
+
+void ClearCacheExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+    auto &state = input.global_state->Cast<ClearCacheState>();
+    if (state.done) {
+        output.SetCardinality(0);
+        return;
+    }
+    state.done = true;
+
+    SnowflakeSchemaCache::Get().Clear();
+    SnowflakeResultCache::Get().Clear();
+    output.SetValue(0, 0, Value::BOOLEAN(true));
+    output.SetCardinality(1);
+}
+
+} // namespace
+
+TableFunction SnowflakeClearCacheFunction::GetFunction() {
+    return TableFunction("snowflake_clear_cache", {}, ClearCacheExecute, ClearCacheBind, ClearCacheInit);
+}
+
+} // namespace duckdb
\ No newline at end of file
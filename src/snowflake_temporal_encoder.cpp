@@ -0,0 +1,370 @@
+#include "include/snowflake_temporal_encoder.hpp"
+#include <arrow/buffer.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace duckdb {
+
+namespace {
+
+using ArrayDataPtr = std::shared_ptr<arrow::ArrayData>;
+using BufferPtr = std::shared_ptr<arrow::Buffer>;
+
+constexpr int64_t POWERS_OF_TEN[] = {1LL,       10LL,       100LL,       1000LL,       10000LL,
+                                     100000LL,  1000000LL,  10000000LL,  100000000LL,  1000000000LL};
+constexpr int32_t MICROS_SCALE = 6;
+constexpr int32_t NANOS_SCALE = 9;
+
+/**
+ * @brief Power of ten per second of a DuckDB TIME / TIMESTAMP variant, or -1
+ */
+int32_t ScaleOfTemporalType(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return 0;
+        case LogicalTypeId::TIMESTAMP_MS:
+            return 3;
+        case LogicalTypeId::TIMESTAMP_NS:
+            return NANOS_SCALE;
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+            return MICROS_SCALE;
+        default:
+            return -1;
+    }
+}
+
+inline int64_t FloorDivide(int64_t value, int64_t divisor) {
+    return value / divisor - static_cast<int64_t>(value % divisor < 0);
+}
+
+// ===== LAYOUTS =====
+
+enum class TemporalLayout : uint8_t {
+    SCALED,               // int64 scaled by 10^scale
+    EPOCH_FRACTION,       // {epoch, fraction}
+    SCALED_EPOCH_TZ,      // {epoch scaled by 10^scale, timezone}
+    EPOCH_FRACTION_TZ     // {epoch, fraction, timezone}
+};
+
+TemporalLayout ChooseLayout(const LogicalType& source_type, SnowflakeTimestampKind kind, int32_t scale) {
+    if (source_type.id() == LogicalTypeId::TIME) {
+        return TemporalLayout::SCALED;
+    }
+    if (kind == SnowflakeTimestampKind::TZ) {
+        return scale <= SnowflakeTemporalEncoder::MAX_COMPACT_TZ_SCALE ? TemporalLayout::SCALED_EPOCH_TZ
+                                                                        : TemporalLayout::EPOCH_FRACTION_TZ;
+    }
+    return scale <= SnowflakeTemporalEncoder::MAX_SCALED_TIMESTAMP_SCALE ? TemporalLayout::SCALED
+                                                                          : TemporalLayout::EPOCH_FRACTION;
+}
+
+const std::shared_ptr<arrow::DataType>& GetLayoutType(TemporalLayout layout) {
+    static const std::shared_ptr<arrow::DataType> layout_types[] = {
+        arrow::int64(),
+        arrow::struct_({arrow::field("epoch", arrow::int64()), arrow::field("fraction", arrow::int32())}),
+        arrow::struct_({arrow::field("epoch", arrow::int64()), arrow::field("timezone", arrow::int32())}),
+        arrow::struct_({arrow::field("epoch", arrow::int64()), arrow::field("fraction", arrow::int32()),
+                        arrow::field("timezone", arrow::int32())})};
+    return layout_types[static_cast<uint8_t>(layout)];
+}
+
+std::string SnowflakeTypeName(const LogicalType& source_type, SnowflakeTimestampKind kind, int32_t scale) {
+    std::string name;
+    if (source_type.id() == LogicalTypeId::TIME) {
+        name = "TIME";
+    } else if (kind == SnowflakeTimestampKind::NTZ) {
+        name = "TIMESTAMP_NTZ";
+    } else if (kind == SnowflakeTimestampKind::LTZ) {
+        name = "TIMESTAMP_LTZ";
+    } else {
+        name = "TIMESTAMP_TZ";
+    }
+    return name + "(" + std::to_string(scale) + ")";
+}
+
+// ===== GATHER =====
+
+/**
+ * @brief Validity of the gathered rows in Arrow form
+ */
+struct GatheredValidity {
+    BufferPtr bitmap;          // nullptr when every row is valid
+    int64_t null_count = 0;
+};
+
+/**
+ * @brief Copy the int64 ticks of any vector type into a dense buffer
+ *
+ * Rows without a value receive the ticks of a valid row, so later min/max
+ * passes and offset lookups can run over the whole batch without consulting
+ * the validity again.
+ */
+arrow::Result<GatheredValidity> GatherTicks(Vector& source, idx_t count, int64_t* ticks, arrow::MemoryPool* pool) {
+    GatheredValidity result;
+    UnifiedVectorFormat format;
+    source.ToUnifiedFormat(count, format);
+    auto data = UnifiedVectorFormat::GetData<int64_t>(format);
+    if (source.GetVectorType() == VectorType::FLAT_VECTOR) {
+        std::memcpy(ticks, data, count * sizeof(int64_t));
+    } else {
+        for (idx_t i = 0; i < count; i++) {
+            ticks[i] = data[format.sel->get_index(i)];
+        }
+    }
+    if (format.validity.AllValid()) {
+        return result;
+    }
+
+    auto word_count = (count + 63) / 64;
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, arrow::AllocateBuffer(static_cast<int64_t>(word_count * sizeof(validity_t)),
+                                                             pool));
+    auto words = reinterpret_cast<validity_t*>(bitmap->mutable_data());
+    int64_t valid_count = 0;
+    idx_t first_valid = count;
+    for (idx_t base = 0; base < count; base += 64) {
+        auto limit = MinValue<idx_t>(64, count - base);
+        validity_t word = 0;
+        for (idx_t bit = 0; bit < limit; bit++) {
+            word |= static_cast<validity_t>(format.validity.RowIsValid(format.sel->get_index(base + bit))) << bit;
+        }
+        words[base / 64] = word;
+        valid_count += __builtin_popcountll(word);
+        if (first_valid == count && word != 0) {
+            first_valid = base + static_cast<idx_t>(__builtin_ctzll(word));
+        }
+    }
+    result.null_count = static_cast<int64_t>(count) - valid_count;
+    if (result.null_count == 0) {
+        return result;
+    }
+    auto filler = first_valid < count ? ticks[first_valid] : 0;
+    for (idx_t i = 0; i < count; i++) {
+        auto valid = (words[i / 64] >> (i % 64)) & 1;
+        ticks[i] = valid ? ticks[i] : filler;
+    }
+    result.bitmap = BufferPtr(std::move(bitmap));
+    return result;
+}
+
+// ===== KERNELS =====
+
+/**
+ * @brief Rescale ticks in place from one power of ten to another (flooring)
+ * @return Row whose value overflowed, or count
+ */
+idx_t RescaleTicks(int64_t* ticks, idx_t count, int32_t source_scale, int32_t target_scale) {
+    if (target_scale < source_scale) {
+        auto divisor = POWERS_OF_TEN[source_scale - target_scale];
+        for (idx_t i = 0; i < count; i++) {
+            ticks[i] = FloorDivide(ticks[i], divisor);
+        }
+        return count;
+    }
+    if (target_scale == source_scale) {
+        return count;
+    }
+    auto multiplier = POWERS_OF_TEN[target_scale - source_scale];
+    int64_t min_value = std::numeric_limits<int64_t>::max();
+    int64_t max_value = std::numeric_limits<int64_t>::min();
+    for (idx_t i = 0; i < count; i++) {
+        min_value = std::min(min_value, ticks[i]);
+        max_value = std::max(max_value, ticks[i]);
+    }
+    auto limit = std::numeric_limits<int64_t>::max() / multiplier;
+    if (min_value < -limit || max_value > limit) {
+        for (idx_t i = 0; i < count; i++) {
+            if (ticks[i] < -limit || ticks[i] > limit) {
+                return i;
+            }
+        }
+    }
+    for (idx_t i = 0; i < count; i++) {
+        ticks[i] *= multiplier;
+    }
+    return count;
+}
+
+/**
+ * @brief Split ticks in place into whole epoch seconds and a nanosecond fraction
+ */
+void SplitEpochFraction(int64_t* ticks, idx_t count, int32_t source_scale, int32_t target_scale,
+                        int32_t* fraction) {
+    auto unit = POWERS_OF_TEN[source_scale];
+    auto to_nanos = static_cast<int32_t>(POWERS_OF_TEN[NANOS_SCALE - source_scale]);
+    // Digits beyond the column scale are dropped; the fraction is non-negative
+    // so truncation is a floor
+    auto truncate = static_cast<int32_t>(POWERS_OF_TEN[NANOS_SCALE - MinValue(source_scale, target_scale)]);
+    for (idx_t i = 0; i < count; i++) {
+        auto epoch = FloorDivide(ticks[i], unit);
+        auto nanos = static_cast<int32_t>(ticks[i] - epoch * unit) * to_nanos;
+        fraction[i] = nanos - nanos % truncate;
+        ticks[i] = epoch;
+    }
+}
+
+/**
+ * @brief Snowflake timezone column: biased offsets of every row
+ */
+void EncodeTimezones(const int64_t* ticks, idx_t count, int32_t source_scale, TimezoneOffsetCache* timezone,
+                     int32_t* target) {
+    if (!timezone) {
+        std::fill(target, target + count, SnowflakeTemporalEncoder::TIMEZONE_BIAS_MINUTES);
+        return;
+    }
+    if (source_scale == MICROS_SCALE) {
+        timezone->Resolve(ticks, count, target);
+    } else {
+        std::vector<int64_t> micros(ticks, ticks + count);
+        if (source_scale > MICROS_SCALE) {
+            RescaleTicks(micros.data(), count, source_scale, MICROS_SCALE);
+        } else {
+            // Second and millisecond instants always fit in microseconds for
+            // DuckDB's timestamp range; saturate anything beyond it
+            auto multiplier = POWERS_OF_TEN[MICROS_SCALE - source_scale];
+            for (auto& value : micros) {
+                int64_t scaled;
+                value = __builtin_mul_overflow(value, multiplier, &scaled)
+                            ? (value < 0 ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max())
+                            : scaled;
+            }
+        }
+        timezone->Resolve(micros.data(), count, target);
+    }
+    for (idx_t i = 0; i < count; i++) {
+        target[i] += SnowflakeTemporalEncoder::TIMEZONE_BIAS_MINUTES;
+    }
+}
+
+arrow::Result<ArrayDataPtr> EncodeTemporal(Vector& source, idx_t count, SnowflakeTimestampKind kind, int32_t scale,
+                                           TimezoneOffsetCache* timezone, arrow::MemoryPool* pool) {
+    auto& source_type = source.GetType();
+    auto source_scale = ScaleOfTemporalType(source_type);
+    if (source_scale < 0) {
+        return arrow::Status::NotImplemented("No temporal encoding for " + source_type.ToString());
+    }
+    if (scale < 0 || scale > NANOS_SCALE) {
+        return arrow::Status::Invalid("Snowflake temporal scale must be in [0, 9], got " + std::to_string(scale));
+    }
+    auto layout = ChooseLayout(source_type, kind, scale);
+    auto length = static_cast<int64_t>(count);
+
+    ARROW_ASSIGN_OR_RAISE(auto epoch_buffer, arrow::AllocateBuffer(length * static_cast<int64_t>(sizeof(int64_t)),
+                                                                   pool));
+    auto ticks = reinterpret_cast<int64_t*>(epoch_buffer->mutable_data());
+    ARROW_ASSIGN_OR_RAISE(auto validity, GatherTicks(source, count, ticks, pool));
+
+    // The timezone is looked up from the instant before it is rescaled or split
+    BufferPtr timezone_buffer;
+    if (layout == TemporalLayout::SCALED_EPOCH_TZ || layout == TemporalLayout::EPOCH_FRACTION_TZ) {
+        ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(length * static_cast<int64_t>(sizeof(int32_t)),
+                                                                 pool));
+        EncodeTimezones(ticks, count, source_scale, timezone, reinterpret_cast<int32_t*>(buffer->mutable_data()));
+        timezone_buffer = BufferPtr(std::move(buffer));
+    }
+
+    BufferPtr fraction_buffer;
+    if (layout == TemporalLayout::EPOCH_FRACTION || layout == TemporalLayout::EPOCH_FRACTION_TZ) {
+        ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(length * static_cast<int64_t>(sizeof(int32_t)),
+                                                                 pool));
+        SplitEpochFraction(ticks, count, source_scale, scale, reinterpret_cast<int32_t*>(buffer->mutable_data()));
+        fraction_buffer = BufferPtr(std::move(buffer));
+    } else {
+        auto failed_row = RescaleTicks(ticks, count, source_scale, scale);
+        if (failed_row < count) {
+            return arrow::Status::Invalid("Value at row " + std::to_string(failed_row) + " is out of range for " +
+                                          SnowflakeTypeName(source_type, kind, scale));
+        }
+    }
+
+    auto& type = GetLayoutType(layout);
+    auto epoch_data = arrow::ArrayData::Make(arrow::int64(), length, {nullptr, BufferPtr(std::move(epoch_buffer))}, 0);
+    if (layout == TemporalLayout::SCALED) {
+        epoch_data->type = type;
+        epoch_data->buffers[0] = validity.bitmap;
+        epoch_data->null_count = validity.null_count;
+        return epoch_data;
+    }
+    std::vector<ArrayDataPtr> children {epoch_data};
+    if (fraction_buffer) {
+        children.push_back(arrow::ArrayData::Make(arrow::int32(), length, {nullptr, fraction_buffer}, 0));
+    }
+    if (timezone_buffer) {
+        children.push_back(arrow::ArrayData::Make(arrow::int32(), length, {nullptr, timezone_buffer}, 0));
+    }
+    return arrow::ArrayData::Make(type, length, {validity.bitmap}, std::move(children), validity.null_count);
+}
+
+} // namespace
+
+// ===== TIMEZONE OFFSET CACHE =====
+
+TimezoneOffsetCache::TimezoneOffsetCache(TimezoneOffsetLookup lookup) : lookup_(std::move(lookup)) {
+}
+
+TimezoneOffsetCache TimezoneOffsetCache::Fixed(int32_t offset_minutes) {
+    return TimezoneOffsetCache([offset_minutes](int64_t) {
+        return TimezoneOffsetSpan {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                                   offset_minutes};
+    });
+}
+
+const TimezoneOffsetSpan& TimezoneOffsetCache::Find(int64_t micros) {
+    for (idx_t i = 0; i < span_count_; i++) {
+        if (spans_[i].Contains(micros)) {
+            return spans_[i];
+        }
+    }
+    auto slot = next_slot_;
+    next_slot_ = (next_slot_ + 1) % CACHED_SPANS;
+    span_count_ = MinValue<idx_t>(span_count_ + 1, CACHED_SPANS);
+    spans_[slot] = lookup_(micros);
+    lookup_count_++;
+    return spans_[slot];
+}
+
+void TimezoneOffsetCache::Resolve(const int64_t* micros, idx_t count, int32_t* offsets) {
+    if (count == 0) {
+        return;
+    }
+    int64_t min_value = micros[0];
+    int64_t max_value = micros[0];
+    for (idx_t i = 1; i < count; i++) {
+        min_value = std::min(min_value, micros[i]);
+        max_value = std::max(max_value, micros[i]);
+    }
+    auto& span = Find(min_value);
+    if (span.Contains(max_value)) {
+        std::fill(offsets, offsets + count, span.offset_minutes);
+        return;
+    }
+    for (idx_t i = 0; i < count; i++) {
+        offsets[i] = Find(micros[i]).offset_minutes;
+    }
+}
+
+// ===== ENCODER =====
+
+std::shared_ptr<arrow::DataType> SnowflakeTemporalEncoder::GetArrowType(const LogicalType& source_type,
+                                                                        SnowflakeTimestampKind kind,
+                                                                        int32_t scale) {
+    if (ScaleOfTemporalType(source_type) < 0 || scale < 0 || scale > NANOS_SCALE) {
+        return nullptr;
+    }
+    return GetLayoutType(ChooseLayout(source_type, kind, scale));
+}
+
+SnowflakeTemporalEncoder::ConversionResult<std::shared_ptr<arrow::Array>>
+SnowflakeTemporalEncoder::Encode(Vector& source, idx_t count, SnowflakeTimestampKind kind, int32_t scale,
+                                 TimezoneOffsetCache* timezone, arrow::MemoryPool* pool) {
+    auto data = EncodeTemporal(source, count, kind, scale, timezone, pool);
+    if (!data.ok()) {
+        return ConversionResult<std::shared_ptr<arrow::Array>>::Error(data.status().ToString());
+    }
+    return ConversionResult<std::shared_ptr<arrow::Array>>::Success(arrow::MakeArray(data.MoveValueUnsafe()));
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,581 @@
+#include "include/snowflake_type_parser.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+namespace {
+
+// ===== KEYWORDS =====
+
+enum class Keyword : uint8_t {
+    UNKNOWN,
+    NUMBER,
+    INTEGER_ALIAS,
+    FLOAT_ALIAS,
+    DOUBLE,
+    CHAR,
+    TEXT_ALIAS,
+    BINARY_ALIAS,
+    BOOLEAN,
+    DATE,
+    TIME,
+    TIMESTAMP,
+    TIMESTAMP_NTZ,
+    TIMESTAMP_LTZ,
+    TIMESTAMP_TZ,
+    VARIANT,
+    OBJECT,
+    ARRAY,
+    MAP,
+    GEOSPATIAL,
+    VECTOR,
+    NOT,
+    NULL_,
+    COLLATE,
+    WITH,
+    WITHOUT,
+    LOCAL,
+    ZONE,
+    PRECISION,
+    VARYING
+};
+
+struct KeywordEntry {
+    std::string_view name;
+    Keyword keyword;
+};
+
+constexpr KeywordEntry KEYWORDS[] = {
+    {"NUMBER", Keyword::NUMBER},           {"DECIMAL", Keyword::NUMBER},
+    {"NUMERIC", Keyword::NUMBER},          {"DEC", Keyword::NUMBER},
+    {"INT", Keyword::INTEGER_ALIAS},       {"INTEGER", Keyword::INTEGER_ALIAS},
+    {"BIGINT", Keyword::INTEGER_ALIAS},    {"SMALLINT", Keyword::INTEGER_ALIAS},
+    {"TINYINT", Keyword::INTEGER_ALIAS},   {"BYTEINT", Keyword::INTEGER_ALIAS},
+    {"FLOAT", Keyword::FLOAT_ALIAS},       {"FLOAT4", Keyword::FLOAT_ALIAS},
+    {"FLOAT8", Keyword::FLOAT_ALIAS},      {"REAL", Keyword::FLOAT_ALIAS},
+    {"DOUBLE", Keyword::DOUBLE},           {"CHAR", Keyword::CHAR},
+    {"CHARACTER", Keyword::CHAR},          {"NCHAR", Keyword::CHAR},
+    {"VARCHAR", Keyword::TEXT_ALIAS},      {"STRING", Keyword::TEXT_ALIAS},
+    {"TEXT", Keyword::TEXT_ALIAS},         {"NVARCHAR", Keyword::TEXT_ALIAS},
+    {"NVARCHAR2", Keyword::TEXT_ALIAS},    {"BINARY", Keyword::BINARY_ALIAS},
+    {"VARBINARY", Keyword::BINARY_ALIAS},  {"BOOLEAN", Keyword::BOOLEAN},
+    {"DATE", Keyword::DATE},               {"TIME", Keyword::TIME},
+    {"TIMESTAMP", Keyword::TIMESTAMP},     {"DATETIME", Keyword::TIMESTAMP_NTZ},
+    {"TIMESTAMP_NTZ", Keyword::TIMESTAMP_NTZ}, {"TIMESTAMPNTZ", Keyword::TIMESTAMP_NTZ},
+    {"TIMESTAMP_LTZ", Keyword::TIMESTAMP_LTZ}, {"TIMESTAMPLTZ", Keyword::TIMESTAMP_LTZ},
+    {"TIMESTAMP_TZ", Keyword::TIMESTAMP_TZ},   {"TIMESTAMPTZ", Keyword::TIMESTAMP_TZ},
+    {"VARIANT", Keyword::VARIANT},         {"OBJECT", Keyword::OBJECT},
+    {"ARRAY", Keyword::ARRAY},             {"MAP", Keyword::MAP},
+    {"GEOGRAPHY", Keyword::GEOSPATIAL},    {"GEOMETRY", Keyword::GEOSPATIAL},
+    {"VECTOR", Keyword::VECTOR},           {"NOT", Keyword::NOT},
+    {"NULL", Keyword::NULL_},              {"COLLATE", Keyword::COLLATE},
+    {"WITH", Keyword::WITH},               {"WITHOUT", Keyword::WITHOUT},
+    {"LOCAL", Keyword::LOCAL},             {"ZONE", Keyword::ZONE},
+    {"PRECISION", Keyword::PRECISION},     {"VARYING", Keyword::VARYING}
+};
+
+inline char ToUpperAscii(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+Keyword LookupKeyword(std::string_view word) {
+    for (auto& entry : KEYWORDS) {
+        if (entry.name.size() != word.size()) {
+            continue;
+        }
+        bool match = true;
+        for (idx_t i = 0; i < word.size() && match; i++) {
+            match = ToUpperAscii(word[i]) == entry.name[i];
+        }
+        if (match) {
+            return entry.keyword;
+        }
+    }
+    return Keyword::UNKNOWN;
+}
+
+inline bool IsIdentifierStart(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
+}
+
+inline bool IsIdentifierChar(char c) {
+    return IsIdentifierStart(c) || (c >= '0' && c <= '9') || c == '$';
+}
+
+inline bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// ===== PARSER =====
+
+class TypeSignatureParser {
+public:
+    explicit TypeSignatureParser(std::string_view input) : input_(input), pos_(0) {
+    }
+
+    SnowflakeTypeParseResult ParseAll() {
+        SnowflakeTypeParseResult result {LogicalType::INVALID, SnowflakeTypeParseError::NONE, 0, nullptr, 9};
+        SkipWhitespace();
+        if (pos_ == input_.size()) {
+            Fail(SnowflakeTypeParseError::EMPTY_INPUT, 0);
+        } else if (ParseType(result.type, 0) && SkipNotNull()) {
+            SkipWhitespace();
+            if (pos_ != input_.size()) {
+                Fail(SnowflakeTypeParseError::TRAILING_INPUT, pos_);
+            }
+        }
+        if (error_ != SnowflakeTypeParseError::NONE) {
+            result.type = LogicalType::INVALID;
+            result.error = error_;
+            result.error_offset = error_offset_;
+            result.expected = expected_;
+        }
+        result.fractional_precision = fractional_precision_;
+        return result;
+    }
+
+private:
+    bool Fail(SnowflakeTypeParseError error, idx_t offset, const char* expected = nullptr) {
+        if (error_ == SnowflakeTypeParseError::NONE) {
+            error_ = error;
+            error_offset_ = offset;
+            expected_ = expected;
+        }
+        return false;
+    }
+
+    void SkipWhitespace() {
+        while (pos_ < input_.size() && IsWhitespace(input_[pos_])) {
+            pos_++;
+        }
+    }
+
+    bool ConsumeChar(char c) {
+        SkipWhitespace();
+        if (pos_ < input_.size() && input_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool ExpectChar(char c, const char* expected) {
+        if (ConsumeChar(c)) {
+            return true;
+        }
+        return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, pos_, expected);
+    }
+
+    bool ReadIdentifier(std::string_view& out) {
+        SkipWhitespace();
+        auto start = pos_;
+        if (pos_ >= input_.size() || !IsIdentifierStart(input_[pos_])) {
+            return false;
+        }
+        while (pos_ < input_.size() && IsIdentifierChar(input_[pos_])) {
+            pos_++;
+        }
+        out = input_.substr(start, pos_ - start);
+        return true;
+    }
+
+    bool TryConsumeKeyword(Keyword keyword) {
+        auto saved = pos_;
+        std::string_view word;
+        if (ReadIdentifier(word) && LookupKeyword(word) == keyword) {
+            return true;
+        }
+        pos_ = saved;
+        return false;
+    }
+
+    bool ExpectKeyword(Keyword keyword, const char* expected) {
+        if (TryConsumeKeyword(keyword)) {
+            return true;
+        }
+        SkipWhitespace();
+        return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, pos_, expected);
+    }
+
+    bool ParseUnsigned(uint32_t& out) {
+        SkipWhitespace();
+        auto start = pos_;
+        uint64_t value = 0;
+        while (pos_ < input_.size() && input_[pos_] >= '0' && input_[pos_] <= '9') {
+            value = value * 10 + static_cast<uint64_t>(input_[pos_] - '0');
+            if (value > UINT32_MAX) {
+                return Fail(SnowflakeTypeParseError::INVALID_NUMBER, start);
+            }
+            pos_++;
+        }
+        if (pos_ == start) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, start, "number");
+        }
+        out = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    // "(n)" after text/binary types; the length has no DuckDB equivalent
+    bool SkipOptionalLength() {
+        if (!ConsumeChar('(')) {
+            return true;
+        }
+        uint32_t length;
+        return ParseUnsigned(length) && ExpectChar(')', "')'");
+    }
+
+    // "(p)" after TIME/TIMESTAMP variants; Snowflake allows 0..9. Only the
+    // outermost type's precision is reported in the result.
+    bool ParseOptionalFractionalPrecision(idx_t depth) {
+        uint32_t precision = 9;
+        if (ConsumeChar('(')) {
+            auto start = pos_;
+            if (!ParseUnsigned(precision)) {
+                return false;
+            }
+            if (precision > 9) {
+                return Fail(SnowflakeTypeParseError::INVALID_PRECISION, start);
+            }
+            if (!ExpectChar(')', "')'")) {
+                return false;
+            }
+        }
+        if (depth == 0) {
+            fractional_precision_ = static_cast<uint8_t>(precision);
+        }
+        return true;
+    }
+
+    // COLLATE 'spec' as printed by DESCRIBE TABLE for collated text columns
+    bool SkipOptionalCollate() {
+        if (!TryConsumeKeyword(Keyword::COLLATE)) {
+            return true;
+        }
+        if (!ConsumeChar('\'')) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, pos_, "collation string");
+        }
+        while (pos_ < input_.size() && input_[pos_] != '\'') {
+            pos_++;
+        }
+        if (pos_ == input_.size()) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, pos_, "closing quote");
+        }
+        pos_++;
+        return true;
+    }
+
+    bool SkipNotNull() {
+        if (!TryConsumeKeyword(Keyword::NOT)) {
+            return true;
+        }
+        return ExpectKeyword(Keyword::NULL_, "NULL");
+    }
+
+    bool ParseFieldName(std::string& name) {
+        SkipWhitespace();
+        if (pos_ < input_.size() && input_[pos_] == '"') {
+            auto start = pos_++;
+            while (true) {
+                if (pos_ >= input_.size()) {
+                    return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, start, "closing '\"'");
+                }
+                if (input_[pos_] == '"') {
+                    if (pos_ + 1 < input_.size() && input_[pos_ + 1] == '"') {
+                        name.push_back('"');
+                        pos_ += 2;
+                        continue;
+                    }
+                    pos_++;
+                    return true;
+                }
+                name.push_back(input_[pos_++]);
+            }
+        }
+        std::string_view word;
+        if (!ReadIdentifier(word)) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, pos_, "field name");
+        }
+        name.assign(word.data(), word.size());
+        return true;
+    }
+
+    bool ParseNumber(LogicalType& result) {
+        uint32_t precision = 38;
+        uint32_t scale = 0;
+        if (ConsumeChar('(')) {
+            auto precision_offset = pos_;
+            if (!ParseUnsigned(precision)) {
+                return false;
+            }
+            if (precision < 1 || precision > 38) {
+                return Fail(SnowflakeTypeParseError::INVALID_PRECISION, precision_offset);
+            }
+            if (ConsumeChar(',')) {
+                auto scale_offset = pos_;
+                if (!ParseUnsigned(scale)) {
+                    return false;
+                }
+                if (scale > precision) {
+                    return Fail(SnowflakeTypeParseError::INVALID_SCALE, scale_offset);
+                }
+            }
+            if (!ExpectChar(')', "')'")) {
+                return false;
+            }
+        }
+        result = LogicalType::DECIMAL(static_cast<uint8_t>(precision), static_cast<uint8_t>(scale));
+        return true;
+    }
+
+    bool ParseTimestampSuffix(LogicalType& result, idx_t depth) {
+        // TIMESTAMP [(p)] [WITH [LOCAL] TIME ZONE | WITHOUT TIME ZONE]
+        if (!ParseOptionalFractionalPrecision(depth)) {
+            return false;
+        }
+        if (TryConsumeKeyword(Keyword::WITH)) {
+            TryConsumeKeyword(Keyword::LOCAL);
+            if (!ExpectKeyword(Keyword::TIME, "TIME") || !ExpectKeyword(Keyword::ZONE, "ZONE")) {
+                return false;
+            }
+            result = LogicalType::TIMESTAMP_TZ;
+            return true;
+        }
+        if (TryConsumeKeyword(Keyword::WITHOUT)) {
+            if (!ExpectKeyword(Keyword::TIME, "TIME") || !ExpectKeyword(Keyword::ZONE, "ZONE")) {
+                return false;
+            }
+        }
+        result = LogicalType::TIMESTAMP;
+        return true;
+    }
+
+    bool ParseArray(LogicalType& result, idx_t depth) {
+        if (!ConsumeChar('(')) {
+            result = LogicalType::LIST(LogicalType::VARCHAR);
+            return true;
+        }
+        LogicalType child;
+        if (!ParseType(child, depth + 1) || !SkipNotNull() || !ExpectChar(')', "')'")) {
+            return false;
+        }
+        result = LogicalType::LIST(std::move(child));
+        return true;
+    }
+
+    bool ParseObject(LogicalType& result, idx_t depth) {
+        child_list_t<LogicalType> children;
+        if (ConsumeChar('(') && !ConsumeChar(')')) {
+            do {
+                std::string name;
+                LogicalType child;
+                if (!ParseFieldName(name) || !ParseType(child, depth + 1) || !SkipNotNull()) {
+                    return false;
+                }
+                children.emplace_back(std::move(name), std::move(child));
+            } while (ConsumeChar(','));
+            if (!ExpectChar(')', "',' or ')'")) {
+                return false;
+            }
+        }
+        result = LogicalType::STRUCT(std::move(children));
+        return true;
+    }
+
+    bool ParseMap(LogicalType& result, idx_t depth) {
+        if (!ConsumeChar('(')) {
+            result = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR);
+            return true;
+        }
+        LogicalType key;
+        LogicalType value;
+        if (!ParseType(key, depth + 1) || !ExpectChar(',', "','") ||
+            !ParseType(value, depth + 1) || !SkipNotNull() || !ExpectChar(')', "')'")) {
+            return false;
+        }
+        result = LogicalType::MAP(std::move(key), std::move(value));
+        return true;
+    }
+
+    bool ParseVector(LogicalType& result) {
+        // VECTOR(INT | FLOAT, dimension)
+        if (!ExpectChar('(', "'('")) {
+            return false;
+        }
+        SkipWhitespace();
+        auto element_offset = pos_;
+        std::string_view element_name;
+        if (!ReadIdentifier(element_name)) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, element_offset, "INT or FLOAT");
+        }
+        LogicalType element;
+        switch (LookupKeyword(element_name)) {
+            case Keyword::INTEGER_ALIAS: element = LogicalType::INTEGER; break;
+            case Keyword::FLOAT_ALIAS:   element = LogicalType::FLOAT; break;
+            default:
+                return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, element_offset, "INT or FLOAT");
+        }
+        uint32_t dimension;
+        if (!ExpectChar(',', "','")) {
+            return false;
+        }
+        auto dimension_offset = pos_;
+        if (!ParseUnsigned(dimension)) {
+            return false;
+        }
+        if (dimension == 0 || dimension > 4096) {
+            return Fail(SnowflakeTypeParseError::INVALID_NUMBER, dimension_offset);
+        }
+        if (!ExpectChar(')', "')'")) {
+            return false;
+        }
+        result = LogicalType::ARRAY(element, dimension);
+        return true;
+    }
+
+    bool ParseType(LogicalType& result, idx_t depth) {
+        if (depth >= SnowflakeTypeParser::MAX_NESTING_DEPTH) {
+            return Fail(SnowflakeTypeParseError::NESTING_TOO_DEEP, pos_);
+        }
+        SkipWhitespace();
+        auto start = pos_;
+        std::string_view name;
+        if (!ReadIdentifier(name)) {
+            return Fail(SnowflakeTypeParseError::EXPECTED_TOKEN, start, "type name");
+        }
+        switch (LookupKeyword(name)) {
+            case Keyword::NUMBER:
+                return ParseNumber(result);
+            case Keyword::INTEGER_ALIAS:
+                // Snowflake integer aliases are all NUMBER(38,0)
+                result = LogicalType::DECIMAL(38, 0);
+                return true;
+            case Keyword::DOUBLE:
+                TryConsumeKeyword(Keyword::PRECISION);
+                result = LogicalType::DOUBLE;
+                return true;
+            case Keyword::FLOAT_ALIAS:
+                // Every Snowflake floating point type is 64-bit
+                result = LogicalType::DOUBLE;
+                return true;
+            case Keyword::CHAR:
+                TryConsumeKeyword(Keyword::VARYING);
+                // fallthrough
+            case Keyword::TEXT_ALIAS:
+                if (!SkipOptionalLength() || !SkipOptionalCollate()) {
+                    return false;
+                }
+                result = LogicalType::VARCHAR;
+                return true;
+            case Keyword::BINARY_ALIAS:
+                if (!SkipOptionalLength()) {
+                    return false;
+                }
+                result = LogicalType::BLOB;
+                return true;
+            case Keyword::BOOLEAN:
+                result = LogicalType::BOOLEAN;
+                return true;
+            case Keyword::DATE:
+                result = LogicalType::DATE;
+                return true;
+            case Keyword::TIME:
+                if (!ParseOptionalFractionalPrecision(depth)) {
+                    return false;
+                }
+                result = LogicalType::TIME;
+                return true;
+            case Keyword::TIMESTAMP:
+                return ParseTimestampSuffix(result, depth);
+            case Keyword::TIMESTAMP_NTZ:
+                if (!ParseOptionalFractionalPrecision(depth)) {
+                    return false;
+                }
+                result = LogicalType::TIMESTAMP;
+                return true;
+            case Keyword::TIMESTAMP_LTZ:
+            case Keyword::TIMESTAMP_TZ:
+                if (!ParseOptionalFractionalPrecision(depth)) {
+                    return false;
+                }
+                result = LogicalType::TIMESTAMP_TZ;
+                return true;
+            case Keyword::VARIANT:
+                // VARIANT → VARCHAR (semi-structured payload arrives as JSON text)
+                result = LogicalType::VARCHAR;
+                return true;
+            case Keyword::GEOSPATIAL:
+                result = LogicalType::VARCHAR;
+                return true;
+            case Keyword::ARRAY:
+                return ParseArray(result, depth);
+            case Keyword::OBJECT:
+                return ParseObject(result, depth);
+            case Keyword::MAP:
+                return ParseMap(result, depth);
+            case Keyword::VECTOR:
+                return ParseVector(result);
+            default:
+                return Fail(SnowflakeTypeParseError::UNKNOWN_TYPE, start);
+        }
+    }
+
+    std::string_view input_;
+    idx_t pos_;
+    SnowflakeTypeParseError error_ = SnowflakeTypeParseError::NONE;
+    idx_t error_offset_ = 0;
+    const char* expected_ = nullptr;
+    uint8_t fractional_precision_ = 9;
+};
+
+} // namespace
+
+SnowflakeTypeParseResult SnowflakeTypeParser::Parse(std::string_view input) {
+    return TypeSignatureParser(input).ParseAll();
+}
+
+LogicalType SnowflakeTypeParseResult::ExactTemporalType() const {
+    if (type.id() != LogicalTypeId::TIMESTAMP) {
+        return type;
+    }
+    if (fractional_precision == 0) {
+        return LogicalType::TIMESTAMP_S;
+    }
+    if (fractional_precision <= 3) {
+        return LogicalType::TIMESTAMP_MS;
+    }
+    return fractional_precision <= 6 ? type : LogicalType::TIMESTAMP_NS;
+}
+
+std::string SnowflakeTypeParseResult::FormatError(std::string_view input) const {
+    std::string text(input);
+    switch (error) {
+        case SnowflakeTypeParseError::NONE:
+            return "";
+        case SnowflakeTypeParseError::EMPTY_INPUT:
+            return "Unsupported Snowflake type: empty type string";
+        case SnowflakeTypeParseError::UNKNOWN_TYPE:
+            return StringUtil::Format("Unsupported Snowflake type: %s (unknown type name at offset %llu)",
+                                      text, static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::EXPECTED_TOKEN:
+            return StringUtil::Format("Invalid Snowflake type '%s': expected %s at offset %llu", text,
+                                      expected ? expected : "token", static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::INVALID_NUMBER:
+            return StringUtil::Format("Invalid Snowflake type '%s': number out of range at offset %llu", text,
+                                      static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::INVALID_PRECISION:
+            return StringUtil::Format("Invalid Snowflake type '%s': precision out of range at offset %llu", text,
+                                      static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::INVALID_SCALE:
+            return StringUtil::Format("Invalid Snowflake type '%s': scale exceeds precision at offset %llu", text,
+                                      static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::TRAILING_INPUT:
+            return StringUtil::Format("Invalid Snowflake type '%s': unexpected input at offset %llu", text,
+                                      static_cast<uint64_t>(error_offset));
+        case SnowflakeTypeParseError::NESTING_TOO_DEEP:
+            return StringUtil::Format("Invalid Snowflake type '%s': nesting deeper than %llu levels", text,
+                                      static_cast<uint64_t>(SnowflakeTypeParser::MAX_NESTING_DEPTH));
+    }
+    return "Invalid Snowflake type: " + text;
+}
+
+} // namespace duckdb
@@ -0,0 +1,152 @@
+#include "include/type_conversion_cache.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include <functional>
+#include <thread>
+
+namespace duckdb {
+
+// ===== STRUCTURAL HASH =====
+
+hash_t HashLogicalTypeStructure(const LogicalType& type) {
+    hash_t hash = Hash<uint8_t>(static_cast<uint8_t>(type.id()));
+    switch (type.id()) {
+        case LogicalTypeId::DECIMAL:
+            hash = CombineHash(hash, Hash<uint8_t>(DecimalType::GetWidth(type)));
+            hash = CombineHash(hash, Hash<uint8_t>(DecimalType::GetScale(type)));
+            break;
+        case LogicalTypeId::LIST:
+            hash = CombineHash(hash, HashLogicalTypeStructure(ListType::GetChildType(type)));
+            break;
+        case LogicalTypeId::ARRAY:
+            hash = CombineHash(hash, HashLogicalTypeStructure(ArrayType::GetChildType(type)));
+            hash = CombineHash(hash, Hash<uint64_t>(ArrayType::GetSize(type)));
+            break;
+        case LogicalTypeId::MAP:
+            hash = CombineHash(hash, HashLogicalTypeStructure(MapType::KeyType(type)));
+            hash = CombineHash(hash, HashLogicalTypeStructure(MapType::ValueType(type)));
+            break;
+        case LogicalTypeId::STRUCT:
+            for (auto& child : StructType::GetChildTypes(type)) {
+                hash = CombineHash(hash, Hash(child.first.c_str(), child.first.size()));
+                hash = CombineHash(hash, HashLogicalTypeStructure(child.second));
+            }
+            break;
+        case LogicalTypeId::UNION:
+            for (idx_t i = 0; i < UnionType::GetMemberCount(type); i++) {
+                auto& member_name = UnionType::GetMemberName(type, i);
+                hash = CombineHash(hash, Hash(member_name.c_str(), member_name.size()));
+                hash = CombineHash(hash, HashLogicalTypeStructure(UnionType::GetMemberType(type, i)));
+            }
+            break;
+        default:
+            break;
+    }
+    return hash;
+}
+
+// ===== CACHE =====
+
+static idx_t NextPowerOfTwo(idx_t value) {
+    idx_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+TypeConversionCache::TypeConversionCache(idx_t capacity)
+    : capacity_(capacity), size_(0), insertions_(0), rejected_(0) {
+    // Keep the load factor at or below 50% so probe chains stay short
+    auto slot_count = NextPowerOfTwo(MaxValue<idx_t>(capacity * 2, MAX_PROBE));
+    mask_ = slot_count - 1;
+    slots_ = std::unique_ptr<std::atomic<const CachedTypeConversion*>[]>(
+        new std::atomic<const CachedTypeConversion*>[slot_count]);
+    for (idx_t i = 0; i < slot_count; i++) {
+        slots_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+TypeConversionCache::~TypeConversionCache() {
+    for (idx_t i = 0; i <= mask_; i++) {
+        delete slots_[i].load(std::memory_order_relaxed);
+    }
+}
+
+TypeConversionCache::CounterStripe& TypeConversionCache::LocalStripe() const {
+    thread_local const idx_t stripe = std::hash<std::thread::id>()(std::this_thread::get_id()) % COUNTER_STRIPES;
+    return stripes_[stripe];
+}
+
+const CachedTypeConversion* TypeConversionCache::Probe(const LogicalType& type, hash_t hash) const {
+    for (idx_t i = 0; i < MAX_PROBE; i++) {
+        auto entry = slots_[(hash + i) & mask_].load(std::memory_order_acquire);
+        if (!entry) {
+            // Insert-only table: an empty slot terminates every probe chain
+            return nullptr;
+        }
+        if (entry->hash == hash && entry->type == type) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+const CachedTypeConversion* TypeConversionCache::Lookup(const LogicalType& type) const {
+    auto entry = Probe(type, HashLogicalTypeStructure(type));
+    auto& stripe = LocalStripe();
+    if (entry) {
+        stripe.hits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        stripe.misses.fetch_add(1, std::memory_order_relaxed);
+    }
+    return entry;
+}
+
+const CachedTypeConversion* TypeConversionCache::GetOrCreate(const LogicalType& type, EntryFactory factory) {
+    auto hash = HashLogicalTypeStructure(type);
+    auto& stripe = LocalStripe();
+    auto existing = Probe(type, hash);
+    if (existing) {
+        stripe.hits.fetch_add(1, std::memory_order_relaxed);
+        return existing;
+    }
+    stripe.misses.fetch_add(1, std::memory_order_relaxed);
+
+    if (size_.load(std::memory_order_relaxed) >= capacity_) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto created = factory(type, hash);
+    for (idx_t i = 0; i < MAX_PROBE; i++) {
+        auto& slot = slots_[(hash + i) & mask_];
+        const CachedTypeConversion* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, created.get(), std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+            insertions_.fetch_add(1, std::memory_order_relaxed);
+            return created.release();
+        }
+        // Lost the race for this slot; another thread may have published the same type
+        if (expected->hash == hash && expected->type == type) {
+            return expected;
+        }
+    }
+    // Probe window exhausted; leave the type uncached
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+TypeConversionCacheStats TypeConversionCache::GetStats() const {
+    TypeConversionCacheStats stats {0, 0, 0, 0, 0, capacity_};
+    for (auto& stripe : stripes_) {
+        stats.hits += stripe.hits.load(std::memory_order_relaxed);
+        stats.misses += stripe.misses.load(std::memory_order_relaxed);
+    }
+    stats.insertions = insertions_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    stats.size = size_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace duckdb
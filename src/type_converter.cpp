@@ -1,85 +1,157 @@
 #include "include/type_converter.hpp"
+#include "include/type_registry.hpp"
+#include "include/type_conversion_cache.hpp"
+#include "include/snowflake_type_parser.hpp"
+#include "include/conversion_validator.hpp"
 #include "duckdb/common/types/decimal.hpp"
 #include "duckdb/common/string_util.hpp"
+#include <arrow/type.h>
+#include <arrow/array.h>
+#include <arrow/util/key_value_metadata.h>
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <sstream>
-
-// TODO: Add Arrow includes once available
-// #include <arrow/type.h>
-// #include <arrow/array.h>
+#include <vector>
 
 namespace duckdb {
 
+// ===== TYPE REGISTRY =====
+
+ArrowTypeTag SnowflakeTypeRegistry::GetArrowTag(const arrow::DataType& arrow_type) {
+    switch (arrow_type.id()) {
+        case arrow::Type::INT8:   return ArrowTypeTag::INT8;
+        case arrow::Type::INT16:  return ArrowTypeTag::INT16;
+        case arrow::Type::INT32:  return ArrowTypeTag::INT32;
+        case arrow::Type::INT64:  return ArrowTypeTag::INT64;
+        case arrow::Type::FLOAT:  return ArrowTypeTag::FLOAT32;
+        case arrow::Type::DOUBLE: return ArrowTypeTag::FLOAT64;
+        case arrow::Type::STRING: return ArrowTypeTag::UTF8;
+        case arrow::Type::BINARY: return ArrowTypeTag::BINARY;
+        case arrow::Type::BOOL:   return ArrowTypeTag::BOOL;
+        case arrow::Type::DATE32: return ArrowTypeTag::DATE32;
+        case arrow::Type::TIME64: {
+            auto& time_type = static_cast<const arrow::Time64Type&>(arrow_type);
+            return time_type.unit() == arrow::TimeUnit::MICRO ? ArrowTypeTag::TIME64_US : ArrowTypeTag::NONE;
+        }
+        case arrow::Type::TIMESTAMP: {
+            auto& ts_type = static_cast<const arrow::TimestampType&>(arrow_type);
+            if (ts_type.unit() != arrow::TimeUnit::MICRO) {
+                if (!ts_type.timezone().empty()) {
+                    return ArrowTypeTag::NONE;
+                }
+                switch (ts_type.unit()) {
+                    case arrow::TimeUnit::NANO:   return ArrowTypeTag::TIMESTAMP_NS;
+                    case arrow::TimeUnit::MILLI:  return ArrowTypeTag::TIMESTAMP_MS;
+                    default:                      return ArrowTypeTag::TIMESTAMP_S;
+                }
+            }
+            if (ts_type.timezone().empty()) {
+                return ArrowTypeTag::TIMESTAMP_US;
+            }
+            return ts_type.timezone() == "UTC" ? ArrowTypeTag::TIMESTAMP_US_UTC : ArrowTypeTag::NONE;
+        }
+        default:
+            return ArrowTypeTag::NONE;
+    }
+}
+
+const std::shared_ptr<arrow::DataType>& SnowflakeTypeRegistry::GetArrowType(ArrowTypeTag tag) {
+    // Built once; every later call is a plain array index
+    static const std::array<std::shared_ptr<arrow::DataType>, type_registry_detail::ARROW_TAG_COUNT> arrow_types = {
+        nullptr,
+        arrow::int8(),
+        arrow::int16(),
+        arrow::int32(),
+        arrow::int64(),
+        arrow::float32(),
+        arrow::float64(),
+        arrow::utf8(),
+        arrow::binary(),
+        arrow::boolean(),
+        arrow::date32(),
+        arrow::time64(arrow::TimeUnit::MICRO),
+        arrow::timestamp(arrow::TimeUnit::MICRO),
+        arrow::timestamp(arrow::TimeUnit::MICRO, "UTC"),
+        arrow::timestamp(arrow::TimeUnit::NANO),
+        arrow::timestamp(arrow::TimeUnit::MILLI),
+        arrow::timestamp(arrow::TimeUnit::SECOND)
+    };
+    return arrow_types[static_cast<uint8_t>(tag)];
+}
+
 // ===== STATIC LOOKUP TABLES =====
+// Derived from SnowflakeTypeRegistry so the string-keyed views can never drift
+// from the indexed one.
 
-const std::unordered_map<LogicalTypeId, std::string> SnowflakeTypeConverter::direct_snowflake_map_ = {
-    {LogicalTypeId::TINYINT, "NUMBER(3,0)"},
-    {LogicalTypeId::SMALLINT, "NUMBER(5,0)"},
-    {LogicalTypeId::INTEGER, "NUMBER(10,0)"},
-    {LogicalTypeId::BIGINT, "NUMBER(19,0)"},
-    {LogicalTypeId::FLOAT, "FLOAT"},
-    {LogicalTypeId::DOUBLE, "DOUBLE"},
-    {LogicalTypeId::VARCHAR, "VARCHAR"},
-    {LogicalTypeId::BLOB, "BINARY"},
-    {LogicalTypeId::BOOLEAN, "BOOLEAN"},
-    {LogicalTypeId::DATE, "DATE"},
-    {LogicalTypeId::TIME, "TIME"},
-    {LogicalTypeId::TIMESTAMP, "TIMESTAMP_NTZ"},
-    {LogicalTypeId::TIMESTAMP_TZ, "TIMESTAMP_TZ"}
-};
+static std::unordered_map<LogicalTypeId, std::string> BuildDirectSnowflakeMap() {
+    std::unordered_map<LogicalTypeId, std::string> result;
+    for (auto& entry : SnowflakeTypeRegistry::Entries()) {
+        result.emplace(entry.duckdb_id, std::string(entry.snowflake_name));
+    }
+    return result;
+}
 
-const std::unordered_map<LogicalTypeId, std::string> SnowflakeTypeConverter::arrow_equivalents_ = {
-    {LogicalTypeId::TINYINT, "int8"},
-    {LogicalTypeId::SMALLINT, "int16"},
-    {LogicalTypeId::INTEGER, "int32"},
-    {LogicalTypeId::BIGINT, "int64"},
-    {LogicalTypeId::FLOAT, "float32"},
-    {LogicalTypeId::DOUBLE, "float64"},
-    {LogicalTypeId::VARCHAR, "utf8"},
-    {LogicalTypeId::BLOB, "binary"},
-    {LogicalTypeId::BOOLEAN, "bool"},
-    {LogicalTypeId::DATE, "date32"},
-    {LogicalTypeId::TIME, "time64[us]"},
-    {LogicalTypeId::TIMESTAMP, "timestamp[us]"},
-    {LogicalTypeId::TIMESTAMP_TZ, "timestamp[us, UTC]"}
-};
+static std::unordered_map<LogicalTypeId, std::string> BuildArrowEquivalents() {
+    std::unordered_map<LogicalTypeId, std::string> result;
+    for (auto& entry : SnowflakeTypeRegistry::Entries()) {
+        result.emplace(entry.duckdb_id, std::string(entry.arrow_name));
+    }
+    return result;
+}
 
-const std::unordered_map<std::string, LogicalTypeId> SnowflakeTypeConverter::reverse_type_map_ = {
-    {"int8", LogicalTypeId::TINYINT},
-    {"int16", LogicalTypeId::SMALLINT},
-    {"int32", LogicalTypeId::INTEGER},
-    {"int64", LogicalTypeId::BIGINT},
-    {"float32", LogicalTypeId::FLOAT},
-    {"float64", LogicalTypeId::DOUBLE},
-    {"utf8", LogicalTypeId::VARCHAR},
-    {"binary", LogicalTypeId::BLOB},
-    {"bool", LogicalTypeId::BOOLEAN},
-    {"date32", LogicalTypeId::DATE},
-    {"time64[us]", LogicalTypeId::TIME},
-    {"timestamp[us]", LogicalTypeId::TIMESTAMP},
-    {"timestamp[us, UTC]", LogicalTypeId::TIMESTAMP_TZ}
+// Arrow ToString() spellings that differ from the registry's arrow_name
+static const std::pair<const char*, const char*> ARROW_SPELLINGS[] = {
+    {"string", "utf8"},
+    {"large_string", "utf8"},
+    {"string_view", "utf8"},
+    {"large_binary", "binary"},
+    {"binary_view", "binary"},
+    {"float", "float32"},
+    {"double", "float64"},
+    {"date32[day]", "date32"},
+    {"timestamp[us, tz=UTC]", "timestamp[us, UTC]"},
 };
 
+static std::unordered_map<std::string, LogicalTypeId> BuildReverseTypeMap() {
+    // Keyed by Arrow description; Snowflake spellings are parsed by SnowflakeTypeParser
+    std::unordered_map<std::string, LogicalTypeId> result;
+    for (auto& entry : SnowflakeTypeRegistry::Entries()) {
+        result.emplace(std::string(entry.arrow_name), entry.duckdb_id);
+    }
+    for (auto& spelling : ARROW_SPELLINGS) {
+        result.emplace(spelling.first, result.at(spelling.second));
+    }
+    return result;
+}
+
+const std::unordered_map<LogicalTypeId, std::string> SnowflakeTypeConverter::direct_snowflake_map_ = BuildDirectSnowflakeMap();
+const std::unordered_map<LogicalTypeId, std::string> SnowflakeTypeConverter::arrow_equivalents_ = BuildArrowEquivalents();
+const std::unordered_map<std::string, LogicalTypeId> SnowflakeTypeConverter::reverse_type_map_ = BuildReverseTypeMap();
+
 // ===== PRIMARY CONVERSION FUNCTIONS =====
 
 SnowflakeTypeConverter::ConversionResult<std::shared_ptr<arrow::DataType>>
 SnowflakeTypeConverter::ConvertDuckDBToArrow(const LogicalType& duckdb_type) {
-    // Lookup direct arrow mapping
-    auto it = arrow_equivalents_.find(duckdb_type.id());
-    if (it != arrow_equivalents_.end()) {
-        // Create Arrow type based on string description
-        if (it->second == "int8") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::int8()));
-        if (it->second == "int16") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::int16()));
-        if (it->second == "int32") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::int32()));
-        if (it->second == "int64") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::int64()));
-        if (it->second == "float32") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::float32()));
-        if (it->second == "float64") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::float64()));
-        if (it->second == "utf8") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::utf8()));
-        if (it->second == "binary") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::binary()));
-        if (it->second == "bool") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::boolean()));
-        if (it->second == "date32") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::date32()));
-        if (it->second == "time64[us]") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::time64(arrow::TimeUnit::MICRO)));
-        if (it->second == "timestamp[us]") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::timestamp(arrow::TimeUnit::MICRO)));
-        if (it->second == "timestamp[us, UTC]") return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::shared_ptr<arrow::DataType>(arrow::timestamp(arrow::TimeUnit::MICRO, "UTC")));
+    // Registry lookup: array index, no hashing
+    auto entry = SnowflakeTypeRegistry::Lookup(duckdb_type.id());
+    if (entry) {
+        auto arrow_type = SnowflakeTypeRegistry::GetArrowType(entry->arrow_tag);
+        return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::move(arrow_type));
+    }
+    auto cached = LookupCachedConversion(duckdb_type);
+    if (cached) {
+        return cached->arrow_type;
+    }
+    return ConvertDuckDBToArrowUncached(duckdb_type);
+}
+
+SnowflakeTypeConverter::ConversionResult<std::shared_ptr<arrow::DataType>>
+SnowflakeTypeConverter::ConvertDuckDBToArrowUncached(const LogicalType& duckdb_type) {
+    auto entry = SnowflakeTypeRegistry::Lookup(duckdb_type.id());
+    if (entry) {
+        auto arrow_type = SnowflakeTypeRegistry::GetArrowType(entry->arrow_tag);
+        return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(std::move(arrow_type));
     }
     // DECIMAL handling
     if (duckdb_type.id() == LogicalTypeId::DECIMAL) {
@@ -94,6 +166,47 @@ SnowflakeTypeConverter::ConvertDuckDBToArrow(const LogicalType& duckdb_type) {
             std::shared_ptr<arrow::DataType>(arrow::decimal128(precision, scale))
         );
     }
+    // Nested: children convert recursively (through the cache when enabled)
+    switch (duckdb_type.id()) {
+        case LogicalTypeId::LIST:
+        case LogicalTypeId::ARRAY: {
+            auto& child_type = duckdb_type.id() == LogicalTypeId::LIST ? ListType::GetChildType(duckdb_type)
+                                                                        : ArrayType::GetChildType(duckdb_type);
+            auto child = ConvertDuckDBToArrow(child_type);
+            if (!child.IsValid()) {
+                return ConversionResult<std::shared_ptr<arrow::DataType>>::Error("element: " + child.GetError());
+            }
+            if (duckdb_type.id() == LogicalTypeId::LIST) {
+                return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(arrow::list(child.GetValue()));
+            }
+            return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(
+                arrow::fixed_size_list(child.GetValue(), static_cast<int32_t>(ArrayType::GetSize(duckdb_type))));
+        }
+        case LogicalTypeId::MAP: {
+            auto key = ConvertDuckDBToArrow(MapType::KeyType(duckdb_type));
+            auto value = ConvertDuckDBToArrow(MapType::ValueType(duckdb_type));
+            if (!key.IsValid() || !value.IsValid()) {
+                return ConversionResult<std::shared_ptr<arrow::DataType>>::Error(
+                    key.IsValid() ? "map value: " + value.GetError() : "map key: " + key.GetError());
+            }
+            return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(
+                std::make_shared<arrow::MapType>(key.GetValue(), value.GetValue()));
+        }
+        case LogicalTypeId::STRUCT: {
+            arrow::FieldVector fields;
+            for (auto& child : StructType::GetChildTypes(duckdb_type)) {
+                auto child_type = ConvertDuckDBToArrow(child.second);
+                if (!child_type.IsValid()) {
+                    return ConversionResult<std::shared_ptr<arrow::DataType>>::Error(
+                        "field '" + child.first + "': " + child_type.GetError());
+                }
+                fields.push_back(arrow::field(child.first, child_type.GetValue()));
+            }
+            return ConversionResult<std::shared_ptr<arrow::DataType>>::Success(arrow::struct_(std::move(fields)));
+        }
+        default:
+            break;
+    }
     return ConversionResult<std::shared_ptr<arrow::DataType>>::Error(
         "Unsupported DuckDB type for Arrow conversion"
     );
@@ -101,90 +214,576 @@ SnowflakeTypeConverter::ConvertDuckDBToArrow(const LogicalType& duckdb_type) {
 
 SnowflakeTypeConverter::ConversionResult<std::string>
 SnowflakeTypeConverter::ConvertArrowToSnowflake(const std::string& arrow_type_desc) {
-    // Primitives
-    if (arrow_type_desc == "int8")   return ConversionResult<std::string>::Success("NUMBER(3,0)");
-    if (arrow_type_desc == "int16")  return ConversionResult<std::string>::Success("NUMBER(5,0)");
-    if (arrow_type_desc == "int32")  return ConversionResult<std::string>::Success("NUMBER(10,0)");
-    if (arrow_type_desc == "int64")  return ConversionResult<std::string>::Success("NUMBER(19,0)");
-    if (arrow_type_desc == "float32")return ConversionResult<std::string>::Success("FLOAT");
-    if (arrow_type_desc == "float64")return ConversionResult<std::string>::Success("DOUBLE");
-    if (arrow_type_desc == "utf8")   return ConversionResult<std::string>::Success("VARCHAR");
-    if (arrow_type_desc == "binary") return ConversionResult<std::string>::Success("BINARY");
-    if (arrow_type_desc == "bool")   return ConversionResult<std::string>::Success("BOOLEAN");
-    if (arrow_type_desc == "date32") return ConversionResult<std::string>::Success("DATE");
-    if (arrow_type_desc == "time64[us]") return ConversionResult<std::string>::Success("TIME");
-    if (arrow_type_desc == "timestamp[us]")     return ConversionResult<std::string>::Success("TIMESTAMP_NTZ");
-    if (arrow_type_desc == "timestamp[us, UTC]")return ConversionResult<std::string>::Success("TIMESTAMP_TZ");
-    // Decimal128(p,s)
-    if (arrow_type_desc.rfind("decimal128(", 0) == 0) {
-        auto params = arrow_type_desc.substr(10, arrow_type_desc.size() - 11);
-        auto comma = params.find(',');
-        auto p = params.substr(0, comma), s = params.substr(comma+1);
+    // Primitives, under their registry or Arrow spelling (including the 64-bit offset and view layouts)
+    auto it = reverse_type_map_.find(arrow_type_desc);
+    if (it != reverse_type_map_.end()) {
+        auto entry = SnowflakeTypeRegistry::Lookup(it->second);
+        return ConversionResult<std::string>::Success(std::string(entry->snowflake_name));
+    }
+    // dictionary<values=T, indices=I, ordered=B>: an encoding of T
+    const std::string dictionary_prefix = "dictionary<values=";
+    auto indices = arrow_type_desc.rfind(", indices=");
+    if (arrow_type_desc.rfind(dictionary_prefix, 0) == 0 && indices != std::string::npos) {
+        return ConvertArrowToSnowflake(
+            arrow_type_desc.substr(dictionary_prefix.size(), indices - dictionary_prefix.size()));
+    }
+    // decimal128(p,s), or decimal128(p, s) as Arrow prints it
+    const std::string decimal_prefix = "decimal128(";
+    auto comma = arrow_type_desc.find(',');
+    if (arrow_type_desc.rfind(decimal_prefix, 0) == 0 && arrow_type_desc.back() == ')' && comma != std::string::npos) {
+        auto p = arrow_type_desc.substr(decimal_prefix.size(), comma - decimal_prefix.size());
+        auto s = arrow_type_desc.substr(comma + 1, arrow_type_desc.size() - comma - 2);
+        StringUtil::Trim(p);
+        StringUtil::Trim(s);
         return ConversionResult<std::string>::Success("NUMBER(" + p + "," + s + ")");
     }
     return ConversionResult<std::string>::Error("Unsupported Arrow type: " + arrow_type_desc);
 }
 
+SnowflakeTypeConverter::ConversionResult<std::string>
+SnowflakeTypeConverter::ConvertArrowToSnowflake(const arrow::DataType& arrow_type) {
+    auto entry = SnowflakeTypeRegistry::Lookup(SnowflakeTypeRegistry::GetArrowTag(arrow_type));
+    if (entry) {
+        return ConversionResult<std::string>::Success(std::string(entry->snowflake_name));
+    }
+    if (arrow_type.id() == arrow::Type::DECIMAL128) {
+        auto& decimal_type = static_cast<const arrow::Decimal128Type&>(arrow_type);
+        return ConversionResult<std::string>::Success(
+            "NUMBER(" + std::to_string(decimal_type.precision()) + "," + std::to_string(decimal_type.scale()) + ")");
+    }
+    switch (arrow_type.id()) {
+        case arrow::Type::DICTIONARY:
+            // Dictionary encoding does not change the column type
+            return ConvertArrowToSnowflake(*static_cast<const arrow::DictionaryType&>(arrow_type).value_type());
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::STRING_VIEW:
+            return ConvertArrowToSnowflake(*arrow::utf8());
+        case arrow::Type::LARGE_BINARY:
+        case arrow::Type::BINARY_VIEW:
+            return ConvertArrowToSnowflake(*arrow::binary());
+        case arrow::Type::LIST:
+        case arrow::Type::FIXED_SIZE_LIST: {
+            auto child = ConvertArrowToSnowflake(*static_cast<const arrow::BaseListType&>(arrow_type).value_type());
+            if (!child.IsValid()) {
+                return child;
+            }
+            return ConversionResult<std::string>::Success(
+                IsSemiStructuredType(child.GetValue()) ? "ARRAY" : "ARRAY(" + child.GetValue() + ")");
+        }
+        case arrow::Type::MAP: {
+            auto& map_type = static_cast<const arrow::MapType&>(arrow_type);
+            auto key = ConvertArrowToSnowflake(*map_type.key_type());
+            auto item = ConvertArrowToSnowflake(*map_type.item_type());
+            if (!key.IsValid() || !item.IsValid()) {
+                return key.IsValid() ? item : key;
+            }
+            return BuildSnowflakeMapType(key.GetValue(), item.GetValue());
+        }
+        case arrow::Type::STRUCT: {
+            std::vector<std::pair<std::string, std::string>> fields;
+            for (auto& field : arrow_type.fields()) {
+                auto child = ConvertArrowToSnowflake(*field->type());
+                if (!child.IsValid()) {
+                    return child;
+                }
+                fields.emplace_back(field->name(), child.GetValue());
+            }
+            return ConversionResult<std::string>::Success(BuildSnowflakeObjectType(fields));
+        }
+        default:
+            break;
+    }
+    return ConversionResult<std::string>::Error("Unsupported Arrow type: " + arrow_type.ToString());
+}
+
 SnowflakeTypeConverter::ConversionResult<std::string>
 SnowflakeTypeConverter::ConvertDuckDBToSnowflake(const LogicalType& duckdb_type) {
+    // Primitives are a registry index; caching them would only add a hash
+    auto entry = SnowflakeTypeRegistry::Lookup(duckdb_type.id());
+    if (entry) {
+        return ConversionResult<std::string>::Success(std::string(entry->snowflake_name));
+    }
+    auto cached = LookupCachedConversion(duckdb_type);
+    if (cached) {
+        return cached->snowflake_type;
+    }
+    return ConvertDuckDBToSnowflakeUncached(duckdb_type);
+}
+
+SnowflakeTypeConverter::ConversionResult<std::string>
+SnowflakeTypeConverter::ConvertDuckDBToSnowflakeUncached(const LogicalType& duckdb_type) {
     // DECIMAL
     if (duckdb_type.id() == LogicalTypeId::DECIMAL) {
-        auto p = DecimalType::GetWidth(duckdb_type);
-        auto s = DecimalType::GetScale(duckdb_type);
-        return ConversionResult<std::string>::Success("NUMBER(" + std::to_string(p) + "," + std::to_string(s) + ")");
+        auto adjustment = AdjustDecimalForSnowflake(DecimalType::GetWidth(duckdb_type),
+                                                    DecimalType::GetScale(duckdb_type));
+        return ConversionResult<std::string>::Success("NUMBER(" + std::to_string(adjustment.adjusted_precision) + "," +
+                                                      std::to_string(adjustment.adjusted_scale) + ")");
     }
     // Nested
     if (duckdb_type.id() == LogicalTypeId::LIST ||
+        duckdb_type.id() == LogicalTypeId::ARRAY ||
         duckdb_type.id() == LogicalTypeId::STRUCT ||
         duckdb_type.id() == LogicalTypeId::MAP ||
         duckdb_type.id() == LogicalTypeId::UNION) {
         return ConvertNestedType(duckdb_type);
     }
     // Direct mapping
-    auto it = direct_snowflake_map_.find(duckdb_type.id());
-    if (it != direct_snowflake_map_.end()) {
-        return ConversionResult<std::string>::Success(std::string(it->second));
+    auto entry = SnowflakeTypeRegistry::Lookup(duckdb_type.id());
+    if (entry) {
+        return ConversionResult<std::string>::Success(std::string(entry->snowflake_name));
     }
     return ConversionResult<std::string>::Error("Unsupported DuckDB type");
 }
 
 SnowflakeTypeConverter::ConversionResult<LogicalType>
 SnowflakeTypeConverter::ConvertSnowflakeToDuckDB(const std::string& snowflake_type) {
-    // NUMBER(p,s)
-    if (snowflake_type.rfind("NUMBER", 0) == 0) {
-        auto params = snowflake_type.substr(snowflake_type.find('(')+1,
-            snowflake_type.find(')') - snowflake_type.find('(') - 1);
-        auto comma = params.find(',');
-        if (comma != std::string::npos) {
-            int p = stoi(params.substr(0,comma)), s = stoi(params.substr(comma+1));
-            return ConversionResult<LogicalType>::Success(LogicalType::DECIMAL(p,s));
-        }
-        return ConversionResult<LogicalType>::Success(LogicalType::DECIMAL(stoi(params),0));
-    }
-    // Primitive reverse
-    auto it = reverse_type_map_.find(snowflake_type);
-    if (it != reverse_type_map_.end()) {
-        return ConversionResult<LogicalType>::Success(LogicalType(it->second));
+    auto parsed = SnowflakeTypeParser::Parse(snowflake_type);
+    if (!parsed.IsValid()) {
+        return ConversionResult<LogicalType>::Error(parsed.FormatError(snowflake_type));
+    }
+    return ConversionResult<LogicalType>::Success(std::move(parsed.type));
+}
+
+// ===== TYPE MAPPING INFO =====
+
+SnowflakeTypeConverter::ConversionResult<SnowflakeTypeConverter::TypeMappingInfo>
+SnowflakeTypeConverter::GetTypeMappingInfo(const LogicalType& duckdb_type) {
+    auto cached = LookupCachedConversion(duckdb_type);
+    if (cached) {
+        return cached->mapping_info;
+    }
+    return BuildTypeMappingInfo(duckdb_type, ConvertDuckDBToSnowflakeUncached(duckdb_type),
+                                ConvertDuckDBToArrowUncached(duckdb_type));
+}
+
+SnowflakeTypeConverter::ConversionResult<SnowflakeTypeConverter::TypeMappingInfo>
+SnowflakeTypeConverter::BuildTypeMappingInfo(const LogicalType& duckdb_type,
+                                             const ConversionResult<std::string>& snowflake_type,
+                                             const ConversionResult<std::shared_ptr<arrow::DataType>>& arrow_type) {
+    if (!snowflake_type.IsValid()) {
+        return ConversionResult<TypeMappingInfo>::Error(snowflake_type.GetError());
+    }
+    TypeMappingInfo info;
+    info.duckdb_type = duckdb_type.ToString();
+    info.arrow_type = arrow_type.IsValid() ? arrow_type.GetValue()->ToString() : "unsupported";
+    info.snowflake_type = snowflake_type.GetValue();
+    info.has_precision_loss = false;
+    info.requires_special_handling = false;
+
+    if (SnowflakeTypeRegistry::Lookup(duckdb_type.id())) {
+        info.conversion_notes = "Direct mapping";
+    } else if (duckdb_type.id() == LogicalTypeId::DECIMAL) {
+        auto adjustment = AdjustDecimalForSnowflake(DecimalType::GetWidth(duckdb_type),
+                                                    DecimalType::GetScale(duckdb_type));
+        info.has_precision_loss = adjustment.precision_reduced || adjustment.scale_reduced;
+        info.requires_special_handling = info.has_precision_loss;
+        info.conversion_notes = info.has_precision_loss ? adjustment.warning_message : "Direct mapping";
+    } else if (IsSemiStructuredType(info.snowflake_type)) {
+        info.requires_special_handling = true;
+        info.conversion_notes = "Semi-structured type; child types are not preserved";
+    } else {
+        info.requires_special_handling = true;
+        info.conversion_notes = "Structured type; child types preserved";
+    }
+    return ConversionResult<TypeMappingInfo>::Success(std::move(info));
+}
+
+// ===== SCHEMA CONVERSION =====
+
+std::string SnowflakeTypeConverter::QuoteIdentifier(const std::string& identifier) {
+    std::string result = "\"";
+    for (auto c : identifier) {
+        if (c == '"') {
+            result += '"';
+        }
+        result += c;
+    }
+    result += '"';
+    return result;
+}
+
+namespace {
+
+/**
+ * @brief Single-quoted Snowflake string literal; backslash is an escape character there
+ */
+std::string QuoteString(const std::string& text) {
+    std::string result = "'";
+    for (auto c : text) {
+        if (c == '\'' || c == '\\') {
+            result += c;
+        }
+        result += c;
+    }
+    result += '\'';
+    return result;
+}
+
+} // namespace
+
+SnowflakeTypeConverter::ConversionResult<std::string>
+SnowflakeTypeConverter::RenderLiteral(const Value& value) {
+    if (value.IsNull()) {
+        return ConversionResult<std::string>::Success("NULL");
+    }
+    auto& type = value.type();
+    auto cast = [&](const std::string& text) {
+        auto snowflake_type = ConvertDuckDBToSnowflake(type);
+        if (!snowflake_type.IsValid()) {
+            return ConversionResult<std::string>::Error(snowflake_type.GetError());
+        }
+        return ConversionResult<std::string>::Success("CAST(" + QuoteString(text) + " AS " +
+                                                      snowflake_type.GetValue() + ")");
+    };
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN:
+            return ConversionResult<std::string>::Success(BooleanValue::Get(value) ? "TRUE" : "FALSE");
+        case LogicalTypeId::TINYINT:
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+        case LogicalTypeId::UTINYINT:
+        case LogicalTypeId::USMALLINT:
+        case LogicalTypeId::UINTEGER:
+        case LogicalTypeId::UBIGINT:
+        case LogicalTypeId::HUGEINT:
+        case LogicalTypeId::UHUGEINT: {
+            auto digits = value.ToString();
+            if (digits.size() - (digits[0] == '-' ? 1 : 0) > 38) {
+                return ConversionResult<std::string>::Error("Integer " + digits + " exceeds NUMBER(38,0)");
+            }
+            return ConversionResult<std::string>::Success(std::move(digits));
+        }
+        case LogicalTypeId::DECIMAL:
+            return cast(value.ToString());
+        case LogicalTypeId::FLOAT:
+            // Widen first: Snowflake FLOAT is double precision, and the
+            // shortest float32 spelling would round to a different double
+            return ConversionResult<std::string>::Success(
+                "CAST(" + QuoteString(Value::DOUBLE(FloatValue::Get(value)).ToString()) + " AS FLOAT)");
+        case LogicalTypeId::DOUBLE:
+            return cast(value.ToString());
+        case LogicalTypeId::VARCHAR:
+            return ConversionResult<std::string>::Success(QuoteString(StringValue::Get(value)));
+        case LogicalTypeId::BLOB: {
+            auto& bytes = StringValue::Get(value);
+            static constexpr const char* HEX = "0123456789ABCDEF";
+            std::string hex;
+            hex.reserve(bytes.size() * 2);
+            for (auto byte : bytes) {
+                hex += HEX[static_cast<uint8_t>(byte) >> 4];
+                hex += HEX[static_cast<uint8_t>(byte) & 0x0F];
+            }
+            return ConversionResult<std::string>::Success("TO_BINARY('" + hex + "', 'HEX')");
+        }
+        case LogicalTypeId::DATE:
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC: {
+            auto text = value.ToString();
+            // "(BC)" dates and infinities have no Snowflake spelling
+            if (text.find('(') != std::string::npos || text.find("infinity") != std::string::npos) {
+                return ConversionResult<std::string>::Error("No Snowflake literal for " + text);
+            }
+            return cast(text);
+        }
+        case LogicalTypeId::TIMESTAMP_TZ: {
+            // DuckDB stores the instant in UTC; spell it with an explicit offset
+            auto text = Value::TIMESTAMP(TimestampValue::Get(value)).ToString();
+            if (text.find('(') != std::string::npos || text.find("infinity") != std::string::npos) {
+                return ConversionResult<std::string>::Error("No Snowflake literal for " + text);
+            }
+            return cast(text + " +00:00");
+        }
+        default:
+            return ConversionResult<std::string>::Error("No Snowflake literal for " + type.ToString() + " values");
     }
-    // VARIANT → VARCHAR (since JSON doesn't exist in DuckDB)
-    if (snowflake_type == "VARIANT") {
-        return ConversionResult<LogicalType>::Success(LogicalType::VARCHAR);
+}
+
+std::string SnowflakeTypeConverter::SchemaConversion::BuildCreateTableDDL(const std::string& table_name) const {
+    std::string ddl = "CREATE TABLE " + QuoteIdentifier(table_name) + " (";
+    for (size_t i = 0; i < snowflake_columns.size(); i++) {
+        if (i > 0) ddl += ", ";
+        ddl += snowflake_columns[i];
+    }
+    ddl += ")";
+    return ddl;
+}
+
+SnowflakeTypeConverter::ConversionResult<SnowflakeTypeConverter::SchemaConversion>
+SnowflakeTypeConverter::ConvertSchema(const std::vector<std::string>& column_names,
+                                      const std::vector<LogicalType>& column_types) {
+    if (column_names.size() != column_types.size()) {
+        return ConversionResult<SchemaConversion>::Error(
+            "Schema conversion requires one name per column type");
+    }
+
+    // Each distinct type is converted once; wide tables usually repeat a
+    // handful of types across hundreds of columns.
+    struct DistinctType {
+        const LogicalType* type;
+        ConversionResult<std::string> snowflake_type;
+        ConversionResult<std::shared_ptr<arrow::DataType>> arrow_type;
+        ConversionResult<TypeMappingInfo> mapping_info;
+        std::shared_ptr<const arrow::KeyValueMetadata> metadata;
+    };
+    std::vector<DistinctType> distinct_types;
+    std::unordered_multimap<hash_t, size_t> distinct_index;
+    std::vector<size_t> column_slots;
+    column_slots.reserve(column_types.size());
+
+    for (auto& column_type : column_types) {
+        auto hash = HashLogicalTypeStructure(column_type);
+        auto range = distinct_index.equal_range(hash);
+        size_t slot = distinct_types.size();
+        for (auto it = range.first; it != range.second; ++it) {
+            if (*distinct_types[it->second].type == column_type) {
+                slot = it->second;
+                break;
+            }
+        }
+        if (slot == distinct_types.size()) {
+            auto cached = LookupCachedConversion(column_type);
+            if (cached) {
+                distinct_types.push_back({&column_type, cached->snowflake_type, cached->arrow_type,
+                                          cached->mapping_info, nullptr});
+            } else {
+                auto snowflake_type = ConvertDuckDBToSnowflake(column_type);
+                auto arrow_type = ConvertDuckDBToArrow(column_type);
+                auto mapping_info = BuildTypeMappingInfo(column_type, snowflake_type, arrow_type);
+                distinct_types.push_back({&column_type, std::move(snowflake_type), std::move(arrow_type),
+                                          std::move(mapping_info), nullptr});
+            }
+            auto& entry = distinct_types.back();
+            if (entry.snowflake_type.IsValid() && entry.arrow_type.IsValid()) {
+                entry.metadata = arrow::key_value_metadata(
+                    {"duckdb.type", "snowflake.type"},
+                    {column_type.ToString(), entry.snowflake_type.GetValue()});
+            }
+            distinct_index.emplace(hash, slot);
+        }
+        column_slots.push_back(slot);
+    }
+
+    SchemaConversion conversion;
+    arrow::FieldVector fields;
+    fields.reserve(column_types.size());
+    conversion.snowflake_columns.reserve(column_types.size());
+    conversion.column_mappings.reserve(column_types.size());
+    std::string errors;
+
+    for (size_t i = 0; i < column_types.size(); i++) {
+        auto& entry = distinct_types[column_slots[i]];
+        if (!entry.snowflake_type.IsValid() || !entry.arrow_type.IsValid()) {
+            auto& detail = entry.snowflake_type.IsValid() ? entry.arrow_type.GetError()
+                                                          : entry.snowflake_type.GetError();
+            if (!errors.empty()) errors += "; ";
+            errors += "column '" + column_names[i] + "' (" + column_types[i].ToString() + "): " + detail;
+            continue;
+        }
+        fields.push_back(arrow::field(column_names[i], entry.arrow_type.GetValue(), true, entry.metadata));
+        conversion.snowflake_columns.push_back(QuoteIdentifier(column_names[i]) + " " +
+                                               entry.snowflake_type.GetValue());
+        conversion.column_mappings.push_back(entry.mapping_info.GetValue());
     }
-    // OBJECT/ARRAY/MAP → STRUCT/LIST/MAP
-    if (snowflake_type == "OBJECT") return ConversionResult<LogicalType>::Success(LogicalType::STRUCT({}));
-    if (snowflake_type == "ARRAY")  return ConversionResult<LogicalType>::Success(LogicalType::LIST(LogicalType::VARCHAR));
-    if (snowflake_type == "MAP")    return ConversionResult<LogicalType>::Success(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR));
 
-    return ConversionResult<LogicalType>::Error("Unsupported Snowflake type: " + snowflake_type);
+    if (!errors.empty()) {
+        return ConversionResult<SchemaConversion>::Error("Schema conversion failed: " + errors);
+    }
+    conversion.arrow_schema = arrow::schema(std::move(fields));
+    return ConversionResult<SchemaConversion>::Success(std::move(conversion));
+}
+
+// ===== CONVERSION CACHE =====
+
+// Caches are never freed, since readers hold entry pointers without a lock;
+// the active one is published through an atomic pointer. Re-enabling reuses
+// the newest cache when it is large enough, and a replacement at least doubles
+// the capacity, so the retained caches never add up to twice the newest one.
+static std::mutex conversion_cache_lock;
+static std::vector<std::unique_ptr<TypeConversionCache>> conversion_cache_instances;
+static std::atomic<TypeConversionCache*> active_conversion_cache {nullptr};
+
+void SnowflakeTypeConverter::EnableConversionCache(idx_t capacity) {
+    std::lock_guard<std::mutex> guard(conversion_cache_lock);
+    if (conversion_cache_instances.empty() || conversion_cache_instances.back()->Capacity() < capacity) {
+        if (!conversion_cache_instances.empty()) {
+            capacity = MaxValue<idx_t>(capacity, conversion_cache_instances.back()->Capacity() * 2);
+        }
+        conversion_cache_instances.push_back(std::unique_ptr<TypeConversionCache>(new TypeConversionCache(capacity)));
+    }
+    active_conversion_cache.store(conversion_cache_instances.back().get(), std::memory_order_release);
+}
+
+void SnowflakeTypeConverter::DisableConversionCache() {
+    active_conversion_cache.store(nullptr, std::memory_order_release);
+}
+
+bool SnowflakeTypeConverter::IsConversionCacheEnabled() {
+    return active_conversion_cache.load(std::memory_order_acquire) != nullptr;
+}
+
+TypeConversionCacheStats SnowflakeTypeConverter::GetConversionCacheStats() {
+    auto cache = active_conversion_cache.load(std::memory_order_acquire);
+    if (!cache) {
+        return TypeConversionCacheStats {0, 0, 0, 0, 0, 0};
+    }
+    return cache->GetStats();
+}
+
+const CachedTypeConversion*
+SnowflakeTypeConverter::LookupCachedConversion(const LogicalType& duckdb_type) {
+    auto cache = active_conversion_cache.load(std::memory_order_acquire);
+    if (!cache) {
+        return nullptr;
+    }
+    return cache->GetOrCreate(duckdb_type, &SnowflakeTypeConverter::BuildCachedConversion);
+}
+
+std::unique_ptr<CachedTypeConversion>
+SnowflakeTypeConverter::BuildCachedConversion(const LogicalType& duckdb_type, hash_t hash) {
+    auto snowflake_type = ConvertDuckDBToSnowflakeUncached(duckdb_type);
+    auto arrow_type = ConvertDuckDBToArrowUncached(duckdb_type);
+    auto mapping_info = BuildTypeMappingInfo(duckdb_type, snowflake_type, arrow_type);
+    return std::unique_ptr<CachedTypeConversion>(new CachedTypeConversion {
+        duckdb_type, hash, std::move(snowflake_type), std::move(arrow_type), std::move(mapping_info)});
+}
+
+// ===== TEMPORAL TYPE HANDLING =====
+
+SnowflakeTypeConverter::ConversionResult<std::string>
+SnowflakeTypeConverter::ConvertTemporalType(const LogicalType& duckdb_type, SnowflakeTimestampKind timestamp_tz_kind) {
+    switch (duckdb_type.id()) {
+        case LogicalTypeId::TIMESTAMP_TZ:
+            switch (timestamp_tz_kind) {
+                case SnowflakeTimestampKind::NTZ: return ConversionResult<std::string>::Success("TIMESTAMP_NTZ");
+                case SnowflakeTimestampKind::LTZ: return ConversionResult<std::string>::Success("TIMESTAMP_LTZ");
+                default:                          return ConversionResult<std::string>::Success("TIMESTAMP_TZ");
+            }
+        case LogicalTypeId::DATE:
+        case LogicalTypeId::TIME:
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_NS:
+        case LogicalTypeId::TIMESTAMP_MS:
+        case LogicalTypeId::TIMESTAMP_SEC:
+            return ConversionResult<std::string>::Success(
+                std::string(SnowflakeTypeRegistry::Lookup(duckdb_type.id())->snowflake_name));
+        default:
+            return ConversionResult<std::string>::Error(
+                FormatConversionError("temporal conversion", duckdb_type, "not a temporal type"));
+    }
+}
+
+// ===== NESTED TYPE HANDLING =====
+
+bool SnowflakeTypeConverter::IsSemiStructuredType(const std::string& snowflake_type) {
+    return snowflake_type == "VARIANT" || snowflake_type == "ARRAY" || snowflake_type == "OBJECT";
+}
+
+/**
+ * @brief Structured OBJECT keys that need no quoting
+ */
+static bool IsPlainFieldName(const std::string& name) {
+    if (name.empty() || !(StringUtil::CharacterIsAlpha(name[0]) || name[0] == '_')) {
+        return false;
+    }
+    for (auto c : name) {
+        if (!(StringUtil::CharacterIsAlpha(c) || StringUtil::CharacterIsDigit(c) || c == '_' || c == '$')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string
+SnowflakeTypeConverter::BuildSnowflakeObjectType(const std::vector<std::pair<std::string, std::string>>& fields) {
+    // Structured types cannot hold semi-structured values; one such field
+    // turns the whole object semi-structured
+    if (fields.empty()) {
+        return "OBJECT";
+    }
+    std::string result = "OBJECT(";
+    for (size_t i = 0; i < fields.size(); i++) {
+        if (IsSemiStructuredType(fields[i].second)) {
+            return "OBJECT";
+        }
+        if (i > 0) result += ", ";
+        result += (IsPlainFieldName(fields[i].first) ? fields[i].first : QuoteIdentifier(fields[i].first)) + " " +
+                  fields[i].second;
+    }
+    return result + ")";
+}
+
+SnowflakeTypeConverter::ConversionResult<std::string>
+SnowflakeTypeConverter::BuildSnowflakeMapType(const std::string& key_type, const std::string& value_type) {
+    // Snowflake MAP keys are VARCHAR or integral NUMBER
+    auto integral_key = StringUtil::StartsWith(key_type, "NUMBER(") && StringUtil::EndsWith(key_type, ",0)");
+    if ((key_type != "VARCHAR" && !integral_key) || IsSemiStructuredType(value_type)) {
+        // Semi-structured fallback: an OBJECT keyed by the (stringified) key
+        return ConversionResult<std::string>::Success("OBJECT");
+    }
+    return ConversionResult<std::string>::Success("MAP(" + key_type + ", " + value_type + ")");
 }
 
-// Nested support
 SnowflakeTypeConverter::ConversionResult<std::string>
 SnowflakeTypeConverter::ConvertNestedType(const LogicalType& duckdb_type) {
     switch (duckdb_type.id()) {
-        case LogicalTypeId::LIST:   return ConversionResult<std::string>::Success("ARRAY");
-        case LogicalTypeId::STRUCT: return ConversionResult<std::string>::Success("OBJECT");
-        case LogicalTypeId::MAP:    return ConversionResult<std::string>::Success("MAP");
+        case LogicalTypeId::LIST: {
+            auto child = ConvertDuckDBToSnowflake(ListType::GetChildType(duckdb_type));
+            if (!child.IsValid()) {
+                return ConversionResult<std::string>::Error(
+                    FormatConversionError("nested conversion", duckdb_type, "element: " + child.GetError()));
+            }
+            return ConversionResult<std::string>::Success(
+                IsSemiStructuredType(child.GetValue()) ? "ARRAY" : "ARRAY(" + child.GetValue() + ")");
+        }
+        case LogicalTypeId::ARRAY: {
+            // Fixed-size INTEGER / FLOAT arrays are Snowflake's VECTOR type
+            auto& child_type = ArrayType::GetChildType(duckdb_type);
+            auto size = std::to_string(ArrayType::GetSize(duckdb_type));
+            if (child_type.id() == LogicalTypeId::INTEGER) {
+                return ConversionResult<std::string>::Success("VECTOR(INT, " + size + ")");
+            }
+            if (child_type.id() == LogicalTypeId::FLOAT) {
+                return ConversionResult<std::string>::Success("VECTOR(FLOAT, " + size + ")");
+            }
+            auto child = ConvertDuckDBToSnowflake(child_type);
+            if (!child.IsValid()) {
+                return ConversionResult<std::string>::Error(
+                    FormatConversionError("nested conversion", duckdb_type, "element: " + child.GetError()));
+            }
+            return ConversionResult<std::string>::Success(
+                IsSemiStructuredType(child.GetValue()) ? "ARRAY" : "ARRAY(" + child.GetValue() + ")");
+        }
+        case LogicalTypeId::STRUCT: {
+            std::vector<std::pair<std::string, std::string>> fields;
+            for (auto& child : StructType::GetChildTypes(duckdb_type)) {
+                auto child_type = ConvertDuckDBToSnowflake(child.second);
+                if (!child_type.IsValid()) {
+                    return ConversionResult<std::string>::Error(FormatConversionError(
+                        "nested conversion", duckdb_type, "field '" + child.first + "': " + child_type.GetError()));
+                }
+                fields.emplace_back(child.first, child_type.GetValue());
+            }
+            return ConversionResult<std::string>::Success(BuildSnowflakeObjectType(fields));
+        }
+        case LogicalTypeId::MAP: {
+            auto key = ConvertDuckDBToSnowflake(MapType::KeyType(duckdb_type));
+            auto value = ConvertDuckDBToSnowflake(MapType::ValueType(duckdb_type));
+            if (!key.IsValid() || !value.IsValid()) {
+                auto detail = key.IsValid() ? "map value: " + value.GetError() : "map key: " + key.GetError();
+                return ConversionResult<std::string>::Error(
+                    FormatConversionError("nested conversion", duckdb_type, detail));
+            }
+            auto map_type = BuildSnowflakeMapType(key.GetValue(), value.GetValue());
+            if (!map_type.IsValid()) {
+                return ConversionResult<std::string>::Error(
+                    FormatConversionError("nested conversion", duckdb_type, map_type.GetError()));
+            }
+            return map_type;
+        }
         case LogicalTypeId::UNION:  return ConversionResult<std::string>::Success("VARIANT");
         default: return ConversionResult<std::string>::Error("Unsupported nested type");
     }
@@ -195,10 +794,47 @@ SnowflakeTypeConverter::DecimalAdjustment
 SnowflakeTypeConverter::AdjustDecimalForSnowflake(uint8_t precision, uint8_t scale) {
     DecimalAdjustment a{precision, scale, false, false, std::string("")};
     if (precision > 38) {
+        // Give up fractional digits before integer digits: the scale absorbs
+        // as much of the excess precision as it can
+        auto excess = static_cast<uint8_t>(precision - 38);
+        auto scale_cut = MinValue<uint8_t>(scale, excess);
         a.adjusted_precision = 38; a.precision_reduced = true;
+        a.adjusted_scale = static_cast<uint8_t>(scale - scale_cut);
+        a.scale_reduced = scale_cut > 0;
         a.warning_message = "Precision reduced to 38";
+        if (a.scale_reduced) {
+            a.warning_message += ", scale reduced to " + std::to_string(a.adjusted_scale);
+        }
+        if (excess > scale_cut) {
+            a.warning_message += "; values with more than " + std::to_string(38 - a.adjusted_scale) +
+                                 " integer digits will not fit";
+        }
     }
     return a;
 }
 
-} // namespace duckdb 
\ No newline at end of file
+std::string SnowflakeTypeConverter::FormatConversionError(const std::string& operation,
+                                                          const LogicalType& source_type,
+                                                          const std::string& error_detail) {
+    return "Type conversion error during " + operation + " of " + source_type.ToString() + ": " + error_detail;
+}
+
+// ===== DATA VALIDATION =====
+
+SnowflakeTypeConverter::ConversionResult<void>
+SnowflakeTypeConverter::ValidateConversion(const LogicalType& source_type,
+                                           const LogicalType& target_type,
+                                           const Vector& source_data,
+                                           const Vector& target_data,
+                                           idx_t count,
+                                           const ValidationOptions& options) {
+    if (source_data.GetType() != source_type || target_data.GetType() != target_type) {
+        return ConversionResult<void>::Error(
+            FormatConversionError("validation", source_type,
+                                  "vector types " + source_data.GetType().ToString() + " / " +
+                                  target_data.GetType().ToString() + " do not match the declared types"));
+    }
+    return ConversionValidator::Validate(source_data, target_data, count, options);
+}
+
+} // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,562 @@
+// Minimal ADBC driver for tests and benchmarks. The SQL text of a statement
+// is a ';'-separated list of Arrow IPC stream files:
+// - ExecuteQuery serves them one after another as one ArrowArrayStream
+// - ExecutePartitions returns one partition per file, read back with
+//   ReadPartition
+// - Bulk ingestion writes the bound stream to the IPC stream file named by
+//   the target table (append rewrites the file with the new batches added)
+// The file list may be wrapped the way snowflake_scan pushes down projection:
+//   SELECT "a", "b" FROM (\n<files>\n) AS "snowflake_scan" [WHERE ...] [LIMIT 0]
+// The named columns are served; WHERE is ignored (the scan filters again) and
+// LIMIT 0 serves the schema without rows. In place of the file list, a table
+// query SELECT ... FROM <db>."<schema>"."<file>" serves the file named by the
+// table, so INFORMATION_SCHEMA rows can describe the files as tables.
+// A "stub_latency_ms=N" parameter in the database URI delays every batch
+// fetched or ingested by N milliseconds, standing in for a remote transfer.
+// A "stub_query_log=<path>" parameter appends every query to <path>, one per
+// line (newlines in a query become spaces). A "stub_information_schema=<path>"
+// parameter serves that file for every query naming INFORMATION_SCHEMA.
+// Loaded by path through the ADBC driver manager, exactly like the Snowflake
+// driver.
+
+#include <arrow/c/bridge.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include "adbc.h"
+}
+
+namespace {
+
+struct StubSettings {
+    int latency_ms = 0;
+    std::string query_log;
+    std::string information_schema;
+};
+
+struct StubStatement {
+    StubSettings settings;
+    std::string query;
+    std::string target_table;
+    std::string ingest_mode = ADBC_INGEST_OPTION_MODE_CREATE;
+    ArrowArrayStream bound = {};
+};
+
+AdbcStatusCode SetError(AdbcError* error, AdbcStatusCode code, const std::string& message) {
+    if (!error) {
+        return code;
+    }
+    if (error->release) {
+        error->release(error);
+    }
+    error->message = new char[message.size() + 1];
+    std::memcpy(error->message, message.c_str(), message.size() + 1);
+    error->vendor_code = 0;
+    std::memset(error->sqlstate, 0, sizeof(error->sqlstate));
+    error->release = [](AdbcError* self) {
+        delete[] self->message;
+        self->message = nullptr;
+        self->release = nullptr;
+    };
+    return code;
+}
+
+std::vector<std::string> SplitPaths(const std::string& query) {
+    std::vector<std::string> paths;
+    size_t start = 0;
+    while (start <= query.size()) {
+        auto end = query.find(';', start);
+        if (end == std::string::npos) {
+            end = query.size();
+        }
+        if (end > start) {
+            paths.push_back(query.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return paths;
+}
+
+/**
+ * A query as the stub understands it: files to serve, columns to keep (empty
+ * keeps all), and whether only the schema is wanted
+ */
+struct StubQuery {
+    std::vector<std::string> paths;
+    std::string column_list;
+    std::vector<std::string> columns;
+    bool schema_only = false;
+};
+
+/**
+ * Parse a list of double-quoted identifiers separated by ", "
+ */
+std::vector<std::string> ParseColumns(const std::string& list) {
+    std::vector<std::string> columns;
+    size_t pos = 0;
+    while (pos < list.size() && list[pos] == '"') {
+        std::string name;
+        for (pos++; pos < list.size(); pos++) {
+            if (list[pos] == '"') {
+                if (pos + 1 < list.size() && list[pos + 1] == '"') {
+                    name += '"';
+                    pos++;
+                    continue;
+                }
+                break;
+            }
+            name += list[pos];
+        }
+        columns.push_back(name);
+        pos = list.find('"', pos + 1);
+    }
+    return columns;
+}
+
+/**
+ * A table query, SELECT <columns> FROM <db>."<schema>"."<table>", reads the
+ * file named by the table (its own column list is ignored); anything else is
+ * a file list
+ */
+std::vector<std::string> SourcePaths(const std::string& source) {
+    const std::string select = "SELECT ";
+    auto table = source.rfind(".\"");
+    if (source.compare(0, select.size(), select) != 0 || source.find(" FROM ") == std::string::npos ||
+        table == std::string::npos) {
+        return SplitPaths(source);
+    }
+    return {ParseColumns(source.substr(table + 1))[0]};
+}
+
+StubQuery ParseQuery(const std::string& query) {
+    const std::string select = "SELECT ";
+    const std::string open = " FROM (\n";
+    const std::string close = "\n) AS \"snowflake_scan\"";
+    StubQuery parsed;
+    auto inner_start = query.find(open);
+    auto inner_end = query.rfind(close);
+    if (query.compare(0, select.size(), select) != 0 || inner_start == std::string::npos ||
+        inner_end == std::string::npos || inner_end < inner_start + open.size()) {
+        parsed.paths = SourcePaths(query);
+        return parsed;
+    }
+    parsed.paths = SourcePaths(query.substr(inner_start + open.size(), inner_end - inner_start - open.size()));
+    auto list = query.substr(select.size(), inner_start - select.size());
+    if (list != "*") {
+        parsed.column_list = list;
+        parsed.columns = ParseColumns(list);
+    }
+    auto rest = query.substr(inner_end + close.size());
+    const std::string limit = " LIMIT 0";
+    parsed.schema_only = rest.size() >= limit.size() && rest.compare(rest.size() - limit.size(), limit.size(), limit) == 0;
+    return parsed;
+}
+
+/**
+ * Partition descriptors carry the projection: "<path>\n<column list>"
+ */
+StubQuery ParseDescriptor(const std::string& descriptor) {
+    StubQuery parsed;
+    auto separator = descriptor.find('\n');
+    parsed.paths.push_back(descriptor.substr(0, separator));
+    if (separator != std::string::npos) {
+        parsed.column_list = descriptor.substr(separator + 1);
+        parsed.columns = ParseColumns(parsed.column_list);
+    }
+    return parsed;
+}
+
+void LogQuery(const StubSettings& settings, std::string query) {
+    if (!settings.query_log.empty()) {
+        std::replace(query.begin(), query.end(), '\n', ' ');
+        std::ofstream(settings.query_log, std::ios::app) << query << "\n";
+    }
+}
+
+arrow::Result<std::shared_ptr<arrow::RecordBatchReader>> OpenFile(const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::ReadableFile::Open(path));
+    ARROW_ASSIGN_OR_RAISE(auto reader, arrow::ipc::RecordBatchStreamReader::Open(file));
+    return std::static_pointer_cast<arrow::RecordBatchReader>(reader);
+}
+
+/**
+ * Reads the files in order, opening each one only when the previous one ends
+ */
+class FileSequenceReader : public arrow::RecordBatchReader {
+public:
+    FileSequenceReader(std::vector<std::string> paths, std::shared_ptr<arrow::RecordBatchReader> first,
+                       std::vector<int> columns, bool schema_only, int latency_ms)
+        : paths_(std::move(paths)), current_(std::move(first)), columns_(std::move(columns)),
+          latency_ms_(latency_ms) {
+        schema_ = current_->schema();
+        if (!columns_.empty()) {
+            arrow::FieldVector fields;
+            for (auto column : columns_) {
+                fields.push_back(schema_->field(column));
+            }
+            schema_ = arrow::schema(fields, schema_->metadata());
+        }
+        if (schema_only) {
+            current_.reset();
+        }
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override { return schema_; }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+        while (current_) {
+            ARROW_RETURN_NOT_OK(current_->ReadNext(batch));
+            if (*batch) {
+                if (!columns_.empty()) {
+                    ARROW_ASSIGN_OR_RAISE(*batch, (*batch)->SelectColumns(columns_));
+                }
+                if (latency_ms_ > 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(latency_ms_));
+                }
+                return arrow::Status::OK();
+            }
+            current_.reset();
+            if (++next_path_ < paths_.size()) {
+                ARROW_ASSIGN_OR_RAISE(current_, OpenFile(paths_[next_path_]));
+            }
+        }
+        batch->reset();
+        return arrow::Status::OK();
+    }
+
+private:
+    std::vector<std::string> paths_;
+    size_t next_path_ = 0;
+    std::shared_ptr<arrow::RecordBatchReader> current_;
+    std::shared_ptr<arrow::Schema> schema_;
+    std::vector<int> columns_;
+    int latency_ms_;
+};
+
+/**
+ * Resolve projected column names against a file schema
+ */
+arrow::Result<std::vector<int>> ColumnIndices(const arrow::Schema& schema, const std::vector<std::string>& columns) {
+    std::vector<int> indices;
+    for (auto& column : columns) {
+        auto index = schema.GetFieldIndex(column);
+        if (index < 0) {
+            return arrow::Status::KeyError("Unknown column \"", column, "\"");
+        }
+        indices.push_back(index);
+    }
+    return indices;
+}
+
+AdbcStatusCode ExportFiles(const StubQuery& query, const StubSettings& settings, ArrowArrayStream* out,
+                           AdbcError* error) {
+    if (query.paths.empty()) {
+        return SetError(error, ADBC_STATUS_INVALID_ARGUMENT, "No result files given");
+    }
+    auto first = OpenFile(query.paths[0]);
+    if (!first.ok()) {
+        return SetError(error, ADBC_STATUS_IO, first.status().ToString());
+    }
+    auto columns = ColumnIndices(*(*first)->schema(), query.columns);
+    if (!columns.ok()) {
+        return SetError(error, ADBC_STATUS_INVALID_ARGUMENT, columns.status().ToString());
+    }
+    auto reader = std::make_shared<FileSequenceReader>(query.paths, *first, *columns, query.schema_only,
+                                                       settings.latency_ms);
+    auto status = arrow::ExportRecordBatchReader(reader, out);
+    if (!status.ok()) {
+        return SetError(error, ADBC_STATUS_INTERNAL, status.ToString());
+    }
+    return ADBC_STATUS_OK;
+}
+
+arrow::Status ReadAll(const std::string& path, arrow::RecordBatchVector* batches) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenFile(path));
+    ARROW_ASSIGN_OR_RAISE(*batches, reader->ToRecordBatches());
+    return arrow::Status::OK();
+}
+
+/**
+ * Write the bound stream to the target file; returns the number of rows written
+ */
+arrow::Result<int64_t> WriteIngest(StubStatement& stub, bool append) {
+    arrow::RecordBatchVector existing;
+    if (append) {
+        ARROW_RETURN_NOT_OK(ReadAll(stub.target_table, &existing));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto reader, arrow::ImportRecordBatchReader(&stub.bound));
+    ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::FileOutputStream::Open(stub.target_table));
+    ARROW_ASSIGN_OR_RAISE(auto writer, arrow::ipc::MakeStreamWriter(file, reader->schema()));
+    for (auto& batch : existing) {
+        ARROW_RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    int64_t rows = 0;
+    while (true) {
+        std::shared_ptr<arrow::RecordBatch> batch;
+        ARROW_RETURN_NOT_OK(reader->ReadNext(&batch));
+        if (!batch) {
+            break;
+        }
+        if (stub.settings.latency_ms > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(stub.settings.latency_ms));
+        }
+        ARROW_RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+        rows += batch->num_rows();
+    }
+    ARROW_RETURN_NOT_OK(writer->Close());
+    ARROW_RETURN_NOT_OK(file->Close());
+    return rows;
+}
+
+AdbcStatusCode ExecuteIngest(StubStatement& stub, int64_t* rows_affected, AdbcError* error) {
+    if (!stub.bound.release) {
+        return SetError(error, ADBC_STATUS_INVALID_STATE, "No data bound for ingestion");
+    }
+    auto exists = arrow::io::ReadableFile::Open(stub.target_table).ok();
+    if (stub.ingest_mode == ADBC_INGEST_OPTION_MODE_CREATE && exists) {
+        stub.bound.release(&stub.bound);
+        return SetError(error, ADBC_STATUS_ALREADY_EXISTS, "Table " + stub.target_table + " already exists");
+    }
+    if (stub.ingest_mode == ADBC_INGEST_OPTION_MODE_APPEND && !exists) {
+        stub.bound.release(&stub.bound);
+        return SetError(error, ADBC_STATUS_NOT_FOUND, "Table " + stub.target_table + " does not exist");
+    }
+    auto rows = WriteIngest(stub, stub.ingest_mode == ADBC_INGEST_OPTION_MODE_APPEND);
+    if (stub.bound.release) {
+        stub.bound.release(&stub.bound);
+    }
+    if (!rows.ok()) {
+        return SetError(error, ADBC_STATUS_IO, rows.status().ToString());
+    }
+    if (rows_affected) {
+        *rows_affected = *rows;
+    }
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode DatabaseNew(AdbcDatabase* database, AdbcError*) {
+    database->private_data = new StubSettings();
+    return ADBC_STATUS_OK;
+}
+
+/**
+ * Value of a "key=value" URI parameter, up to the next '&'
+ */
+bool UriParameter(const std::string& uri, const std::string& key, std::string* value) {
+    auto parameter = uri.find(key + "=");
+    if (parameter == std::string::npos) {
+        return false;
+    }
+    auto start = parameter + key.size() + 1;
+    *value = uri.substr(start, uri.find('&', start) - start);
+    return true;
+}
+
+AdbcStatusCode DatabaseSetOption(AdbcDatabase* database, const char* key, const char* value, AdbcError*) {
+    if (std::strcmp(key, "uri") != 0 || !value) {
+        return ADBC_STATUS_OK;
+    }
+    auto settings = static_cast<StubSettings*>(database->private_data);
+    std::string latency;
+    if (UriParameter(value, "stub_latency_ms", &latency)) {
+        settings->latency_ms = std::atoi(latency.c_str());
+    }
+    UriParameter(value, "stub_query_log", &settings->query_log);
+    UriParameter(value, "stub_information_schema", &settings->information_schema);
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode DatabaseInit(AdbcDatabase*, AdbcError*) {
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode DatabaseRelease(AdbcDatabase* database, AdbcError*) {
+    delete static_cast<StubSettings*>(database->private_data);
+    database->private_data = nullptr;
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode ConnectionNew(AdbcConnection* connection, AdbcError*) {
+    connection->private_data = new StubSettings();
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode ConnectionSetOption(AdbcConnection*, const char*, const char*, AdbcError*) {
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode ConnectionInit(AdbcConnection* connection, AdbcDatabase* database, AdbcError*) {
+    *static_cast<StubSettings*>(connection->private_data) = *static_cast<StubSettings*>(database->private_data);
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode ConnectionReadPartition(AdbcConnection* connection, const uint8_t* serialized_partition,
+                                       size_t serialized_length, ArrowArrayStream* out, AdbcError* error) {
+    std::string descriptor(reinterpret_cast<const char*>(serialized_partition), serialized_length);
+    return ExportFiles(ParseDescriptor(descriptor), *static_cast<StubSettings*>(connection->private_data), out,
+                       error);
+}
+
+AdbcStatusCode ConnectionRelease(AdbcConnection* connection, AdbcError*) {
+    delete static_cast<StubSettings*>(connection->private_data);
+    connection->private_data = nullptr;
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementNew(AdbcConnection* connection, AdbcStatement* statement, AdbcError*) {
+    auto stub = new StubStatement();
+    stub->settings = *static_cast<StubSettings*>(connection->private_data);
+    statement->private_data = stub;
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementSetSqlQuery(AdbcStatement* statement, const char* query, AdbcError*) {
+    static_cast<StubStatement*>(statement->private_data)->query = query;
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementSetOption(AdbcStatement* statement, const char* key, const char* value, AdbcError* error) {
+    auto stub = static_cast<StubStatement*>(statement->private_data);
+    if (std::strcmp(key, ADBC_INGEST_OPTION_TARGET_TABLE) == 0) {
+        stub->target_table = value;
+    } else if (std::strcmp(key, ADBC_INGEST_OPTION_MODE) == 0) {
+        stub->ingest_mode = value;
+    } else if (std::strcmp(key, ADBC_INGEST_OPTION_TARGET_DB_SCHEMA) == 0) {
+        // Tables are files; the schema is accepted and ignored
+    } else {
+        return SetError(error, ADBC_STATUS_NOT_IMPLEMENTED, std::string("Unknown statement option ") + key);
+    }
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementBindStream(AdbcStatement* statement, ArrowArrayStream* stream, AdbcError*) {
+    auto stub = static_cast<StubStatement*>(statement->private_data);
+    if (stub->bound.release) {
+        stub->bound.release(&stub->bound);
+    }
+    // Take ownership, leaving the caller's struct released
+    stub->bound = *stream;
+    stream->release = nullptr;
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementExecuteQuery(AdbcStatement* statement, ArrowArrayStream* out, int64_t* rows_affected,
+                                     AdbcError* error) {
+    auto stub = static_cast<StubStatement*>(statement->private_data);
+    if (!stub->target_table.empty()) {
+        return ExecuteIngest(*stub, rows_affected, error);
+    }
+    if (rows_affected) {
+        *rows_affected = -1;
+    }
+    LogQuery(stub->settings, stub->query);
+    if (!stub->settings.information_schema.empty() && stub->query.find("INFORMATION_SCHEMA") != std::string::npos) {
+        StubQuery metadata;
+        metadata.paths.push_back(stub->settings.information_schema);
+        return ExportFiles(metadata, stub->settings, out, error);
+    }
+    return ExportFiles(ParseQuery(stub->query), stub->settings, out, error);
+}
+
+struct StubPartitions {
+    std::vector<std::string> descriptors;
+    std::vector<const uint8_t*> pointers;
+    std::vector<size_t> lengths;
+};
+
+AdbcStatusCode StatementExecutePartitions(AdbcStatement* statement, ArrowSchema* schema, AdbcPartitions* partitions,
+                                          int64_t* rows_affected, AdbcError* error) {
+    auto statement_stub = static_cast<StubStatement*>(statement->private_data);
+    LogQuery(statement_stub->settings, statement_stub->query);
+    auto query = ParseQuery(statement_stub->query);
+    if (query.paths.empty()) {
+        return SetError(error, ADBC_STATUS_INVALID_ARGUMENT, "No result files given");
+    }
+    // Like Snowflake, the schema is known up front; the first file provides it
+    auto first = OpenFile(query.paths[0]);
+    if (!first.ok()) {
+        return SetError(error, ADBC_STATUS_IO, first.status().ToString());
+    }
+    auto columns = ColumnIndices(*(*first)->schema(), query.columns);
+    if (!columns.ok()) {
+        return SetError(error, ADBC_STATUS_INVALID_ARGUMENT, columns.status().ToString());
+    }
+    FileSequenceReader projected({}, *first, *columns, true, 0);
+    auto status = arrow::ExportSchema(*projected.schema(), schema);
+    if (!status.ok()) {
+        return SetError(error, ADBC_STATUS_INTERNAL, status.ToString());
+    }
+
+    auto stub = new StubPartitions();
+    if (!query.schema_only) {
+        for (auto& path : query.paths) {
+            stub->descriptors.push_back(query.column_list.empty() ? path : path + "\n" + query.column_list);
+        }
+    }
+    for (auto& descriptor : stub->descriptors) {
+        stub->pointers.push_back(reinterpret_cast<const uint8_t*>(descriptor.data()));
+        stub->lengths.push_back(descriptor.size());
+    }
+    partitions->num_partitions = stub->descriptors.size();
+    partitions->partitions = stub->pointers.data();
+    partitions->partition_lengths = stub->lengths.data();
+    partitions->private_data = stub;
+    partitions->release = [](AdbcPartitions* self) {
+        delete static_cast<StubPartitions*>(self->private_data);
+        self->private_data = nullptr;
+        self->release = nullptr;
+    };
+    if (rows_affected) {
+        *rows_affected = -1;
+    }
+    return ADBC_STATUS_OK;
+}
+
+AdbcStatusCode StatementRelease(AdbcStatement* statement, AdbcError*) {
+    auto stub = static_cast<StubStatement*>(statement->private_data);
+    if (stub->bound.release) {
+        stub->bound.release(&stub->bound);
+    }
+    delete stub;
+    statement->private_data = nullptr;
+    return ADBC_STATUS_OK;
+}
+
+} // namespace
+
+extern "C" ADBC_EXPORT AdbcStatusCode AdbcDriverInit(int version, void* raw_driver, AdbcError* error) {
+    if (version != ADBC_VERSION_1_0_0) {
+        return ADBC_STATUS_NOT_IMPLEMENTED;
+    }
+    auto driver = static_cast<AdbcDriver*>(raw_driver);
+    std::memset(driver, 0, ADBC_DRIVER_1_0_0_SIZE);
+    driver->DatabaseNew = DatabaseNew;
+    driver->DatabaseSetOption = DatabaseSetOption;
+    driver->DatabaseInit = DatabaseInit;
+    driver->DatabaseRelease = DatabaseRelease;
+    driver->ConnectionNew = ConnectionNew;
+    driver->ConnectionSetOption = ConnectionSetOption;
+    driver->ConnectionInit = ConnectionInit;
+    driver->ConnectionReadPartition = ConnectionReadPartition;
+    driver->ConnectionRelease = ConnectionRelease;
+    driver->StatementNew = StatementNew;
+    driver->StatementSetSqlQuery = StatementSetSqlQuery;
+    driver->StatementSetOption = StatementSetOption;
+    driver->StatementBindStream = StatementBindStream;
+    driver->StatementExecuteQuery = StatementExecuteQuery;
+    driver->StatementExecutePartitions = StatementExecutePartitions;
+    driver->StatementRelease = StatementRelease;
+    return ADBC_STATUS_OK;
+}
\ No newline at end of file
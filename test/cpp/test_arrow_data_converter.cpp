@@ -0,0 +1,392 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "arrow_data_converter.hpp"
+#include <arrow/array.h>
+#include <arrow/util/decimal.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+bool TestValidityKernels() {
+    std::cout << "\n=== Testing Validity Kernels ===" << std::endl;
+    
+    validity_t source[2] = {~validity_t(0), ~validity_t(0)};
+    source[0] &= ~(validity_t(1) << 3);
+    source[1] &= ~(validity_t(1) << 5);
+    uint8_t bitmap[16];
+    auto null_count = DuckDBToArrowConverter::CopyValidity(source, 70, bitmap);
+    TEST_ASSERT(null_count == 2, "Null count from popcount");
+    TEST_ASSERT((bitmap[0] & (1 << 3)) == 0 && (bitmap[8] & (1 << 5)) == 0, "Null bits preserved");
+
+    source[1] &= ~(validity_t(1) << 40);
+    null_count = DuckDBToArrowConverter::CopyValidity(source, 70, bitmap);
+    TEST_ASSERT(null_count == 2, "Bits past the row count are ignored");
+
+    uint8_t booleans[11] = {1, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0};
+    uint8_t packed[8] = {0};
+    DuckDBToArrowConverter::PackBooleans(booleans, 11, packed);
+    TEST_ASSERT(packed[0] == 0x8D, "Eight booleans pack into one byte");
+    TEST_ASSERT(packed[1] == 0x03, "Remainder booleans packed");
+
+    return true;
+}
+
+bool TestFlatVectors() {
+    std::cout << "\n=== Testing Flat Vector Conversion ===" << std::endl;
+    
+    Vector integers(LogicalType::INTEGER, 100);
+    auto data = FlatVector::GetData<int32_t>(integers);
+    for (int32_t i = 0; i < 100; i++) {
+        data[i] = i * 3;
+    }
+    FlatVector::SetNull(integers, 7, true);
+
+    auto result = DuckDBToArrowConverter::ConvertVector(integers, 100);
+    TEST_ASSERT(result.IsValid(), "INTEGER vector conversion");
+    auto& array = static_cast<const arrow::Int32Array&>(*result.GetValue());
+    TEST_ASSERT(array.length() == 100 && array.null_count() == 1, "Length and null count");
+    TEST_ASSERT(array.IsNull(7) && array.Value(99) == 297, "Values and nulls");
+    TEST_ASSERT(array.raw_values() == data, "Fixed-width FLAT vector is zero-copy");
+
+    ArrowConversionOptions copy_options;
+    copy_options.zero_copy = false;
+    auto copied = DuckDBToArrowConverter::ConvertVector(integers, 100, copy_options);
+    TEST_ASSERT(static_cast<const arrow::Int32Array&>(*copied.GetValue()).raw_values() != data,
+                "Zero-copy can be disabled");
+
+    Vector booleans(LogicalType::BOOLEAN, 70);
+    auto bool_data = FlatVector::GetData<bool>(booleans);
+    for (idx_t i = 0; i < 70; i++) {
+        bool_data[i] = i % 3 == 0;
+    }
+    auto bool_result = DuckDBToArrowConverter::ConvertVector(booleans, 70);
+    auto& bool_array = static_cast<const arrow::BooleanArray&>(*bool_result.GetValue());
+    TEST_ASSERT(bool_array.Value(0) && !bool_array.Value(1) && bool_array.Value(69), "BOOLEAN bit packing");
+
+    Vector strings(LogicalType::VARCHAR, 3);
+    auto string_data = FlatVector::GetData<string_t>(strings);
+    string_data[0] = StringVector::AddString(strings, "short");
+    string_data[1] = StringVector::AddString(strings, "a string longer than twelve bytes");
+    FlatVector::SetNull(strings, 2, true);
+    auto string_result = DuckDBToArrowConverter::ConvertVector(strings, 3);
+    auto& string_array = static_cast<const arrow::StringArray&>(*string_result.GetValue());
+    TEST_ASSERT(string_array.GetString(0) == "short", "Inlined string");
+    TEST_ASSERT(string_array.GetString(1) == "a string longer than twelve bytes", "Heap string");
+    TEST_ASSERT(string_array.IsNull(2), "NULL string");
+
+    Vector decimals(LogicalType::DECIMAL(18, 3), 2);
+    auto decimal_data = FlatVector::GetData<int64_t>(decimals);
+    decimal_data[0] = 123456;
+    decimal_data[1] = -42;
+    auto decimal_result = DuckDBToArrowConverter::ConvertVector(decimals, 2);
+    auto& decimal_array = static_cast<const arrow::Decimal128Array&>(*decimal_result.GetValue());
+    TEST_ASSERT(decimal_array.FormatValue(0) == "123.456", "DECIMAL(18,3) widened to decimal128");
+    TEST_ASSERT(decimal_array.FormatValue(1) == "-0.042", "Negative decimal sign-extended");
+
+    return true;
+}
+
+bool TestConstantAndDictionaryVectors() {
+    std::cout << "\n=== Testing Constant and Dictionary Vectors ===" << std::endl;
+    
+    Vector constant(Value::BIGINT(42));
+    auto constant_result = DuckDBToArrowConverter::ConvertVector(constant, 5);
+    auto& constant_array = static_cast<const arrow::Int64Array&>(*constant_result.GetValue());
+    TEST_ASSERT(constant_array.length() == 5 && constant_array.Value(4) == 42, "CONSTANT vector broadcast");
+
+    Vector null_constant(Value(LogicalType::DOUBLE));
+    auto null_result = DuckDBToArrowConverter::ConvertVector(null_constant, 5);
+    TEST_ASSERT(null_result.GetValue()->null_count() == 5, "NULL CONSTANT vector");
+
+    Vector dictionary_values(LogicalType::INTEGER, 3);
+    auto values = FlatVector::GetData<int32_t>(dictionary_values);
+    values[0] = 10;
+    values[1] = 20;
+    values[2] = 30;
+    SelectionVector sel(4);
+    sel.set_index(0, 2);
+    sel.set_index(1, 0);
+    sel.set_index(2, 2);
+    sel.set_index(3, 1);
+    Vector dictionary(dictionary_values, sel, 4);
+    auto dictionary_result = DuckDBToArrowConverter::ConvertVector(dictionary, 4);
+    auto& dictionary_array = static_cast<const arrow::Int32Array&>(*dictionary_result.GetValue());
+    TEST_ASSERT(dictionary_array.Value(0) == 30 && dictionary_array.Value(1) == 10 &&
+                dictionary_array.Value(3) == 20, "DICTIONARY vector gathered through selection");
+
+    return true;
+}
+
+bool TestNestedVectors() {
+    std::cout << "\n=== Testing Nested Vector Conversion ===" << std::endl;
+
+    // [[1, 2], NULL, [], [3]]
+    Vector lists(LogicalType::LIST(LogicalType::INTEGER), 4);
+    ListVector::Reserve(lists, 3);
+    auto& elements = ListVector::GetEntry(lists);
+    auto element_data = FlatVector::GetData<int32_t>(elements);
+    element_data[0] = 1;
+    element_data[1] = 2;
+    element_data[2] = 3;
+    ListVector::SetListSize(lists, 3);
+    auto entries = FlatVector::GetData<list_entry_t>(lists);
+    entries[0] = list_entry_t(0, 2);
+    entries[1] = list_entry_t(2, 0);
+    entries[2] = list_entry_t(2, 0);
+    entries[3] = list_entry_t(2, 1);
+    FlatVector::SetNull(lists, 1, true);
+
+    auto result = DuckDBToArrowConverter::ConvertVector(lists, 4);
+    TEST_ASSERT(result.IsValid(), "LIST(INTEGER) vector conversion");
+    auto& list_array = static_cast<const arrow::ListArray&>(*result.GetValue());
+    TEST_ASSERT(list_array.IsNull(1) && list_array.value_length(2) == 0 && list_array.value_offset(4) == 3,
+                "List offsets and nulls");
+    auto& values = static_cast<const arrow::Int32Array&>(*list_array.values());
+    TEST_ASSERT(values.Value(2) == 3, "List elements");
+    TEST_ASSERT(values.raw_values() == element_data, "Contiguous list child is zero-copy");
+
+    // Out-of-order entries are gathered
+    entries[0] = list_entry_t(1, 2);
+    entries[3] = list_entry_t(0, 1);
+    result = DuckDBToArrowConverter::ConvertVector(lists, 4);
+    auto& gathered = static_cast<const arrow::ListArray&>(*result.GetValue());
+    auto& gathered_values = static_cast<const arrow::Int32Array&>(*gathered.values());
+    TEST_ASSERT(gathered_values.Value(0) == 2 && gathered_values.Value(1) == 3 && gathered_values.Value(2) == 1,
+                "Non-contiguous list elements gathered in row order");
+
+    auto row_type = LogicalType::STRUCT({{"a", LogicalType::INTEGER}, {"b", LogicalType::VARCHAR}});
+    Vector rows(row_type, 2);
+    rows.SetValue(0, Value::STRUCT({{"a", Value::INTEGER(7)}, {"b", Value("seven")}}));
+    rows.SetValue(1, Value(row_type));
+    result = DuckDBToArrowConverter::ConvertVector(rows, 2);
+    TEST_ASSERT(result.IsValid(), "STRUCT vector conversion");
+    auto& struct_array = static_cast<const arrow::StructArray&>(*result.GetValue());
+    TEST_ASSERT(struct_array.IsNull(1) && !struct_array.IsNull(0), "Struct validity");
+    TEST_ASSERT(static_cast<const arrow::Int32Array&>(*struct_array.field(0)).raw_values() ==
+                FlatVector::GetData<int32_t>(*StructVector::GetEntries(rows)[0]),
+                "Struct child is zero-copy");
+    TEST_ASSERT(static_cast<const arrow::StringArray&>(*struct_array.field(1)).GetString(0) == "seven",
+                "Struct string child");
+
+    auto map_type = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::INTEGER);
+    Vector maps(map_type, 1);
+    maps.SetValue(0, Value::MAP(LogicalType::VARCHAR, LogicalType::INTEGER, {Value("k1"), Value("k2")},
+                                {Value::INTEGER(1), Value::INTEGER(2)}));
+    result = DuckDBToArrowConverter::ConvertVector(maps, 1);
+    TEST_ASSERT(result.IsValid() && result.GetValue()->type_id() == arrow::Type::MAP, "MAP vector conversion");
+    auto& map_array = static_cast<const arrow::MapArray&>(*result.GetValue());
+    TEST_ASSERT(map_array.value_length(0) == 2 &&
+                static_cast<const arrow::StringArray&>(*map_array.keys()).GetString(1) == "k2" &&
+                static_cast<const arrow::Int32Array&>(*map_array.items()).Value(1) == 2,
+                "Map keys and items");
+
+    Vector constant_list(Value::LIST(LogicalType::INTEGER, {Value::INTEGER(5)}));
+    result = DuckDBToArrowConverter::ConvertVector(constant_list, 3);
+    TEST_ASSERT(result.IsValid() && static_cast<const arrow::ListArray&>(*result.GetValue()).value_offset(3) == 3,
+                "CONSTANT list vector broadcast");
+
+    return true;
+}
+
+bool TestChunkConversion() {
+    std::cout << "\n=== Testing Chunk Conversion ===" << std::endl;
+    
+    std::vector<LogicalType> types = {LogicalType::INTEGER, LogicalType::VARCHAR};
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), types);
+    chunk.SetValue(0, 0, Value::INTEGER(1));
+    chunk.SetValue(1, 0, Value("one"));
+    chunk.SetValue(0, 1, Value::INTEGER(2));
+    chunk.SetValue(1, 1, Value("two"));
+    chunk.SetCardinality(2);
+
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"id", "label"}, types);
+    auto batch = DuckDBToArrowConverter::ConvertChunk(chunk, schema.GetValue().arrow_schema);
+    TEST_ASSERT(batch.IsValid(), "Chunk conversion");
+    TEST_ASSERT(batch.GetValue()->num_rows() == 2 && batch.GetValue()->num_columns() == 2, "Batch shape");
+
+    auto unsupported = SnowflakeTypeConverter::ConvertSchema({"id"}, {LogicalType::INTEGER});
+    auto mismatch = DuckDBToArrowConverter::ConvertChunk(chunk, unsupported.GetValue().arrow_schema);
+    TEST_ASSERT(!mismatch.IsValid(), "Column count mismatch rejected");
+
+    return true;
+}
+
+bool TestDictionaryEncoding() {
+    std::cout << "\n=== Testing Dictionary Encoding ===" << std::endl;
+
+    Vector entries(LogicalType::VARCHAR, 3);
+    auto strings = FlatVector::GetData<string_t>(entries);
+    strings[0] = StringVector::AddString(entries, "germany");
+    strings[1] = StringVector::AddString(entries, "france");
+    FlatVector::SetNull(entries, 2, true);
+    SelectionVector sel(5);
+    sel.set_index(0, 1);
+    sel.set_index(1, 0);
+    sel.set_index(2, 1);
+    sel.set_index(3, 2);
+    sel.set_index(4, 0);
+    Vector dictionary(entries, sel, 5);
+
+    auto gathered = DuckDBToArrowConverter::ConvertVector(dictionary, 5);
+    TEST_ASSERT(gathered.IsValid() && gathered.GetValue()->type_id() == arrow::Type::STRING,
+                "DICTIONARY vector gathered by default");
+
+    ArrowConversionOptions options;
+    options.keep_dictionaries = true;
+    auto kept = DuckDBToArrowConverter::ConvertVector(dictionary, 5, options);
+    TEST_ASSERT(kept.IsValid() && kept.GetValue()->type()->Equals(*arrow::dictionary(arrow::int32(), arrow::utf8())),
+                "keep_dictionaries produces dictionary<int32, utf8>");
+    auto& kept_array = static_cast<const arrow::DictionaryArray&>(*kept.GetValue());
+    TEST_ASSERT(kept_array.dictionary()->length() == 3, "DuckDB dictionary reused as the Arrow dictionary");
+    TEST_ASSERT(kept_array.GetValueIndex(0) == 1 && kept_array.GetValueIndex(4) == 0, "Selection copied to indices");
+    TEST_ASSERT(kept_array.IsNull(3) && kept_array.null_count() == 1, "NULL entry becomes a NULL row");
+    TEST_ASSERT(kept.GetValue()->ValidateFull().ok(), "Dictionary array is valid");
+
+    Vector flat(LogicalType::VARCHAR, 6);
+    auto flat_strings = FlatVector::GetData<string_t>(flat);
+    const char *countries[] = {"chile", "peru", "chile", "chile", "peru", "chile"};
+    for (idx_t i = 0; i < 6; i++) {
+        flat_strings[i] = StringVector::AddString(flat, countries[i]);
+    }
+    DataChunk chunk;
+    chunk.InitializeEmpty({LogicalType::VARCHAR, LogicalType::INTEGER});
+    chunk.data[0].Reference(flat);
+    chunk.data[1].Reference(Value::INTEGER(7));
+    chunk.SetCardinality(6);
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"country", "n"}, {LogicalType::VARCHAR, LogicalType::INTEGER});
+    auto encoded_schema = DuckDBToArrowConverter::DictionaryEncodeStrings(schema.GetValue().arrow_schema);
+    TEST_ASSERT(encoded_schema->field(0)->type()->id() == arrow::Type::DICTIONARY &&
+                    encoded_schema->field(1)->type()->id() == arrow::Type::INT32,
+                "Only string fields dictionary-encoded");
+    TEST_ASSERT(encoded_schema->field(0)->metadata() != nullptr, "Field metadata kept");
+
+    auto batch = DuckDBToArrowConverter::ConvertChunk(chunk, encoded_schema);
+    TEST_ASSERT(batch.IsValid(), "Chunk converted to the dictionary schema");
+    auto& country = static_cast<const arrow::DictionaryArray&>(*batch.GetValue()->column(0));
+    TEST_ASSERT(country.dictionary()->length() == 2, "FLAT vector hash-encoded to its distinct values");
+    TEST_ASSERT(country.GetValueIndex(2) == 0 && country.GetValueIndex(4) == 1, "Indices follow first occurrence");
+    TEST_ASSERT(batch.GetValue()->ValidateFull().ok(), "Encoded batch is valid");
+
+    chunk.data[0].Reference(dictionary);
+    chunk.SetCardinality(5);
+    auto from_dictionary = DuckDBToArrowConverter::ConvertChunk(chunk, encoded_schema);
+    TEST_ASSERT(from_dictionary.IsValid() &&
+                    static_cast<const arrow::DictionaryArray&>(*from_dictionary.GetValue()->column(0))
+                            .dictionary()
+                            ->length() == 3,
+                "DICTIONARY vector keeps its dictionary in ConvertChunk");
+
+    auto wrong = arrow::schema({arrow::field("country", arrow::utf8()),
+                                arrow::field("n", arrow::dictionary(arrow::int32(), arrow::int32()))});
+    TEST_ASSERT(!DuckDBToArrowConverter::ConvertChunk(chunk, wrong).IsValid(),
+                "Dictionary encoding of non-string columns rejected");
+
+    return true;
+}
+
+bool TestStringViews() {
+    std::cout << "\n=== Testing String Views ===" << std::endl;
+
+    const char *bodies[] = {"tiny", "a string that needs the out-of-line heap", "exactly12chr",
+                            "another string well past the inline limit", "", "tiny"};
+    Vector vector(LogicalType::VARCHAR, 7);
+    auto strings = FlatVector::GetData<string_t>(vector);
+    for (idx_t i = 0; i < 6; i++) {
+        strings[i] = StringVector::AddString(vector, bodies[i]);
+    }
+    FlatVector::SetNull(vector, 6, true);
+
+    ArrowConversionOptions options;
+    options.string_views = true;
+    auto views = DuckDBToArrowConverter::ConvertVector(vector, 7, options);
+    TEST_ASSERT(views.IsValid() && views.GetValue()->type_id() == arrow::Type::STRING_VIEW,
+                "string_views produces string_view");
+    TEST_ASSERT(views.GetValue()->ValidateFull().ok(), "View array is valid");
+    auto& view_array = static_cast<const arrow::StringViewArray&>(*views.GetValue());
+    for (idx_t i = 0; i < 6; i++) {
+        TEST_ASSERT(view_array.GetView(static_cast<int64_t>(i)) == bodies[i], "Row " + std::to_string(i) + " kept");
+    }
+    TEST_ASSERT(view_array.IsNull(6), "NULL row kept");
+    TEST_ASSERT(view_array.GetView(1).data() == strings[1].GetData() &&
+                    view_array.GetView(3).data() == strings[3].GetData(),
+                "Out-of-line views alias DuckDB's string heap");
+
+    options.zero_copy = false;
+    auto copied = DuckDBToArrowConverter::ConvertVector(vector, 7, options);
+    TEST_ASSERT(copied.IsValid() && copied.GetValue()->ValidateFull().ok(), "Copied view array is valid");
+    auto& copied_array = static_cast<const arrow::StringViewArray&>(*copied.GetValue());
+    TEST_ASSERT(copied_array.data()->buffers.size() == 3 && copied_array.GetView(1).data() != strings[1].GetData() &&
+                    copied_array.GetView(3) == bodies[3],
+                "Without zero-copy long strings are copied into one data buffer");
+
+    // Views over a DICTIONARY vector alias the dictionary's heap
+    SelectionVector sel(3);
+    sel.set_index(0, 3);
+    sel.set_index(1, 0);
+    sel.set_index(2, 3);
+    Vector dictionary(vector, sel, 3);
+    options.zero_copy = true;
+    auto from_dictionary = DuckDBToArrowConverter::ConvertVector(dictionary, 3, options);
+    auto& dictionary_array = static_cast<const arrow::StringViewArray&>(*from_dictionary.GetValue());
+    TEST_ASSERT(from_dictionary.IsValid() && dictionary_array.GetView(2) == bodies[3] &&
+                    dictionary_array.GetView(0).data() == strings[3].GetData(),
+                "DICTIONARY vector rows alias the child heap");
+
+    // ConvertChunk follows view and large schema fields
+    DataChunk chunk;
+    chunk.InitializeEmpty({LogicalType::VARCHAR, LogicalType::BLOB});
+    chunk.data[0].Reference(vector);
+    chunk.data[1].Reference(Value::BLOB("payload bytes past the inline limit"));
+    chunk.SetCardinality(7);
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"body", "raw"}, {LogicalType::VARCHAR, LogicalType::BLOB});
+    auto view_schema = DuckDBToArrowConverter::ViewEncodeStrings(schema.GetValue().arrow_schema);
+    TEST_ASSERT(view_schema->field(0)->type()->id() == arrow::Type::STRING_VIEW &&
+                    view_schema->field(1)->type()->id() == arrow::Type::BINARY_VIEW,
+                "String and binary fields view-encoded");
+    auto batch = DuckDBToArrowConverter::ConvertChunk(chunk, view_schema);
+    TEST_ASSERT(batch.IsValid() && batch.GetValue()->schema() == view_schema && batch.GetValue()->ValidateFull().ok(),
+                "Chunk converted to the view schema");
+
+    auto large_schema = arrow::schema({arrow::field("body", arrow::large_utf8()),
+                                       arrow::field("raw", arrow::large_binary())});
+    auto large = DuckDBToArrowConverter::ConvertChunk(chunk, large_schema);
+    TEST_ASSERT(large.IsValid() && large.GetValue()->column(0)->type_id() == arrow::Type::LARGE_STRING &&
+                    large.GetValue()->ValidateFull().ok(),
+                "Chunk converted to large_utf8 / large_binary");
+
+    auto wrong = arrow::schema({arrow::field("body", arrow::binary_view()), arrow::field("raw", arrow::binary())});
+    TEST_ASSERT(!DuckDBToArrowConverter::ConvertChunk(chunk, wrong).IsValid(), "VARCHAR as binary_view rejected");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting DuckDBToArrowConverter tests..." << std::endl;
+    
+    bool all_passed = true;
+    
+    all_passed &= TestValidityKernels();
+    all_passed &= TestFlatVectors();
+    all_passed &= TestConstantAndDictionaryVectors();
+    all_passed &= TestNestedVectors();
+    all_passed &= TestChunkConversion();
+    all_passed &= TestDictionaryEncoding();
+    all_passed &= TestStringViews();
+    
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,156 @@
+#include <iostream>
+#include <string>
+#include "conversion_validator.hpp"
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+bool TestFullValidation() {
+    std::cout << "\n=== Testing Full Validation ===" << std::endl;
+
+    const idx_t count = 3000;
+    Vector source(LogicalType::BIGINT, count);
+    Vector target(LogicalType::BIGINT, count);
+    auto source_data = FlatVector::GetData<int64_t>(source);
+    auto target_data = FlatVector::GetData<int64_t>(target);
+    for (idx_t i = 0; i < count; i++) {
+        source_data[i] = target_data[i] = static_cast<int64_t>(i * 31);
+    }
+    auto result = SnowflakeTypeConverter::ValidateConversion(LogicalType::BIGINT, LogicalType::BIGINT, source, target,
+                                                             count);
+    TEST_ASSERT(result.IsValid(), "Identical columns validate");
+
+    target_data[2500] = -1;
+    result = SnowflakeTypeConverter::ValidateConversion(LogicalType::BIGINT, LogicalType::BIGINT, source, target,
+                                                        count);
+    TEST_ASSERT(!result.IsValid(), "Changed value detected");
+    TEST_ASSERT(result.GetError().find("row 2500") != std::string::npos, "Error names the row");
+
+    target_data[2500] = source_data[2500];
+    FlatVector::SetNull(target, 10, true);
+    result = SnowflakeTypeConverter::ValidateConversion(LogicalType::BIGINT, LogicalType::BIGINT, source, target,
+                                                        count);
+    TEST_ASSERT(!result.IsValid() && result.GetError().find("row 10") != std::string::npos, "Lost value detected");
+
+    // Canonical comparison across decimal scales and storage
+    Vector narrow(LogicalType::DECIMAL(9, 2), 2);
+    Vector wide(LogicalType::DECIMAL(38, 4), 2);
+    FlatVector::GetData<int32_t>(narrow)[0] = 12345;
+    FlatVector::GetData<int32_t>(narrow)[1] = -7;
+    FlatVector::GetData<hugeint_t>(wide)[0] = hugeint_t(1234500);
+    FlatVector::GetData<hugeint_t>(wide)[1] = hugeint_t(-700);
+    result = SnowflakeTypeConverter::ValidateConversion(narrow.GetType(), wide.GetType(), narrow, wide, 2);
+    TEST_ASSERT(result.IsValid(), "DECIMAL(9,2) validates against DECIMAL(38,4)");
+
+    Vector strings(LogicalType::VARCHAR, 2);
+    result = SnowflakeTypeConverter::ValidateConversion(narrow.GetType(), strings.GetType(), narrow, strings, 2);
+    TEST_ASSERT(!result.IsValid(), "Incomparable types rejected");
+
+    result = SnowflakeTypeConverter::ValidateConversion(LogicalType::INTEGER, wide.GetType(), narrow, wide, 2);
+    TEST_ASSERT(!result.IsValid(), "Declared type must match the vector");
+
+    return true;
+}
+
+bool TestSampledValidation() {
+    std::cout << "\n=== Testing Sampled Validation ===" << std::endl;
+
+    const idx_t count = 1000;
+    Vector source(LogicalType::VARCHAR, count);
+    Vector target(LogicalType::VARCHAR, count);
+    for (idx_t i = 0; i < count; i++) {
+        auto value = "value-" + std::to_string(i);
+        FlatVector::GetData<string_t>(source)[i] = StringVector::AddString(source, value);
+        FlatVector::GetData<string_t>(target)[i] = StringVector::AddString(target, value);
+    }
+    FlatVector::GetData<string_t>(target)[15] = StringVector::AddString(target, "changed");
+
+    ValidationOptions options;
+    options.mode = ValidationMode::SAMPLED;
+    options.sample_fraction = 0.1;
+    options.sample_seed = 0;
+    auto result = ConversionValidator::Validate(source, target, count, options);
+    TEST_ASSERT(result.IsValid(), "Row outside the sample is not compared");
+
+    options.sample_seed = 5;
+    result = ConversionValidator::Validate(source, target, count, options);
+    TEST_ASSERT(!result.IsValid() && result.GetError().find("row 15") != std::string::npos,
+                "Row inside the sample is compared");
+
+    options.sample_fraction = 0;
+    result = ConversionValidator::Validate(source, target, count, options);
+    TEST_ASSERT(!result.IsValid(), "Invalid sample fraction rejected");
+
+    return true;
+}
+
+bool TestChecksumValidation() {
+    std::cout << "\n=== Testing Checksum Validation ===" << std::endl;
+
+    const idx_t count = 100;
+    Vector source(LogicalType::DECIMAL(10, 2), count);
+    Vector reversed(LogicalType::DECIMAL(10, 2), count);
+    for (idx_t i = 0; i < count; i++) {
+        FlatVector::GetData<int64_t>(source)[i] = static_cast<int64_t>(i * 101);
+        FlatVector::GetData<int64_t>(reversed)[count - 1 - i] = static_cast<int64_t>(i * 101);
+    }
+    FlatVector::SetNull(source, 3, true);
+    FlatVector::SetNull(reversed, count - 1 - 3, true);
+
+    ValidationOptions options;
+    options.mode = ValidationMode::CHECKSUM;
+    auto result = ConversionValidator::Validate(source, reversed, count, options);
+    TEST_ASSERT(result.IsValid(), "Checksum is order independent");
+
+    FlatVector::GetData<int64_t>(reversed)[0] += 1;
+    result = ConversionValidator::Validate(source, reversed, count, options);
+    TEST_ASSERT(!result.IsValid() && result.GetError().find("Checksum mismatch") != std::string::npos,
+                "Checksum detects a changed value");
+
+    auto checksum = ConversionValidator::ComputeChecksum(source, count);
+    TEST_ASSERT(checksum.row_count == 100 && checksum.null_count == 1, "Row and null counts");
+    TEST_ASSERT(checksum.value_sum == hugeint_t(101 * (99 * 100 / 2 - 3)), "Exact sum of unscaled values");
+
+    auto partial = ConversionValidator::ComputeChecksum(source, 50);
+    ColumnChecksum combined = partial;
+    Vector tail(LogicalType::DECIMAL(10, 2), 50);
+    for (idx_t i = 0; i < 50; i++) {
+        FlatVector::GetData<int64_t>(tail)[i] = static_cast<int64_t>((i + 50) * 101);
+    }
+    combined.Combine(ConversionValidator::ComputeChecksum(tail, 50));
+    TEST_ASSERT(combined.Matches(checksum), "Batch checksums combine");
+
+    auto sql = ConversionValidator::BuildSnowflakeChecksumSQL("amount", LogicalType::DECIMAL(10, 2));
+    TEST_ASSERT(sql == "COUNT(*), COUNT(\"amount\"), (SUM(\"amount\") * 100)::NUMBER(38,0)", "Snowflake checksum SQL");
+    auto remote = ColumnChecksum::FromSnowflakeAggregates(100, 99, Hugeint::ToString(checksum.value_sum));
+    TEST_ASSERT(remote.MatchesAggregates(checksum), "Snowflake aggregates compare with the local checksum");
+    remote = ColumnChecksum::FromSnowflakeAggregates(100, 100, Hugeint::ToString(checksum.value_sum));
+    TEST_ASSERT(!remote.MatchesAggregates(checksum), "Null count difference detected");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting ConversionValidator tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestFullValidation();
+    all_passed &= TestSampledValidation();
+    all_passed &= TestChecksumValidation();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
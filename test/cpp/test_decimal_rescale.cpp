@@ -0,0 +1,134 @@
+#include <iostream>
+#include <string>
+#include "decimal_rescale.hpp"
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+bool TestDecimalAdjustment() {
+    std::cout << "\n=== Testing Decimal Adjustment ===" << std::endl;
+
+    auto adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(45, 5);
+    TEST_ASSERT(adjustment.adjusted_precision == 38 && adjustment.adjusted_scale == 0, "(45,5) -> (38,0)");
+    TEST_ASSERT(adjustment.precision_reduced && adjustment.scale_reduced, "Both reductions reported");
+
+    adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(42, 10);
+    TEST_ASSERT(adjustment.adjusted_precision == 38 && adjustment.adjusted_scale == 6, "(42,10) -> (38,6)");
+
+    adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(18, 4);
+    TEST_ASSERT(!adjustment.precision_reduced && !adjustment.scale_reduced, "(18,4) unchanged");
+
+    TEST_ASSERT(DecimalRescaleKernel::GetSnowflakeDecimalType(LogicalType::HUGEINT) == LogicalType::DECIMAL(38, 0),
+                "HUGEINT -> DECIMAL(38,0)");
+    TEST_ASSERT(DecimalRescaleKernel::GetSnowflakeDecimalType(LogicalType::INTEGER) == LogicalType::DECIMAL(10, 0),
+                "INTEGER -> DECIMAL(10,0)");
+    TEST_ASSERT(DecimalRescaleKernel::GetSnowflakeDecimalType(LogicalType::VARCHAR).id() == LogicalTypeId::INVALID,
+                "VARCHAR has no decimal type");
+
+    return true;
+}
+
+bool TestRescaleKernel() {
+    std::cout << "\n=== Testing Rescale Kernel ===" << std::endl;
+
+    // Upscale without possible overflow: DECIMAL(9,2) -> DECIMAL(18,4)
+    Vector source(LogicalType::DECIMAL(9, 2), 4);
+    auto source_data = FlatVector::GetData<int32_t>(source);
+    source_data[0] = 12345;     // 123.45
+    source_data[1] = -1;        // -0.01
+    source_data[2] = 999999999; // 9999999.99
+    FlatVector::SetNull(source, 3, true);
+    Vector widened(LogicalType::DECIMAL(18, 4), 4);
+    auto result = DecimalRescaleKernel::Rescale(source, 4, widened);
+    TEST_ASSERT(result.IsValid(), "Exact upscale");
+    auto widened_data = FlatVector::GetData<int64_t>(widened);
+    TEST_ASSERT(widened_data[0] == 1234500 && widened_data[1] == -100, "Values multiplied by 10^2");
+    TEST_ASSERT(FlatVector::IsNull(widened, 3), "NULL carried over");
+    TEST_ASSERT(result.GetValue().rows_rounded == 0 && result.GetValue().rows_out_of_range == 0, "No rows affected");
+
+    // Downscale with rounding: DECIMAL(9,2) -> DECIMAL(9,0)
+    Vector rounded(LogicalType::DECIMAL(9, 0), 4);
+    result = DecimalRescaleKernel::Rescale(source, 4, rounded);
+    auto rounded_data = FlatVector::GetData<int32_t>(rounded);
+    TEST_ASSERT(result.IsValid() && rounded_data[0] == 123 && rounded_data[1] == 0, "Rounded half away from zero");
+    TEST_ASSERT(rounded_data[2] == 10000000, "Carry from rounding");
+    TEST_ASSERT(result.GetValue().rows_rounded == 3, "Rounded rows counted (NULL excluded)");
+
+    // Narrowing with overflow: DECIMAL(9,2) -> DECIMAL(4,2)
+    Vector narrow(LogicalType::DECIMAL(4, 2), 4);
+    result = DecimalRescaleKernel::Rescale(source, 4, narrow, DecimalOverflowPolicy::ERROR);
+    TEST_ASSERT(!result.IsValid(), "ERROR policy fails");
+    TEST_ASSERT(result.GetError().find("row 0") != std::string::npos, "Error names the first row");
+
+    result = DecimalRescaleKernel::Rescale(source, 4, narrow, DecimalOverflowPolicy::SET_NULL);
+    TEST_ASSERT(result.IsValid() && result.GetValue().rows_out_of_range == 2, "Out-of-range rows counted");
+    TEST_ASSERT(FlatVector::IsNull(narrow, 0) && !FlatVector::IsNull(narrow, 1) && FlatVector::IsNull(narrow, 2),
+                "SET_NULL nulls only the overflowing rows");
+    TEST_ASSERT(FlatVector::GetData<int16_t>(narrow)[1] == -1, "Fitting row kept");
+    TEST_ASSERT(!FlatVector::IsNull(source, 0), "Source validity untouched");
+
+    Vector saturated(LogicalType::DECIMAL(4, 2), 4);
+    result = DecimalRescaleKernel::Rescale(source, 4, saturated, DecimalOverflowPolicy::SATURATE);
+    TEST_ASSERT(result.IsValid() && FlatVector::GetData<int16_t>(saturated)[0] == 9999, "SATURATE clamps to 99.99");
+
+    return true;
+}
+
+bool TestHugeintRescale() {
+    std::cout << "\n=== Testing HUGEINT Rescale ===" << std::endl;
+
+    // HUGEINT holds 39 digits; NUMBER(38,0) does not
+    Vector source(LogicalType::HUGEINT, 3);
+    auto data = FlatVector::GetData<hugeint_t>(source);
+    data[0] = hugeint_t(42);
+    data[1] = Hugeint::POWERS_OF_TEN[38];
+    data[2] = -Hugeint::POWERS_OF_TEN[38];
+    Vector result(DecimalRescaleKernel::GetSnowflakeDecimalType(LogicalType::HUGEINT), 3);
+    auto stats = DecimalRescaleKernel::AdjustForSnowflake(source, 3, result, DecimalOverflowPolicy::SATURATE);
+    TEST_ASSERT(stats.IsValid() && stats.GetValue().rows_out_of_range == 2, "39-digit values detected");
+    TEST_ASSERT(result.GetValue(0).ToString() == "42", "Small value kept");
+    TEST_ASSERT(result.GetValue(2).ToString() == "-" + std::string(38, '9'), "Negative value saturated");
+
+    // DECIMAL(38,10) -> DECIMAL(18,2): hugeint source into int64 storage
+    Vector wide(LogicalType::DECIMAL(38, 10), 2);
+    auto wide_data = FlatVector::GetData<hugeint_t>(wide);
+    wide_data[0] = hugeint_t(123456789012LL);  // 12.3456789012
+    wide_data[1] = Hugeint::POWERS_OF_TEN[30]; // 10^20
+    Vector narrow(LogicalType::DECIMAL(18, 2), 2);
+    stats = DecimalRescaleKernel::Rescale(wide, 2, narrow, DecimalOverflowPolicy::SET_NULL);
+    TEST_ASSERT(stats.IsValid() && FlatVector::GetData<int64_t>(narrow)[0] == 1235, "Rescaled into int64 storage");
+    TEST_ASSERT(FlatVector::IsNull(narrow, 1), "Overflowing hugeint nulled");
+
+    // Constant input
+    Vector constant(Value::DECIMAL(int64_t(150), 4, 2));
+    Vector from_constant(LogicalType::DECIMAL(4, 1), 8);
+    stats = DecimalRescaleKernel::Rescale(constant, 8, from_constant);
+    TEST_ASSERT(stats.IsValid() && FlatVector::GetData<int16_t>(from_constant)[7] == 15, "Constant vector flattened");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting DecimalRescaleKernel tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestDecimalAdjustment();
+    all_passed &= TestRescaleKernel();
+    all_passed &= TestHugeintRescale();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,386 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "snowflake_arrow_decoder.hpp"
+#include <arrow/api.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+template<typename BUILDER, typename T>
+std::shared_ptr<arrow::Array> BuildArray(const std::vector<T>& values, const std::vector<bool>& valid = {}) {
+    BUILDER builder;
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!valid.empty() && !valid[i]) {
+            (void)builder.AppendNull();
+        } else {
+            (void)builder.Append(values[i]);
+        }
+    }
+    return builder.Finish().ValueOrDie();
+}
+
+std::shared_ptr<arrow::Field> ScaledField(const std::string& name, const std::shared_ptr<arrow::DataType>& type,
+                                          int scale) {
+    return arrow::field(name, type, true, arrow::key_value_metadata({"scale"}, {std::to_string(scale)}));
+}
+
+bool TestNumberDecoding() {
+    std::cout << "\n=== Testing NUMBER Decoding ===" << std::endl;
+
+    auto target = LogicalType::DECIMAL(10, 2);
+    auto decoder = SnowflakeColumnDecoder::Create(*ScaledField("amount", arrow::int8(), 2), target);
+    TEST_ASSERT(decoder.IsValid(), "Decoder for NUMBER(10,2)");
+    TEST_ASSERT(decoder.GetValue().GetSourceScale() == 2, "Scale read from field metadata");
+
+    // Batch 1: Snowflake chose int8
+    Vector result(target);
+    auto narrow = BuildArray<arrow::Int8Builder, int8_t>({125, -7, 0}, {true, true, false});
+    auto decoded = decoder.GetValue().Decode(*narrow, 0, 3, result);
+    TEST_ASSERT(decoded.IsValid() && decoded.GetValue() == 3, "int8 batch decoded");
+    auto values = FlatVector::GetData<int64_t>(result);
+    TEST_ASSERT(values[0] == 125 && values[1] == -7, "int8 widened into DECIMAL(10,2) storage");
+    TEST_ASSERT(FlatVector::IsNull(result, 2), "NULL preserved");
+
+    // Batch 2: same column, int64 encoding
+    auto wide = BuildArray<arrow::Int64Builder, int64_t>({99999999, -1});
+    decoded = decoder.GetValue().Decode(*wide, 0, 2, result);
+    TEST_ASSERT(decoded.IsValid() && values[0] == 99999999, "Encoding may change between batches");
+    TEST_ASSERT(!FlatVector::IsNull(result, 1), "Validity reset for batches without nulls");
+
+    // Rescale: values sent at scale 4 into DECIMAL(10,2)
+    auto rescaled = SnowflakeColumnDecoder::Create(*ScaledField("amount", arrow::int32(), 4), target);
+    auto scaled = BuildArray<arrow::Int32Builder, int32_t>({12345, -12355, 100});
+    decoded = rescaled.GetValue().Decode(*scaled, 0, 3, result);
+    TEST_ASSERT(decoded.IsValid() && values[0] == 123 && values[1] == -124 && values[2] == 1,
+                "Downscale rounds half away from zero");
+
+    // Overflow is reported, not truncated
+    auto small_target = LogicalType::DECIMAL(4, 0);
+    auto small = SnowflakeColumnDecoder::Create(*ScaledField("n", arrow::int64(), 0), small_target);
+    Vector small_result(small_target);
+    auto too_big = BuildArray<arrow::Int64Builder, int64_t>({1, 70000});
+    decoded = small.GetValue().Decode(*too_big, 0, 2, small_result);
+    TEST_ASSERT(!decoded.IsValid(), "Out-of-range value rejected");
+    TEST_ASSERT(decoded.GetError().find("row 1") != std::string::npos, "Error names the row");
+
+    // decimal128 into DECIMAL(38,0)
+    auto huge_target = LogicalType::DECIMAL(38, 0);
+    auto huge = SnowflakeColumnDecoder::Create(*arrow::field("big", arrow::decimal128(38, 0)), huge_target);
+    arrow::Decimal128Builder decimal_builder(arrow::decimal128(38, 0));
+    (void)decimal_builder.Append(arrow::Decimal128("123456789012345678901234567890"));
+    (void)decimal_builder.Append(arrow::Decimal128(-5));
+    auto decimals = decimal_builder.Finish().ValueOrDie();
+    Vector huge_result(huge_target);
+    decoded = huge.GetValue().Decode(*decimals, 0, 2, huge_result);
+    TEST_ASSERT(decoded.IsValid(), "decimal128 batch decoded");
+    TEST_ASSERT(huge_result.GetValue(0).ToString() == "123456789012345678901234567890", "decimal128 copied");
+    TEST_ASSERT(huge_result.GetValue(1).ToString() == "-5", "Negative decimal128 copied");
+
+    // int8 into DECIMAL(38,0): widened into hugeint storage
+    auto int8_values = BuildArray<arrow::Int8Builder, int8_t>({-3, 4});
+    auto widened = SnowflakeColumnDecoder::Create(*ScaledField("big", arrow::int8(), 0), huge_target);
+    decoded = widened.GetValue().Decode(*int8_values, 0, 2, huge_result);
+    TEST_ASSERT(decoded.IsValid() && huge_result.GetValue(0).ToString() == "-3", "int8 widened to hugeint");
+
+    return true;
+}
+
+bool TestTemporalDecoding() {
+    std::cout << "\n=== Testing Temporal Decoding ===" << std::endl;
+
+    // int64 nanoseconds (scale 9) → microseconds, flooring pre-epoch values
+    auto timestamp = SnowflakeColumnDecoder::Create(*ScaledField("ts", arrow::int64(), 9), LogicalType::TIMESTAMP);
+    TEST_ASSERT(timestamp.IsValid(), "Decoder for TIMESTAMP_NTZ(9)");
+    auto nanos = BuildArray<arrow::Int64Builder, int64_t>({1700000000123456789LL, -1});
+    Vector result(LogicalType::TIMESTAMP);
+    auto decoded = timestamp.GetValue().Decode(*nanos, 0, 2, result);
+    auto micros = FlatVector::GetData<int64_t>(result);
+    TEST_ASSERT(decoded.IsValid() && micros[0] == 1700000000123456LL, "Nanoseconds scaled to microseconds");
+    TEST_ASSERT(micros[1] == -1, "Pre-epoch values round toward negative infinity");
+
+    // int64 milliseconds (scale 3) → microseconds
+    auto millis_decoder = SnowflakeColumnDecoder::Create(*ScaledField("ts", arrow::int64(), 3), LogicalType::TIMESTAMP);
+    auto millis = BuildArray<arrow::Int64Builder, int64_t>({1500});
+    decoded = millis_decoder.GetValue().Decode(*millis, 0, 1, result);
+    TEST_ASSERT(decoded.IsValid() && micros[0] == 1500000, "Milliseconds scaled to microseconds");
+
+    // {epoch, fraction, timezone} struct
+    auto epoch = BuildArray<arrow::Int64Builder, int64_t>({1700000000, 0, 5});
+    auto fraction = BuildArray<arrow::Int32Builder, int32_t>({123456789, 1000, 0});
+    auto timezone = BuildArray<arrow::Int32Builder, int32_t>({1440 + 60, 1440, 1440});
+    auto tz_struct = arrow::StructArray::Make({epoch, fraction, timezone}, {"epoch", "fraction", "timezone"})
+                         .ValueOrDie();
+    auto tz_decoder = SnowflakeColumnDecoder::Create(*ScaledField("ts", tz_struct->type(), 9),
+                                                     LogicalType::TIMESTAMP_TZ);
+    Vector tz_result(LogicalType::TIMESTAMP_TZ);
+    decoded = tz_decoder.GetValue().Decode(*tz_struct, 0, 3, tz_result);
+    auto tz_micros = FlatVector::GetData<int64_t>(tz_result);
+    TEST_ASSERT(decoded.IsValid(), "Timestamp struct decoded");
+    TEST_ASSERT(tz_micros[0] == 1700000000123456LL && tz_micros[1] == 1, "Epoch seconds plus fraction");
+
+    // Sliced struct: decode rows [1, 3)
+    decoded = tz_decoder.GetValue().Decode(*tz_struct, 1, 2, tz_result);
+    TEST_ASSERT(decoded.IsValid() && tz_micros[0] == 1 && tz_micros[1] == 5000000, "Struct decoded from an offset");
+
+    // {epoch, timezone} struct with epoch at scale 3
+    auto epoch_millis = BuildArray<arrow::Int64Builder, int64_t>({2500});
+    auto tz_only = BuildArray<arrow::Int32Builder, int32_t>({1440});
+    auto compact = arrow::StructArray::Make({epoch_millis, tz_only}, {"epoch", "timezone"}).ValueOrDie();
+    auto compact_decoder = SnowflakeColumnDecoder::Create(*ScaledField("ts", compact->type(), 3),
+                                                          LogicalType::TIMESTAMP_TZ);
+    decoded = compact_decoder.GetValue().Decode(*compact, 0, 1, tz_result);
+    TEST_ASSERT(decoded.IsValid() && tz_micros[0] == 2500000, "Scaled epoch struct decoded");
+
+    // Nanosecond target keeps every digit of the struct fraction
+    auto ns_decoder = SnowflakeColumnDecoder::Create(*ScaledField("ts", tz_struct->type(), 9),
+                                                     LogicalType::TIMESTAMP_NS);
+    TEST_ASSERT(ns_decoder.IsValid(), "Decoder for TIMESTAMP_NS");
+    Vector ns_result(LogicalType::TIMESTAMP_NS);
+    decoded = ns_decoder.GetValue().Decode(*tz_struct, 0, 2, ns_result);
+    auto ns_values = FlatVector::GetData<int64_t>(ns_result);
+    TEST_ASSERT(decoded.IsValid() && ns_values[0] == 1700000000123456789LL && ns_values[1] == 1000,
+                "Struct decoded to nanoseconds");
+
+    // DATE and TIME
+    auto date_decoder = SnowflakeColumnDecoder::Create(*arrow::field("d", arrow::date32()), LogicalType::DATE);
+    auto days = BuildArray<arrow::Date32Builder, int32_t>({19000, -1});
+    Vector date_result(LogicalType::DATE);
+    decoded = date_decoder.GetValue().Decode(*days, 0, 2, date_result);
+    TEST_ASSERT(decoded.IsValid() && FlatVector::GetData<int32_t>(date_result)[1] == -1, "date32 copied");
+
+    auto time_decoder = SnowflakeColumnDecoder::Create(*ScaledField("t", arrow::int32(), 3), LogicalType::TIME);
+    auto time_values = BuildArray<arrow::Int32Builder, int32_t>({3723004});
+    Vector time_result(LogicalType::TIME);
+    decoded = time_decoder.GetValue().Decode(*time_values, 0, 1, time_result);
+    TEST_ASSERT(decoded.IsValid() && FlatVector::GetData<int64_t>(time_result)[0] == 3723004000LL,
+                "TIME(3) scaled to microseconds");
+
+    return true;
+}
+
+bool TestBatchDecoding() {
+    std::cout << "\n=== Testing Batch Decoding ===" << std::endl;
+
+    auto schema = arrow::schema({ScaledField("id", arrow::int16(), 0), arrow::field("name", arrow::utf8()),
+                                 arrow::field("flag", arrow::boolean()), arrow::field("score", arrow::float64())});
+    auto decoder = SnowflakeBatchDecoder::CreateFromSnowflakeTypes(
+        *schema, {"NUMBER(38,0)", "VARCHAR(100)", "BOOLEAN", "FLOAT"});
+    TEST_ASSERT(decoder.IsValid(), "Decoder bound from Snowflake column types");
+    TEST_ASSERT(decoder.GetValue().GetTypes()[0] == LogicalType::DECIMAL(38, 0), "NUMBER(38,0) target");
+
+    const int64_t rows = STANDARD_VECTOR_SIZE + 10;
+    arrow::Int16Builder ids;
+    arrow::StringBuilder names;
+    arrow::BooleanBuilder flags;
+    arrow::DoubleBuilder scores;
+    for (int64_t i = 0; i < rows; i++) {
+        (void)ids.Append(static_cast<int16_t>(i));
+        (void)names.Append("row" + std::to_string(i));
+        (void)flags.Append(i % 3 == 0);
+        (void)scores.Append(i * 0.5);
+    }
+    auto batch = arrow::RecordBatch::Make(schema, rows,
+                                          {ids.Finish().ValueOrDie(), names.Finish().ValueOrDie(),
+                                           flags.Finish().ValueOrDie(), scores.Finish().ValueOrDie()});
+
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), decoder.GetValue().GetTypes());
+    auto first = decoder.GetValue().Decode(*batch, 0, chunk);
+    TEST_ASSERT(first.IsValid() && first.GetValue() == STANDARD_VECTOR_SIZE, "First slice fills the chunk");
+    auto second = decoder.GetValue().Decode(*batch, STANDARD_VECTOR_SIZE, chunk);
+    TEST_ASSERT(second.IsValid() && second.GetValue() == 10 && chunk.size() == 10, "Remainder decoded");
+    TEST_ASSERT(chunk.GetValue(1, 0).ToString() == "row" + std::to_string(STANDARD_VECTOR_SIZE), "Strings decoded");
+    TEST_ASSERT(chunk.GetValue(2, 1).GetValue<bool>() == ((STANDARD_VECTOR_SIZE + 1) % 3 == 0),
+                "Booleans unpacked from an offset");
+    TEST_ASSERT(chunk.GetValue(3, 2).GetValue<double>() == (STANDARD_VECTOR_SIZE + 2) * 0.5, "Doubles copied");
+
+    auto unsupported = SnowflakeBatchDecoder::Create(*schema, {LogicalType::INTEGER, LogicalType::VARCHAR,
+                                                               LogicalType::BOOLEAN,
+                                                               LogicalType::LIST(LogicalType::INTEGER)});
+    TEST_ASSERT(!unsupported.IsValid(), "Target without a kernel rejected at bind time");
+
+    auto described = arrow::schema({
+        arrow::field("amount", arrow::int32(), true,
+                     arrow::key_value_metadata({"logicalType", "precision", "scale"}, {"FIXED", "9", "2"})),
+        arrow::field("created", arrow::int64(), true,
+                     arrow::key_value_metadata({"logicalType", "scale"}, {"TIMESTAMP_NTZ", "3"})),
+        arrow::field("note", arrow::utf8()),
+    });
+    auto resolved = SnowflakeColumnDecoder::ResolveSnowflakeType(*described->field(1));
+    TEST_ASSERT(resolved.IsValid() && resolved.GetValue() == "TIMESTAMP_NTZ(3)", "Type from field metadata");
+    auto from_schema = SnowflakeBatchDecoder::CreateFromSchema(*described);
+    TEST_ASSERT(from_schema.IsValid(), "Decoder bound from the schema alone");
+    TEST_ASSERT(from_schema.GetValue().GetTypes()[0] == LogicalType::DECIMAL(9, 2) &&
+                from_schema.GetValue().GetTypes()[2] == LogicalType::VARCHAR,
+                "FIXED becomes DECIMAL, plain Arrow types fall back to the type mapping");
+    TEST_ASSERT(from_schema.GetValue().GetNames()[1] == "created", "Column names kept");
+    TEST_ASSERT(from_schema.GetValue().GetTypes()[1] == LogicalType::TIMESTAMP, "Microseconds by default");
+    auto exact = SnowflakeBatchDecoder::CreateFromSchema(*described, true);
+    TEST_ASSERT(exact.IsValid() && exact.GetValue().GetTypes()[1] == LogicalType::TIMESTAMP_MS,
+                "TIMESTAMP_NTZ(3) kept at its own unit on request");
+
+    return true;
+}
+
+bool TestDictionaryDecoding() {
+    std::cout << "\n=== Testing Dictionary Decoding ===" << std::endl;
+
+    auto values = BuildArray<arrow::StringBuilder, std::string>({"active", "closed", "pending"});
+    const int64_t rows = STANDARD_VECTOR_SIZE + 100;
+    arrow::Int8Builder index_builder;
+    for (int64_t i = 0; i < rows; i++) {
+        if (i % 10 == 9) {
+            (void)index_builder.AppendNull();
+        } else {
+            (void)index_builder.Append(static_cast<int8_t>(i % 3));
+        }
+    }
+    auto indices = index_builder.Finish().ValueOrDie();
+    auto type = arrow::dictionary(arrow::int8(), arrow::utf8());
+    auto column = arrow::DictionaryArray::FromArrays(type, indices, values).ValueOrDie();
+
+    auto resolved = SnowflakeColumnDecoder::ResolveSnowflakeType(*arrow::field("status", type));
+    TEST_ASSERT(resolved.IsValid() && resolved.GetValue() == "TEXT", "Dictionary column typed by its values");
+
+    auto schema = arrow::schema({arrow::field("status", type)});
+    auto batch = arrow::RecordBatch::Make(schema, rows, {column});
+    auto decoder = SnowflakeBatchDecoder::CreateFromSchema(*schema);
+    TEST_ASSERT(decoder.IsValid() && decoder.GetValue().GetTypes()[0] == LogicalType::VARCHAR,
+                "Dictionary column decodes to VARCHAR");
+
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), decoder.GetValue().GetTypes());
+    std::vector<SnowflakeDecodedDictionary> dictionaries;
+    auto first = decoder.GetValue().Decode(*batch, 0, chunk, &dictionaries);
+    TEST_ASSERT(first.IsValid() && first.GetValue() == STANDARD_VECTOR_SIZE, "First slice decoded");
+    TEST_ASSERT(chunk.data[0].GetVectorType() == VectorType::DICTIONARY_VECTOR, "Decoded into a DICTIONARY vector");
+    TEST_ASSERT(chunk.GetValue(0, 0).ToString() == "active" && chunk.GetValue(0, 2).ToString() == "pending",
+                "Rows select their dictionary entries");
+    TEST_ASSERT(chunk.GetValue(0, 9).IsNull() && !chunk.GetValue(0, 10).IsNull(), "Null indices decode to NULL");
+    auto shared = dictionaries[0].values.get();
+    TEST_ASSERT(shared != nullptr && dictionaries[0].source == column->data()->dictionary,
+                "Dictionary kept for later slices");
+
+    auto second = decoder.GetValue().Decode(*batch, STANDARD_VECTOR_SIZE, chunk, &dictionaries);
+    TEST_ASSERT(second.IsValid() && second.GetValue() == 100, "Remainder decoded");
+    TEST_ASSERT(dictionaries[0].values.get() == shared, "Dictionary decoded once per batch");
+    // Rows 2049 (null) and 2050 (index 2050 % 3)
+    TEST_ASSERT(chunk.GetValue(0, 1).IsNull() && chunk.GetValue(0, 2).ToString() == "closed",
+                "Slice offsets applied to the indices");
+
+    // Without a cache the dictionary is decoded for the call
+    auto decoded = decoder.GetValue().Decode(*batch, 0, chunk);
+    TEST_ASSERT(decoded.IsValid() && chunk.GetValue(0, 4).ToString() == "closed", "Decoded without a cache");
+
+    // Scaled integer dictionaries go through the NUMBER kernels
+    auto numbers = BuildArray<arrow::Int32Builder, int32_t>({1250, -5});
+    auto number_indices = BuildArray<arrow::UInt16Builder, uint16_t>({1, 0, 1});
+    auto number_type = arrow::dictionary(arrow::uint16(), arrow::int32());
+    auto number_column = arrow::DictionaryArray::FromArrays(number_type, number_indices, numbers).ValueOrDie();
+    auto number_decoder =
+        SnowflakeColumnDecoder::Create(*ScaledField("amount", number_type, 2), LogicalType::DECIMAL(10, 2));
+    TEST_ASSERT(number_decoder.IsValid(), "Decoder for a dictionary-encoded NUMBER");
+    Vector amounts(LogicalType::DECIMAL(10, 2));
+    auto amount_result = number_decoder.GetValue().Decode(*number_column, 0, 3, amounts);
+    TEST_ASSERT(amount_result.IsValid() && amounts.GetValue(0).ToString() == "-0.05" &&
+                    amounts.GetValue(1).ToString() == "12.50",
+                "Dictionary values rescaled");
+
+    // Corrupt indices are reported, not read out of bounds
+    auto bad_indices = BuildArray<arrow::Int32Builder, int32_t>({0, 7});
+    auto bad_column = std::make_shared<arrow::DictionaryArray>(arrow::dictionary(arrow::int32(), arrow::utf8()),
+                                                               bad_indices, values);
+    auto string_decoder = SnowflakeColumnDecoder::Create(*arrow::field("status", bad_column->type()),
+                                                         LogicalType::VARCHAR);
+    Vector statuses(LogicalType::VARCHAR);
+    auto bad = string_decoder.GetValue().Decode(*bad_column, 0, 2, statuses);
+    TEST_ASSERT(!bad.IsValid() && bad.GetError().find("out of range") != std::string::npos,
+                "Out-of-range index rejected");
+
+    return true;
+}
+
+bool TestStringDecoding() {
+    std::cout << "\n=== Testing Zero-Copy String Decoding ===" << std::endl;
+
+    const std::string long_value = "a value longer than the twelve inline bytes";
+    std::vector<std::string> values = {"short", long_value, "", long_value + " again"};
+    auto decoder = SnowflakeColumnDecoder::Create(*arrow::field("body", arrow::utf8()), LogicalType::VARCHAR);
+    TEST_ASSERT(decoder.IsValid(), "Decoder for utf8");
+
+    Vector result(LogicalType::VARCHAR);
+    const char* payload;
+    int64_t payload_size;
+    {
+        auto column = BuildArray<arrow::StringBuilder, std::string>(values, {true, true, false, true});
+        payload = reinterpret_cast<const char*>(column->data()->buffers[2]->data());
+        payload_size = column->data()->buffers[2]->size();
+        auto decoded = decoder.GetValue().Decode(*column, 0, 4, result);
+        TEST_ASSERT(decoded.IsValid(), "utf8 decoded");
+    }
+    // The Arrow array is gone; the vector keeps its data buffer alive
+    auto strings = FlatVector::GetData<string_t>(result);
+    TEST_ASSERT(strings[0].IsInlined() && result.GetValue(0).ToString() == "short", "Short strings are inlined");
+    TEST_ASSERT(!strings[1].IsInlined() && strings[1].GetData() >= payload &&
+                    strings[1].GetData() < payload + payload_size,
+                "Long strings point into the Arrow buffer");
+    TEST_ASSERT(result.GetValue(1).ToString() == long_value && result.GetValue(2).IsNull() &&
+                    result.GetValue(3).ToString() == long_value + " again",
+                "Values read back after the array is released");
+
+    // large_utf8 and string_view take the same path
+    auto large = BuildArray<arrow::LargeStringBuilder, std::string>(values);
+    Vector large_result(LogicalType::VARCHAR);
+    auto large_decoded = decoder.GetValue().Decode(*large, 1, 3, large_result);
+    TEST_ASSERT(large_decoded.IsValid() && large_result.GetValue(0).ToString() == long_value &&
+                    large_result.GetValue(1).ToString().empty(),
+                "large_utf8 decoded with an offset");
+
+    auto views = BuildArray<arrow::StringViewBuilder, std::string>(values, {true, true, true, false});
+    Vector view_result(LogicalType::VARCHAR);
+    auto view_decoded = decoder.GetValue().Decode(*views, 0, 4, view_result);
+    auto view_strings = FlatVector::GetData<string_t>(view_result);
+    TEST_ASSERT(view_decoded.IsValid() && view_result.GetValue(0).ToString() == "short" &&
+                    view_result.GetValue(1).ToString() == long_value && view_result.GetValue(3).IsNull(),
+                "string_view decoded");
+    TEST_ASSERT(view_strings[1].GetData() == reinterpret_cast<const char*>(views->data()->buffers[2]->data()),
+                "Out-of-line views point into their data buffer");
+
+    auto blobs = BuildArray<arrow::BinaryViewBuilder, std::string>({std::string("\x00\x01", 2)});
+    auto blob_decoder = SnowflakeColumnDecoder::Create(*arrow::field("raw", arrow::binary_view()), LogicalType::BLOB);
+    Vector blob_result(LogicalType::BLOB);
+    auto blob_decoded = blob_decoder.GetValue().Decode(*blobs, 0, 1, blob_result);
+    TEST_ASSERT(blob_decoded.IsValid() && FlatVector::GetData<string_t>(blob_result)[0].GetSize() == 2,
+                "binary_view decoded into BLOB");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting SnowflakeArrowDecoder tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestNumberDecoding();
+    all_passed &= TestTemporalDecoding();
+    all_passed &= TestBatchDecoding();
+    all_passed &= TestDictionaryDecoding();
+    all_passed &= TestStringDecoding();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_schema_cache.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string COLUMNS_PATH = "test_snowflake_catalog_columns.arrows";
+const std::string QUERY_LOG = "test_snowflake_catalog_queries.log";
+// Stub tables are files: the table name is the file the stub serves and ingests into
+const std::string SCORES_TABLE = "test_snowflake_catalog_scores.arrows";
+const std::string EVENTS_TABLE = "test_snowflake_catalog_events.arrows";
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                               ";account=stub;user=stub;database=ANALYTICS;stub_information_schema=" +
+                               COLUMNS_PATH + ";stub_query_log=" + QUERY_LOG;
+
+bool WriteFile(const std::string &path, const std::shared_ptr<arrow::RecordBatch> &batch) {
+    auto file = arrow::io::FileOutputStream::Open(path);
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, batch->schema());
+    if (!writer.ok() || !(*writer)->WriteRecordBatch(*batch).ok()) {
+        return false;
+    }
+    return (*writer)->Close().ok() && (*file)->Close().ok();
+}
+
+/**
+ * @brief Two tables in two schemas, plus the INFORMATION_SCHEMA rows describing them
+ */
+bool WriteTables() {
+    arrow::StringBuilder names;
+    arrow::DoubleBuilder scores;
+    for (int i = 0; i < 3; i++) {
+        (void)names.Append("player" + std::to_string(i));
+        (void)scores.Append(1.5 * (i + 1));
+    }
+    auto scores_schema =
+        arrow::schema({arrow::field("NAME", arrow::utf8()), arrow::field("SCORE", arrow::float64())});
+    auto scores_batch =
+        arrow::RecordBatch::Make(scores_schema, 3, {names.Finish().ValueOrDie(), scores.Finish().ValueOrDie()});
+    if (!WriteFile(SCORES_TABLE, scores_batch)) {
+        return false;
+    }
+
+    arrow::Int64Builder ids;
+    arrow::StringBuilder attrs;
+    (void)ids.Append(42);
+    (void)attrs.Append("{\"source\":\"web\"}");
+    auto events_schema =
+        arrow::schema({arrow::field("ID", arrow::int64()), arrow::field("ATTRS", arrow::utf8())});
+    if (!WriteFile(EVENTS_TABLE, arrow::RecordBatch::Make(events_schema, 1,
+                                                          {ids.Finish().ValueOrDie(), attrs.Finish().ValueOrDie()}))) {
+        return false;
+    }
+
+    // TABLE_SCHEMA, TABLE_NAME, COLUMN_NAME, DATA_TYPE, NUMERIC_PRECISION, NUMERIC_SCALE,
+    // DATETIME_PRECISION, CHARACTER_MAXIMUM_LENGTH, IS_NULLABLE
+    struct Row {
+        std::string schema, table, column, data_type;
+        int64_t precision, scale, length;
+    };
+    std::vector<Row> rows = {
+        {"PUBLIC", SCORES_TABLE, "NAME", "TEXT", -1, -1, 100},
+        {"PUBLIC", SCORES_TABLE, "SCORE", "FLOAT", -1, -1, -1},
+        {"PUBLIC", SCORES_TABLE, "PAYLOAD", "MYSTERY", -1, -1, -1},
+        {"STAGING", EVENTS_TABLE, "ID", "NUMBER", 18, 0, -1},
+        {"STAGING", EVENTS_TABLE, "ATTRS", "OBJECT", -1, -1, -1},
+    };
+    arrow::StringBuilder schemas, tables, columns, data_types, nullables;
+    arrow::Int64Builder precisions, scales, datetime_precisions, lengths;
+    auto append_number = [](arrow::Int64Builder &builder, int64_t value) {
+        return value < 0 ? builder.AppendNull() : builder.Append(value);
+    };
+    for (auto &row : rows) {
+        (void)schemas.Append(row.schema);
+        (void)tables.Append(row.table);
+        (void)columns.Append(row.column);
+        (void)data_types.Append(row.data_type);
+        (void)append_number(precisions, row.precision);
+        (void)append_number(scales, row.scale);
+        (void)datetime_precisions.AppendNull();
+        (void)append_number(lengths, row.length);
+        (void)nullables.Append("YES");
+    }
+    auto columns_schema = arrow::schema({arrow::field("TABLE_SCHEMA", arrow::utf8()),
+                                         arrow::field("TABLE_NAME", arrow::utf8()),
+                                         arrow::field("COLUMN_NAME", arrow::utf8()),
+                                         arrow::field("DATA_TYPE", arrow::utf8()),
+                                         arrow::field("NUMERIC_PRECISION", arrow::int64()),
+                                         arrow::field("NUMERIC_SCALE", arrow::int64()),
+                                         arrow::field("DATETIME_PRECISION", arrow::int64()),
+                                         arrow::field("CHARACTER_MAXIMUM_LENGTH", arrow::int64()),
+                                         arrow::field("IS_NULLABLE", arrow::utf8())});
+    return WriteFile(COLUMNS_PATH,
+                     arrow::RecordBatch::Make(columns_schema, rows.size(),
+                                              {schemas.Finish().ValueOrDie(), tables.Finish().ValueOrDie(),
+                                               columns.Finish().ValueOrDie(), data_types.Finish().ValueOrDie(),
+                                               precisions.Finish().ValueOrDie(), scales.Finish().ValueOrDie(),
+                                               datetime_precisions.Finish().ValueOrDie(),
+                                               lengths.Finish().ValueOrDie(), nullables.Finish().ValueOrDie()}));
+}
+
+std::vector<std::string> Queries() {
+    std::ifstream log(QUERY_LOG);
+    std::vector<std::string> queries;
+    std::string line;
+    while (std::getline(log, line)) {
+        queries.push_back(line);
+    }
+    return queries;
+}
+
+bool TestLazyAttach(Connection &con) {
+    std::cout << "\n=== Testing Lazy ATTACH ===" << std::endl;
+
+    auto attached = con.Query("ATTACH '" + CONNECTION + "' AS sf (TYPE snowflake)");
+    TEST_ASSERT(!attached->HasError(), "ATTACH succeeds: " + (attached->HasError() ? attached->GetError() : ""));
+    TEST_ASSERT(Queries().empty(), "ATTACH reads no metadata");
+
+    auto result = con.Query("SELECT COUNT(*), SUM(score) FROM sf.public.\"" + SCORES_TABLE + "\"");
+    TEST_ASSERT(!result->HasError(), "Table scanned: " + (result->HasError() ? result->GetError() : ""));
+    TEST_ASSERT(result->GetValue(0, 0).GetValue<int64_t>() == 3 && result->GetValue(1, 0).GetValue<double>() == 9.0,
+                "Scan returns the table rows");
+
+    auto queries = Queries();
+    TEST_ASSERT(queries.size() == 2 && queries[0].find("WHERE TABLE_SCHEMA = 'PUBLIC'") != std::string::npos,
+                "Lower-case schema resolved with one INFORMATION_SCHEMA query");
+    TEST_ASSERT(queries[1].find("SELECT \"SCORE\" FROM (") == 0 &&
+                    queries[1].find("FROM ANALYTICS.\"PUBLIC\".\"" + SCORES_TABLE + "\"") != std::string::npos,
+                "Scan goes through snowflake_scan with projection pushdown");
+
+    auto again = con.Query("SELECT name FROM sf.\"" + SCORES_TABLE + "\" WHERE score > 2 ORDER BY name");
+    TEST_ASSERT(!again->HasError() && again->RowCount() == 2 && again->GetValue(0, 0).ToString() == "player1",
+                "Default schema PUBLIC, filters applied");
+    TEST_ASSERT(Queries().size() == 3, "Second query reuses the cached metadata");
+
+    return true;
+}
+
+bool TestColumnsAndErrors(Connection &con) {
+    std::cout << "\n=== Testing Columns and Missing Entries ===" << std::endl;
+
+    auto described = con.Query("SELECT column_name, data_type FROM duckdb_columns() WHERE database_name = 'sf' "
+                               "AND table_name = '" + SCORES_TABLE + "' ORDER BY column_index");
+    TEST_ASSERT(!described->HasError() && described->RowCount() == 2, "Unconvertible column left out");
+    TEST_ASSERT(described->GetValue(0, 0).ToString() == "NAME" && described->GetValue(1, 1).ToString() == "DOUBLE",
+                "Columns carry converted types");
+
+    auto semi = con.Query("SELECT data_type FROM duckdb_columns() WHERE database_name = 'sf' AND table_name = '" +
+                          EVENTS_TABLE + "' AND column_name = 'ATTRS'");
+    TEST_ASSERT(!semi->HasError() && semi->RowCount() == 1 && semi->GetValue(0, 0).ToString() == "VARCHAR",
+                "OBJECT column exposed as VARCHAR");
+    auto events = con.Query("SELECT * FROM sf.staging.\"" + EVENTS_TABLE + "\"");
+    TEST_ASSERT(!events->HasError(),
+                "SELECT * over an OBJECT column: " + (events->HasError() ? events->GetError() : ""));
+    TEST_ASSERT(events->RowCount() == 1 && events->GetValue(1, 0).ToString() == "{\"source\":\"web\"}",
+                "OBJECT column reads as its JSON text");
+
+    auto missing = con.Query("SELECT * FROM sf.public.nope");
+    TEST_ASSERT(missing->HasError(), "Missing table reported");
+    auto missing_schema = con.Query("SELECT * FROM sf.nope.nope");
+    TEST_ASSERT(missing_schema->HasError(), "Missing schema reported");
+
+    auto tables = con.Query("SELECT schema_name, table_name FROM duckdb_tables() WHERE database_name = 'sf' "
+                            "ORDER BY schema_name");
+    TEST_ASSERT(!tables->HasError() && tables->RowCount() == 2 && tables->GetValue(0, 1).ToString() == "STAGING",
+                "Every schema listed");
+
+    auto update = con.Query("DELETE FROM sf.public.\"" + SCORES_TABLE + "\"");
+    TEST_ASSERT(update->HasError(), "DELETE is rejected");
+
+    return true;
+}
+
+bool TestInsert(Connection &con) {
+    std::cout << "\n=== Testing INSERT ===" << std::endl;
+
+    auto before = con.Query("SELECT COUNT(*) FROM sf.public.\"" + SCORES_TABLE + "\"");
+    TEST_ASSERT(!before->HasError() && before->GetValue(0, 0).GetValue<int64_t>() == 3, "Count before INSERT");
+
+    auto inserted = con.Query("INSERT INTO sf.public.\"" + SCORES_TABLE +
+                              "\" SELECT 'bulk' || i, i::DOUBLE FROM range(5000) t(i)");
+    TEST_ASSERT(!inserted->HasError(), "INSERT succeeds: " + (inserted->HasError() ? inserted->GetError() : ""));
+    TEST_ASSERT(inserted->GetValue(0, 0).GetValue<int64_t>() == 5000, "INSERT reports the rows loaded");
+
+    auto counted = con.Query("SELECT COUNT(*) FROM sf.public.\"" + SCORES_TABLE + "\"");
+    TEST_ASSERT(!counted->HasError() && counted->GetValue(0, 0).GetValue<int64_t>() == 5003,
+                "Inserted rows visible to the same scan run again");
+
+    auto values = con.Query("INSERT INTO sf.public.\"" + SCORES_TABLE + "\" VALUES ('last', 0.5)");
+    TEST_ASSERT(!values->HasError() && values->GetValue(0, 0).GetValue<int64_t>() == 1, "INSERT VALUES");
+
+    return true;
+}
+
+bool TestReadOnly(Connection &con) {
+    std::cout << "\n=== Testing READ_ONLY ===" << std::endl;
+
+    auto attached = con.Query("ATTACH '" + CONNECTION + "' AS sf_ro (TYPE snowflake, READ_ONLY)");
+    TEST_ASSERT(!attached->HasError(), "Read-only ATTACH succeeds");
+    auto inserted = con.Query("INSERT INTO sf_ro.public.\"" + SCORES_TABLE + "\" VALUES ('x', 1)");
+    TEST_ASSERT(inserted->HasError(), "INSERT into a read-only database rejected");
+
+    auto unattached = con.Query("ATTACH 'account=stub' AS sf_bad (TYPE snowflake)");
+    TEST_ASSERT(unattached->HasError(), "ATTACH without a database rejected");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake catalog tests..." << std::endl;
+
+    if (!WriteTables()) {
+        std::cout << "❌ Could not write table files" << std::endl;
+        return 1;
+    }
+    std::remove(QUERY_LOG.c_str());
+    SnowflakeSchemaCache::Get().Clear();
+
+    bool all_passed = true;
+    {
+        DuckDB db(nullptr);
+        SnowflakeExtension::Load(*db.instance);
+        Connection con(db);
+
+        all_passed &= TestLazyAttach(con);
+        all_passed &= TestColumnsAndErrors(con);
+        all_passed &= TestInsert(con);
+        all_passed &= TestReadOnly(con);
+    }
+
+    std::remove(COLUMNS_PATH.c_str());
+    std::remove(SCORES_TABLE.c_str());
+    std::remove(EVENTS_TABLE.c_str());
+    std::remove(QUERY_LOG.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
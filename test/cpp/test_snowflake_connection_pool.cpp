@@ -0,0 +1,307 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_connection_pool.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER + ";account=stub;user=stub;database=stub";
+const std::string RESULT_PATH = "test_snowflake_connection_pool.arrows";
+
+SnowflakeConfig StubConfig(const std::string &database = "stub") {
+    auto config = SnowflakeConfig::Parse(CONNECTION);
+    config.database = database;
+    return config;
+}
+
+// The stub driver reads queries as file names, so "SELECT 1" cannot be used as the health check
+SnowflakePoolOptions StubOptions() {
+    SnowflakePoolOptions options;
+    options.max_size = 2;
+    options.health_check = [](SnowflakeADBCConnector &connector) { return connector.IsConnected(); };
+    return options;
+}
+
+bool WriteResultFile() {
+    auto schema = arrow::schema({arrow::field("id", arrow::int64())});
+    arrow::Int64Builder ids;
+    for (int64_t i = 0; i < 10; i++) {
+        (void)ids.Append(i);
+    }
+    auto batch = arrow::RecordBatch::Make(schema, 10, {ids.Finish().ValueOrDie()});
+    auto file = arrow::io::FileOutputStream::Open(RESULT_PATH);
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    return writer.ok() && (*writer)->WriteRecordBatch(*batch).ok() && (*writer)->Close().ok() &&
+           (*file)->Close().ok();
+}
+
+bool TestReuse() {
+    std::cout << "\n=== Testing Session Reuse ===" << std::endl;
+
+    SnowflakeConnectionPool pool(StubOptions());
+    SnowflakeADBCConnector *first_session = nullptr;
+    {
+        auto leased = pool.Acquire(StubConfig());
+        TEST_ASSERT(leased.first && leased.first->IsConnected(), "Leased a connected session: " + leased.second);
+        first_session = leased.first.get();
+    }
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.misses == 1 && metrics.open_sessions == 1 && metrics.idle_sessions == 1,
+                "Released session returned to the pool");
+
+    auto again = pool.Acquire(StubConfig());
+    TEST_ASSERT(again.first.get() == first_session, "Idle session reused");
+    metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.hits == 1 && metrics.leases == 2 && metrics.idle_sessions == 0, "Reuse counted as a hit");
+
+    auto other = pool.Acquire(StubConfig("other"));
+    TEST_ASSERT(other.first && other.first.get() != first_session, "Other configuration gets its own session");
+
+    auto invalid = pool.Acquire(SnowflakeConfig());
+    TEST_ASSERT(!invalid.first && !invalid.second.empty(), "Connection error reported");
+    TEST_ASSERT(pool.GetMetrics().open_sessions == 2, "Failed connection not counted as open");
+
+    return true;
+}
+
+bool TestOptionOrder() {
+    std::cout << "\n=== Testing Option Order ===" << std::endl;
+
+    // Same options, different insertion order and bucket count, so the maps iterate differently
+    auto ordered = StubConfig();
+    auto reversed = StubConfig();
+    reversed.options.reserve(256);
+    for (int i = 0; i < 16; i++) {
+        ordered.options["opt" + std::to_string(i)] = std::to_string(i);
+        reversed.options["opt" + std::to_string(15 - i)] = std::to_string(15 - i);
+    }
+
+    SnowflakeConnectionPool pool(StubOptions());
+    SnowflakeADBCConnector *first_session = nullptr;
+    {
+        auto leased = pool.Acquire(ordered);
+        TEST_ASSERT(leased.first != nullptr, "Leased with options: " + leased.second);
+        first_session = leased.first.get();
+    }
+    auto again = pool.Acquire(reversed);
+    TEST_ASSERT(again.first.get() == first_session && pool.GetMetrics().hits == 1,
+                "Option order does not split the pool");
+
+    return true;
+}
+
+bool TestDisconnectedNotReturned() {
+    std::cout << "\n=== Testing Broken Sessions ===" << std::endl;
+
+    SnowflakeConnectionPool pool(StubOptions());
+    {
+        auto leased = pool.Acquire(StubConfig());
+        TEST_ASSERT(leased.first != nullptr, "Leased");
+        leased.first->Disconnect();
+    }
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.open_sessions == 0 && metrics.idle_sessions == 0, "Disconnected session closed, not pooled");
+
+    return true;
+}
+
+bool TestMaxSizeAndWait() {
+    std::cout << "\n=== Testing Max Size ===" << std::endl;
+
+    auto options = StubOptions();
+    options.acquire_timeout = std::chrono::milliseconds(50);
+    SnowflakeConnectionPool pool(options);
+
+    auto first = pool.Acquire(StubConfig());
+    auto second = pool.Acquire(StubConfig());
+    TEST_ASSERT(first.first && second.first, "Leased up to max_size");
+
+    auto timed_out = pool.Acquire(StubConfig());
+    TEST_ASSERT(!timed_out.first && timed_out.second.find("Timed out") != std::string::npos,
+                "Acquire times out when every session is leased");
+
+    options.acquire_timeout = std::chrono::seconds(10);
+    pool.Configure(options);
+    auto first_session = first.first.get();
+    std::thread releaser([&first]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        first.first.reset();
+    });
+    auto waited = pool.Acquire(StubConfig());
+    releaser.join();
+    TEST_ASSERT(waited.first.get() == first_session, "Waiter receives the returned session");
+
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.waits == 2 && metrics.max_wait_micros >= 10000 && metrics.open_sessions == 2,
+                "Waits and wait time recorded");
+
+    return true;
+}
+
+bool TestConcurrentLeases() {
+    std::cout << "\n=== Testing Concurrent Leases ===" << std::endl;
+
+    SnowflakeConnectionPool pool(StubOptions());
+    std::atomic<int> failures(0);
+    std::atomic<int> in_use(0);
+    std::atomic<int> max_in_use(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 50; i++) {
+                auto leased = pool.Acquire(StubConfig());
+                if (!leased.first) {
+                    failures++;
+                    continue;
+                }
+                auto now_in_use = ++in_use;
+                auto seen = max_in_use.load();
+                while (now_in_use > seen && !max_in_use.compare_exchange_weak(seen, now_in_use)) {
+                }
+                in_use--;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(failures == 0, "Every lease succeeded");
+    TEST_ASSERT(max_in_use <= 2 && metrics.open_sessions <= 2, "Never more than max_size sessions");
+    TEST_ASSERT(metrics.leases == 400 && metrics.hits + metrics.misses == 400, "Every lease counted");
+
+    return true;
+}
+
+bool TestIdleEviction() {
+    std::cout << "\n=== Testing Idle Eviction ===" << std::endl;
+
+    auto options = StubOptions();
+    options.idle_timeout = std::chrono::milliseconds(0);
+    options.min_size = 1;
+    SnowflakeConnectionPool pool(options);
+    {
+        auto first = pool.Acquire(StubConfig());
+        auto second = pool.Acquire(StubConfig());
+    }
+    TEST_ASSERT(pool.GetMetrics().idle_sessions == 2, "Both sessions idle");
+
+    pool.EvictIdle();
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.evictions == 1 && metrics.open_sessions == 1, "Evicted down to min_size");
+
+    return true;
+}
+
+bool TestHealthCheck() {
+    std::cout << "\n=== Testing Health Check ===" << std::endl;
+
+    auto options = StubOptions();
+    options.health_check_after = std::chrono::milliseconds(0);
+    std::atomic<int> checks(0);
+    options.health_check = [&checks](SnowflakeADBCConnector &) { return ++checks > 1; };
+    SnowflakeConnectionPool pool(options);
+
+    SnowflakeADBCConnector *first_session = nullptr;
+    {
+        auto leased = pool.Acquire(StubConfig());
+        first_session = leased.first.get();
+    }
+    auto replaced = pool.Acquire(StubConfig());
+    TEST_ASSERT(replaced.first && replaced.first.get() != first_session, "Unhealthy session replaced");
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.health_check_failures == 1 && metrics.open_sessions == 1, "Failure counted and session closed");
+
+    return true;
+}
+
+bool TestWarm() {
+    std::cout << "\n=== Testing Warm ===" << std::endl;
+
+    SnowflakeConnectionPool pool(StubOptions());
+    TEST_ASSERT(pool.Warm(StubConfig(), 5).empty(), "Warmed");
+    auto metrics = pool.GetMetrics();
+    TEST_ASSERT(metrics.idle_sessions == 2 && metrics.open_sessions == 2, "Warmed up to max_size");
+
+    auto leased = pool.Acquire(StubConfig());
+    TEST_ASSERT(leased.first && pool.GetMetrics().hits == 1, "First lease served warm");
+    TEST_ASSERT(!pool.Warm(SnowflakeConfig(), 1).empty(), "Warm reports connection errors");
+
+    return true;
+}
+
+bool TestScanUsesPool() {
+    std::cout << "\n=== Testing snowflake_scan Through the Pool ===" << std::endl;
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+
+    auto before = SnowflakeConnectionPool::Get().GetMetrics();
+    auto sql = "SELECT SUM(id) FROM snowflake_scan('" + CONNECTION + "', '" + RESULT_PATH + "')";
+    for (int i = 0; i < 3; i++) {
+        auto result = con.Query(sql);
+        TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == 45,
+                    "Scan executed: " + (result->HasError() ? result->GetError() : ""));
+    }
+    auto after = SnowflakeConnectionPool::Get().GetMetrics();
+    TEST_ASSERT(after.leases - before.leases == 3 && after.hits - before.hits >= 2, "Later scans reuse the session");
+
+    auto stats = con.Query("SELECT leases, hits, open_sessions FROM snowflake_pool_stats()");
+    TEST_ASSERT(!stats->HasError() && stats->GetValue(0, 0).GetValue<uint64_t>() >= 3,
+                "snowflake_pool_stats() reports the pool");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting connection pool tests..." << std::endl;
+
+    if (!WriteResultFile()) {
+        std::cout << "❌ Could not write " << RESULT_PATH << std::endl;
+        return 1;
+    }
+
+    bool all_passed = true;
+
+    all_passed &= TestReuse();
+    all_passed &= TestOptionOrder();
+    all_passed &= TestDisconnectedNotReturned();
+    all_passed &= TestMaxSizeAndWait();
+    all_passed &= TestConcurrentLeases();
+    all_passed &= TestIdleEviction();
+    all_passed &= TestHealthCheck();
+    all_passed &= TestWarm();
+    all_passed &= TestScanUsesPool();
+
+    std::remove(RESULT_PATH.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
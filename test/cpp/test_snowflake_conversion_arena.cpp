@@ -0,0 +1,155 @@
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_conversion_arena.hpp"
+#include "arrow_data_converter.hpp"
+#include <arrow/api.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+bool TestBumpAllocation() {
+    std::cout << "\n=== Testing bump allocation ===" << std::endl;
+
+    SnowflakeConversionArena arena;
+    auto first = arena.Allocate(3);
+    auto second = arena.AllocateArray<uint64_t>(10);
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(first) % SnowflakeConversionArena::ALIGNMENT == 0,
+                "First allocation is aligned");
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(second) % SnowflakeConversionArena::ALIGNMENT == 0,
+                "Second allocation is aligned");
+    TEST_ASSERT(reinterpret_cast<data_ptr_t>(second) == first + SnowflakeConversionArena::ALIGNMENT,
+                "Allocations are consecutive");
+    TEST_ASSERT(arena.GetUsed() == 16 + 80, "Used bytes are rounded to the alignment");
+    TEST_ASSERT(arena.GetBlockAllocations() == 1, "Small allocations share one block");
+
+    arena.Reset();
+    TEST_ASSERT(arena.GetUsed() == 0, "Reset releases everything");
+    TEST_ASSERT(arena.Allocate(3) == first, "Reset rewinds to the start of the block");
+
+    return true;
+}
+
+bool TestGrowthAndMerge() {
+    std::cout << "\n=== Testing growth and merging ===" << std::endl;
+
+    SnowflakeConversionArena arena;
+    // A batch that outgrows the first block
+    for (idx_t i = 0; i < 4; i++) {
+        arena.Allocate(SnowflakeConversionArena::INITIAL_CAPACITY / 2 + 16);
+    }
+    TEST_ASSERT(arena.GetBlockAllocations() > 1, "Allocations past a block start another");
+    auto capacity = arena.GetCapacity();
+
+    arena.Reset();
+    TEST_ASSERT(arena.GetCapacity() == capacity, "Reset merges the blocks into one of the same size");
+    auto blocks = arena.GetBlockAllocations();
+    for (idx_t batch = 0; batch < 10; batch++) {
+        for (idx_t i = 0; i < 4; i++) {
+            arena.Allocate(SnowflakeConversionArena::INITIAL_CAPACITY / 2 + 16);
+        }
+        arena.Reset();
+    }
+    TEST_ASSERT(arena.GetBlockAllocations() == blocks, "Batches of the same shape take no further blocks");
+
+    arena.Allocate(SnowflakeConversionArena::MAX_RETAINED_CAPACITY + 1);
+    arena.Reset();
+    TEST_ASSERT(arena.GetCapacity() == 0, "An oversized block is released on Reset");
+    arena.Allocate(8);
+    TEST_ASSERT(arena.GetCapacity() == SnowflakeConversionArena::INITIAL_CAPACITY,
+                "Allocation after a release starts from the initial capacity");
+
+    return true;
+}
+
+bool TestScopes() {
+    std::cout << "\n=== Testing scopes ===" << std::endl;
+
+    auto &arena = SnowflakeConversionArena::Get();
+    {
+        SnowflakeConversionArena::Scope outer;
+        TEST_ASSERT(&outer.GetArena() == &arena, "Scope uses this thread's arena");
+        arena.Allocate(64);
+        {
+            SnowflakeConversionArena::Scope inner;
+            arena.Allocate(64);
+        }
+        TEST_ASSERT(arena.GetUsed() == 128, "Inner scope keeps the outer scope's memory");
+    }
+    TEST_ASSERT(arena.GetUsed() == 0, "Outer scope resets the arena");
+
+    SnowflakeConversionArena *other = nullptr;
+    std::thread worker([&]() {
+        other = &SnowflakeConversionArena::Get();
+    });
+    worker.join();
+    TEST_ASSERT(other != &arena, "Each thread has its own arena");
+
+    return true;
+}
+
+bool TestConversionScratch() {
+    std::cout << "\n=== Testing conversion scratch ===" << std::endl;
+
+    constexpr idx_t ROWS = 2048;
+    Vector strings(LogicalType::VARCHAR, ROWS);
+    auto data = FlatVector::GetData<string_t>(strings);
+    for (idx_t i = 0; i < ROWS; i++) {
+        data[i] = StringVector::AddString(strings, "status-" + std::to_string(i % 7));
+    }
+    FlatVector::SetNull(strings, 5, true);
+    DataChunk chunk;
+    chunk.InitializeEmpty({LogicalType::VARCHAR});
+    chunk.data[0].Reference(strings);
+    chunk.SetCardinality(ROWS);
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"status"}, {LogicalType::VARCHAR});
+    auto encoded = DuckDBToArrowConverter::DictionaryEncodeStrings(schema.GetValue().arrow_schema);
+
+    auto &arena = SnowflakeConversionArena::Get();
+    auto first = DuckDBToArrowConverter::ConvertChunk(chunk, encoded);
+    TEST_ASSERT(first.IsValid(), "Hash-encoded conversion succeeds");
+    auto &column = static_cast<const arrow::DictionaryArray &>(*first.GetValue()->column(0));
+    TEST_ASSERT(column.dictionary()->length() == 7, "Each distinct value is encoded once");
+    TEST_ASSERT(column.IsNull(5) && column.null_count() == 1, "NULL row stays NULL");
+    TEST_ASSERT(column.GetValueIndex(0) == column.GetValueIndex(7), "Equal values share an index");
+    TEST_ASSERT(first.GetValue()->ValidateFull().ok(), "Batch is valid");
+    TEST_ASSERT(arena.GetUsed() == 0, "Scratch is released after the conversion");
+
+    auto blocks = arena.GetBlockAllocations();
+    for (idx_t batch = 0; batch < 10; batch++) {
+        auto again = DuckDBToArrowConverter::ConvertChunk(chunk, encoded);
+        TEST_ASSERT(again.IsValid() && again.GetValue()->Equals(*first.GetValue()), "Repeated conversion matches");
+    }
+    TEST_ASSERT(arena.GetBlockAllocations() == blocks, "Repeated conversions take no scratch from the heap");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake conversion arena tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestBumpAllocation();
+    all_passed &= TestGrowthAndMerge();
+    all_passed &= TestScopes();
+    all_passed &= TestConversionScratch();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,284 @@
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_ingest.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+// The stub driver ingests into the IPC stream file named by the target table
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER + ";account=stub;user=stub;database=stub";
+const std::string TABLE_PATH = "test_snowflake_ingest_table.arrows";
+
+std::shared_ptr<arrow::Schema> IdSchema() {
+    return arrow::schema({arrow::field("id", arrow::int64())});
+}
+
+std::shared_ptr<arrow::RecordBatch> IdBatch(int64_t start, int64_t count) {
+    arrow::Int64Builder ids;
+    for (int64_t i = 0; i < count; i++) {
+        (void)ids.Append(start + i);
+    }
+    return arrow::RecordBatch::Make(IdSchema(), count, {ids.Finish().ValueOrDie()});
+}
+
+/**
+ * @brief Read the ingested table back through the driver: {rows, sum of the first column}
+ */
+std::pair<int64_t, int64_t> ReadBack(SnowflakeADBCConnector &connector) {
+    auto executed = connector.ExecuteQuery(TABLE_PATH);
+    if (!executed.first) {
+        return {-1, -1};
+    }
+    int64_t rows = 0;
+    int64_t sum = 0;
+    while (auto batch = executed.first->ReadNext().first) {
+        auto ids = std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+        for (int64_t i = 0; i < ids->length(); i++) {
+            sum += ids->Value(i);
+        }
+        rows += batch->num_rows();
+    }
+    return {rows, sum};
+}
+
+bool TestIngestModes() {
+    std::cout << "\n=== Testing Ingest Modes ===" << std::endl;
+    std::remove(TABLE_PATH.c_str());
+
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    auto error = connector.InsertBatch(TABLE_PATH, IdBatch(0, 10));
+    TEST_ASSERT(!error.empty(), "InsertBatch appends, so a missing table is an error");
+
+    auto reader = arrow::RecordBatchReader::Make({IdBatch(0, 10), IdBatch(10, 10)}).ValueOrDie();
+    auto created = connector.IngestStream(TABLE_PATH, SnowflakeIngestMode::CREATE, reader);
+    TEST_ASSERT(created.second.empty() && created.first == 20, "CREATE ingests the stream: " + created.second);
+
+    reader = arrow::RecordBatchReader::Make({IdBatch(0, 1)}).ValueOrDie();
+    auto again = connector.IngestStream(TABLE_PATH, SnowflakeIngestMode::CREATE, reader);
+    TEST_ASSERT(again.second.find("ADBC Error") != std::string::npos, "CREATE on an existing table fails");
+
+    error = connector.InsertBatch(TABLE_PATH, IdBatch(20, 5));
+    TEST_ASSERT(error.empty(), "InsertBatch appends: " + error);
+    TEST_ASSERT(ReadBack(connector) == std::make_pair<int64_t, int64_t>(25, 300), "Appended rows follow existing ones");
+
+    reader = arrow::RecordBatchReader::Make({IdBatch(100, 2)}).ValueOrDie();
+    auto replaced = connector.IngestStream(TABLE_PATH, SnowflakeIngestMode::REPLACE, reader);
+    TEST_ASSERT(replaced.second.empty(), "REPLACE ingests: " + replaced.second);
+    TEST_ASSERT(ReadBack(connector) == std::make_pair<int64_t, int64_t>(2, 201), "REPLACE drops the old rows");
+
+    return true;
+}
+
+bool TestPipeline() {
+    std::cout << "\n=== Testing Ingest Pipeline ===" << std::endl;
+    std::remove(TABLE_PATH.c_str());
+
+    auto connector = std::make_shared<SnowflakeADBCConnector>(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector->Connect().empty(), "Connected");
+
+    SnowflakeIngestOptions options;
+    options.table = TABLE_PATH;
+    options.mode = SnowflakeIngestMode::CREATE;
+    options.max_pending_batches = 2;
+    {
+        // Four producers; a queue of 2 makes them block on the upload
+        SnowflakeIngestPipeline pipeline(connector, IdSchema(), options);
+        std::vector<std::thread> producers;
+        std::vector<string> errors(4);
+        for (int t = 0; t < 4; t++) {
+            producers.emplace_back([&, t]() {
+                for (int64_t b = 0; b < 25; b++) {
+                    auto error = pipeline.Append(IdBatch((t * 25 + b) * 100, 100));
+                    if (!error.empty()) {
+                        errors[t] = error;
+                    }
+                }
+            });
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        for (auto &error : errors) {
+            TEST_ASSERT(error.empty(), "Batch queued: " + error);
+        }
+        auto result = pipeline.Finish();
+        TEST_ASSERT(result.second.empty() && result.first == 10000, "Every row ingested: " + result.second);
+    }
+    TEST_ASSERT(ReadBack(*connector) == std::make_pair<int64_t, int64_t>(10000, 10000LL * 9999 / 2),
+                "Ingested data matches");
+
+    {
+        // Upload fails (table exists): producers are told instead of blocking
+        SnowflakeIngestPipeline pipeline(connector, IdSchema(), options);
+        auto result = pipeline.Finish();
+        TEST_ASSERT(!result.second.empty(), "Upload error reported by Finish");
+        TEST_ASSERT(!pipeline.Append(IdBatch(0, 1)).empty(), "Append after the upload ended fails");
+    }
+
+    {
+        options.mode = SnowflakeIngestMode::APPEND;
+        SnowflakeIngestPipeline pipeline(connector, IdSchema(), options);
+        TEST_ASSERT(pipeline.Append(IdBatch(0, 10)).empty(), "Batch queued");
+        pipeline.Abort("cancelled by test");
+        auto result = pipeline.Finish();
+        TEST_ASSERT(result.second.find("cancelled by test") != std::string::npos, "Abort fails the driver's load");
+    }
+
+    return true;
+}
+
+bool TestCopyTo() {
+    std::cout << "\n=== Testing COPY TO snowflake ===" << std::endl;
+    std::remove(TABLE_PATH.c_str());
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("SET threads = 4");
+    con.Query("CREATE TABLE orders AS SELECT range AS id, (range % 1000)::DECIMAL(18,2) AS amount, "
+              "'order-' || range AS label FROM range(200000)");
+
+    auto copy = "COPY orders TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake, TABLE '" + TABLE_PATH +
+                "', MODE 'create', BATCH_SIZE 10000)";
+    auto result = con.Query(copy);
+    TEST_ASSERT(!result->HasError(), "COPY executed: " + (result->HasError() ? result->GetError() : ""));
+    TEST_ASSERT(result->GetValue(0, 0).GetValue<int64_t>() == 200000, "COPY reports the row count");
+
+    result = con.Query("SELECT COUNT(*), SUM(id), SUM(amount)::BIGINT, COUNT(DISTINCT label) FROM snowflake_scan('" +
+                       CONNECTION + "', '" + TABLE_PATH + "')");
+    TEST_ASSERT(!result->HasError(), "Loaded table scanned: " + (result->HasError() ? result->GetError() : ""));
+    TEST_ASSERT(result->GetValue(0, 0).GetValue<int64_t>() == 200000 &&
+                    result->GetValue(1, 0).GetValue<int64_t>() == 200000LL * 199999 / 2,
+                "Every row loaded once");
+    TEST_ASSERT(result->GetValue(2, 0).GetValue<int64_t>() == 200LL * 999 * 1000 / 2, "Decimals round-trip");
+    TEST_ASSERT(result->GetValue(3, 0).GetValue<int64_t>() == 200000, "Strings round-trip");
+
+    result = con.Query(copy);
+    TEST_ASSERT(result->HasError() && result->GetError().find("snowflake COPY") != std::string::npos,
+                "Driver error surfaced");
+
+    result = con.Query("COPY orders TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake)");
+    TEST_ASSERT(result->HasError() && result->GetError().find("TABLE") != std::string::npos, "TABLE is required");
+
+    result = con.Query("COPY orders TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake, TABLE 't', MODE 'upsert')");
+    TEST_ASSERT(result->HasError(), "Unknown MODE rejected");
+
+    return true;
+}
+
+bool TestCopyDictionary() {
+    std::cout << "\n=== Testing COPY with DICTIONARY ===" << std::endl;
+    std::remove(TABLE_PATH.c_str());
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("CREATE TABLE events AS SELECT range AS id, ['open', 'closed', 'pending'][range % 3 + 1] AS status, "
+              "CASE WHEN range % 7 = 0 THEN NULL ELSE 'eu' END AS region FROM range(50000)");
+
+    auto result = con.Query("COPY events TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake, TABLE '" + TABLE_PATH +
+                            "', MODE 'create', BATCH_SIZE 10000, DICTIONARY true)");
+    TEST_ASSERT(!result->HasError(), "COPY executed: " + (result->HasError() ? result->GetError() : ""));
+
+    auto file = arrow::io::ReadableFile::Open(TABLE_PATH).ValueOrDie();
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(file).ValueOrDie();
+    auto schema = reader->schema();
+    TEST_ASSERT(schema->field(0)->type()->id() == arrow::Type::INT64 &&
+                    schema->field(1)->type()->id() == arrow::Type::DICTIONARY &&
+                    schema->field(2)->type()->id() == arrow::Type::DICTIONARY,
+                "String columns uploaded dictionary-encoded");
+    std::shared_ptr<arrow::RecordBatch> batch;
+    TEST_ASSERT(reader->ReadNext(&batch).ok() && batch &&
+                    static_cast<const arrow::DictionaryArray&>(*batch->column(1)).dictionary()->length() == 3,
+                "Each batch holds the distinct values once");
+
+    result = con.Query("SELECT COUNT(*), COUNT(region), COUNT(DISTINCT status), MIN(status) FROM snowflake_scan('" +
+                       CONNECTION + "', '" + TABLE_PATH + "')");
+    TEST_ASSERT(!result->HasError(), "Dictionary table scanned: " + (result->HasError() ? result->GetError() : ""));
+    TEST_ASSERT(result->GetValue(0, 0).GetValue<int64_t>() == 50000 &&
+                    result->GetValue(1, 0).GetValue<int64_t>() == 50000 - (50000 + 6) / 7,
+                "Rows and NULLs round-trip");
+    TEST_ASSERT(result->GetValue(2, 0).GetValue<int64_t>() == 3 && result->GetValue(3, 0).ToString() == "closed",
+                "Dictionary values round-trip");
+
+    auto same = con.Query("SELECT COUNT(*) FROM (SELECT id, status FROM events EXCEPT SELECT id, status FROM "
+                          "snowflake_scan('" + CONNECTION + "', '" + TABLE_PATH + "'))");
+    TEST_ASSERT(!same->HasError() && same->GetValue(0, 0).GetValue<int64_t>() == 0, "Every row decodes to its value");
+
+    return true;
+}
+
+bool TestCopyStringView() {
+    std::cout << "\n=== Testing COPY with STRING_VIEW ===" << std::endl;
+    std::remove(TABLE_PATH.c_str());
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("CREATE TABLE notes AS SELECT range AS id, CASE WHEN range % 5 = 0 THEN NULL WHEN range % 2 = 0 "
+              "THEN 'short' ELSE 'a note long enough to live outside the view ' || range END AS body, "
+              "encode('payload-' || range) AS raw FROM range(30000)");
+
+    auto result = con.Query("COPY notes TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake, TABLE '" + TABLE_PATH +
+                            "', MODE 'create', BATCH_SIZE 10000, STRING_VIEW true)");
+    TEST_ASSERT(!result->HasError(), "COPY executed: " + (result->HasError() ? result->GetError() : ""));
+
+    auto file = arrow::io::ReadableFile::Open(TABLE_PATH).ValueOrDie();
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(file).ValueOrDie();
+    auto schema = reader->schema();
+    TEST_ASSERT(schema->field(1)->type()->id() == arrow::Type::STRING_VIEW &&
+                    schema->field(2)->type()->id() == arrow::Type::BINARY_VIEW,
+                "String columns uploaded as views");
+
+    auto same = con.Query("SELECT COUNT(*) FROM (SELECT * FROM notes EXCEPT SELECT * FROM snowflake_scan('" +
+                          CONNECTION + "', '" + TABLE_PATH + "'))");
+    TEST_ASSERT(!same->HasError() && same->GetValue(0, 0).GetValue<int64_t>() == 0, "Every row decodes to its value");
+    auto nulls = con.Query("SELECT COUNT(*) - COUNT(body) FROM snowflake_scan('" + CONNECTION + "', '" + TABLE_PATH +
+                           "')");
+    TEST_ASSERT(!nulls->HasError() && nulls->GetValue(0, 0).GetValue<int64_t>() == 6000, "NULLs round-trip");
+
+    result = con.Query("COPY notes TO 'snowflake://" + CONNECTION + "' (FORMAT snowflake, TABLE '" + TABLE_PATH +
+                       "', MODE 'replace', DICTIONARY true, STRING_VIEW true)");
+    TEST_ASSERT(result->HasError(), "DICTIONARY and STRING_VIEW are rejected together");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake ingest tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestIngestModes();
+    all_passed &= TestPipeline();
+    all_passed &= TestCopyTo();
+    all_passed &= TestCopyDictionary();
+    all_passed &= TestCopyStringView();
+
+    std::remove(TABLE_PATH.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
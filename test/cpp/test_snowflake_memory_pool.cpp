@@ -0,0 +1,175 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "duckdb.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "snowflake_memory_pool.hpp"
+#include "arrow_data_converter.hpp"
+#include <arrow/api.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+std::shared_ptr<arrow::RecordBatch> MakeBatch(int64_t rows) {
+    arrow::Int64Builder ids;
+    for (int64_t i = 0; i < rows; i++) {
+        (void)ids.Append(i);
+    }
+    auto schema = arrow::schema({arrow::field("id", arrow::int64())});
+    return arrow::RecordBatch::Make(schema, rows, {ids.Finish().ValueOrDie()});
+}
+
+idx_t UsedMemory(DuckDB &db) {
+    return BufferManager::GetBufferManager(*db.instance).GetUsedMemory();
+}
+
+bool TestAllocation() {
+    std::cout << "\n=== Testing allocation and recycling ===" << std::endl;
+
+    auto pool = SnowflakeMemoryPool::Create(Allocator::DefaultAllocator());
+
+    uint8_t *first;
+    TEST_ASSERT(pool->Allocate(10000, 64, &first).ok(), "Allocation succeeds");
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(first) % 64 == 0, "Allocation is 64-byte aligned");
+    std::memset(first, 0xAB, 10000);
+    TEST_ASSERT(pool->bytes_allocated() >= 10000, "Allocated bytes are counted");
+    TEST_ASSERT(pool->num_allocations() == 1, "One allocation counted");
+
+    pool->Free(first, 10000, 64);
+    TEST_ASSERT(pool->bytes_allocated() == 0, "Freed bytes are no longer counted");
+    TEST_ASSERT(pool->GetStats().cached_bytes > 0, "Freed buffer is cached");
+
+    uint8_t *second;
+    TEST_ASSERT(pool->Allocate(9000, 64, &second).ok(), "Allocation of the same size class succeeds");
+    TEST_ASSERT(second == first, "Cached buffer is reused");
+    TEST_ASSERT(pool->GetStats().reused == 1, "Reuse is counted");
+    TEST_ASSERT(pool->GetStats().cached_bytes == 0, "Reused buffer leaves the cache");
+
+    auto peak = pool->max_memory();
+    TEST_ASSERT(peak >= 10000, "Peak covers the largest allocation");
+
+    // Grows in place within the size class, moves beyond it
+    auto moved = second;
+    TEST_ASSERT(pool->Reallocate(9000, 10240, 64, &moved).ok(), "Reallocation within the size class succeeds");
+    TEST_ASSERT(moved == second, "Reallocation within the size class stays in place");
+    moved[0] = 42;
+    TEST_ASSERT(pool->Reallocate(10240, 1 << 20, 64, &moved).ok(), "Reallocation beyond the size class succeeds");
+    TEST_ASSERT(moved != second && moved[0] == 42, "Reallocation beyond the size class keeps the contents");
+    pool->Free(moved, 1 << 20, 64);
+
+    uint8_t *empty;
+    TEST_ASSERT(pool->Allocate(0, 64, &empty).ok(), "Zero-size allocation succeeds");
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(empty) % 64 == 0, "Zero-size allocation is aligned");
+    pool->Free(empty, 0, 64);
+
+    TEST_ASSERT(pool->GetStats().cached_bytes > 0, "Freed buffers are cached");
+    pool->ReleaseUnused();
+    TEST_ASSERT(pool->GetStats().cached_bytes == 0, "ReleaseUnused empties the cache");
+    TEST_ASSERT(pool->bytes_allocated() == 0, "Nothing is outstanding");
+
+    return true;
+}
+
+bool TestMemoryLimit() {
+    std::cout << "\n=== Testing the memory limit ===" << std::endl;
+
+    DuckDB db(nullptr);
+    Connection con(db);
+    con.Query("SET memory_limit='64MB'");
+    auto pool = SnowflakeMemoryPool::Create(*con.context, 0);
+
+    uint8_t *huge;
+    auto status = pool->Allocate(100LL << 20, 64, &huge);
+    TEST_ASSERT(status.IsOutOfMemory(), "Allocation past memory_limit fails with OutOfMemory");
+
+    auto before = UsedMemory(db);
+    uint8_t *block;
+    TEST_ASSERT(pool->Allocate(8LL << 20, 64, &block).ok(), "Allocation within memory_limit succeeds");
+    TEST_ASSERT(UsedMemory(db) >= before + (8ULL << 20), "Allocation counts against the buffer manager");
+    pool->Free(block, 8LL << 20, 64);
+    TEST_ASSERT(UsedMemory(db) == before, "Free returns the reservation");
+
+    return true;
+}
+
+bool TestTracking() {
+    std::cout << "\n=== Testing tracked batches ===" << std::endl;
+
+    DuckDB db(nullptr);
+    Connection con(db);
+    auto pool = SnowflakeMemoryPool::Create(*con.context);
+
+    auto before = UsedMemory(db);
+    auto source = MakeBatch(100000);
+    auto tracked = pool->Track(source);
+    TEST_ASSERT(tracked.ok(), "Tracking succeeds");
+    TEST_ASSERT(tracked.ValueOrDie()->Equals(*source), "Tracked batch holds the same data");
+    TEST_ASSERT(UsedMemory(db) >= before + 800000, "Tracked batch counts against the buffer manager");
+    TEST_ASSERT(pool->GetStats().tracked_bytes >= 800000, "Tracked bytes are reported");
+
+    // The column outlives the batch and the pool handle
+    auto column = tracked.ValueOrDie()->column(0);
+    tracked = arrow::Status::Cancelled("dropped");
+    std::weak_ptr<SnowflakeMemoryPool> weak = pool;
+    pool.reset();
+    TEST_ASSERT(UsedMemory(db) >= before + 800000, "Reservation lasts as long as a buffer");
+    TEST_ASSERT(!weak.expired(), "Pool outlives its handle while a batch is tracked");
+    column.reset();
+    TEST_ASSERT(UsedMemory(db) == before, "Reservation ends with the last buffer");
+    TEST_ASSERT(weak.expired(), "Pool is released after its last batch");
+
+    return true;
+}
+
+bool TestConversion() {
+    std::cout << "\n=== Testing conversion into the pool ===" << std::endl;
+
+    auto pool = SnowflakeMemoryPool::Create(Allocator::DefaultAllocator());
+    Vector vector(LogicalType::VARCHAR, 100);
+    auto data = FlatVector::GetData<string_t>(vector);
+    for (idx_t i = 0; i < 100; i++) {
+        data[i] = StringVector::AddString(vector, "value number " + std::to_string(i));
+    }
+
+    ArrowConversionOptions options;
+    options.pool = pool.get();
+    auto converted = DuckDBToArrowConverter::ConvertVector(vector, 100, options);
+    TEST_ASSERT(converted.IsValid(), "Conversion succeeds");
+    TEST_ASSERT(pool->num_allocations() > 0, "Conversion allocates from the pool");
+    TEST_ASSERT(pool->bytes_allocated() > 0, "Converted buffers are outstanding");
+
+    std::weak_ptr<SnowflakeMemoryPool> weak = pool;
+    pool.reset();
+    TEST_ASSERT(!weak.expired(), "Pool outlives its handle while buffers are outstanding");
+    converted = DuckDBToArrowConverter::ConversionResult<std::shared_ptr<arrow::Array>>::Error("dropped");
+    TEST_ASSERT(weak.expired(), "Pool is released with its last buffer");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake memory pool tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestAllocation();
+    all_passed &= TestMemoryLimit();
+    all_passed &= TestTracking();
+    all_passed &= TestConversion();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
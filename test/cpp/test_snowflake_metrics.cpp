@@ -0,0 +1,239 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_metrics.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include "arrow_data_converter.hpp"
+#include "decimal_rescale.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string RESULT_PATH = "test_snowflake_metrics_result.arrows";
+constexpr int64_t BATCHES = 8;
+constexpr int64_t ROWS_PER_BATCH = 1000;
+
+std::shared_ptr<arrow::Schema> Schema() {
+    return arrow::schema({arrow::field("id", arrow::int64()), arrow::field("name", arrow::utf8())});
+}
+
+std::shared_ptr<arrow::RecordBatch> MakeBatch(int64_t start) {
+    arrow::Int64Builder ids;
+    arrow::StringBuilder names;
+    for (int64_t i = 0; i < ROWS_PER_BATCH; i++) {
+        (void)ids.Append(start + i);
+        (void)names.Append("name-" + std::to_string(start + i));
+    }
+    return arrow::RecordBatch::Make(Schema(), ROWS_PER_BATCH, {ids.Finish().ValueOrDie(), names.Finish().ValueOrDie()});
+}
+
+bool TestScopedTimer() {
+    std::cout << "\n=== Testing scoped timers ===" << std::endl;
+
+    std::atomic<uint64_t> counter {0};
+    {
+        SnowflakeScopedTimer timer(&counter);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    TEST_ASSERT(counter >= 5000000, "Timer adds the elapsed time");
+    {
+        SnowflakeScopedTimer timer(nullptr);
+    }
+    TEST_ASSERT(true, "Timer without a counter does nothing");
+
+    return true;
+}
+
+bool TestTransferMetrics() {
+    std::cout << "\n=== Testing transfer metrics ===" << std::endl;
+
+    auto &registry = SnowflakeMetrics::Get();
+    registry.Reset();
+
+    auto untimed = registry.Begin(SnowflakeTransferKind::SCAN, {"id", "name"}, false);
+    TEST_ASSERT(untimed->Time(untimed->driver_ns) == nullptr, "Untimed transfer hands out no timer");
+    TEST_ASSERT(untimed->ColumnTimes() == nullptr, "Untimed transfer hands out no column timers");
+
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    for (int64_t batch = 0; batch < BATCHES; batch++) {
+        batches.push_back(MakeBatch(batch * ROWS_PER_BATCH));
+    }
+    auto reader = arrow::RecordBatchReader::Make(batches, Schema()).ValueOrDie();
+    auto stream = untimed->Track(std::unique_ptr<SnowflakeResultStream>(new SnowflakeResultStream(reader)));
+    int64_t rows = 0;
+    for (auto next = stream->ReadNext(); next.first; next = stream->ReadNext()) {
+        rows += next.first->num_rows();
+    }
+    TEST_ASSERT(rows == BATCHES * ROWS_PER_BATCH, "Tracked stream returns every row");
+    TEST_ASSERT(untimed->batches == BATCHES, "Batches are counted");
+    TEST_ASSERT(untimed->rows == static_cast<uint64_t>(rows), "Rows are counted");
+    TEST_ASSERT(untimed->bytes >= static_cast<uint64_t>(rows) * 8, "Bytes are counted");
+    TEST_ASSERT(untimed->driver_ns == 0, "Untimed transfer takes no times");
+
+    TEST_ASSERT(registry.GetTotals(SnowflakeTransferKind::SCAN).transfers == 0, "Running transfer is not totaled");
+    stream.reset();
+    untimed.reset();
+    auto totals = registry.GetTotals(SnowflakeTransferKind::SCAN);
+    TEST_ASSERT(totals.transfers == 1 && totals.batches == BATCHES, "Finished transfer is added to the totals");
+    TEST_ASSERT(totals.column_ns.empty(), "Untimed transfer adds no column times");
+
+    auto timed = registry.Begin(SnowflakeTransferKind::COPY, {"id", "name"}, true);
+    TEST_ASSERT(timed->Time(timed->driver_ns) == &timed->driver_ns, "Timed transfer hands out its counters");
+    timed->ColumnTimes()[1] += 42;
+    InsertionOrderPreservingMap<string> explained;
+    timed->ToString(explained);
+    TEST_ASSERT(explained.find("Driver Time") != explained.end(), "EXPLAIN entries include driver time");
+    TEST_ASSERT(explained["Slowest Columns"].find("name") == 0, "EXPLAIN entries list the slowest column first");
+    timed.reset();
+    totals = registry.GetTotals(SnowflakeTransferKind::COPY);
+    TEST_ASSERT(totals.column_ns["name"] == 42, "Column times are totaled by name");
+
+    registry.Reset();
+    TEST_ASSERT(registry.GetTotals(SnowflakeTransferKind::COPY).transfers == 0, "Reset zeroes the totals");
+
+    return true;
+}
+
+bool TestColumnTiming() {
+    std::cout << "\n=== Testing per-column timing ===" << std::endl;
+
+    auto batch = MakeBatch(0);
+    auto decoder = SnowflakeBatchDecoder::Create(*Schema(), {LogicalType::BIGINT, LogicalType::VARCHAR});
+    TEST_ASSERT(decoder.IsValid(), "Decoder created");
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), decoder.GetValue().GetTypes(), ROWS_PER_BATCH);
+    std::atomic<uint64_t> decode_ns[2] = {{0}, {0}};
+    auto decoded = decoder.GetValue().Decode(*batch, 0, chunk, nullptr, decode_ns);
+    TEST_ASSERT(decoded.IsValid() && decoded.GetValue() == ROWS_PER_BATCH, "Timed decode succeeds");
+    TEST_ASSERT(decode_ns[0] > 0 && decode_ns[1] > 0, "Every decoded column is timed");
+
+    auto schema = SnowflakeTypeConverter::ConvertSchema({"id", "name"}, {LogicalType::BIGINT, LogicalType::VARCHAR});
+    std::atomic<uint64_t> convert_ns[2] = {{0}, {0}};
+    ArrowConversionOptions options;
+    options.column_ns = convert_ns;
+    auto converted = DuckDBToArrowConverter::ConvertChunk(chunk, schema.GetValue().arrow_schema, options);
+    TEST_ASSERT(converted.IsValid() && converted.GetValue()->Equals(*batch), "Timed conversion round-trips");
+    TEST_ASSERT(convert_ns[0] > 0 && convert_ns[1] > 0, "Every converted column is timed");
+
+    return true;
+}
+
+bool TestRescaleCounters() {
+    std::cout << "\n=== Testing decimal rescale counters ===" << std::endl;
+
+    auto &registry = SnowflakeMetrics::Get();
+    registry.Reset();
+    Vector source(LogicalType::DECIMAL(18, 2), 3);
+    auto data = FlatVector::GetData<int64_t>(source);
+    data[0] = 12345;    // 123.45: rounds
+    data[1] = 1200;     // 12.00: exact
+    data[2] = 9999999;  // 99999.99: out of range
+    Vector result(LogicalType::DECIMAL(4, 0), 3);
+    auto rescaled = DecimalRescaleKernel::Rescale(source, 3, result, DecimalOverflowPolicy::SET_NULL);
+    TEST_ASSERT(rescaled.IsValid(), "Rescale succeeds");
+    TEST_ASSERT(registry.GetRowsRounded() == rescaled.GetValue().rows_rounded, "Rounded rows are counted");
+    TEST_ASSERT(registry.GetRowsRejected() == 1, "Out-of-range rows are counted");
+
+    auto failed = DecimalRescaleKernel::Rescale(source, 3, result, DecimalOverflowPolicy::ERROR);
+    TEST_ASSERT(!failed.IsValid(), "Rescale fails under ERROR");
+    TEST_ASSERT(registry.GetRowsRejected() == 2, "Failing row is counted");
+
+    return true;
+}
+
+bool TestMetricsFunction() {
+    std::cout << "\n=== Testing snowflake_metrics() ===" << std::endl;
+
+    {
+        auto file = arrow::io::FileOutputStream::Open(RESULT_PATH).ValueOrDie();
+        auto writer = arrow::ipc::MakeStreamWriter(file, Schema()).ValueOrDie();
+        for (int64_t batch = 0; batch < BATCHES; batch++) {
+            (void)writer->WriteRecordBatch(*MakeBatch(batch * ROWS_PER_BATCH));
+        }
+        (void)writer->Close();
+        (void)file->Close();
+    }
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    auto scan = std::string("snowflake_scan('driver=") + ADBC_IPC_STUB_DRIVER +
+                ";account=stub;user=stub;database=stub', '" + RESULT_PATH + "', cache := false)";
+
+    TEST_ASSERT(!con.Query("CALL snowflake_reset_metrics()")->HasError(), "snowflake_reset_metrics runs");
+    auto count = con.Query("SELECT COUNT(*) FROM " + scan);
+    TEST_ASSERT(!count->HasError() && count->GetValue(0, 0).GetValue<int64_t>() == BATCHES * ROWS_PER_BATCH,
+                "Untimed scan returns every row");
+    auto totals = SnowflakeMetrics::Get().GetTotals(SnowflakeTransferKind::SCAN);
+    TEST_ASSERT(totals.transfers == 1 && totals.rows == BATCHES * ROWS_PER_BATCH, "Scan rows are counted");
+    TEST_ASSERT(totals.driver_ns == 0 && totals.convert_ns == 0, "Scan is not timed by default");
+
+    TEST_ASSERT(!con.Query("SET snowflake_metrics = true")->HasError(), "snowflake_metrics setting exists");
+    auto scanned = con.Query("SELECT SUM(LENGTH(name)) FROM " + scan);
+    TEST_ASSERT(!scanned->HasError(), "Timed scan runs");
+    auto metrics = con.Query("SELECT metric, column_name, value FROM snowflake_metrics() WHERE scope = 'scan' "
+                             "ORDER BY metric, column_name");
+    TEST_ASSERT(!metrics->HasError(), "snowflake_metrics() runs");
+    bool decode_timed = false;
+    bool name_timed = false;
+    for (idx_t row = 0; row < metrics->RowCount(); row++) {
+        auto metric = metrics->GetValue(0, row).ToString();
+        auto value = metrics->GetValue(2, row).GetValue<double>();
+        if (metric == "convert_ms") {
+            decode_timed = value > 0;
+        } else if (metric == "column_convert_ms" && metrics->GetValue(1, row).ToString() == "name") {
+            name_timed = value > 0;
+        }
+    }
+    TEST_ASSERT(decode_timed, "Decode time is reported");
+    TEST_ASSERT(name_timed, "Per-column decode time is reported");
+
+    auto hit_rate = con.Query("SELECT value FROM snowflake_metrics() WHERE scope = 'connection_pool' AND "
+                              "metric = 'hit_rate'");
+    TEST_ASSERT(!hit_rate->HasError() && hit_rate->RowCount() == 1, "Connection pool hit rate is reported");
+
+    TEST_ASSERT(!con.Query("SET snowflake_metrics = false")->HasError(), "snowflake_metrics can be disabled");
+    auto explained = con.Query("EXPLAIN ANALYZE SELECT SUM(id) FROM " + scan);
+    TEST_ASSERT(!explained->HasError(), "EXPLAIN ANALYZE runs");
+    auto plan = explained->GetValue(1, 0).ToString();
+    TEST_ASSERT(plan.find("Driver Time") != std::string::npos && plan.find("Convert Time") != std::string::npos,
+                "EXPLAIN ANALYZE times the scan without the setting");
+
+    std::remove(RESULT_PATH.c_str());
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake metrics tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestScopedTimer();
+    all_passed &= TestTransferMetrics();
+    all_passed &= TestColumnTiming();
+    all_passed &= TestRescaleCounters();
+    all_passed &= TestMetricsFunction();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_prefetch.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string RESULT_PATH = "test_snowflake_prefetch_result.arrows";
+constexpr int64_t BATCHES = 20;
+constexpr int64_t ROWS_PER_BATCH = 1000;
+
+std::shared_ptr<arrow::Schema> Schema() {
+    return arrow::schema({arrow::field("id", arrow::int64())});
+}
+
+std::shared_ptr<arrow::RecordBatch> MakeBatch(int64_t start) {
+    arrow::Int64Builder ids;
+    for (int64_t i = 0; i < ROWS_PER_BATCH; i++) {
+        (void)ids.Append(start + i);
+    }
+    return arrow::RecordBatch::Make(Schema(), ROWS_PER_BATCH, {ids.Finish().ValueOrDie()});
+}
+
+/**
+ * @brief Source of BATCHES batches of consecutive ids, optionally slow or failing part way
+ */
+class TestSource : public arrow::RecordBatchReader {
+public:
+    TestSource(int delay_ms = 0, int64_t fail_after = -1) : delay_ms_(delay_ms), fail_after_(fail_after) {
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return Schema();
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override {
+        if (delay_ms_ > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms_));
+        }
+        if (next_ == fail_after_) {
+            return arrow::Status::IOError("connection reset");
+        }
+        if (next_ == BATCHES) {
+            batch->reset();
+            return arrow::Status::OK();
+        }
+        *batch = MakeBatch(next_++ * ROWS_PER_BATCH);
+        return arrow::Status::OK();
+    }
+
+private:
+    int delay_ms_;
+    int64_t fail_after_;
+    int64_t next_ = 0;
+};
+
+std::unique_ptr<SnowflakeResultStream> Source(int delay_ms = 0, int64_t fail_after = -1) {
+    return std::unique_ptr<SnowflakeResultStream>(
+        new SnowflakeResultStream(std::make_shared<TestSource>(delay_ms, fail_after)));
+}
+
+bool TestOrderAndCompleteness() {
+    std::cout << "\n=== Testing Order and Completeness ===" << std::endl;
+
+    auto stats = std::make_shared<SnowflakePrefetchStats>();
+    auto stream = SnowflakePrefetchReader::Wrap(Source(), SnowflakePrefetchOptions(), stats);
+    TEST_ASSERT(stream->GetSchema()->Equals(*Schema()), "Schema of the source");
+
+    int64_t expected = 0;
+    while (true) {
+        auto next = stream->ReadNext();
+        TEST_ASSERT(next.second.empty(), "No error");
+        if (!next.first) {
+            break;
+        }
+        auto ids = std::static_pointer_cast<arrow::Int64Array>(next.first->column(0));
+        for (int64_t i = 0; i < ids->length(); i++) {
+            if (ids->Value(i) != expected++) {
+                TEST_ASSERT(false, "Rows in source order");
+            }
+        }
+    }
+    TEST_ASSERT(expected == BATCHES * ROWS_PER_BATCH, "Every row delivered in order");
+    TEST_ASSERT(!stream->ReadNext().first, "Stays exhausted");
+    TEST_ASSERT(stats->batches == BATCHES && stats->bytes > 0, "Batches counted");
+
+    SnowflakePrefetchOptions disabled;
+    disabled.max_batches = 0;
+    auto source = Source();
+    auto source_address = source.get();
+    TEST_ASSERT(SnowflakePrefetchReader::Wrap(std::move(source), disabled, stats).get() == source_address,
+                "max_batches = 0 leaves the stream as is");
+
+    return true;
+}
+
+bool TestBounds() {
+    std::cout << "\n=== Testing Queue Bounds ===" << std::endl;
+
+    // Slow consumer: the I/O thread fills the queue and waits
+    SnowflakePrefetchOptions options;
+    options.max_batches = 3;
+    auto stats = std::make_shared<SnowflakePrefetchStats>();
+    auto stream = SnowflakePrefetchReader::Wrap(Source(), options, stats);
+    int64_t batches = 0;
+    while (stream->ReadNext().first) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        batches++;
+    }
+    TEST_ASSERT(batches == BATCHES, "Every batch read");
+    TEST_ASSERT(stats->peak_batches <= 3, "Never more than max_batches queued");
+    TEST_ASSERT(stats->queue_full_stalls > 0, "I/O thread waited for the decoder");
+
+    // A byte bound below one batch still admits one batch at a time
+    options.max_batches = 8;
+    options.max_bytes = 1;
+    stats = std::make_shared<SnowflakePrefetchStats>();
+    stream = SnowflakePrefetchReader::Wrap(Source(), options, stats);
+    batches = 0;
+    while (stream->ReadNext().first) {
+        batches++;
+    }
+    TEST_ASSERT(batches == BATCHES && stats->peak_batches == 1, "Byte bound holds one oversized batch");
+
+    return true;
+}
+
+bool TestStallsAndErrors() {
+    std::cout << "\n=== Testing Fetch Stalls and Errors ===" << std::endl;
+
+    // Slow source: the consumer waits for the network
+    auto stats = std::make_shared<SnowflakePrefetchStats>();
+    auto stream = SnowflakePrefetchReader::Wrap(Source(2), SnowflakePrefetchOptions(), stats);
+    while (stream->ReadNext().first) {
+    }
+    TEST_ASSERT(stats->fetch_stalls > 0 && stats->fetch_stall_us > 0, "Decoder waits counted as fetch stalls");
+
+    stream = SnowflakePrefetchReader::Wrap(Source(0, 5), SnowflakePrefetchOptions(), nullptr);
+    int64_t batches = 0;
+    std::string error;
+    while (true) {
+        auto next = stream->ReadNext();
+        if (!next.second.empty()) {
+            error = next.second;
+            break;
+        }
+        if (!next.first) {
+            break;
+        }
+        batches++;
+    }
+    TEST_ASSERT(batches == 5, "Batches before the error delivered");
+    TEST_ASSERT(error.find("connection reset") != std::string::npos, "Source error delivered after them");
+
+    // Abandoned while the I/O thread waits for space: must not hang
+    SnowflakePrefetchOptions options;
+    options.max_batches = 1;
+    stream = SnowflakePrefetchReader::Wrap(Source(), options, nullptr);
+    TEST_ASSERT(stream->ReadNext().first != nullptr, "First batch read");
+    stream.reset();
+    TEST_ASSERT(true, "Abandoned reader stops its I/O thread");
+
+    return true;
+}
+
+bool TestScanPrefetch() {
+    std::cout << "\n=== Testing snowflake_scan Prefetch ===" << std::endl;
+
+    {
+        auto file = arrow::io::FileOutputStream::Open(RESULT_PATH).ValueOrDie();
+        auto writer = arrow::ipc::MakeStreamWriter(file, Schema()).ValueOrDie();
+        for (int64_t batch = 0; batch < BATCHES; batch++) {
+            (void)writer->WriteRecordBatch(*MakeBatch(batch * ROWS_PER_BATCH));
+        }
+        (void)writer->Close();
+        (void)file->Close();
+    }
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    auto scan = std::string("snowflake_scan('driver=") + ADBC_IPC_STUB_DRIVER +
+                ";account=stub;user=stub;database=stub', '" + RESULT_PATH + "'";
+    int64_t rows = BATCHES * ROWS_PER_BATCH;
+
+    for (auto options : {std::string(""), std::string(", prefetch_batches := 0"),
+                         std::string(", prefetch_batches := 1, prefetch_bytes := 1"),
+                         std::string(", partitioned := false")}) {
+        auto result = con.Query("SELECT COUNT(*), SUM(id) FROM " + scan + options + ")");
+        TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == rows &&
+                        result->GetValue(1, 0).GetValue<int64_t>() == rows * (rows - 1) / 2,
+                    "Same result with options '" + options + "'");
+    }
+
+    auto negative = con.Query("SELECT * FROM " + scan + ", prefetch_batches := -1)");
+    TEST_ASSERT(negative->HasError(), "Negative prefetch_batches rejected");
+
+    auto explained = con.Query("EXPLAIN ANALYZE SELECT SUM(id) FROM " + scan + ")");
+    TEST_ASSERT(!explained->HasError(), "EXPLAIN ANALYZE runs");
+    auto plan = explained->GetValue(1, 0).ToString();
+    TEST_ASSERT(plan.find("Fetch Stalls") != std::string::npos &&
+                    plan.find("Queue Full Stalls") != std::string::npos,
+                "Profiler shows prefetch stalls");
+
+    std::remove(RESULT_PATH.c_str());
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake prefetch tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestOrderAndCompleteness();
+    all_passed &= TestBounds();
+    all_passed &= TestStallsAndErrors();
+    all_passed &= TestScanPrefetch();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
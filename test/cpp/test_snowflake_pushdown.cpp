@@ -0,0 +1,227 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "duckdb.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_pushdown.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string RESULT_PATH = "test_snowflake_pushdown.arrows";
+const std::string QUERY_LOG = "test_snowflake_pushdown_queries.log";
+// The stub driver logs every query it receives, so the rewritten SQL can be checked
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                               ";account=stub;user=stub;database=stub;stub_query_log=" + QUERY_LOG;
+constexpr int64_t ROWS = 10000;
+
+/**
+ * @brief Result with columns id BIGINT, label VARCHAR, payload VARCHAR, doc VARIANT (as JSON text)
+ */
+bool WriteResultFile() {
+    arrow::Int64Builder ids;
+    arrow::StringBuilder labels;
+    arrow::StringBuilder payloads;
+    arrow::StringBuilder docs;
+    for (int64_t i = 0; i < ROWS; i++) {
+        (void)ids.Append(i);
+        (void)labels.Append("row-" + std::to_string(i));
+        if (i % 10 == 0) {
+            (void)payloads.AppendNull();
+        } else {
+            (void)payloads.Append(std::string(64, 'x'));
+        }
+        (void)docs.Append("{\"n\":" + std::to_string(i) + "}");
+    }
+    auto schema = arrow::schema({arrow::field("id", arrow::int64()), arrow::field("label", arrow::utf8()),
+                                 arrow::field("payload", arrow::utf8()),
+                                 arrow::field("doc", arrow::utf8(), true,
+                                              arrow::key_value_metadata({"logicalType"}, {"VARIANT"}))});
+    auto batch = arrow::RecordBatch::Make(schema, ROWS,
+                                          {ids.Finish().ValueOrDie(), labels.Finish().ValueOrDie(),
+                                           payloads.Finish().ValueOrDie(), docs.Finish().ValueOrDie()});
+    auto file = arrow::io::FileOutputStream::Open(RESULT_PATH);
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    return writer.ok() && (*writer)->WriteRecordBatch(*batch).ok() && (*writer)->Close().ok() &&
+           (*file)->Close().ok();
+}
+
+/**
+ * @brief Last query the stub driver received
+ */
+std::string LastQuery() {
+    std::ifstream log(QUERY_LOG);
+    std::string line;
+    std::string query;
+    while (std::getline(log, line)) {
+        query = line;
+    }
+    return query;
+}
+
+bool TestRenderFilter() {
+    std::cout << "\n=== Testing Filter Rendering ===" << std::endl;
+
+    auto render = [](const TableFilter& filter) {
+        auto result = SnowflakePushdown::RenderFilter("\"c\"", filter);
+        return result.IsValid() ? result.GetValue() : "error";
+    };
+
+    TEST_ASSERT(render(ConstantFilter(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value::BIGINT(10))) == "\"c\" >= 10",
+                "Constant comparison");
+    TEST_ASSERT(render(ConstantFilter(ExpressionType::COMPARE_NOTEQUAL, Value("a'b"))) == "\"c\" <> 'a''b'",
+                "String constant quoted");
+    TEST_ASSERT(render(IsNullFilter()) == "\"c\" IS NULL", "IS NULL");
+    TEST_ASSERT(render(IsNotNullFilter()) == "\"c\" IS NOT NULL", "IS NOT NULL");
+    TEST_ASSERT(render(InFilter({Value::INTEGER(1), Value::INTEGER(2), Value::INTEGER(3)})) == "\"c\" IN (1, 2, 3)",
+                "IN list");
+
+    ConjunctionAndFilter range;
+    range.child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHAN, Value::INTEGER(1)));
+    range.child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value::INTEGER(9)));
+    TEST_ASSERT(render(range) == "(\"c\" > 1) AND (\"c\" < 9)", "AND of comparisons");
+
+    ConjunctionOrFilter either;
+    either.child_filters.push_back(make_uniq<IsNullFilter>());
+    either.child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, Value::INTEGER(0)));
+    TEST_ASSERT(render(either) == "(\"c\" IS NULL) OR (\"c\" = 0)", "OR of filters");
+
+    // An interval has no literal: an AND keeps the rest, an OR cannot be pushed at all
+    auto interval = Value::INTERVAL(interval_t());
+    range.child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, interval));
+    TEST_ASSERT(render(range) == "(\"c\" > 1) AND (\"c\" < 9)", "AND drops children it cannot render");
+    either.child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, interval));
+    TEST_ASSERT(render(either) == "error", "OR with a child it cannot render is not pushed");
+
+    return true;
+}
+
+bool TestBuildQuery() {
+    std::cout << "\n=== Testing Query Rewriting ===" << std::endl;
+
+    TEST_ASSERT(SnowflakePushdown::BuildQuery("SELECT * FROM orders;\n", {"id", "Total \"net\""}, {"\"id\" > 5"}) ==
+                    "SELECT \"id\", \"Total \"\"net\"\"\" FROM (\nSELECT * FROM orders\n) AS \"snowflake_scan\" "
+                    "WHERE (\"id\" > 5)",
+                "Columns quoted, trailing semicolon dropped");
+    TEST_ASSERT(SnowflakePushdown::BuildQuery("SELECT 1 -- note", {}, {"a", "b"}) ==
+                    "SELECT * FROM (\nSELECT 1 -- note\n) AS \"snowflake_scan\" WHERE (a) AND (b)",
+                "Predicates ANDed; a trailing comment cannot swallow the parenthesis");
+    TEST_ASSERT(SnowflakePushdown::BuildSchemaQuery("SELECT * FROM orders") ==
+                    "SELECT * FROM (\nSELECT * FROM orders\n) AS \"snowflake_scan\" LIMIT 0",
+                "Schema probe");
+
+    return true;
+}
+
+bool TestCanPushFilter() {
+    std::cout << "\n=== Testing Pushdown Eligibility ===" << std::endl;
+
+    TEST_ASSERT(SnowflakePushdown::CanPushFilter("NUMBER(38,0)") && SnowflakePushdown::CanPushFilter("VARCHAR(100)") &&
+                    SnowflakePushdown::CanPushFilter("FLOAT") && SnowflakePushdown::CanPushFilter("BOOLEAN") &&
+                    SnowflakePushdown::CanPushFilter("DATE") && SnowflakePushdown::CanPushFilter("BINARY"),
+                "Native scalar types pushed");
+    TEST_ASSERT(SnowflakePushdown::CanPushFilter("TIMESTAMP_NTZ(6)") && SnowflakePushdown::CanPushFilter("TIME(3)") &&
+                    SnowflakePushdown::CanPushFilter("TIMESTAMP_TZ(0)"),
+                "Temporal types of scale 6 or less pushed");
+    TEST_ASSERT(!SnowflakePushdown::CanPushFilter("TIMESTAMP_NTZ(9)") && !SnowflakePushdown::CanPushFilter("TIME(9)") &&
+                    !SnowflakePushdown::CanPushFilter("TIMESTAMP_LTZ"),
+                "Temporal types truncated on read not pushed");
+    TEST_ASSERT(!SnowflakePushdown::CanPushFilter("VARIANT") && !SnowflakePushdown::CanPushFilter("OBJECT") &&
+                    !SnowflakePushdown::CanPushFilter("ARRAY") && !SnowflakePushdown::CanPushFilter("GEOGRAPHY"),
+                "Semi-structured and geospatial types not pushed");
+    TEST_ASSERT(!SnowflakePushdown::CanPushFilter(""), "Unknown type not pushed");
+
+    return true;
+}
+
+bool TestScanPushdown() {
+    std::cout << "\n=== Testing snowflake_scan Pushdown ===" << std::endl;
+    std::remove(QUERY_LOG.c_str());
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    auto scan = "snowflake_scan('" + CONNECTION + "', '" + RESULT_PATH + "')";
+
+    auto result = con.Query("DESCRIBE SELECT * FROM " + scan);
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 4, "Schema from the zero-row probe");
+    TEST_ASSERT(LastQuery().find("LIMIT 0") != std::string::npos, "Bind runs the LIMIT 0 probe");
+
+    result = con.Query("SELECT label FROM " + scan + " WHERE id >= 9990");
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 10, "Filtered rows returned");
+    auto query = LastQuery();
+    TEST_ASSERT(query.find("\"payload\"") == std::string::npos, "Unused column not selected: " + query);
+    TEST_ASSERT(query.find("WHERE (\"id\" >= 9990)") != std::string::npos, "Comparison pushed down: " + query);
+
+    // The stub ignores WHERE, so exact counts show DuckDB applies the filters again
+    result = con.Query("SELECT COUNT(*) FROM " + scan + " WHERE payload IS NULL AND id < 1000");
+    TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == 100,
+                "Pushed filters re-applied to the rows received");
+    query = LastQuery();
+    TEST_ASSERT(query.find("\"payload\" IS NULL") != std::string::npos &&
+                    query.find("\"id\" < 1000") != std::string::npos,
+                "Both filters pushed down: " + query);
+
+    result = con.Query("SELECT COUNT(*) FROM " + scan);
+    TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == ROWS, "COUNT(*) counts every row");
+    TEST_ASSERT(LastQuery().find("SELECT \"id\" FROM") == 0, "COUNT(*) fetches a single column");
+
+    result = con.Query("SELECT label, id FROM " + scan + " WHERE label = 'row-42'");
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 1 && result->GetValue(1, 0).GetValue<int64_t>() == 42,
+                "Projection in query order");
+
+    // DuckDB compares the JSON text; Snowflake would compare VARIANT values
+    result = con.Query("SELECT id FROM " + scan + " WHERE doc = '{\"n\":7}'");
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 1 && result->GetValue(0, 0).GetValue<int64_t>() == 7,
+                "VARIANT filter applied in DuckDB");
+    query = LastQuery();
+    TEST_ASSERT(query.find("WHERE") == std::string::npos, "VARIANT filter not pushed down: " + query);
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting snowflake_scan pushdown tests..." << std::endl;
+
+    if (!WriteResultFile()) {
+        std::cout << "❌ Could not write " << RESULT_PATH << std::endl;
+        return 1;
+    }
+
+    bool all_passed = true;
+
+    all_passed &= TestRenderFilter();
+    all_passed &= TestBuildQuery();
+    all_passed &= TestCanPushFilter();
+    all_passed &= TestScanPushdown();
+
+    std::remove(RESULT_PATH.c_str());
+    std::remove(QUERY_LOG.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,301 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_result_cache.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string CACHE_DIRECTORY = "test_snowflake_result_cache";
+const std::string QUERY_LOG = "test_snowflake_result_cache_queries.log";
+// The stub driver logs every query it runs, so cache hits can be told from round trips
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                               ";account=stub;user=stub;database=stub;stub_query_log=" + QUERY_LOG;
+constexpr int64_t ROWS = 50000;
+
+std::string ResultPath(int result) {
+    return "test_snowflake_result_cache_" + std::to_string(result) + ".arrows";
+}
+
+/**
+ * @brief Write a result of ROWS ids starting at `start`, in batches of 10000
+ */
+bool WriteResultFile(int result, int64_t start) {
+    auto schema = arrow::schema({arrow::field("id", arrow::int64())});
+    auto file = arrow::io::FileOutputStream::Open(ResultPath(result));
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    if (!writer.ok()) {
+        return false;
+    }
+    for (int64_t offset = 0; offset < ROWS; offset += 10000) {
+        arrow::Int64Builder ids;
+        for (int64_t i = 0; i < 10000; i++) {
+            (void)ids.Append(start + offset + i);
+        }
+        auto batch = arrow::RecordBatch::Make(schema, 10000, {ids.Finish().ValueOrDie()});
+        if (!(*writer)->WriteRecordBatch(*batch).ok()) {
+            return false;
+        }
+    }
+    return (*writer)->Close().ok() && (*file)->Close().ok();
+}
+
+idx_t QueriesRun() {
+    std::ifstream log(QUERY_LOG);
+    std::string line;
+    idx_t queries = 0;
+    while (std::getline(log, line)) {
+        queries++;
+    }
+    return queries;
+}
+
+/**
+ * @brief Read a result to the end: {rows, sum of ids}, or {-1, -1} on error
+ */
+std::pair<int64_t, int64_t> ReadAll(std::pair<std::unique_ptr<SnowflakeResultStream>, string> executed) {
+    if (!executed.first) {
+        return {-1, -1};
+    }
+    int64_t rows = 0;
+    int64_t sum = 0;
+    while (true) {
+        auto next = executed.first->ReadNext();
+        if (!next.second.empty()) {
+            return {-1, -1};
+        }
+        if (!next.first) {
+            return {rows, sum};
+        }
+        auto ids = std::static_pointer_cast<arrow::Int64Array>(next.first->column(0));
+        for (int64_t i = 0; i < ids->length(); i++) {
+            sum += ids->Value(i);
+        }
+        rows += next.first->num_rows();
+    }
+}
+
+SnowflakeResultCacheOptions Options() {
+    SnowflakeResultCacheOptions options;
+    options.directory = CACHE_DIRECTORY;
+    return options;
+}
+
+bool TestNormalizeQuery() {
+    std::cout << "\n=== Testing Query Normalization ===" << std::endl;
+
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("  SELECT  a,\n\tb FROM t ;\n") == "SELECT a, b FROM t",
+                "Whitespace collapsed, trailing semicolon dropped");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT 'a  b', \"x  y\" FROM t") ==
+                    "SELECT 'a  b', \"x  y\" FROM t",
+                "Quoted text kept as is");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT 'it''s  \\'  x' FROM t") ==
+                    "SELECT 'it''s  \\'  x' FROM t",
+                "Doubled and escaped quotes stay inside the literal");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT 1 -- c\n+ 1") !=
+                    SnowflakeResultCache::NormalizeQuery("SELECT 1 -- c + 1"),
+                "A line comment keeps its newline");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT $$a  b$$,  $$$$ FROM t") == "SELECT $$a  b$$, $$$$ FROM t",
+                "Dollar-quoted text kept as is");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT $$a  b$$") !=
+                    SnowflakeResultCache::NormalizeQuery("SELECT $$a b$$"),
+                "Dollar-quoted whitespace is significant");
+    TEST_ASSERT(SnowflakeResultCache::NormalizeQuery("SELECT /* x   y */  1") == "SELECT /* x   y */ 1",
+                "Block comments kept as is");
+
+    return true;
+}
+
+bool TestHitsAndMisses() {
+    std::cout << "\n=== Testing Cache Hits and Misses ===" << std::endl;
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    std::remove(QUERY_LOG.c_str());
+
+    SnowflakeResultCache cache(Options());
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+    auto expected = std::make_pair<int64_t, int64_t>(ROWS + 0, ROWS * (ROWS - 1) / 2);
+
+    TEST_ASSERT(ReadAll(cache.Execute(connector, ResultPath(0))) == expected, "Miss returns the live result");
+    auto metrics = cache.GetMetrics();
+    TEST_ASSERT(metrics.misses == 1 && metrics.stores == 1 && metrics.entries == 1, "Result stored");
+
+    TEST_ASSERT(ReadAll(cache.Execute(connector, "  " + ResultPath(0) + " ;")) == expected,
+                "Hit returns the same result");
+    TEST_ASSERT(cache.GetMetrics().hits == 1 && QueriesRun() == 1, "Hit served without running the query");
+
+    // Another principal does not see the entry
+    SnowflakeADBCConnector other(SnowflakeConfig::Parse(CONNECTION + ";role=OTHER"));
+    TEST_ASSERT(other.Connect().empty(), "Connected");
+    TEST_ASSERT(ReadAll(cache.Execute(other, ResultPath(0))) == expected && QueriesRun() == 2,
+                "Connection identity is part of the key");
+
+    // A result read only in part is not stored
+    auto partial = cache.Execute(connector, ResultPath(1));
+    TEST_ASSERT(partial.first && partial.first->ReadNext().first, "Partial read");
+    partial.first.reset();
+    metrics = cache.GetMetrics();
+    TEST_ASSERT(metrics.entries == 2 && metrics.store_failures == 1, "Partial result discarded");
+
+    // Files written earlier are picked up by a new cache
+    SnowflakeResultCache reopened(Options());
+    TEST_ASSERT(reopened.GetMetrics().entries == 2, "Entries indexed from the directory");
+    TEST_ASSERT(ReadAll(reopened.Execute(connector, ResultPath(0))) == expected && QueriesRun() == 3,
+                "Persisted entry served");
+    TEST_ASSERT(reopened.GetMetrics().hits == 1, "Persisted entry counted as a hit");
+
+    cache.Clear();
+    TEST_ASSERT(cache.GetMetrics().entries == 0 && std::filesystem::is_empty(CACHE_DIRECTORY), "Clear deletes files");
+
+    return true;
+}
+
+bool TestExpiryAndEviction() {
+    std::cout << "\n=== Testing Expiry and Eviction ===" << std::endl;
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    auto options = Options();
+    options.ttl = std::chrono::seconds(0);
+    SnowflakeResultCache expiring(options);
+    ReadAll(expiring.Execute(connector, ResultPath(0)));
+    TEST_ASSERT(!expiring.Lookup(connector.GetConfig(), ResultPath(0)), "Expired entry not served");
+    TEST_ASSERT(expiring.GetMetrics().expirations == 1 && expiring.GetMetrics().entries == 0,
+                "Expired entry deleted");
+
+    // Room for one result only
+    options = Options();
+    options.max_bytes = ROWS * sizeof(int64_t) * 3 / 2;
+    SnowflakeResultCache bounded(options);
+    ReadAll(bounded.Execute(connector, ResultPath(0)));
+    ReadAll(bounded.Execute(connector, ResultPath(1)));
+    auto metrics = bounded.GetMetrics();
+    TEST_ASSERT(metrics.entries == 1 && metrics.evictions == 1 && metrics.bytes <= options.max_bytes,
+                "Least recently used entry evicted");
+    TEST_ASSERT(!bounded.Lookup(connector.GetConfig(), ResultPath(0)) &&
+                    bounded.Lookup(connector.GetConfig(), ResultPath(1)),
+                "Newest entry kept");
+
+    options.max_bytes = 1024;
+    SnowflakeResultCache tiny(options);
+    ReadAll(tiny.Execute(connector, ResultPath(1)));
+    TEST_ASSERT(tiny.GetMetrics().entries == 0 && tiny.GetMetrics().store_failures == 1,
+                "Result larger than the cache not stored");
+
+    return true;
+}
+
+bool TestConcurrentReaders() {
+    std::cout << "\n=== Testing Concurrent Readers ===" << std::endl;
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    SnowflakeResultCache cache(Options());
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+    ReadAll(cache.Execute(connector, ResultPath(0)));
+
+    // Readers keep their mapping while the entry is cleared under them
+    auto held = cache.Lookup(connector.GetConfig(), ResultPath(0));
+    std::vector<std::thread> readers;
+    std::vector<std::pair<int64_t, int64_t>> results(8);
+    for (int t = 0; t < 8; t++) {
+        readers.emplace_back([&, t]() {
+            auto cached = cache.Lookup(connector.GetConfig(), ResultPath(0));
+            results[t] = cached ? ReadAll({std::move(cached), ""}) : std::make_pair<int64_t, int64_t>(-1, -1);
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (auto &result : results) {
+        TEST_ASSERT(result.first == ROWS, "Concurrent reader saw the whole result");
+    }
+    cache.Clear();
+    TEST_ASSERT(ReadAll({std::move(held), ""}).first == ROWS, "Result readable after its entry was deleted");
+
+    return true;
+}
+
+bool TestScanCache() {
+    std::cout << "\n=== Testing snowflake_scan with the Result Cache ===" << std::endl;
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    std::remove(QUERY_LOG.c_str());
+    SnowflakeResultCache::Get().Configure(Options());
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    auto query = "SELECT COUNT(*), SUM(id) FROM snowflake_scan('" + CONNECTION + "', '" + ResultPath(0) + "')";
+
+    for (int run = 0; run < 3; run++) {
+        auto result = con.Query(query);
+        TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == ROWS &&
+                        result->GetValue(1, 0).GetValue<int64_t>() == ROWS * (ROWS - 1) / 2,
+                    "Scan result correct: " + (result->HasError() ? result->GetError() : ""));
+    }
+    // Schema probe and scan, each run once
+    TEST_ASSERT(QueriesRun() == 2, "Repeated scans served from the cache");
+
+    auto stats = con.Query("SELECT hits, misses, entries FROM snowflake_cache_stats()");
+    TEST_ASSERT(!stats->HasError() && stats->GetValue(0, 0).GetValue<int64_t>() == 4 &&
+                    stats->GetValue(1, 0).GetValue<int64_t>() == 2 && stats->GetValue(2, 0).GetValue<int64_t>() == 2,
+                "snowflake_cache_stats reports hits and entries");
+
+    auto bypass = con.Query("SELECT COUNT(*) FROM snowflake_scan('" + CONNECTION + "', '" + ResultPath(0) +
+                            "', cache := false)");
+    TEST_ASSERT(!bypass->HasError() && QueriesRun() == 4, "cache := false runs the query");
+
+    SnowflakeResultCache::Get().Configure(SnowflakeResultCacheOptions());
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake result cache tests..." << std::endl;
+
+    if (!WriteResultFile(0, 0) || !WriteResultFile(1, ROWS)) {
+        std::cout << "❌ Could not write result files" << std::endl;
+        return 1;
+    }
+
+    bool all_passed = true;
+
+    all_passed &= TestNormalizeQuery();
+    all_passed &= TestHitsAndMisses();
+    all_passed &= TestExpiryAndEviction();
+    all_passed &= TestConcurrentReaders();
+    all_passed &= TestScanCache();
+
+    std::remove(ResultPath(0).c_str());
+    std::remove(ResultPath(1).c_str());
+    std::remove(QUERY_LOG.c_str());
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
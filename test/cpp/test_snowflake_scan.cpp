@@ -0,0 +1,273 @@
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_scan.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+// Batches larger than a DuckDB vector, so each one spans several chunks
+constexpr int64_t ROWS_PER_BATCH = 3000;
+constexpr int64_t BATCHES_PER_PARTITION = 2;
+constexpr int64_t PARTITIONS = 4;
+constexpr int64_t TOTAL_ROWS = ROWS_PER_BATCH * BATCHES_PER_PARTITION * PARTITIONS;
+
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER + ";account=stub;user=stub;database=stub";
+
+std::string PartitionPath(int64_t partition) {
+    return "test_snowflake_scan_part" + std::to_string(partition) + ".arrows";
+}
+
+// The stub driver treats the query as the list of result files, one partition each
+std::string ResultQuery() {
+    std::string query;
+    for (int64_t partition = 0; partition < PARTITIONS; partition++) {
+        query += (partition > 0 ? ";" : "") + PartitionPath(partition);
+    }
+    return query;
+}
+
+/**
+ * @brief Write one partition of a Snowflake-shaped result: amount NUMBER(18,2) as scaled int64, label TEXT
+ */
+bool WritePartitionFile(int64_t partition) {
+    auto schema = arrow::schema({
+        arrow::field("amount", arrow::int64(), true,
+                     arrow::key_value_metadata({"logicalType", "precision", "scale"}, {"FIXED", "18", "2"})),
+        arrow::field("label", arrow::utf8(), true, arrow::key_value_metadata({"logicalType"}, {"TEXT"})),
+    });
+    auto file = arrow::io::FileOutputStream::Open(PartitionPath(partition));
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    if (!writer.ok()) {
+        return false;
+    }
+    for (int64_t batch = 0; batch < BATCHES_PER_PARTITION; batch++) {
+        arrow::Int64Builder amounts;
+        arrow::StringBuilder labels;
+        for (int64_t i = 0; i < ROWS_PER_BATCH; i++) {
+            auto row = (partition * BATCHES_PER_PARTITION + batch) * ROWS_PER_BATCH + i;
+            (void)amounts.Append(row);
+            (void)labels.Append("row-" + std::to_string(row));
+        }
+        auto record_batch = arrow::RecordBatch::Make(schema, ROWS_PER_BATCH,
+                                                     {amounts.Finish().ValueOrDie(), labels.Finish().ValueOrDie()});
+        if (!(*writer)->WriteRecordBatch(*record_batch).ok()) {
+            return false;
+        }
+    }
+    return (*writer)->Close().ok() && (*file)->Close().ok();
+}
+
+const std::string SEMI_STRUCTURED_PATH = "test_snowflake_scan_semi.arrows";
+
+/**
+ * @brief Write a result with OBJECT and ARRAY columns, which Snowflake sends as JSON text
+ */
+bool WriteSemiStructuredFile() {
+    auto schema = arrow::schema({
+        arrow::field("id", arrow::int64(), true,
+                     arrow::key_value_metadata({"logicalType", "precision", "scale"}, {"FIXED", "18", "0"})),
+        arrow::field("attrs", arrow::utf8(), true, arrow::key_value_metadata({"logicalType"}, {"OBJECT"})),
+        arrow::field("tags", arrow::utf8(), true, arrow::key_value_metadata({"logicalType"}, {"ARRAY"})),
+    });
+    arrow::Int64Builder ids;
+    arrow::StringBuilder attrs;
+    arrow::StringBuilder tags;
+    for (int64_t i = 0; i < 3; i++) {
+        (void)ids.Append(i);
+        (void)attrs.Append("{\"n\":" + std::to_string(i) + "}");
+        (void)tags.Append("[\"t" + std::to_string(i) + "\"]");
+    }
+    auto batch = arrow::RecordBatch::Make(
+        schema, 3, {ids.Finish().ValueOrDie(), attrs.Finish().ValueOrDie(), tags.Finish().ValueOrDie()});
+    auto file = arrow::io::FileOutputStream::Open(SEMI_STRUCTURED_PATH);
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    return writer.ok() && (*writer)->WriteRecordBatch(*batch).ok() && (*writer)->Close().ok() &&
+           (*file)->Close().ok();
+}
+
+bool TestConnectionString() {
+    std::cout << "\n=== Testing Connection String ===" << std::endl;
+
+    auto config = SnowflakeConfig::Parse("account=acme; user=loader;database=SALES;warehouse=WH;query_tag=nightly");
+    TEST_ASSERT(config.account == "acme" && config.user == "loader" && config.database == "SALES",
+                "Known keys parsed and trimmed");
+    TEST_ASSERT(config.driver == "adbc_driver_snowflake", "Snowflake driver by default");
+    TEST_ASSERT(config.options.at("query_tag") == "nightly", "Unknown keys kept as options");
+    TEST_ASSERT(config.BuildURI().find("warehouse=WH") != std::string::npos, "Options reach the URI");
+    TEST_ASSERT(!SnowflakeConfig::Parse("user=loader").IsValid(), "Missing account is invalid");
+
+    return true;
+}
+
+bool TestResultStream() {
+    std::cout << "\n=== Testing Result Stream ===" << std::endl;
+
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    auto error = connector.Connect();
+    TEST_ASSERT(error.empty(), "Connected through the stub driver: " + error);
+
+    auto executed = connector.ExecuteQuery(ResultQuery());
+    TEST_ASSERT(executed.first != nullptr, "Query executed: " + executed.second);
+    TEST_ASSERT(executed.first->GetSchema()->num_fields() == 2, "Schema available before reading");
+
+    int64_t batches = 0;
+    int64_t rows = 0;
+    while (true) {
+        auto next = executed.first->ReadNext();
+        TEST_ASSERT(next.second.empty(), "Batch read");
+        if (!next.first) {
+            break;
+        }
+        batches++;
+        rows += next.first->num_rows();
+    }
+    TEST_ASSERT(batches == BATCHES_PER_PARTITION * PARTITIONS && rows == TOTAL_ROWS, "Every batch streamed");
+    auto after_end = executed.first->ReadNext();
+    TEST_ASSERT(after_end.first == nullptr && after_end.second.empty(), "Exhausted stream stays exhausted");
+
+    auto missing = connector.ExecuteQuery("does_not_exist.arrows");
+    TEST_ASSERT(missing.first == nullptr && missing.second.find("ADBC Error") != std::string::npos,
+                "Driver error reported");
+
+    return true;
+}
+
+bool TestPartitions() {
+    std::cout << "\n=== Testing Partitioned Execution ===" << std::endl;
+
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    auto executed = connector.ExecutePartitions(ResultQuery());
+    TEST_ASSERT(executed.first != nullptr, "Partitions returned: " + executed.second);
+    TEST_ASSERT(connector.SupportsPartitions(), "Driver supports partitions");
+    auto& partitions = *executed.first;
+    TEST_ASSERT(partitions.descriptors.size() == PARTITIONS && partitions.schema->num_fields() == 2,
+                "One descriptor per partition, schema up front");
+
+    // Read in reverse: partitions are independent
+    int64_t rows = 0;
+    for (auto descriptor = partitions.descriptors.rbegin(); descriptor != partitions.descriptors.rend(); ++descriptor) {
+        auto stream = connector.ReadPartition(*descriptor);
+        TEST_ASSERT(stream.first != nullptr, "Partition opened: " + stream.second);
+        while (auto batch = stream.first->ReadNext().first) {
+            rows += batch->num_rows();
+        }
+    }
+    TEST_ASSERT(rows == TOTAL_ROWS, "Partitions cover the result");
+
+    auto missing = connector.ReadPartition("does_not_exist.arrows");
+    TEST_ASSERT(missing.first == nullptr && !missing.second.empty(), "Bad partition reported");
+
+    return true;
+}
+
+bool TestScanFunction() {
+    std::cout << "\n=== Testing snowflake_scan ===" << std::endl;
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    con.Query("SET threads = 4");
+
+    auto scan = "snowflake_scan('" + CONNECTION + "', '" + ResultQuery() + "')";
+    for (auto& source : {scan, "snowflake_scan('" + CONNECTION + "', '" + ResultQuery() + "', partitioned := false)"}) {
+        auto result = con.Query("SELECT COUNT(*), SUM(amount * 100)::BIGINT, COUNT(DISTINCT label) FROM " + source);
+        TEST_ASSERT(!result->HasError(), "Scan executed: " + (result->HasError() ? result->GetError() : ""));
+        TEST_ASSERT(result->GetValue(0, 0).GetValue<int64_t>() == TOTAL_ROWS, "Every row scanned once");
+        TEST_ASSERT(result->GetValue(1, 0).GetValue<int64_t>() == TOTAL_ROWS * (TOTAL_ROWS - 1) / 2,
+                    "Scaled NUMBER values decoded");
+        TEST_ASSERT(result->GetValue(2, 0).GetValue<int64_t>() == TOTAL_ROWS, "Strings decoded");
+    }
+
+    auto result = con.Query("SELECT label FROM " + scan + " WHERE amount = 123.45");
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 1 && result->GetValue(0, 0).ToString() == "row-12345",
+                "Row lookup");
+
+    result = con.Query("DESCRIBE SELECT * FROM " + scan);
+    TEST_ASSERT(!result->HasError() && result->GetValue(1, 0).ToString() == "DECIMAL(18,2)",
+                "Column type from Snowflake field metadata");
+
+    result = con.Query("SELECT * FROM snowflake_scan('" + CONNECTION + "', 'does_not_exist.arrows')");
+    TEST_ASSERT(result->HasError() && result->GetError().find("snowflake_scan") != std::string::npos,
+                "Driver error surfaced");
+
+    auto semi = "snowflake_scan('" + CONNECTION + "', '" + SEMI_STRUCTURED_PATH + "')";
+    result = con.Query("DESCRIBE SELECT * FROM " + semi);
+    TEST_ASSERT(!result->HasError() && result->GetValue(1, 1).ToString() == "VARCHAR" &&
+                    result->GetValue(1, 2).ToString() == "VARCHAR",
+                "OBJECT and ARRAY columns bind as VARCHAR");
+    result = con.Query("SELECT attrs, tags FROM " + semi + " WHERE id = 2");
+    TEST_ASSERT(!result->HasError() && result->RowCount() == 1 && result->GetValue(0, 0).ToString() == "{\"n\":2}" &&
+                    result->GetValue(1, 0).ToString() == "[\"t2\"]",
+                "Semi-structured values read as JSON text");
+
+    // Bound scans hold no session, so more prepared scans than the pool's max_size all run
+    std::vector<unique_ptr<PreparedStatement>> prepared;
+    for (int i = 0; i < 12; i++) {
+        prepared.push_back(con.Prepare("SELECT COUNT(*) FROM " + semi));
+        TEST_ASSERT(!prepared.back()->HasError(), "Scan prepared");
+    }
+    for (auto &statement : prepared) {
+        result = statement->Execute();
+        TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<int64_t>() == 3, "Prepared scan executed");
+    }
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting snowflake_scan tests..." << std::endl;
+
+    for (int64_t partition = 0; partition < PARTITIONS; partition++) {
+        if (!WritePartitionFile(partition)) {
+            std::cout << "❌ Could not write " << PartitionPath(partition) << std::endl;
+            return 1;
+        }
+    }
+    if (!WriteSemiStructuredFile()) {
+        std::cout << "❌ Could not write " << SEMI_STRUCTURED_PATH << std::endl;
+        return 1;
+    }
+
+    bool all_passed = true;
+
+    all_passed &= TestConnectionString();
+    all_passed &= TestResultStream();
+    all_passed &= TestPartitions();
+    all_passed &= TestScanFunction();
+
+    for (int64_t partition = 0; partition < PARTITIONS; partition++) {
+        std::remove(PartitionPath(partition).c_str());
+    }
+    std::remove(SEMI_STRUCTURED_PATH.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
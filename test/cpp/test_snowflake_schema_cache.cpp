@@ -0,0 +1,295 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "duckdb.hpp"
+#include "snowflake_extension.hpp"
+#include "snowflake_schema_cache.hpp"
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+const std::string COLUMNS_PATH = "test_snowflake_schema_cache_columns.arrows";
+const std::string QUERY_LOG = "test_snowflake_schema_cache_queries.log";
+// The stub driver answers every INFORMATION_SCHEMA query with COLUMNS_PATH and logs what it ran
+const std::string CONNECTION = std::string("driver=") + ADBC_IPC_STUB_DRIVER +
+                               ";account=stub;user=stub;database=ANALYTICS;stub_information_schema=" +
+                               COLUMNS_PATH + ";stub_query_log=" + QUERY_LOG;
+
+struct ColumnRow {
+    std::string schema;
+    std::string table;
+    std::string column;
+    std::string data_type;
+    int64_t precision;  // -1 for NULL, as in ColumnType
+    int64_t scale;
+    int64_t datetime_precision;
+    int64_t length;
+    std::string nullable;
+};
+
+const std::vector<ColumnRow> COLUMN_ROWS = {
+    {"PUBLIC", "CUSTOMERS", "ID", "NUMBER", 38, 0, -1, -1, "NO"},
+    {"PUBLIC", "CUSTOMERS", "NAME", "TEXT", -1, -1, -1, 100, "YES"},
+    {"PUBLIC", "ORDERS", "ID", "NUMBER", 38, 0, -1, -1, "NO"},
+    {"PUBLIC", "ORDERS", "AMOUNT", "NUMBER", 18, 2, -1, -1, "YES"},
+    {"PUBLIC", "ORDERS", "PLACED_AT", "TIMESTAMP_NTZ", -1, -1, 9, -1, "YES"},
+    {"PUBLIC", "ORDERS", "NOTE", "TEXT", -1, -1, -1, 100, "YES"},
+    {"PUBLIC", "ORDERS", "PAYLOAD", "MYSTERY", -1, -1, -1, -1, "YES"},
+    {"STAGING", "RAW_ORDERS", "ID", "NUMBER", 38, 0, -1, -1, "YES"},
+    {"STAGING", "RAW_ORDERS", "RAW", "VARIANT", -1, -1, -1, -1, "YES"},
+};
+
+/**
+ * @brief Write COLUMN_ROWS the way Snowflake returns INFORMATION_SCHEMA.COLUMNS
+ */
+bool WriteColumnsFile() {
+    arrow::StringBuilder schemas, tables, columns, data_types, nullables;
+    arrow::Int64Builder precisions, scales, datetime_precisions, lengths;
+    auto append_number = [](arrow::Int64Builder &builder, int64_t value) {
+        return value < 0 ? builder.AppendNull() : builder.Append(value);
+    };
+    for (auto &row : COLUMN_ROWS) {
+        (void)schemas.Append(row.schema);
+        (void)tables.Append(row.table);
+        (void)columns.Append(row.column);
+        (void)data_types.Append(row.data_type);
+        (void)append_number(precisions, row.precision);
+        (void)append_number(scales, row.scale);
+        (void)append_number(datetime_precisions, row.datetime_precision);
+        (void)append_number(lengths, row.length);
+        (void)nullables.Append(row.nullable);
+    }
+    auto schema = arrow::schema({arrow::field("TABLE_SCHEMA", arrow::utf8()),
+                                 arrow::field("TABLE_NAME", arrow::utf8()),
+                                 arrow::field("COLUMN_NAME", arrow::utf8()),
+                                 arrow::field("DATA_TYPE", arrow::utf8()),
+                                 arrow::field("NUMERIC_PRECISION", arrow::int64()),
+                                 arrow::field("NUMERIC_SCALE", arrow::int64()),
+                                 arrow::field("DATETIME_PRECISION", arrow::int64()),
+                                 arrow::field("CHARACTER_MAXIMUM_LENGTH", arrow::int64()),
+                                 arrow::field("IS_NULLABLE", arrow::utf8())});
+    auto batch = arrow::RecordBatch::Make(
+        schema, COLUMN_ROWS.size(),
+        {schemas.Finish().ValueOrDie(), tables.Finish().ValueOrDie(), columns.Finish().ValueOrDie(),
+         data_types.Finish().ValueOrDie(), precisions.Finish().ValueOrDie(), scales.Finish().ValueOrDie(),
+         datetime_precisions.Finish().ValueOrDie(), lengths.Finish().ValueOrDie(), nullables.Finish().ValueOrDie()});
+
+    auto file = arrow::io::FileOutputStream::Open(COLUMNS_PATH);
+    if (!file.ok()) {
+        return false;
+    }
+    auto writer = arrow::ipc::MakeStreamWriter(*file, schema);
+    if (!writer.ok() || !(*writer)->WriteRecordBatch(*batch).ok()) {
+        return false;
+    }
+    return (*writer)->Close().ok() && (*file)->Close().ok();
+}
+
+idx_t QueriesRun() {
+    std::ifstream log(QUERY_LOG);
+    std::string line;
+    idx_t queries = 0;
+    while (std::getline(log, line)) {
+        queries++;
+    }
+    return queries;
+}
+
+bool TestColumnType() {
+    std::cout << "\n=== Testing Column Type Reconstruction ===" << std::endl;
+
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("NUMBER", 18, 2, -1, -1) == "NUMBER(18,2)", "NUMBER with scale");
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("NUMBER", 38, -1, -1, -1) == "NUMBER(38,0)",
+                "NULL scale read as 0");
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("TEXT", -1, -1, -1, 16777216) == "VARCHAR(16777216)",
+                "TEXT with length");
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("TIMESTAMP_LTZ", -1, -1, 3, -1) == "TIMESTAMP_LTZ(3)",
+                "Timestamp precision");
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("TIME", -1, -1, 0, -1) == "TIME(0)", "TIME precision 0 kept");
+    TEST_ASSERT(SnowflakeSchemaCache::ColumnType("float", 53, -1, -1, -1) == "FLOAT", "Other types unchanged");
+
+    return true;
+}
+
+bool TestColumnsQuery() {
+    std::cout << "\n=== Testing INFORMATION_SCHEMA Query ===" << std::endl;
+
+    auto query = SnowflakeSchemaCache::BuildColumnsQuery("ANALYTICS", "PUBLIC");
+    TEST_ASSERT(query.find("FROM ANALYTICS.INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = 'PUBLIC'") !=
+                    std::string::npos,
+                "Schema query reads one schema of the database");
+    TEST_ASSERT(query.find("ORDER BY TABLE_SCHEMA, TABLE_NAME, ORDINAL_POSITION") != std::string::npos,
+                "Columns come in table order");
+
+    query = SnowflakeSchemaCache::BuildColumnsQuery("my-db", "it's");
+    TEST_ASSERT(query.find("FROM \"my-db\".INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = 'it''s'") !=
+                    std::string::npos,
+                "Database quoted, schema escaped");
+    TEST_ASSERT(SnowflakeSchemaCache::BuildColumnsQuery("ANALYTICS", "").find("WHERE") == std::string::npos,
+                "Database query reads every schema");
+    TEST_ASSERT(SnowflakeSchemaCache::QualifiedName("ANALYTICS", "PUBLIC", "Orders") ==
+                    "ANALYTICS.\"PUBLIC\".\"Orders\"",
+                "Qualified table name");
+
+    return true;
+}
+
+bool TestSchemaLoad() {
+    std::cout << "\n=== Testing Schema Load ===" << std::endl;
+    std::remove(QUERY_LOG.c_str());
+
+    SnowflakeSchemaCache cache;
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    auto orders = cache.GetTable(connector, "PUBLIC", "ORDERS");
+    TEST_ASSERT(orders.first && orders.second.empty(), "Table found: " + orders.second);
+    TEST_ASSERT(orders.first->columns.size() == 5 && orders.first->columns[0].name == "ID" &&
+                    orders.first->columns[4].name == "PAYLOAD",
+                "Columns in ordinal order");
+
+    auto &amount = orders.first->columns[1];
+    TEST_ASSERT(amount.snowflake_type == "NUMBER(18,2)" && amount.type == LogicalType::DECIMAL(18, 2) &&
+                    amount.nullable,
+                "Decimal column converted");
+    TEST_ASSERT(!orders.first->columns[0].nullable, "IS_NULLABLE = NO kept");
+    TEST_ASSERT(orders.first->columns[2].type == LogicalType::TIMESTAMP, "Timestamp with precision converted");
+    TEST_ASSERT(!orders.first->columns[4].error.empty() && orders.first->columns[4].snowflake_type == "MYSTERY",
+                "Unknown type reported per column");
+
+    auto customers = cache.GetTable(connector, "PUBLIC", "customers");
+    TEST_ASSERT(customers.first && customers.first->name == "CUSTOMERS", "Unquoted name matched case-insensitively");
+    TEST_ASSERT(QueriesRun() == 1, "Whole schema loaded by one query");
+
+    auto metrics = cache.GetMetrics();
+    TEST_ASSERT(metrics.loads == 1 && metrics.misses == 1 && metrics.hits == 1 && metrics.schemas == 1,
+                "Second table served from the cache");
+    // NUMBER(38,0), VARCHAR(100), NUMBER(18,2), TIMESTAMP_NTZ(9), MYSTERY
+    TEST_ASSERT(metrics.type_conversions == 5, "Each distinct type converted once");
+
+    auto missing = cache.GetTable(connector, "PUBLIC", "NOPE");
+    TEST_ASSERT(!missing.first && missing.second.find("PUBLIC.NOPE") != std::string::npos,
+                "Missing table reported");
+
+    auto empty = cache.GetSchema(connector, "NOPE");
+    TEST_ASSERT(empty.first && empty.first->tables.empty(), "Missing schema has no tables");
+
+    return true;
+}
+
+bool TestExpiryAndInvalidation() {
+    std::cout << "\n=== Testing Expiry and Invalidation ===" << std::endl;
+    std::remove(QUERY_LOG.c_str());
+
+    SnowflakeSchemaCacheOptions options;
+    options.ttl = std::chrono::milliseconds(0);
+    SnowflakeSchemaCache cache(options);
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    cache.GetTable(connector, "PUBLIC", "ORDERS");
+    cache.GetTable(connector, "PUBLIC", "ORDERS");
+    TEST_ASSERT(QueriesRun() == 2 && cache.GetMetrics().hits == 0, "Expired schema reloaded");
+
+    cache.Configure(SnowflakeSchemaCacheOptions());
+    cache.GetTable(connector, "PUBLIC", "ORDERS");
+    cache.GetTable(connector, "PUBLIC", "ORDERS");
+    TEST_ASSERT(QueriesRun() == 3, "Fresh schema served from the cache");
+
+    // Another principal has its own entries
+    SnowflakeADBCConnector other(SnowflakeConfig::Parse(CONNECTION + ";role=OTHER"));
+    TEST_ASSERT(other.Connect().empty(), "Connected as another role");
+    cache.GetTable(other, "PUBLIC", "ORDERS");
+    TEST_ASSERT(QueriesRun() == 4 && cache.GetMetrics().schemas == 2, "Entries keyed by connection");
+
+    cache.Invalidate(connector.GetConfig());
+    TEST_ASSERT(cache.GetMetrics().schemas == 1, "Invalidate drops one connection's schemas");
+    cache.GetTable(connector, "PUBLIC", "ORDERS");
+    TEST_ASSERT(QueriesRun() == 5, "Invalidated schema reloaded");
+
+    cache.Clear();
+    TEST_ASSERT(cache.GetMetrics().schemas == 0, "Clear drops every schema");
+
+    return true;
+}
+
+bool TestPrefetchDatabase() {
+    std::cout << "\n=== Testing Database Prefetch ===" << std::endl;
+    std::remove(QUERY_LOG.c_str());
+
+    SnowflakeSchemaCache cache;
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+
+    auto prefetched = cache.PrefetchDatabase(connector);
+    TEST_ASSERT(prefetched.second.empty() && prefetched.first == std::vector<std::string>({"PUBLIC", "STAGING"}),
+                "Database prefetched");
+    TEST_ASSERT(cache.GetMetrics().schemas == 2, "Every schema cached");
+
+    auto raw = cache.GetTable(connector, "STAGING", "RAW_ORDERS");
+    auto orders = cache.GetTable(connector, "PUBLIC", "ORDERS");
+    TEST_ASSERT(raw.first && orders.first, "Tables of both schemas found");
+    TEST_ASSERT(QueriesRun() == 1 && cache.GetMetrics().loads == 1, "One query for the whole database");
+
+    return true;
+}
+
+bool TestClearCacheFunction() {
+    std::cout << "\n=== Testing snowflake_clear_cache() ===" << std::endl;
+
+    SnowflakeADBCConnector connector(SnowflakeConfig::Parse(CONNECTION));
+    TEST_ASSERT(connector.Connect().empty(), "Connected");
+    SnowflakeSchemaCache::Get().GetSchema(connector, "PUBLIC");
+    TEST_ASSERT(SnowflakeSchemaCache::Get().GetMetrics().schemas == 1, "Shared cache filled");
+
+    DuckDB db(nullptr);
+    SnowflakeExtension::Load(*db.instance);
+    Connection con(db);
+    auto result = con.Query("CALL snowflake_clear_cache()");
+    TEST_ASSERT(!result->HasError() && result->GetValue(0, 0).GetValue<bool>(),
+                "CALL succeeds: " + (result->HasError() ? result->GetError() : ""));
+    TEST_ASSERT(SnowflakeSchemaCache::Get().GetMetrics().schemas == 0, "Shared cache cleared");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting Snowflake schema cache tests..." << std::endl;
+
+    if (!WriteColumnsFile()) {
+        std::cout << "❌ Could not write INFORMATION_SCHEMA file" << std::endl;
+        return 1;
+    }
+
+    bool all_passed = true;
+
+    all_passed &= TestColumnType();
+    all_passed &= TestColumnsQuery();
+    all_passed &= TestSchemaLoad();
+    all_passed &= TestExpiryAndInvalidation();
+    all_passed &= TestPrefetchDatabase();
+    all_passed &= TestClearCacheFunction();
+
+    std::remove(COLUMNS_PATH.c_str());
+    std::remove(QUERY_LOG.c_str());
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <limits>
+#include <string>
+#include "snowflake_temporal_encoder.hpp"
+#include "snowflake_arrow_decoder.hpp"
+#include <arrow/api.h>
+#include <arrow/util/key_value_metadata.h>
+
+using namespace duckdb;
+
+#define TEST_ASSERT(condition, message) \
+    if (!(condition)) { \
+        std::cout << "✗ FAIL: " << message << std::endl; \
+        return false; \
+    } else { \
+        std::cout << "✓ PASS: " << message << std::endl; \
+    }
+
+constexpr int64_t MICROS_PER_HOUR = 3600LL * 1000000LL;
+
+template<typename ARRAY>
+const ARRAY& Child(const arrow::Array& array, const std::string& name) {
+    return static_cast<const ARRAY&>(*static_cast<const arrow::StructArray&>(array).GetFieldByName(name));
+}
+
+bool TestScaledEncoding() {
+    std::cout << "\n=== Testing Scaled Encoding ===" << std::endl;
+
+    Vector timestamps(LogicalType::TIMESTAMP, 3);
+    auto micros = FlatVector::GetData<int64_t>(timestamps);
+    micros[0] = 1700000000123456LL;
+    micros[1] = -1;
+    FlatVector::SetNull(timestamps, 2, true);
+
+    auto encoded = SnowflakeTemporalEncoder::Encode(timestamps, 3, SnowflakeTimestampKind::NTZ, 3);
+    TEST_ASSERT(encoded.IsValid(), "TIMESTAMP encoded as TIMESTAMP_NTZ(3)");
+    auto& millis = static_cast<const arrow::Int64Array&>(*encoded.GetValue());
+    TEST_ASSERT(millis.Value(0) == 1700000000123LL && millis.Value(1) == -1, "Microseconds floored to milliseconds");
+    TEST_ASSERT(millis.IsNull(2) && millis.null_count() == 1, "NULL preserved");
+
+    encoded = SnowflakeTemporalEncoder::Encode(timestamps, 2, SnowflakeTimestampKind::LTZ, 7);
+    TEST_ASSERT(encoded.IsValid() &&
+                static_cast<const arrow::Int64Array&>(*encoded.GetValue()).Value(0) == 17000000001234560LL,
+                "TIMESTAMP_LTZ(7) scaled up");
+
+    Vector times(LogicalType::TIME, 1);
+    FlatVector::GetData<int64_t>(times)[0] = 3723004005LL;
+    encoded = SnowflakeTemporalEncoder::Encode(times, 1, SnowflakeTimestampKind::NTZ, 9);
+    TEST_ASSERT(encoded.IsValid() &&
+                static_cast<const arrow::Int64Array&>(*encoded.GetValue()).Value(0) == 3723004005000LL,
+                "TIME encoded as TIME(9)");
+
+    micros[0] = std::numeric_limits<int64_t>::max() / 10 + 1;
+    encoded = SnowflakeTemporalEncoder::Encode(timestamps, 2, SnowflakeTimestampKind::NTZ, 7);
+    TEST_ASSERT(!encoded.IsValid() && encoded.GetError().find("row 0") != std::string::npos,
+                "Overflow reported with its row");
+
+    return true;
+}
+
+bool TestStructEncoding() {
+    std::cout << "\n=== Testing Struct Encoding ===" << std::endl;
+
+    Vector nanos(LogicalType::TIMESTAMP_NS, 2);
+    FlatVector::GetData<int64_t>(nanos)[0] = 1700000000123456789LL;
+    FlatVector::GetData<int64_t>(nanos)[1] = -1;
+
+    auto encoded = SnowflakeTemporalEncoder::Encode(nanos, 2, SnowflakeTimestampKind::NTZ, 9);
+    TEST_ASSERT(encoded.IsValid(), "TIMESTAMP_NS encoded as TIMESTAMP_NTZ(9)");
+    TEST_ASSERT(encoded.GetValue()->type()->Equals(
+                    *SnowflakeTemporalEncoder::GetArrowType(LogicalType::TIMESTAMP_NS, SnowflakeTimestampKind::NTZ, 9)),
+                "Type matches GetArrowType");
+    auto& epoch = Child<arrow::Int64Array>(*encoded.GetValue(), "epoch");
+    auto& fraction = Child<arrow::Int32Array>(*encoded.GetValue(), "fraction");
+    TEST_ASSERT(epoch.Value(0) == 1700000000 && fraction.Value(0) == 123456789, "Epoch and nanosecond fraction");
+    TEST_ASSERT(epoch.Value(1) == -1 && fraction.Value(1) == 999999999, "Pre-epoch fraction is non-negative");
+
+    encoded = SnowflakeTemporalEncoder::Encode(nanos, 1, SnowflakeTimestampKind::LTZ, 8);
+    TEST_ASSERT(encoded.IsValid() && Child<arrow::Int32Array>(*encoded.GetValue(), "fraction").Value(0) == 123456780,
+                "Fraction truncated to the column scale");
+
+    // Round trip through the decoder
+    auto field = arrow::field("ts", encoded.GetValue()->type(), true, arrow::key_value_metadata({"scale"}, {"8"}));
+    auto decoder = SnowflakeColumnDecoder::Create(*field, LogicalType::TIMESTAMP_NS);
+    Vector decoded(LogicalType::TIMESTAMP_NS);
+    auto rows = decoder.GetValue().Decode(*encoded.GetValue(), 0, 1, decoded);
+    TEST_ASSERT(rows.IsValid() && FlatVector::GetData<int64_t>(decoded)[0] == 1700000000123456780LL,
+                "Decoder reads the encoder's struct layout");
+
+    return true;
+}
+
+bool TestTimezoneEncoding() {
+    std::cout << "\n=== Testing Timezone Encoding ===" << std::endl;
+
+    Vector instants(LogicalType::TIMESTAMP_TZ, 4);
+    auto micros = FlatVector::GetData<int64_t>(instants);
+    micros[0] = 10 * MICROS_PER_HOUR;
+    micros[1] = 20 * MICROS_PER_HOUR;
+    micros[2] = 11 * MICROS_PER_HOUR;
+    FlatVector::SetNull(instants, 3, true);
+
+    // UTC+1 before hour 12, UTC+2 from then on
+    TimezoneOffsetCache zone([](int64_t value) {
+        auto boundary = 12 * MICROS_PER_HOUR;
+        if (value < boundary) {
+            return TimezoneOffsetSpan {std::numeric_limits<int64_t>::min(), boundary - 1, 60};
+        }
+        return TimezoneOffsetSpan {boundary, std::numeric_limits<int64_t>::max(), 120};
+    });
+
+    auto encoded = SnowflakeTemporalEncoder::Encode(instants, 4, SnowflakeTimestampKind::TZ, 9, &zone);
+    TEST_ASSERT(encoded.IsValid(), "TIMESTAMP_TZ(9) encoded");
+    auto& timezone = Child<arrow::Int32Array>(*encoded.GetValue(), "timezone");
+    TEST_ASSERT(timezone.Value(0) == 1440 + 60 && timezone.Value(1) == 1440 + 120 && timezone.Value(2) == 1440 + 60,
+                "Offsets follow the zone's transition");
+    TEST_ASSERT(encoded.GetValue()->IsNull(3), "NULL preserved");
+    TEST_ASSERT(zone.GetLookupCount() == 2, "One lookup per span, not per row");
+
+    encoded = SnowflakeTemporalEncoder::Encode(instants, 3, SnowflakeTimestampKind::TZ, 9, &zone);
+    TEST_ASSERT(zone.GetLookupCount() == 2, "Spans reused across batches");
+
+    auto fixed = TimezoneOffsetCache::Fixed(-300);
+    encoded = SnowflakeTemporalEncoder::Encode(instants, 3, SnowflakeTimestampKind::TZ, 3, &fixed);
+    TEST_ASSERT(encoded.IsValid(), "TIMESTAMP_TZ(3) encoded");
+    TEST_ASSERT(Child<arrow::Int64Array>(*encoded.GetValue(), "epoch").Value(0) == 36000000LL,
+                "Compact layout scales the epoch");
+    TEST_ASSERT(Child<arrow::Int32Array>(*encoded.GetValue(), "timezone").Value(2) == 1440 - 300, "Fixed offset");
+    TEST_ASSERT(fixed.GetLookupCount() == 1, "Fixed zone looked up once");
+
+    encoded = SnowflakeTemporalEncoder::Encode(instants, 1, SnowflakeTimestampKind::TZ, 6);
+    TEST_ASSERT(encoded.IsValid() && Child<arrow::Int32Array>(*encoded.GetValue(), "timezone").Value(0) == 1440,
+                "No zone means UTC");
+
+    Vector numbers(LogicalType::BIGINT, 1);
+    encoded = SnowflakeTemporalEncoder::Encode(numbers, 1, SnowflakeTimestampKind::NTZ, 9);
+    TEST_ASSERT(!encoded.IsValid(), "Non-temporal vector rejected");
+
+    return true;
+}
+
+int main() {
+    std::cout << "Starting SnowflakeTemporalEncoder tests..." << std::endl;
+
+    bool all_passed = true;
+
+    all_passed &= TestScaledEncoding();
+    all_passed &= TestStructEncoding();
+    all_passed &= TestTimezoneEncoding();
+
+    if (all_passed) {
+        std::cout << "\n🎉 All tests passed!" << std::endl;
+        return 0;
+    } else {
+        std::cout << "\n❌ Some tests failed!" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
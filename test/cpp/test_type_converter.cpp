@@ -1,6 +1,11 @@
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 #include "type_converter.hpp"
+#include "type_conversion_cache.hpp"
+#include "snowflake_type_parser.hpp"
+#include "type_registry.hpp"
 
 using namespace duckdb;
 
@@ -94,6 +99,41 @@ bool TestTemporalTypes() {
     TEST_ASSERT(result.IsValid(), "TIMESTAMP_TZ conversion");
     TEST_ASSERT(result.GetValue() == "TIMESTAMP_TZ", "TIMESTAMP_TZ -> TIMESTAMP_TZ");
 
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::TIMESTAMP_NS);
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "TIMESTAMP_NTZ(9)", "TIMESTAMP_NS -> TIMESTAMP_NTZ(9)");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::TIMESTAMP_MS);
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "TIMESTAMP_NTZ(3)", "TIMESTAMP_MS -> TIMESTAMP_NTZ(3)");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::TIMESTAMP_S);
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "TIMESTAMP_NTZ(0)", "TIMESTAMP_S -> TIMESTAMP_NTZ(0)");
+
+    result = SnowflakeTypeConverter::ConvertTemporalType(LogicalType::TIMESTAMP_TZ, SnowflakeTimestampKind::LTZ);
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "TIMESTAMP_LTZ", "TIMESTAMP_TZ -> TIMESTAMP_LTZ on request");
+
+    result = SnowflakeTypeConverter::ConvertTemporalType(LogicalType::INTEGER);
+    TEST_ASSERT(!result.IsValid(), "Non-temporal type rejected");
+
+    auto ltz = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("TIMESTAMP_LTZ(9)");
+    TEST_ASSERT(ltz.IsValid() && ltz.GetValue().id() == LogicalTypeId::TIMESTAMP_TZ, "TIMESTAMP_LTZ(9) -> TIMESTAMP_TZ");
+
+    auto time9 = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("TIME(9)");
+    TEST_ASSERT(time9.IsValid() && time9.GetValue().id() == LogicalTypeId::TIME, "TIME(9) -> TIME");
+
+    auto parsed = SnowflakeTypeParser::Parse("TIMESTAMP_NTZ(9)");
+    TEST_ASSERT(parsed.fractional_precision == 9 && parsed.ExactTemporalType() == LogicalType::TIMESTAMP_NS,
+                "TIMESTAMP_NTZ(9) resolves to TIMESTAMP_NS");
+    parsed = SnowflakeTypeParser::Parse("TIMESTAMP(3) WITHOUT TIME ZONE");
+    TEST_ASSERT(parsed.fractional_precision == 3 && parsed.ExactTemporalType() == LogicalType::TIMESTAMP_MS,
+                "TIMESTAMP(3) resolves to TIMESTAMP_MS");
+    parsed = SnowflakeTypeParser::Parse("TIMESTAMP_NTZ(6)");
+    TEST_ASSERT(parsed.ExactTemporalType() == LogicalType::TIMESTAMP, "TIMESTAMP_NTZ(6) stays TIMESTAMP");
+    parsed = SnowflakeTypeParser::Parse("TIME(0)");
+    TEST_ASSERT(parsed.fractional_precision == 0 && parsed.ExactTemporalType() == LogicalType::TIME,
+                "TIME has no other resolution");
+    parsed = SnowflakeTypeParser::Parse("ARRAY(TIMESTAMP_NTZ(0))");
+    TEST_ASSERT(parsed.fractional_precision == 9, "Nested precision not reported");
+
     return true;
 }
 
@@ -110,6 +150,10 @@ bool TestDecimalTypes() {
     TEST_ASSERT(result.IsValid(), "DECIMAL(38,10) conversion");
     TEST_ASSERT(result.GetValue() == "NUMBER(38,10)", "DECIMAL(38,10) -> NUMBER(38,10)");
 
+    auto adjustment = SnowflakeTypeConverter::AdjustDecimalForSnowflake(50, 10);
+    TEST_ASSERT(adjustment.adjusted_precision == 38 && adjustment.adjusted_scale == 0,
+                "(50,10) reduces scale first -> (38,0)");
+
     return true;
 }
 
@@ -133,6 +177,307 @@ bool TestArrowConversion() {
     return true;
 }
 
+bool TestNestedTypes() {
+    std::cout << "\n=== Testing Nested Types ===" << std::endl;
+
+    auto result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::LIST(LogicalType::INTEGER));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "ARRAY(NUMBER(10,0))", "LIST(INTEGER) -> ARRAY(NUMBER(10,0))");
+
+    auto row_type = LogicalType::STRUCT({{"a", LogicalType::INTEGER}, {"b", LogicalType::VARCHAR}});
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(row_type);
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "OBJECT(a NUMBER(10,0), b VARCHAR)",
+                "STRUCT -> structured OBJECT");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(
+        LogicalType::STRUCT({{"odd name", LogicalType::BOOLEAN}}));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "OBJECT(\"odd name\" BOOLEAN)", "Field names quoted when needed");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::LIST(row_type));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "ARRAY(OBJECT(a NUMBER(10,0), b VARCHAR))",
+                "Conversion is recursive");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::DOUBLE));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "MAP(VARCHAR, DOUBLE)", "MAP(VARCHAR, DOUBLE)");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::MAP(LogicalType::DOUBLE, LogicalType::VARCHAR));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "OBJECT", "MAP with a DOUBLE key falls back to OBJECT");
+
+    auto union_type = LogicalType::UNION({{"n", LogicalType::INTEGER}, {"s", LogicalType::VARCHAR}});
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::LIST(union_type));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "ARRAY", "Semi-structured element gives untyped ARRAY");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::ARRAY(LogicalType::FLOAT, 3));
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "VECTOR(FLOAT, 3)", "ARRAY(FLOAT, 3) -> VECTOR(FLOAT, 3)");
+
+    result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::LIST(LogicalType::INTERVAL));
+    TEST_ASSERT(!result.IsValid() && result.GetError().find("element") != std::string::npos,
+                "Unsupported element named in the error");
+
+    auto arrow_result = SnowflakeTypeConverter::ConvertDuckDBToArrow(row_type);
+    TEST_ASSERT(arrow_result.IsValid() &&
+                arrow_result.GetValue()->Equals(*arrow::struct_({arrow::field("a", arrow::int32()),
+                                                                 arrow::field("b", arrow::utf8())})),
+                "STRUCT -> Arrow struct");
+    arrow_result = SnowflakeTypeConverter::ConvertDuckDBToArrow(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::DOUBLE));
+    TEST_ASSERT(arrow_result.IsValid() && arrow_result.GetValue()->id() == arrow::Type::MAP, "MAP -> Arrow map");
+    result = SnowflakeTypeConverter::ConvertArrowToSnowflake(*arrow_result.GetValue());
+    TEST_ASSERT(result.IsValid() && result.GetValue() == "MAP(VARCHAR, DOUBLE)", "Arrow map -> Snowflake MAP");
+
+    return true;
+}
+
+bool TestTypeRegistry() {
+    std::cout << "\n=== Testing Type Registry ===" << std::endl;
+    
+    for (auto& entry : SnowflakeTypeRegistry::Entries()) {
+        std::string name(entry.duckdb_name);
+        LogicalType duckdb_type(entry.duckdb_id);
+
+        auto snowflake_result = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(duckdb_type);
+        TEST_ASSERT(snowflake_result.IsValid() && snowflake_result.GetValue() == entry.snowflake_name,
+                    name + " -> " + std::string(entry.snowflake_name));
+
+        auto arrow_result = SnowflakeTypeConverter::ConvertDuckDBToArrow(duckdb_type);
+        TEST_ASSERT(arrow_result.IsValid() && arrow_result.GetValue() != nullptr, name + " -> Arrow");
+        TEST_ASSERT(SnowflakeTypeRegistry::GetArrowTag(*arrow_result.GetValue()) == entry.arrow_tag,
+                    name + " Arrow type maps back to its registry tag");
+
+        auto typed_result = SnowflakeTypeConverter::ConvertArrowToSnowflake(*arrow_result.GetValue());
+        TEST_ASSERT(typed_result.IsValid() && typed_result.GetValue() == entry.snowflake_name,
+                    name + " Arrow type -> Snowflake");
+
+        auto string_result = SnowflakeTypeConverter::ConvertArrowToSnowflake(std::string(entry.arrow_name));
+        TEST_ASSERT(string_result.IsValid() && string_result.GetValue() == entry.snowflake_name,
+                    std::string(entry.arrow_name) + " -> Snowflake");
+
+        // Arrow prints some types differently from the registry (string, double, date32[day], ...)
+        auto printed = arrow_result.GetValue()->ToString();
+        auto printed_result = SnowflakeTypeConverter::ConvertArrowToSnowflake(printed);
+        TEST_ASSERT(printed_result.IsValid() && printed_result.GetValue() == entry.snowflake_name,
+                    printed + " -> Snowflake");
+        auto encoded = arrow::dictionary(arrow::int32(), arrow_result.GetValue())->ToString();
+        auto encoded_result = SnowflakeTypeConverter::ConvertArrowToSnowflake(encoded);
+        TEST_ASSERT(encoded_result.IsValid() && encoded_result.GetValue() == entry.snowflake_name,
+                    encoded + " -> Snowflake");
+    }
+
+    // Dictionary encoding does not change the column type
+    auto dictionary_type = arrow::dictionary(arrow::int16(), arrow::utf8());
+    auto dictionary = SnowflakeTypeConverter::ConvertArrowToSnowflake(*dictionary_type);
+    auto plain = SnowflakeTypeConverter::ConvertArrowToSnowflake(*arrow::utf8());
+    TEST_ASSERT(dictionary.IsValid() && dictionary.GetValue() == plain.GetValue(), "dictionary<int16, utf8> -> TEXT");
+    auto dictionary_desc = SnowflakeTypeConverter::ConvertArrowToSnowflake(dictionary_type->ToString());
+    TEST_ASSERT(dictionary_desc.IsValid() && dictionary_desc.GetValue() == plain.GetValue(),
+                dictionary_type->ToString() + " -> TEXT");
+    for (auto& string_type : {arrow::large_utf8(), arrow::utf8_view()}) {
+        auto converted = SnowflakeTypeConverter::ConvertArrowToSnowflake(*string_type);
+        auto described = SnowflakeTypeConverter::ConvertArrowToSnowflake(string_type->ToString());
+        TEST_ASSERT(converted.IsValid() && converted.GetValue() == plain.GetValue() && described.IsValid() &&
+                        described.GetValue() == plain.GetValue(),
+                    string_type->ToString() + " -> TEXT");
+    }
+    auto decimal = SnowflakeTypeConverter::ConvertArrowToSnowflake(arrow::decimal128(12, 4)->ToString());
+    TEST_ASSERT(decimal.IsValid() && decimal.GetValue() == "NUMBER(12,4)", "decimal128(12, 4) -> NUMBER(12,4)");
+    auto binary = SnowflakeTypeConverter::ConvertArrowToSnowflake(*arrow::binary());
+    for (auto& binary_type : {arrow::large_binary(), arrow::binary_view()}) {
+        auto converted = SnowflakeTypeConverter::ConvertArrowToSnowflake(*binary_type);
+        auto described = SnowflakeTypeConverter::ConvertArrowToSnowflake(binary_type->ToString());
+        TEST_ASSERT(converted.IsValid() && converted.GetValue() == binary.GetValue() && described.IsValid() &&
+                        described.GetValue() == binary.GetValue(),
+                    binary_type->ToString() + " -> BINARY");
+    }
+
+    // Snowflake spellings are no longer mistaken for Arrow descriptions
+    auto invalid = SnowflakeTypeConverter::ConvertArrowToSnowflake("VARCHAR");
+    TEST_ASSERT(!invalid.IsValid(), "Snowflake name is not an Arrow description");
+
+    auto reverse = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("TIMESTAMP_NTZ");
+    TEST_ASSERT(reverse.IsValid() && reverse.GetValue().id() == LogicalTypeId::TIMESTAMP, "TIMESTAMP_NTZ -> TIMESTAMP");
+
+    return true;
+}
+
+bool TestConversionCache() {
+    std::cout << "\n=== Testing Conversion Cache ===" << std::endl;
+    
+    SnowflakeTypeConverter::EnableConversionCache(64);
+    TEST_ASSERT(SnowflakeTypeConverter::IsConversionCacheEnabled(), "Cache enabled");
+
+    auto decimal_type = LogicalType::DECIMAL(18, 3);
+    auto first = SnowflakeTypeConverter::LookupCachedConversion(decimal_type);
+    auto second = SnowflakeTypeConverter::LookupCachedConversion(LogicalType::DECIMAL(18, 3));
+    TEST_ASSERT(first != nullptr && first == second, "Equal types share one cache entry");
+    TEST_ASSERT(first->snowflake_type.GetValue() == "NUMBER(18,3)", "Cached Snowflake type");
+
+    auto other_scale = SnowflakeTypeConverter::LookupCachedConversion(LogicalType::DECIMAL(18, 4));
+    TEST_ASSERT(other_scale != first, "Decimal scale is part of the cache key");
+    TEST_ASSERT(HashLogicalTypeStructure(LogicalType::LIST(LogicalType::INTEGER)) !=
+                HashLogicalTypeStructure(LogicalType::LIST(LogicalType::VARCHAR)),
+                "List child type is part of the structural hash");
+
+    auto struct_a = LogicalType::STRUCT({{"a", LogicalType::INTEGER}});
+    auto struct_b = LogicalType::STRUCT({{"b", LogicalType::INTEGER}});
+    TEST_ASSERT(SnowflakeTypeConverter::LookupCachedConversion(struct_a) !=
+                SnowflakeTypeConverter::LookupCachedConversion(struct_b),
+                "Struct field names are part of the cache key");
+
+    auto info = SnowflakeTypeConverter::GetTypeMappingInfo(decimal_type);
+    TEST_ASSERT(info.IsValid() && info.GetValue().snowflake_type == "NUMBER(18,3)", "Cached mapping info");
+
+    // Concurrent readers all observe the same published entry
+    std::vector<std::thread> threads;
+    std::vector<const CachedTypeConversion*> seen(8, nullptr);
+    for (size_t t = 0; t < seen.size(); t++) {
+        threads.emplace_back([&seen, t]() {
+            for (int i = 0; i < 1000; i++) {
+                seen[t] = SnowflakeTypeConverter::LookupCachedConversion(LogicalType::DECIMAL(30, 2));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    bool all_same = true;
+    for (auto entry : seen) {
+        all_same &= entry != nullptr && entry == seen[0];
+    }
+    TEST_ASSERT(all_same, "Concurrent lookups converge on one entry");
+
+    auto stats = SnowflakeTypeConverter::GetConversionCacheStats();
+    TEST_ASSERT(stats.hits > 0 && stats.misses > 0, "Hit and miss counters advance");
+    TEST_ASSERT(stats.size <= stats.capacity, "Cache stays within capacity");
+
+    SnowflakeTypeConverter::DisableConversionCache();
+    TEST_ASSERT(SnowflakeTypeConverter::LookupCachedConversion(decimal_type) == nullptr, "Disabled cache is bypassed");
+
+    SnowflakeTypeConverter::EnableConversionCache(64);
+    TEST_ASSERT(SnowflakeTypeConverter::LookupCachedConversion(decimal_type) == first,
+                "Re-enabling reuses the existing cache");
+    SnowflakeTypeConverter::EnableConversionCache(100);
+    auto grown = SnowflakeTypeConverter::GetConversionCacheStats();
+    TEST_ASSERT(grown.capacity >= 128 && grown.size == 0, "Larger capacity replaces the cache, at least doubling it");
+    SnowflakeTypeConverter::DisableConversionCache();
+
+    return true;
+}
+
+bool TestSnowflakeTypeParser() {
+    std::cout << "\n=== Testing Snowflake Type Parser ===" << std::endl;
+    
+    auto result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("NUMBER( 38 , 2 )");
+    TEST_ASSERT(result.IsValid() && result.GetValue() == LogicalType::DECIMAL(38, 2), "NUMBER with spaces");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("number(10)");
+    TEST_ASSERT(result.IsValid() && result.GetValue() == LogicalType::DECIMAL(10, 0), "Lowercase NUMBER(p)");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("VARCHAR(16777216)");
+    TEST_ASSERT(result.IsValid() && result.GetValue() == LogicalType::VARCHAR, "VARCHAR(16777216) -> VARCHAR");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("TIMESTAMP_NTZ(9)");
+    TEST_ASSERT(result.IsValid() && result.GetValue().id() == LogicalTypeId::TIMESTAMP, "TIMESTAMP_NTZ(9)");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("ARRAY(NUMBER(10,0))");
+    TEST_ASSERT(result.IsValid() && result.GetValue() == LogicalType::LIST(LogicalType::DECIMAL(10, 0)),
+                "ARRAY(NUMBER(10,0)) -> LIST(DECIMAL(10,0))");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("OBJECT(a VARCHAR, b INT)");
+    TEST_ASSERT(result.IsValid() &&
+                result.GetValue() == LogicalType::STRUCT({{"a", LogicalType::VARCHAR}, {"b", LogicalType::DECIMAL(38, 0)}}),
+                "OBJECT(a VARCHAR, b INT) -> STRUCT");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("MAP(VARCHAR, NUMBER(38,0))");
+    TEST_ASSERT(result.IsValid() &&
+                result.GetValue() == LogicalType::MAP(LogicalType::VARCHAR, LogicalType::DECIMAL(38, 0)),
+                "MAP(VARCHAR, NUMBER) -> MAP");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("VARCHAR(10) COLLATE 'en-ci'");
+    TEST_ASSERT(result.IsValid() && result.GetValue() == LogicalType::VARCHAR, "Collated VARCHAR");
+
+    auto parsed = SnowflakeTypeParser::Parse("NUMBER(99999999999)");
+    TEST_ASSERT(parsed.error == SnowflakeTypeParseError::INVALID_NUMBER && parsed.error_offset == 7,
+                "Oversized precision reports INVALID_NUMBER at its offset");
+
+    parsed = SnowflakeTypeParser::Parse("NUMBER(10,11)");
+    TEST_ASSERT(parsed.error == SnowflakeTypeParseError::INVALID_SCALE, "Scale larger than precision rejected");
+
+    parsed = SnowflakeTypeParser::Parse("ARRAY(");
+    TEST_ASSERT(parsed.error == SnowflakeTypeParseError::EXPECTED_TOKEN, "Truncated input rejected");
+
+    parsed = SnowflakeTypeParser::Parse("VARCHAR junk");
+    TEST_ASSERT(parsed.error == SnowflakeTypeParseError::TRAILING_INPUT, "Trailing input rejected");
+
+    std::string deep;
+    for (int i = 0; i < 100; i++) deep += "ARRAY(";
+    parsed = SnowflakeTypeParser::Parse(deep);
+    TEST_ASSERT(parsed.error == SnowflakeTypeParseError::NESTING_TOO_DEEP, "Nesting depth is bounded");
+
+    result = SnowflakeTypeConverter::ConvertSnowflakeToDuckDB("GIBBERISH");
+    TEST_ASSERT(!result.IsValid() && result.GetError().find("Unsupported Snowflake type") != std::string::npos,
+                "Unknown type reports a structured error");
+
+    return true;
+}
+
+bool TestSchemaConversion() {
+    std::cout << "\n=== Testing Schema Conversion ===" << std::endl;
+    
+    std::vector<std::string> names = {"id", "name", "amount", "tax", "created_at"};
+    std::vector<LogicalType> types = {LogicalType::INTEGER, LogicalType::VARCHAR, LogicalType::DECIMAL(18, 2),
+                                      LogicalType::DECIMAL(18, 2), LogicalType::TIMESTAMP};
+    auto result = SnowflakeTypeConverter::ConvertSchema(names, types);
+    TEST_ASSERT(result.IsValid(), "Schema conversion succeeds");
+
+    auto& schema = result.GetValue();
+    TEST_ASSERT(schema.arrow_schema->num_fields() == 5, "Arrow schema has one field per column");
+    TEST_ASSERT(schema.arrow_schema->field(2)->type() == schema.arrow_schema->field(3)->type(),
+                "Identical column types share one Arrow type instance");
+    TEST_ASSERT(schema.arrow_schema->field(2)->metadata()->Get("snowflake.type").ValueOrDie() == "NUMBER(18,2)",
+                "Field metadata carries the Snowflake type");
+    TEST_ASSERT(schema.snowflake_columns[0] == "\"id\" NUMBER(10,0)", "Snowflake column definition");
+    TEST_ASSERT(schema.column_mappings[4].snowflake_type == "TIMESTAMP_NTZ", "Per-column mapping info");
+    TEST_ASSERT(schema.BuildCreateTableDDL("orders") ==
+                "CREATE TABLE \"orders\" (\"id\" NUMBER(10,0), \"name\" VARCHAR, \"amount\" NUMBER(18,2), "
+                "\"tax\" NUMBER(18,2), \"created_at\" TIMESTAMP_NTZ)",
+                "CREATE TABLE DDL");
+
+    auto failed = SnowflakeTypeConverter::ConvertSchema({"ok", "bad"}, {LogicalType::INTEGER, LogicalType::INTERVAL});
+    TEST_ASSERT(!failed.IsValid() && failed.GetError().find("column 'bad'") != std::string::npos,
+                "Schema errors name the failing column");
+
+    auto mismatched = SnowflakeTypeConverter::ConvertSchema({"a"}, {});
+    TEST_ASSERT(!mismatched.IsValid(), "Name/type count mismatch rejected");
+
+    return true;
+}
+
+bool TestRenderLiteral() {
+    std::cout << "\n=== Testing Literal Rendering ===" << std::endl;
+
+    auto render = [](const Value& value) {
+        auto result = SnowflakeTypeConverter::RenderLiteral(value);
+        return result.IsValid() ? result.GetValue() : "error: " + result.GetError();
+    };
+    TEST_ASSERT(render(Value(LogicalType::INTEGER)) == "NULL", "NULL literal");
+    TEST_ASSERT(render(Value::BOOLEAN(true)) == "TRUE", "Boolean literal");
+    TEST_ASSERT(render(Value::BIGINT(-42)) == "-42", "Integer literal");
+    TEST_ASSERT(render(Value("it's a \\ path")) == "'it''s a \\\\ path'", "Quotes and backslashes escaped");
+    TEST_ASSERT(render(Value::DECIMAL(int64_t(12345), 18, 2)) == "CAST('123.45' AS NUMBER(18,2))",
+                "DECIMAL keeps its scale");
+    TEST_ASSERT(render(Value::DATE(date_t(0))) == "CAST('1970-01-01' AS DATE)", "DATE literal");
+    TEST_ASSERT(render(Value::TIMESTAMP(timestamp_t(86400000000LL))) == "CAST('1970-01-02 00:00:00' AS TIMESTAMP_NTZ)",
+                "TIMESTAMP literal");
+    TEST_ASSERT(render(Value::BLOB(const_data_ptr_cast("\x01\xAB"), 2)) == "TO_BINARY('01AB', 'HEX')", "BLOB literal");
+
+    TEST_ASSERT(!SnowflakeTypeConverter::RenderLiteral(Value::TIMESTAMP(timestamp_t::infinity())).IsValid(),
+                "Infinite timestamps not rendered");
+    TEST_ASSERT(!SnowflakeTypeConverter::RenderLiteral(Value::HUGEINT(NumericLimits<hugeint_t>::Maximum())).IsValid(),
+                "Integers beyond NUMBER(38,0) not rendered");
+    TEST_ASSERT(!SnowflakeTypeConverter::RenderLiteral(Value::INTERVAL(interval_t())).IsValid(),
+                "INTERVAL not rendered");
+
+    return true;
+}
+
 bool TestErrorHandling() {
     std::cout << "\n=== Testing Error Handling ===" << std::endl;
     
@@ -146,6 +491,17 @@ bool TestErrorHandling() {
     TEST_ASSERT(!unsupported_result.IsValid(), "Unsupported DuckDB type should fail");
     TEST_ASSERT(unsupported_result.GetError().find("Unsupported DuckDB type") != std::string::npos, "Error message contains expected text");
 
+    // Messages exist only on failure
+    auto success = SnowflakeTypeConverter::ConvertDuckDBToSnowflake(LogicalType::BIGINT);
+    TEST_ASSERT(!success.error_message, "Successful result carries no message");
+    TEST_ASSERT(success.GetError().empty(), "Successful result reports an empty error");
+    auto copied = unsupported_result;
+    TEST_ASSERT(copied.error_message == unsupported_result.error_message, "Copied error shares its message");
+    auto void_error = SnowflakeTypeConverter::ConversionResult<void>::Error("failed");
+    TEST_ASSERT(!void_error.IsValid() && void_error.GetError() == "failed", "void result carries its error");
+    TEST_ASSERT(SnowflakeTypeConverter::ConversionResult<void>::Success().GetError().empty(),
+                "Successful void result reports an empty error");
+
     return true;
 }
 
@@ -161,6 +517,12 @@ int main() {
     all_passed &= TestTemporalTypes();
     all_passed &= TestDecimalTypes();
     all_passed &= TestArrowConversion();
+    all_passed &= TestNestedTypes();
+    all_passed &= TestTypeRegistry();
+    all_passed &= TestConversionCache();
+    all_passed &= TestSnowflakeTypeParser();
+    all_passed &= TestSchemaConversion();
+    all_passed &= TestRenderLiteral();
     all_passed &= TestErrorHandling();
     
     if (all_passed) {
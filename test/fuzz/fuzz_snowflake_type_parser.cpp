@@ -0,0 +1,32 @@
+#include "snowflake_type_parser.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+using namespace duckdb;
+
+/**
+ * @brief libFuzzer entry point for SnowflakeTypeParser
+ *
+ * Run with the seed corpus: ./fuzz_snowflake_type_parser corpus/snowflake_type_parser
+ * Checks that arbitrary input never crashes the parser, that successful parses
+ * always yield a usable type and that error offsets stay inside the input.
+ */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    std::string_view input(reinterpret_cast<const char*>(data), size);
+    auto result = SnowflakeTypeParser::Parse(input);
+    if (result.IsValid()) {
+        if (result.type.id() == LogicalTypeId::INVALID) {
+            std::abort();
+        }
+        return 0;
+    }
+    if (result.error_offset > size) {
+        std::abort();
+    }
+    auto message = result.FormatError(input);
+    if (message.empty()) {
+        std::abort();
+    }
+    return 0;
+}